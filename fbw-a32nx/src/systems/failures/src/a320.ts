@@ -230,3 +230,21 @@ export const A320FailureDefinitions: FailureDefinition[] = [
   [34, A320Failure.RadioAntennaDirectCoupling1, 'RA 1 Direct Coupling'],
   [34, A320Failure.RadioAntennaDirectCoupling2, 'RA 2 Direct Coupling'],
 ];
+
+// Failures in the order of the bits of the bulk failure masks (A32NX_FAILURE_BULK_*) of the fly-by-wire WASM.
+// IMPORTANT: must match getFailureIndex() in fbw_a320/src/failures/FailureList.h
+export const A320BulkFailures: number[] = [
+  A320Failure.Fac1Failure,
+  A320Failure.Fac2Failure,
+  A320Failure.Fmgc1Failure,
+  A320Failure.Fmgc2Failure,
+  A320Failure.Fcu1Failure,
+  A320Failure.Fcu2Failure,
+  A320Failure.Elac1Failure,
+  A320Failure.Elac2Failure,
+  A320Failure.Sec1Failure,
+  A320Failure.Sec2Failure,
+  A320Failure.Sec3Failure,
+  A320Failure.Fcdc1Failure,
+  A320Failure.Fcdc2Failure,
+];
@@ -2,4 +2,4 @@
 //
 // SPDX-License-Identifier: GPL-3.0
 
-export { A320Failure, A320FailureDefinitions } from './a320';
+export { A320BulkFailures, A320Failure, A320FailureDefinitions } from './a320';
@@ -5,7 +5,7 @@ import React from 'react';
 
 import { render } from '@instruments/common/index';
 import { AircraftContext, EfbWrapper, syncSettingsFromPersistentStorage } from '@flybywiresim/flypad';
-import { A320FailureDefinitions } from '@failures';
+import { A320BulkFailures, A320FailureDefinitions } from '@failures';
 import { A320251NLandingCalculator } from '@shared/performance/a32nx_landing';
 import { A320251NTakeoffPerformanceCalculator } from '@shared/performance/a32nx_takeoff';
 import { AutomaticCallOutsPage } from './Pages/AutomaticCallOutsPage';
@@ -75,7 +75,12 @@ render(
       },
     }}
   >
-    <EfbWrapper failures={A320FailureDefinitions} aircraftSetup={aircraftEfbSetup} eventBus={new EventBus()} />
+    <EfbWrapper
+      failures={A320FailureDefinitions}
+      bulkFailures={A320BulkFailures}
+      aircraftSetup={aircraftEfbSetup}
+      eventBus={new EventBus()}
+    />
   </AircraftContext.Provider>,
   true,
   true,
@@ -14,14 +14,15 @@
 #include "EngineRatios.hpp"
 #include "Polynomials_A32NX.hpp"
 #include "Tables1502_A32NX.hpp"
-#include "ThrustLimits_A32NX.hpp"
 
 #include <algorithm>
+#include <array>
 
 void EngineControl_A32NX::initialize(MsfsHandler* msfsHandler) {
   this->msfsHandlerPtr = msfsHandler;
   this->dataManagerPtr = &msfsHandler->getDataManager();
   this->simData.initialize(dataManagerPtr);
+  this->thrustLimitCache.initialize();
   LOG_INFO("Fadec::EngineControl_A32NX::initialize() - initialized");
 }
 
@@ -58,14 +59,24 @@ void EngineControl_A32NX::update() {
 
   generateIdleParameters(pressureAltitude, mach, ambientTemperature, ambientPressure);
 
+  // The corrected fuel flow and EGT polynomials of both engines share the terms that only depend on mach and
+  // altitude, so they are evaluated for both engines in one call.
+  std::array<double, 2> simCN1{};
+  for (int engineIdx = 0; engineIdx < 2; engineIdx++) {
+    simCN1[engineIdx] = simData.correctedN1DataPtr[engineIdx]->data().correctedN1;
+  }
+  std::array<double, 2> correctedFuelFlow{};
+  Polynomial_A32NX::correctedFuelFlow(simCN1, mach, pressureAltitude, correctedFuelFlow);
+  std::array<double, 2> correctedEGT{};
+  Polynomial_A32NX::correctedEGT(simCN1, correctedFuelFlow, mach, pressureAltitude, correctedEGT);
+
   double simN1highest;
 
   for (int engine = 1; engine <= 2; engine++) {
     const int engineIdx = engine - 1;
 
-    double simCN1 = simData.correctedN1DataPtr[engineIdx]->data().correctedN1;
-    double simN1  = simData.simVarsDataPtr->data().simEngineN1[engineIdx];
-    double simN2  = simData.simVarsDataPtr->data().simEngineN2[engineIdx];
+    double simN1 = simData.simVarsDataPtr->data().simEngineN1[engineIdx];
+    double simN2 = simData.simVarsDataPtr->data().simEngineN2[engineIdx];
 
     double       engineTimer   = simData.engineTimer[engineIdx]->get();
     const int    engineIgniter = static_cast<int>(simData.simVarsDataPtr->data().engineIgniter[engineIdx]);  // 0: crank, 1:norm, 2: ign
@@ -114,13 +125,13 @@ void EngineControl_A32NX::update() {
         }
       case SHUTTING:
         engineShutdownProcedure(engine, ambientTemperature, simN1, deltaTime, engineTimer);
-        updateFF(engine, imbalance, simCN1, mach, pressureAltitude, ambientTemperature, ambientPressure);
+        updateFF(engine, imbalance, correctedFuelFlow[engineIdx], mach, ambientTemperature, ambientPressure);
         break;
       default:
         updatePrimaryParameters(engine, imbalance, simN1, simN2);
-        const double correctedFuelFlow = updateFF(engine, imbalance, simCN1, mach, pressureAltitude, ambientTemperature, ambientPressure);
-        updateEGT(engine, imbalance, deltaTime, msfsHandlerPtr->getSimOnGround(), engineState, simCN1, correctedFuelFlow, mach,
-                  pressureAltitude, ambientTemperature);
+        updateFF(engine, imbalance, correctedFuelFlow[engineIdx], mach, ambientTemperature, ambientPressure);
+        updateEGT(engine, imbalance, deltaTime, msfsHandlerPtr->getSimOnGround(), engineState, correctedEGT[engineIdx], mach,
+                  ambientTemperature);
         // updateOil(engine, imbalance, thrust, simN2, deltaN2, deltaTime, ambientTemp);
     }
 
@@ -565,19 +576,16 @@ void EngineControl_A32NX::engineShutdownProcedure(int    engine,              //
 #endif
 }
 
-double EngineControl_A32NX::updateFF(int    engine,
-                                     double imbalance,
-                                     double simCN1,
-                                     double mach,
-                                     double pressureAltitude,
-                                     double ambientTemperature,
-                                     double ambientPressure) {
+void EngineControl_A32NX::updateFF(int    engine,
+                                   double imbalance,
+                                   double correctedFuelFlow,
+                                   double mach,
+                                   double ambientTemperature,
+                                   double ambientPressure) {
 #ifdef PROFILING
   profilerUpdateFF.start();
 #endif
 
-  const double correctedFuelFlow = Polynomial_A32NX::correctedFuelFlow(simCN1, mach, pressureAltitude);  // in lbs/hr.
-
   // Check which engine is imbalanced and set the imbalance parameter
   const double engineImbalanced = imbalanceExtractor(imbalance, 1);
   double       ffImbalance      = 0;
@@ -601,8 +609,6 @@ double EngineControl_A32NX::updateFF(int    engine,
     profilerUpdateFF.print();
   }
 #endif
-
-  return correctedFuelFlow;
 }
 
 void EngineControl_A32NX::updatePrimaryParameters(int engine, double imbalance, double simN1, double simN2) {
@@ -634,10 +640,8 @@ void EngineControl_A32NX::updateEGT(int         engine,
                                     double      deltaTime,
                                     double      simOnGround,
                                     EngineState engineState,
-                                    double      simCN1,
-                                    double      customFuelFlow,
+                                    double      correctedEGT,
                                     double      mach,
-                                    double      pressureAltitude,
                                     double      ambientTemperature) {
 #ifdef PROFILING
   profilerUpdateEGT.start();
@@ -654,7 +658,6 @@ void EngineControl_A32NX::updateEGT(int         engine,
     if (engineImbalanced == engine) {
       egtImbalance = imbalanceExtractor(imbalance, 2);
     }
-    const double correctedEGT      = Polynomial_A32NX::correctedEGT(simCN1, customFuelFlow, mach, pressureAltitude);
     const double egtFbwPreviousEng = simData.engineEgt[engineIdx]->get();
     double       egtFbwActualEng   = (correctedEGT * EngineRatios::theta2(mach, ambientTemperature)) - egtImbalance;
     egtFbwActualEng                = egtFbwActualEng + (egtFbwPreviousEng - egtFbwActualEng) * (std::exp)(-0.1 * deltaTime);
@@ -1020,16 +1023,16 @@ void EngineControl_A32NX::updateThrustLimits(double                  simulationT
   double flex    = 0;
 
   // Write all N1 Limits
-  to = ThrustLimits_A32NX::limitN1(0, (std::min)(16600.0, pressAltitude), ambientTemperature, ambientPressure, 0, packs, nai, wai);
-  ga = ThrustLimits_A32NX::limitN1(1, (std::min)(16600.0, pressAltitude), ambientTemperature, ambientPressure, 0, packs, nai, wai);
+  to = thrustLimitCache.limitN1(0, (std::min)(16600.0, pressAltitude), ambientTemperature, ambientPressure, 0, packs, nai, wai);
+  ga = thrustLimitCache.limitN1(1, (std::min)(16600.0, pressAltitude), ambientTemperature, ambientPressure, 0, packs, nai, wai);
   if (flexTemp > 0) {
     flex_to =
-        ThrustLimits_A32NX::limitN1(0, (std::min)(16600.0, pressAltitude), ambientTemperature, ambientPressure, flexTemp, packs, nai, wai);
+        thrustLimitCache.limitN1(0, (std::min)(16600.0, pressAltitude), ambientTemperature, ambientPressure, flexTemp, packs, nai, wai);
     flex_ga =
-        ThrustLimits_A32NX::limitN1(1, (std::min)(16600.0, pressAltitude), ambientTemperature, ambientPressure, flexTemp, packs, nai, wai);
+        thrustLimitCache.limitN1(1, (std::min)(16600.0, pressAltitude), ambientTemperature, ambientPressure, flexTemp, packs, nai, wai);
   }
-  clb = ThrustLimits_A32NX::limitN1(2, pressAltitude, ambientTemperature, ambientPressure, 0, packs, nai, wai);
-  mct = ThrustLimits_A32NX::limitN1(3, pressAltitude, ambientTemperature, ambientPressure, 0, packs, nai, wai);
+  clb = thrustLimitCache.limitN1(2, pressAltitude, ambientTemperature, ambientPressure, 0, packs, nai, wai);
+  mct = thrustLimitCache.limitN1(3, pressAltitude, ambientTemperature, ambientPressure, 0, packs, nai, wai);
 
   // transition between TO and GA limit -----------------------------------------------------------------------------
   double machFactorLow = (std::max)(0.0, (std::min)(1.0, (mach - 0.04) / 0.04));
@@ -8,6 +8,8 @@
 
 #include "FadecSimData_A32NX.hpp"
 #include "FuelConfiguration_A32NX.h"
+#include "ThrustLimitCache.hpp"
+#include "ThrustLimits_A32NX.hpp"
 
 #define FILENAME_FADEC_CONF_DIRECTORY "\\work\\AircraftStates\\"
 #define FILENAME_FADEC_CONF_FILE_EXTENSION ".ini"
@@ -39,6 +41,9 @@ class EngineControl_A32NX {
   // Fuel configuration for loading and storing fuel levels
   FuelConfiguration_A32NX fuelConfiguration{};
 
+  // N1 thrust limits precomputed over altitude and temperature
+  ThrustLimitCache<ThrustLimits_A32NX> thrustLimitCache{};
+
   // previous time the fuel levels were saved to file
   double                  lastFuelSaveTime   = 0.0;
   static constexpr double FUEL_SAVE_INTERVAL = 5.0;  // seconds
@@ -253,20 +258,17 @@ class EngineControl_A32NX {
    *
    * @param engine The engine number (1 or 2).
    * @param imbalance The current encoded imbalance number of the engine.
-   * @param simCN1 The current corrected fan speed value from the simulator.
+   * @param correctedFuelFlow The corrected fuel flow of the engine in lbs/hour (see Polynomial_A32NX::correctedFuelFlow).
    * @param mach The current Mach number of the aircraft.
-   * @param pressureAltitude The current pressure altitude of the aircraft in feet.
    * @param ambientTemperature The current ambient temperature in degrees Celsius to calculate the engine's operating temperature.
    * @param ambientPressure The current ambient pressure in hPa.
-   * @return The updated fuel flow as a double.
    */
-  double updateFF(int    engine,              //
-                  double imbalance,           //
-                  double simCN1,              //
-                  double mach,                //
-                  double pressureAltitude,    //
-                  double ambientTemperature,  //
-                  double ambientPressure);    //
+  void updateFF(int    engine,              //
+                double imbalance,           //
+                double correctedFuelFlow,   //
+                double mach,                //
+                double ambientTemperature,  //
+                double ambientPressure);    //
 
   /**
    * @brief Updates the primary cusomter parameters (LVars) of the engine when not starting or stopping the engine
@@ -287,10 +289,8 @@ class EngineControl_A32NX {
    * @param deltaTime The time difference since the last update to calculate the rate of change of various parameters.
    * @param simOnGround The on ground status of the aircraft (0 or 1).
    * @param engineState The current state of the engine.
-   * @param simCN1 The current corrected fan speed value from the simulator.
-   * @param customFuelFlow The current custom fuel flow of the engine.
+   * @param correctedEGT The corrected EGT of the engine in degree Celsius (see Polynomial_A32NX::correctedEGT).
    * @param mach The current Mach number of the aircraft.
-   * @param pressureAltitude The current pressure altitude of the aircraft in feet.
    * @param ambientTemperature The current ambient temperature in degrees Celsius.
    *
    * @see EngineState
@@ -300,10 +300,8 @@ class EngineControl_A32NX {
                  double      deltaTime,
                  double      simOnGround,
                  EngineState engineState,
-                 double      simCN1,
-                 double      customFuelFlow,
+                 double      correctedEGT,
                  double      mach,
-                 double      pressureAltitude,
                  double      ambientTemperature);
 
   /**
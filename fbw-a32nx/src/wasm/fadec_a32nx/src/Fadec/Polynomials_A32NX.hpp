@@ -2,9 +2,13 @@
 #define FLYBYWIRE_AIRCRAFT_POLYNOMIAL_A32NX_HPP
 
 #include <algorithm>
+#include <array>
 #include <cmath>
+#include <cstddef>
 #include <numeric>
 
+#include "math_utils.hpp"
+
 /**
  * @brief Class representing a collection of multi-variate regression polynomials for engine parameters.
  *
@@ -12,6 +16,10 @@
  * regression polynomials. These parameters include N2, N1, EGT, Fuel Flow, Oil Temperature,
  * and Oil Pressure during different engine states such as shutdown and startup. The class also
  * includes methods for calculating corrected EGT and Fuel Flow, as well as Oil Gulping percentage.
+ *
+ * The polynomials are evaluated in Horner form (helper::Math::horner) instead of summing up std::pow() terms.
+ * The corrected EGT and Fuel Flow have batch variants for all engines that evaluate the terms which only
+ * depend on Mach and altitude once.
  */
 class Polynomial_A32NX {
  public:
@@ -51,10 +59,7 @@ class Polynomial_A32NX {
     };
 
     // Calculate the N2 percentage using the polynomial equation.
-    double outN2 = 0.0;
-    for (int i = 0; i < 16; ++i) {
-      outN2 += c_N2[i] * (std::pow)(normalN2, i);
-    }
+    double outN2 = helper::Math::horner(c_N2, normalN2);
 
     outN2 *= n2;
     outN2 = (std::max)(outN2, preN2 + 0.002);
@@ -87,15 +92,11 @@ class Polynomial_A32NX {
     };
 
     // Calculate the N1 percentage using the polynomial equation.
-    const double normalN1pre = (-2.4698087 * (std::pow)(normalN2, 3))   //
-                               + (0.9662026 * (std::pow)(normalN2, 2))  //
-                               + (0.0701367 * normalN2);                //
+    constexpr double c_N1pre[4] = {0.0, 0.0701367, 0.9662026, -2.4698087};
+    const double     normalN1pre  = helper::Math::horner(c_N1pre, normalN2);
 
     // Calculate the N2 percentage using the polynomial equation.
-    double normalN1post = 0.0;
-    for (int i = 0; i < 9; ++i) {
-      normalN1post += c_N1[i] * (std::pow)(normalN2, i);
-    }
+    const double normalN1post = helper::Math::horner(c_N1, normalN2);
 
     // Return the calculated N1 percentage, ensuring it is within the range [normalN1pre, normalN1post]
     // and then multiplied by idleN1.
@@ -131,9 +132,7 @@ class Polynomial_A32NX {
           -4.1220062e+03   // coefficient for x^8
       };
       // Calculate the FF using the polynomial equation.
-      for (int i = 0; i < 9; ++i) {
-        normalFF += c_FF[i] * (std::pow)(normalN2, i);
-      }
+      normalFF = helper::Math::horner(c_FF, normalN2);
     }
 
     // Return the calculated FF, ensuring it is not less than 0.0 and then multiplied by idleFF.
@@ -178,10 +177,7 @@ class Polynomial_A32NX {
       };
 
       // Calculate the EGT using the polynomial equation.
-      normalizedEGT = 0.0;
-      for (int i = 0; i < 9; ++i) {
-        normalizedEGT += c_EGT[i] * (std::pow)(normalizedN2, i);
-      }
+      normalizedEGT = helper::Math::horner(c_EGT, normalizedN2);
     }
 
     // Return the calculated EGT, ensuring it is within the range [ambientTemp, idleEGT].
@@ -271,41 +267,29 @@ class Polynomial_A32NX {
    * @return The calculated corrected EGT in Celsius.
    */
   static double correctedEGT(double cn1, double cff, double mach, double alt) {
-    constexpr double c_EGT[16] = {
-        3.2636e+02,   // coefficient for x^0
-        0.0000e+00,   // coefficient for x^1
-        9.2893e-01,   // coefficient for x^2
-        3.9505e-02,   // coefficient for x^3
-        3.9070e+02,   // coefficient for x^4
-        -4.7911e-04,  // coefficient for x^5
-        7.7679e-03,   // coefficient for x^6
-        5.8361e-05,   // coefficient for x^7
-        -2.5566e+00,  // coefficient for x^8
-        5.1227e-06,   // coefficient for x^9
-        1.0178e-07,   // coefficient for x^10
-        -7.4602e-03,  // coefficient for x^11
-        1.2106e-07,   // coefficient for x^12
-        -5.1639e+01,  // coefficient for x^13
-        -2.7356e-03,  // coefficient for x^14
-        1.9312e-08    // coefficient for x^15
-    };
+    const std::array<double, 3> c = correctedEGTTerms(mach, alt);
+    return correctedEGTFromTerms(c, cn1, cff);
+  }
 
-    return c_EGT[0]                             //
-           + c_EGT[1]                           //
-           + (c_EGT[2] * cn1)                   //
-           + (c_EGT[3] * cff)                   //
-           + (c_EGT[4] * mach)                  //
-           + (c_EGT[5] * alt)                   //
-           + (c_EGT[6] * (std::pow)(cn1, 2))    //
-           + (c_EGT[7] * cn1 * cff)             //
-           + (c_EGT[8] * cn1 * mach)            //
-           + (c_EGT[9] * cn1 * alt)             //
-           + (c_EGT[10] * (std::pow)(cff, 2))   //
-           + (c_EGT[11] * mach * cff)           //
-           + (c_EGT[12] * cff * alt)            //
-           + (c_EGT[13] * (std::pow)(mach, 2))  //
-           + (c_EGT[14] * mach * alt)           //
-           + (c_EGT[15] * (std::pow)(alt, 2));
+  /**
+   * @brief Calculates the corrected EGT of several engines at once.
+   *
+   * @param cn1 The corrected fan speed of each engine in percent.
+   * @param cff The corrected fuel flow of each engine in pounds per hour.
+   * @param mach The Mach number.
+   * @param alt The altitude in feet.
+   * @param correctedEGTs Receives the calculated corrected EGT of each engine in Celsius.
+   */
+  template <std::size_t N>
+  static void correctedEGT(const std::array<double, N>& cn1,
+                           const std::array<double, N>& cff,
+                           double                       mach,
+                           double                       alt,
+                           std::array<double, N>&       correctedEGTs) {
+    const std::array<double, 3> c = correctedEGTTerms(mach, alt);
+    for (std::size_t i = 0; i < N; ++i) {
+      correctedEGTs[i] = correctedEGTFromTerms(c, cn1[i], cff[i]);
+    }
   }
 
   /**
@@ -318,51 +302,23 @@ class Polynomial_A32NX {
    * @return The calculated corrected fuel flow in pounds per hour.
    */
   static double correctedFuelFlow(double cn1, double mach, double alt) {
-    constexpr double c_Flow[21] = {
-        -1.7630e+02,  // coefficient for x^0
-        -2.1542e-01,  // coefficient for x^1
-        4.7119e+01,   // coefficient for x^2
-        6.1519e+02,   // coefficient for x^3
-        1.8047e-03,   // coefficient for x^4
-        -4.4554e-01,  // coefficient for x^5
-        -4.3940e+01,  // coefficient for x^6
-        4.0459e-05,   // coefficient for x^7
-        -3.2912e+01,  // coefficient for x^8
-        -6.2894e-03,  // coefficient for x^9
-        -1.2544e-07,  // coefficient for x^10
-        1.0938e-02,   // coefficient for x^11
-        4.0936e-01,   // coefficient for x^12
-        -5.5841e-06,  // coefficient for x^13
-        -2.3829e+01,  // coefficient for x^14
-        9.3269e-04,   // coefficient for x^15
-        2.0273e-11,   // coefficient for x^16
-        -2.4100e+02,  // coefficient for x^17
-        1.4171e-02,   // coefficient for x^18
-        -9.5581e-07,  // coefficient for x^19
-        1.2728e-11    // coefficient for x^20
-    };
+    return helper::Math::horner(correctedFuelFlowCn1Coefficients(mach, alt), cn1);
+  }
 
-    return c_Flow[0]                                   //
-           + c_Flow[1]                                 //
-           + (c_Flow[2] * cn1)                         //
-           + (c_Flow[3] * mach)                        //
-           + (c_Flow[4] * alt)                         //
-           + (c_Flow[5] * (std::pow)(cn1, 2))          //
-           + (c_Flow[6] * cn1 * mach)                  //
-           + (c_Flow[7] * cn1 * alt)                   //
-           + (c_Flow[8] * (std::pow)(mach, 2))         //
-           + (c_Flow[9] * mach * alt)                  //
-           + (c_Flow[10] * (std::pow)(alt, 2))         //
-           + (c_Flow[11] * (std::pow)(cn1, 3))         //
-           + (c_Flow[12] * (std::pow)(cn1, 2) * mach)  //
-           + (c_Flow[13] * (std::pow)(cn1, 2) * alt)   //
-           + (c_Flow[14] * cn1 * (std::pow)(mach, 2))  //
-           + (c_Flow[15] * cn1 * mach * alt)           //
-           + (c_Flow[16] * cn1 * (std::pow)(alt, 2))   //
-           + (c_Flow[17] * (std::pow)(mach, 3))        //
-           + (c_Flow[18] * (std::pow)(mach, 2) * alt)  //
-           + (c_Flow[19] * mach * (std::pow)(alt, 2))  //
-           + (c_Flow[20] * (std::pow)(alt, 3));
+  /**
+   * @brief Calculates the corrected fuel flow of several engines at once.
+   *
+   * @param cn1 The corrected fan speed of each engine.
+   * @param mach The Mach number.
+   * @param alt The altitude.
+   * @param correctedFuelFlows Receives the calculated corrected fuel flow of each engine in pounds per hour.
+   */
+  template <std::size_t N>
+  static void correctedFuelFlow(const std::array<double, N>& cn1, double mach, double alt, std::array<double, N>& correctedFuelFlows) {
+    const std::array<double, 4> c = correctedFuelFlowCn1Coefficients(mach, alt);
+    for (std::size_t i = 0; i < N; ++i) {
+      correctedFuelFlows[i] = helper::Math::horner(c, cn1[i]);
+    }
   }
 
   /**
@@ -407,8 +363,7 @@ class Polynomial_A32NX {
    */
   static double oilGulpPct(double thrust) {
     const double oilGulpCoefficients[3] = {20.1968848, -1.2270302e-4, 1.78442e-8};
-    const double outOilGulpPct =
-        oilGulpCoefficients[0] + (oilGulpCoefficients[1] * thrust) + (oilGulpCoefficients[2] * (std::pow)(thrust, 2));
+    const double outOilGulpPct          = helper::Math::horner(oilGulpCoefficients, thrust);
     return outOilGulpPct / 100;
   }
 
@@ -420,7 +375,100 @@ class Polynomial_A32NX {
    */
   static double oilPressure(double simN2) {
     const double oilPressureCoefficients[3] = {-0.88921, 0.23711, 0.00682};
-    return oilPressureCoefficients[0] + (oilPressureCoefficients[1] * simN2) + (oilPressureCoefficients[2] * (std::pow)(simN2, 2));
+    return helper::Math::horner(oilPressureCoefficients, simN2);
+  }
+
+ private:
+  /**
+   * @brief Coefficients of the corrected EGT regression.
+   *
+   * EGT = c0 + c1 + c2*cn1 + c3*cff + c4*mach + c5*alt + c6*cn1^2 + c7*cn1*cff + c8*cn1*mach + c9*cn1*alt
+   *       + c10*cff^2 + c11*mach*cff + c12*cff*alt + c13*mach^2 + c14*mach*alt + c15*alt^2
+   */
+  static constexpr double cEGT[16] = {
+      3.2636e+02,   // coefficient for x^0
+      0.0000e+00,   // coefficient for x^1
+      9.2893e-01,   // coefficient for x^2
+      3.9505e-02,   // coefficient for x^3
+      3.9070e+02,   // coefficient for x^4
+      -4.7911e-04,  // coefficient for x^5
+      7.7679e-03,   // coefficient for x^6
+      5.8361e-05,   // coefficient for x^7
+      -2.5566e+00,  // coefficient for x^8
+      5.1227e-06,   // coefficient for x^9
+      1.0178e-07,   // coefficient for x^10
+      -7.4602e-03,  // coefficient for x^11
+      1.2106e-07,   // coefficient for x^12
+      -5.1639e+01,  // coefficient for x^13
+      -2.7356e-03,  // coefficient for x^14
+      1.9312e-08    // coefficient for x^15
+  };
+
+  /**
+   * @brief Coefficients of the corrected fuel flow regression.
+   *
+   * FF = c0 + c1 + c2*cn1 + c3*mach + c4*alt + c5*cn1^2 + c6*cn1*mach + c7*cn1*alt + c8*mach^2 + c9*mach*alt + c10*alt^2
+   *      + c11*cn1^3 + c12*cn1^2*mach + c13*cn1^2*alt + c14*cn1*mach^2 + c15*cn1*mach*alt + c16*cn1*alt^2
+   *      + c17*mach^3 + c18*mach^2*alt + c19*mach*alt^2 + c20*alt^3
+   */
+  static constexpr double cFlow[21] = {
+      -1.7630e+02,  // coefficient for x^0
+      -2.1542e-01,  // coefficient for x^1
+      4.7119e+01,   // coefficient for x^2
+      6.1519e+02,   // coefficient for x^3
+      1.8047e-03,   // coefficient for x^4
+      -4.4554e-01,  // coefficient for x^5
+      -4.3940e+01,  // coefficient for x^6
+      4.0459e-05,   // coefficient for x^7
+      -3.2912e+01,  // coefficient for x^8
+      -6.2894e-03,  // coefficient for x^9
+      -1.2544e-07,  // coefficient for x^10
+      1.0938e-02,   // coefficient for x^11
+      4.0936e-01,   // coefficient for x^12
+      -5.5841e-06,  // coefficient for x^13
+      -2.3829e+01,  // coefficient for x^14
+      9.3269e-04,   // coefficient for x^15
+      2.0273e-11,   // coefficient for x^16
+      -2.4100e+02,  // coefficient for x^17
+      1.4171e-02,   // coefficient for x^18
+      -9.5581e-07,  // coefficient for x^19
+      1.2728e-11    // coefficient for x^20
+  };
+
+  /**
+   * @brief The terms of the corrected EGT regression that do not depend on the engine.
+   * @return {sum of the mach/altitude only terms, factor of cn1, factor of cff}
+   */
+  static std::array<double, 3> correctedEGTTerms(double mach, double alt) {
+    return {
+        cEGT[0] + cEGT[1] + mach * (cEGT[4] + cEGT[13] * mach + cEGT[14] * alt) + alt * (cEGT[5] + cEGT[15] * alt),
+        cEGT[2] + cEGT[8] * mach + cEGT[9] * alt,
+        cEGT[3] + cEGT[11] * mach + cEGT[12] * alt,
+    };
+  }
+
+  /**
+   * @brief Completes the corrected EGT regression with the engine dependent terms.
+   * @param c The result of correctedEGTTerms()
+   */
+  static double correctedEGTFromTerms(const std::array<double, 3>& c, double cn1, double cff) {
+    return c[0] + cn1 * (c[1] + cEGT[6] * cn1 + cEGT[7] * cff) + cff * (c[2] + cEGT[10] * cff);
+  }
+
+  /**
+   * @brief Collects the corrected fuel flow regression into a cubic polynomial in cn1 for the given mach and altitude.
+   * @return The coefficients of the cubic in ascending order of the power of cn1
+   */
+  static std::array<double, 4> correctedFuelFlowCn1Coefficients(double mach, double alt) {
+    const double machTerms =
+        mach * (cFlow[3] + mach * (cFlow[8] + cFlow[17] * mach + cFlow[18] * alt) + alt * (cFlow[9] + cFlow[19] * alt));
+    const double altTerms = alt * (cFlow[4] + alt * (cFlow[10] + cFlow[20] * alt));
+    return {
+        cFlow[0] + cFlow[1] + machTerms + altTerms,
+        cFlow[2] + mach * (cFlow[6] + cFlow[14] * mach + cFlow[15] * alt) + alt * (cFlow[7] + cFlow[16] * alt),
+        cFlow[5] + cFlow[12] * mach + cFlow[13] * alt,
+        cFlow[11],
+    };
   }
 };
 
@@ -112,6 +112,11 @@ class ThrustLimits_A32NX {
       {39000,   -47.286, -18.508, 97.278, 85.545, 0.000 }  // row 71
   };
 
+  /**
+   * @brief First and last row in the limits array for each type of limit (0-TO, 1-GA, 2-CLB, 3-MCT).
+   */
+  static constexpr int rowRanges[4][2] = {{0, 20}, {21, 41}, {42, 58}, {59, 71}};
+
  public:
   /**
    * @brief Finds the top-row boundary in the limits array.
@@ -127,6 +132,31 @@ class ThrustLimits_A32NX {
     return index;
   }
 
+  /**
+   * @brief Finds the rows in the limits array enclosing the altitude for the given type of limit.
+   *
+   * Altitudes outside of the table use the first or last row of the type of limit for both rows.
+   *
+   * @param type The type of limit (0-TO, 1-GA, 2-CLB, 3-MCT).
+   * @param altitude The altitude in feet.
+   * @param loAltRow Receives the row at or below the altitude.
+   * @param hiAltRow Receives the row above the altitude.
+   */
+  static void findRows(int type, double altitude, int& loAltRow, int& hiAltRow) {
+    const int rowMin = rowRanges[type][0];
+    const int rowMax = rowRanges[type][1];
+    if (altitude <= limits[rowMin][0]) {
+      hiAltRow = rowMin;
+      loAltRow = rowMin;
+    } else if (altitude >= limits[rowMax][0]) {
+      hiAltRow = rowMax;
+      loAltRow = rowMax;
+    } else {
+      hiAltRow = finder(altitude, rowMin);
+      loAltRow = hiAltRow - 1;
+    }
+  }
+
   /**
    * @brief Structure to store the bleed values for different types of limits.
    *
@@ -142,13 +172,21 @@ class ThrustLimits_A32NX {
   };
 
   /**
-   * @brief Lookup table for bleed values based on limit type.
+   * @brief Bleed de-rating of the N1 limit for the packs, the nacelle anti-ice and the wing anti-ice.
    *
-   * This map stores the bleed values for different types of limits. The key is an integer
-   * representing the type of limit (0-TO, 1-GA, 2-CLB, 3-MCT),
-   * and the value is a `BleedValues` structure containing the values for `n1Packs`, `n1Nai`, and `n1Wai`.
+   * Indexed by the type of limit (0-TO, 1-GA, 2-CLB, 3-MCT), whether the altitude is below 8000ft and whether the
+   * outside air temperature is below the corner point. CLB and MCT have no de-rating below the corner point.
    */
-  static std::map<int, BleedValues> bleedValuesLookup;  // see below for initialization
+  static constexpr BleedValues bleedValuesLookup[4][2][2] = {
+  // TO
+      {{{-0.7, -0.8, -0.8}, {-0.6, -0.8, -0.8}}, {{-0.5, -0.6, -0.7}, {-0.4, -0.6, -0.7}}}, //
+  // GA
+      {{{-0.6, -0.7, -0.8}, {-0.6, -0.7, -0.8}}, {{-0.4, -0.6, -0.6}, {-0.4, -0.6, -0.6}}}, //
+  // CLB
+      {{{-0.3, -0.8, -0.4}, {0.0, 0.0, 0.0}},    {{-0.2, -0.8, -0.4}, {0.0, 0.0, 0.0}}   }, //
+  // MCT
+      {{{-0.6, -0.9, -1.2}, {0.0, 0.0, 0.0}},    {{-0.6, -0.9, -1.2}, {0.0, 0.0, 0.0}}   }  //
+  };
 
   /**
    * @brief Calculates the total bleed for the engine.
@@ -179,38 +217,43 @@ class ThrustLimits_A32NX {
       return packs * -0.6 + nacelle * -0.7 + wing * -0.7;
     }
 
-    // Define a map to store the bleed values for different conditions
-    // Keys:
-    // int - Represents the type of operation (0-TO, 1-GA, 2-CLB, 3-MCT).
-    // bool - Represents whether the altitude is less than 8000.
-    // bool - Represents whether the outside air temperature is less than the corner point.
-    // Values:
-    // double - Represents the bleed value for the packs.
-    // double - Represents the bleed value for the nacelle anti-ice.
-    // double - Represents the bleed value for the wing anti-ice.
-    std::map<std::tuple<int, bool, bool>, std::tuple<double, double, double>> bleedValues = {
-        {{0, true, true},   {-0.4, -0.6, -0.7}}, //
-        {{0, true, false},  {-0.5, -0.6, -0.7}}, //
-        {{0, false, true},  {-0.6, -0.8, -0.8}}, //
-        {{0, false, false}, {-0.7, -0.8, -0.8}}, //
-        {{1, true, true},   {-0.4, -0.6, -0.6}}, //
-        {{1, true, false},  {-0.4, -0.6, -0.6}}, //
-        {{1, false, true},  {-0.6, -0.7, -0.8}}, //
-        {{1, false, false}, {-0.6, -0.7, -0.8}}, //
-        {{2, true, false},  {-0.2, -0.8, -0.4}}, //
-        {{2, false, false}, {-0.3, -0.8, -0.4}}, //
-        {{3, true, false},  {-0.6, -0.9, -1.2}}, //
-        {{3, false, false}, {-0.6, -0.9, -1.2}}  //
-    };
+    const BleedValues& bleedValues = bleedValuesLookup[type][altitude < 8000][oat < cp];
+    return packs * bleedValues.n1Packs + nacelle * bleedValues.n1Nai + wing * bleedValues.n1Wai;
+  }
 
-    double n1Packs = 0;
-    double n1Nai   = 0;
-    double n1Wai   = 0;
+  /**
+   * @brief Calculates the bleed de-rating limitN1 adds to the rated N1 limit.
+   *
+   * Allows callers which cache the rated N1 limit to add the bleed de-rating separately.
+   *
+   * @param type The type of limit (0-TO, 1-GA, 2-CLB, 3-MCT).
+   * @param altitude The altitude in feet.
+   * @param ambientTemp The ambient temperature in degrees Celsius.
+   * @param flexTemp The flex temperature in degrees Celsius.
+   * @param packs The status of the air conditioning (0 for off, 1 for on).
+   * @param nacelle The status of the nacelle anti-ice (0 for off, 1 for on).
+   * @param wing The status of the wing anti-ice (0 for off, 1 for on).
+   * @return The bleed de-rating of the N1 limit.
+   */
+  static double bleedN1(int    type,         //
+                        double altitude,     //
+                        double ambientTemp,  //
+                        double flexTemp,     //
+                        int    packs,        //
+                        int    nacelle,      //
+                        int    wing          //
+  ) {
+    if (packs == 0 && nacelle == 0 && wing == 0) {
+      return 0;
+    }
 
-    // Use the map to get the bleed values
-    std::tie(n1Packs, n1Nai, n1Wai) = bleedValues[{type, altitude < 8000, oat < cp}];
+    int loAltRow = 0;
+    int hiAltRow = 0;
+    findRows(type, altitude, loAltRow, hiAltRow);
 
-    return packs * n1Packs + nacelle * n1Nai + wing * n1Wai;
+    const double cp = Fadec::interpolate(altitude, limits[loAltRow][0], limits[hiAltRow][0], limits[loAltRow][1], limits[hiAltRow][1]);
+    const double lp = Fadec::interpolate(altitude, limits[loAltRow][0], limits[hiAltRow][0], limits[loAltRow][2], limits[hiAltRow][2]);
+    return bleedTotal(type, altitude, ambientTemp, cp, lp, flexTemp, packs, nacelle, wing);
   }
 
   /**
@@ -239,8 +282,6 @@ class ThrustLimits_A32NX {
                         int    nacelle,          //
                         int    wing              //
   ) {
-    int    rowMin   = 0;
-    int    rowMax   = 0;
     int    loAltRow = 0;
     int    hiAltRow = 0;
     double mach     = 0;
@@ -248,18 +289,12 @@ class ThrustLimits_A32NX {
     // Set main variables per Limit Type
     switch (type) {
       case 0:  // TO
-        rowMin = 0;
-        rowMax = 20;
-        mach   = 0;
+        mach = 0;
         break;
       case 1:  // GA
-        rowMin = 21;
-        rowMax = 41;
-        mach   = 0.225;
+        mach = 0.225;
         break;
       case 2:  // CLB
-        rowMin = 42;
-        rowMax = 58;
         if (altitude <= 10000) {
           mach = Fadec::cas2mach(250, ambientPressure);
         } else {
@@ -269,23 +304,12 @@ class ThrustLimits_A32NX {
         }
         break;
       case 3:  // MCT
-        rowMin = 59;
-        rowMax = 71;
-        mach   = Fadec::cas2mach(230, ambientPressure);
+        mach = Fadec::cas2mach(230, ambientPressure);
         break;
     }
 
-    // Check for over/under flows. Else, find top row value
-    if (altitude <= limits[rowMin][0]) {
-      hiAltRow = rowMin;
-      loAltRow = rowMin;
-    } else if (altitude >= limits[rowMax][0]) {
-      hiAltRow = rowMax;
-      loAltRow = rowMax;
-    } else {
-      hiAltRow = finder(altitude, rowMin);
-      loAltRow = hiAltRow - 1;
-    }
+    // Find the rows enclosing the altitude
+    findRows(type, altitude, loAltRow, hiAltRow);
 
     // Define key table variables and interpolation
     const double cp      = Fadec::interpolate(altitude, limits[loAltRow][0], limits[hiAltRow][0], limits[loAltRow][1], limits[hiAltRow][1]);
@@ -146,9 +146,14 @@ clang++ \
   "${FBW_COMMON_DIR}/src/zlib/zfstream.cc" \
   "${DIR}/src/FlyByWireInterface.cpp" \
   "${DIR}/src/recording/FlightDataRecorder.cpp" \
+  "${DIR}/src/recording/FrameLayout.cpp" \
   "${DIR}/src/Arinc429.cpp" \
   "${DIR}/src/Arinc429Utils.cpp" \
   "${FBW_COMMON_DIR}/src/LocalVariable.cpp" \
+  "${FBW_COMMON_DIR}/src/LocalVariableStore.cpp" \
+  "${FBW_COMMON_DIR}/src/ColumnarFrameWriter.cpp" \
+  "${FBW_COMMON_DIR}/src/FrameRecorder.cpp" \
+  "${FBW_COMMON_DIR}/src/FrameRingBuffer.cpp" \
   "${FBW_COMMON_DIR}/src/InterpolatingLookupTable.cpp" \
   "${DIR}/src/SpoilersHandler.cpp" \
   "${FBW_COMMON_DIR}/src/ThrottleAxisMapping.cpp" \
@@ -0,0 +1,12 @@
+#pragma once
+
+// Stand-in for the MSFS SDK header, only what the sim data structs need for host builds.
+
+// Named (local) variables, the host program has to provide the definitions
+typedef int ID;
+typedef double FLOAT64;
+typedef const char* PCSTRINGZ;
+
+ID register_named_variable(PCSTRINGZ name);
+FLOAT64 get_named_variable_value(ID id);
+void set_named_variable_value(ID id, FLOAT64 value);
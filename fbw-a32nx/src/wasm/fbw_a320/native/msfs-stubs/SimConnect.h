@@ -0,0 +1,15 @@
+#pragma once
+
+// Stand-in for the MSFS SDK header, only what the sim data structs need for host builds.
+
+struct SIMCONNECT_DATA_XYZ {
+  double x;
+  double y;
+  double z;
+};
+
+struct SIMCONNECT_DATA_LATLONALT {
+  double Latitude;
+  double Longitude;
+  double Altitude;
+};
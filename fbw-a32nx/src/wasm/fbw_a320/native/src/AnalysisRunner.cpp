@@ -0,0 +1,159 @@
+#include "AnalysisRunner.h"
+
+#include <algorithm>
+#include <chrono>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+#include "FdrSignals.h"
+#include "recording/FrameLayout.h"
+
+namespace {
+// Each worker takes from the back of its own queue and steals from the front of the others. Only the file indices
+// are shared, the lock is held for a push or pop and never while a file is decoded.
+class WorkStealingQueues {
+ public:
+  WorkStealingQueues(std::size_t numberOfItems, std::size_t numberOfQueues) : queues(numberOfQueues) {
+    // deal round robin so every worker starts on a different part of the list
+    for (std::size_t i = 0; i < numberOfItems; i++) {
+      queues[i % numberOfQueues].items.push_back(i);
+    }
+  }
+
+  bool pop(std::size_t worker, std::size_t& item) {
+    {
+      Queue& own = queues[worker];
+      std::lock_guard<std::mutex> lock(own.mutex);
+      if (!own.items.empty()) {
+        item = own.items.back();
+        own.items.pop_back();
+        return true;
+      }
+    }
+    for (std::size_t i = 1; i < queues.size(); i++) {
+      Queue& victim = queues[(worker + i) % queues.size()];
+      std::lock_guard<std::mutex> lock(victim.mutex);
+      if (!victim.items.empty()) {
+        item = victim.items.front();
+        victim.items.pop_front();
+        return true;
+      }
+    }
+    return false;
+  }
+
+ private:
+  struct Queue {
+    std::mutex mutex;
+    std::deque<std::size_t> items;
+  };
+
+  std::vector<Queue> queues;
+};
+}  // namespace
+
+AnalysisRunner::AnalysisRunner(std::vector<SignalCheck> checks, std::vector<std::string> rangeSignals)
+    : checks(std::move(checks)), rangeSignals(std::move(rangeSignals)) {}
+
+std::vector<FileStatistics> AnalysisRunner::run(const std::vector<std::string>& files, int numberOfThreads) const {
+  std::vector<FileStatistics> results(files.size());
+  const std::size_t numberOfWorkers = std::clamp<std::size_t>(numberOfThreads, 1, std::max<std::size_t>(files.size(), 1));
+  WorkStealingQueues queues(files.size(), numberOfWorkers);
+
+  auto worker = [&](std::size_t index) {
+    FdrFile file;
+    std::size_t item;
+    while (queues.pop(index, item)) {
+      results[item] = analyzeFile(files[item], file);
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (std::size_t i = 1; i < numberOfWorkers; i++) {
+    threads.emplace_back(worker, i);
+  }
+  worker(0);
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  return results;
+}
+
+FileStatistics AnalysisRunner::analyzeFile(const std::string& filename, FdrFile& file) const {
+  const auto start = std::chrono::steady_clock::now();
+  FileStatistics statistics;
+  statistics.filename = filename;
+  for (const auto& check : checks) {
+    statistics.checks.push_back({check.signal});
+  }
+  for (const auto& signal : rangeSignals) {
+    statistics.ranges.push_back({signal});
+  }
+
+  // the files are already spread over the workers, so every file is decoded on the worker's thread only
+  if (!file.open(filename, [](uint64_t version) { return FrameLayout::getFrameSize(FrameLayout::getFrameSegments(version)); }, 1)) {
+    statistics.error = file.getError();
+    return statistics;
+  }
+  const auto layout = FrameLayout::getFrameSegments(file.getInterfaceVersion());
+  if (layout.empty()) {
+    statistics.error = "interface version " + std::to_string(file.getInterfaceVersion()) + " is not supported";
+    return statistics;
+  }
+
+  // the signals are resolved per file, a columnar file carries its own layout
+  const auto& segments = file.isColumnar() ? file.getSegments() : layout;
+  FdrSignal time;
+  FdrSignals::resolve(segments, "base.simulation_time_s", time);
+  std::vector<FdrSignal> checkSignals(checks.size());
+  for (std::size_t i = 0; i < checks.size(); i++) {
+    statistics.checks[i].isValid = FdrSignals::resolve(segments, checks[i].signal, checkSignals[i]);
+  }
+  std::vector<FdrSignal> rangeSignalsOfFile(rangeSignals.size());
+  std::vector<bool> isRangeResolved(rangeSignals.size());
+  for (std::size_t i = 0; i < rangeSignals.size(); i++) {
+    isRangeResolved[i] = FdrSignals::resolve(segments, rangeSignals[i], rangeSignalsOfFile[i]);
+  }
+
+  for (const FdrFrame& frame : file) {
+    for (std::size_t i = 0; i < checks.size(); i++) {
+      CheckResult& result = statistics.checks[i];
+      if (!result.isValid) {
+        continue;
+      }
+      const double value = checkSignals[i].read(frame.data());
+      // written so that NaN counts as a violation
+      if (!(value >= checks[i].minimum && value <= checks[i].maximum)) {
+        if (result.violations == 0 && time.offset >= 0) {
+          result.firstViolationSimulationTime = time.read(frame.data());
+        }
+        result.violations++;
+        statistics.violations++;
+      }
+    }
+
+    for (std::size_t i = 0; i < rangeSignals.size(); i++) {
+      if (!isRangeResolved[i]) {
+        continue;
+      }
+      SignalRange& range = statistics.ranges[i];
+      const double value = rangeSignalsOfFile[i].read(frame.data());
+      if (!range.isValid) {
+        range.isValid = true;
+        range.minimum = value;
+        range.maximum = value;
+      } else {
+        range.minimum = std::min(range.minimum, value);
+        range.maximum = std::max(range.maximum, value);
+      }
+    }
+
+    statistics.ticks++;
+  }
+
+  statistics.error = file.getError();
+  statistics.wallTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  return statistics;
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "FdrFile.h"
+
+// A check fails for every tick at which the signal lies outside [minimum, maximum].
+struct SignalCheck {
+  std::string signal;
+  double minimum;
+  double maximum;
+};
+
+struct SignalRange {
+  std::string signal;
+  // false if the signal is not part of the recording or the recording has no frames
+  bool isValid = false;
+  double minimum = 0;
+  double maximum = 0;
+};
+
+struct CheckResult {
+  std::string signal;
+  bool isValid = false;
+  uint64_t violations = 0;
+  double firstViolationSimulationTime = 0;
+};
+
+struct FileStatistics {
+  std::string filename;
+  // set if the file could not be opened or is truncated, the statistics cover the frames read until then
+  std::string error;
+  uint64_t ticks = 0;
+  double wallTime = 0;
+  uint64_t violations = 0;
+  std::vector<CheckResult> checks;
+  std::vector<SignalRange> ranges;
+};
+
+// Decodes flight data recordings on a pool of worker threads and evaluates the checks and signal ranges on every
+// frame. The files are dealt out to per-worker queues up front, a worker that runs out of files steals from the others,
+// so a few long recordings do not leave the remaining threads idle. Every worker owns its file and decode buffers.
+class AnalysisRunner {
+ public:
+  AnalysisRunner(std::vector<SignalCheck> checks, std::vector<std::string> rangeSignals);
+
+  // the statistics are in the order of the files
+  std::vector<FileStatistics> run(const std::vector<std::string>& files, int numberOfThreads) const;
+
+ private:
+  std::vector<SignalCheck> checks;
+  std::vector<std::string> rangeSignals;
+
+  FileStatistics analyzeFile(const std::string& filename, FdrFile& file) const;
+};
@@ -0,0 +1,167 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "AnalysisRunner.h"
+#include "FdrSignals.h"
+
+namespace {
+struct Options {
+  std::vector<std::string> files;
+  std::vector<SignalCheck> checks;
+  std::vector<std::string> rangeSignals;
+  int threads = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+  int repeat = 1;
+  bool benchmark = false;
+  bool listSignals = false;
+};
+
+void printUsage(const char* program) {
+  std::printf(
+      "usage: %s [--threads N] [--check SIGNAL:MIN:MAX]... [--range SIGNAL]... [--benchmark] [--repeat N] [--list-signals] "
+      "FILE...\n",
+      program);
+}
+
+bool parseCheck(const char* value, SignalCheck& check) {
+  const std::string text = value;
+  const auto second = text.rfind(':');
+  const auto first = second == std::string::npos || second == 0 ? std::string::npos : text.rfind(':', second - 1);
+  if (first == std::string::npos) {
+    return false;
+  }
+  check.signal = text.substr(0, first);
+  check.minimum = std::atof(text.substr(first + 1, second - first - 1).c_str());
+  check.maximum = std::atof(text.substr(second + 1).c_str());
+  return !check.signal.empty() && check.minimum <= check.maximum;
+}
+
+bool parseOptions(int argc, char* argv[], Options& options) {
+  for (int i = 1; i < argc; i++) {
+    if (std::strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+      options.threads = std::atoi(argv[++i]);
+    } else if (std::strcmp(argv[i], "--check") == 0 && i + 1 < argc) {
+      SignalCheck check;
+      if (!parseCheck(argv[++i], check)) {
+        return false;
+      }
+      options.checks.push_back(check);
+    } else if (std::strcmp(argv[i], "--range") == 0 && i + 1 < argc) {
+      options.rangeSignals.emplace_back(argv[++i]);
+    } else if (std::strcmp(argv[i], "--repeat") == 0 && i + 1 < argc) {
+      options.repeat = std::atoi(argv[++i]);
+    } else if (std::strcmp(argv[i], "--benchmark") == 0) {
+      options.benchmark = true;
+    } else if (std::strcmp(argv[i], "--list-signals") == 0) {
+      options.listSignals = true;
+    } else if (argv[i][0] == '-') {
+      return false;
+    } else {
+      options.files.emplace_back(argv[i]);
+    }
+  }
+  return (options.listSignals || !options.files.empty()) && options.threads > 0 && options.repeat > 0;
+}
+
+// returns the number of violations
+uint64_t printStatistics(const std::vector<FileStatistics>& results) {
+  uint64_t violations = 0;
+  for (const auto& statistics : results) {
+    std::printf("%s: %llu ticks in %.3f s, %llu violations%s%s\n", statistics.filename.c_str(),
+                static_cast<unsigned long long>(statistics.ticks), statistics.wallTime,
+                static_cast<unsigned long long>(statistics.violations), statistics.error.empty() ? "" : ", ",
+                statistics.error.c_str());
+    for (const auto& check : statistics.checks) {
+      if (!check.isValid) {
+        std::printf("  check %s: not recorded\n", check.signal.c_str());
+      } else if (check.violations > 0) {
+        std::printf("  check %s: %llu violations, first at t = %.3f s\n", check.signal.c_str(),
+                    static_cast<unsigned long long>(check.violations), check.firstViolationSimulationTime);
+      }
+    }
+    for (const auto& range : statistics.ranges) {
+      if (range.isValid) {
+        std::printf("  range %s: [%g, %g]\n", range.signal.c_str(), range.minimum, range.maximum);
+      } else {
+        std::printf("  range %s: not recorded\n", range.signal.c_str());
+      }
+    }
+    violations += statistics.violations;
+  }
+  return violations;
+}
+
+// runs the same work with 1, 2, 4, ... threads up to the requested count and reports the speedup over one thread
+void runBenchmark(const AnalysisRunner& runner, const std::vector<std::string>& files, int maximumThreads) {
+  std::vector<int> threadCounts;
+  for (int threads = 1; threads < maximumThreads; threads *= 2) {
+    threadCounts.push_back(threads);
+  }
+  threadCounts.push_back(maximumThreads);
+
+  std::printf("%8s %10s %14s %9s %11s\n", "threads", "wall [s]", "ticks/s", "speedup", "efficiency");
+  double singleThreadTime = 0;
+  for (int threads : threadCounts) {
+    const auto start = std::chrono::steady_clock::now();
+    const auto results = runner.run(files, threads);
+    const double wallTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    uint64_t ticks = 0;
+    for (const auto& statistics : results) {
+      ticks += statistics.ticks;
+    }
+    if (threads == 1) {
+      singleThreadTime = wallTime;
+    }
+    const double speedup = singleThreadTime / std::max(wallTime, 1e-9);
+    std::printf("%8d %10.3f %14.0f %9.2f %10.0f%%\n", threads, wallTime, ticks / std::max(wallTime, 1e-9), speedup,
+                100 * speedup / threads);
+  }
+}
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  Options options;
+  if (!parseOptions(argc, argv, options)) {
+    printUsage(argv[0]);
+    return 1;
+  }
+
+  if (options.listSignals) {
+    for (const auto& name : FdrSignals::getSignalNames()) {
+      std::printf("%s\n", name.c_str());
+    }
+    return 0;
+  }
+
+  // repeating the files gives the benchmark enough work to spread over the threads
+  std::vector<std::string> files;
+  for (int i = 0; i < options.repeat; i++) {
+    files.insert(files.end(), options.files.begin(), options.files.end());
+  }
+
+  AnalysisRunner runner(options.checks, options.rangeSignals);
+  if (options.benchmark) {
+    runBenchmark(runner, files, options.threads);
+    return 0;
+  }
+
+  const auto start = std::chrono::steady_clock::now();
+  const auto results = runner.run(files, options.threads);
+  const double wallTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  const uint64_t violations = printStatistics(results);
+  const bool hasErrors = std::any_of(results.begin(), results.end(), [](const auto& statistics) { return !statistics.error.empty(); });
+  std::printf("%zu files in %.3f s on %d threads, %llu violations\n", results.size(), wallTime, options.threads,
+              static_cast<unsigned long long>(violations));
+
+  if (hasErrors) {
+    return 1;
+  }
+  return violations > 0 ? 2 : 0;
+}
@@ -0,0 +1,393 @@
+#include "FdrFile.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <climits>
+#include <thread>
+
+namespace {
+// ticks decoded at once from a gzip stream
+constexpr std::size_t GzipFramesPerWindow = 256;
+// blocks per decoding thread in a window of a columnar file
+constexpr std::size_t BlocksPerThread = 2;
+
+// transposes a matrix of 8x8 bytes in place, byte j of rows[i] becomes byte i of rows[j]
+void transpose8x8(uint64_t (&rows)[8]) {
+  for (std::size_t i = 0; i < 4; ++i) {
+    const uint64_t t = ((rows[i] >> 32) ^ rows[i + 4]) & 0x00000000FFFFFFFFull;
+    rows[i] ^= t << 32;
+    rows[i + 4] ^= t;
+  }
+  for (std::size_t i : {0, 1, 4, 5}) {
+    const uint64_t t = ((rows[i] >> 16) ^ rows[i + 2]) & 0x0000FFFF0000FFFFull;
+    rows[i] ^= t << 16;
+    rows[i + 2] ^= t;
+  }
+  for (std::size_t i : {0, 2, 4, 6}) {
+    const uint64_t t = ((rows[i] >> 8) ^ rows[i + 1]) & 0x00FF00FF00FF00FFull;
+    rows[i] ^= t << 8;
+    rows[i + 1] ^= t;
+  }
+}
+}  // namespace
+
+FdrFile::Iterator& FdrFile::Iterator::operator++() {
+  if (++frameInWindow >= file->framesInWindow) {
+    frameInWindow = 0;
+    if (!file->decodeWindow()) {
+      file = nullptr;
+      return *this;
+    }
+  }
+  frame.frame = file->window.data() + frameInWindow * file->frameSize;
+  return *this;
+}
+
+FdrFile::~FdrFile() {
+  close();
+}
+
+bool FdrFile::open(const std::string& filename, const FrameSizeOfVersion& frameSizeOfVersion, int numberOfThreads) {
+  close();
+  error.clear();
+
+  const int fd = ::open(filename.c_str(), O_RDONLY);
+  if (fd < 0) {
+    error = "cannot open " + filename;
+    return false;
+  }
+  struct stat status = {};
+  if (fstat(fd, &status) != 0 || status.st_size == 0) {
+    ::close(fd);
+    error = "cannot read header of " + filename;
+    return false;
+  }
+  mappingSize = static_cast<std::size_t>(status.st_size);
+  void* address = mmap(nullptr, mappingSize, PROT_READ, MAP_PRIVATE, fd, 0);
+  // the mapping keeps the file referenced
+  ::close(fd);
+  if (address == MAP_FAILED) {
+    mappingSize = 0;
+    error = "cannot map " + filename;
+    return false;
+  }
+  mapping = static_cast<const char*>(address);
+  madvise(address, mappingSize, MADV_SEQUENTIAL);
+
+  this->numberOfThreads = numberOfThreads > 0 ? numberOfThreads : std::max(1u, std::thread::hardware_concurrency());
+
+  isColumnarFile = mappingSize >= 4 && std::memcmp(mapping, "FDR2", 4) == 0;
+  if (isColumnarFile) {
+    if (readColumnarHeader()) {
+      return true;
+    }
+  } else if (readGzipHeader(frameSizeOfVersion)) {
+    return true;
+  }
+  close();
+  return false;
+}
+
+bool FdrFile::readColumnarHeader() {
+  std::size_t offset = 4;
+  uint32_t formatVersion = 0;
+  uint32_t storedFrameSize = 0;
+  uint32_t ticksPerBlock = 0;
+  uint32_t numberOfSegments = 0;
+  if (!readValue(offset, formatVersion)) {
+    error = "truncated header";
+    return false;
+  }
+  if (formatVersion != ColumnarFrameWriter::FORMAT_VERSION && formatVersion != ColumnarFrameWriter::FORMAT_VERSION_WITHOUT_ENCODING) {
+    error = "unsupported format version " + std::to_string(formatVersion);
+    return false;
+  }
+  // the encoding was added with format version 3, older files are stored plain
+  encoding = ColumnarFrameWriter::Plain;
+  if (!readValue(offset, interfaceVersion) || !readValue(offset, storedFrameSize) || !readValue(offset, ticksPerBlock) ||
+      (formatVersion != ColumnarFrameWriter::FORMAT_VERSION_WITHOUT_ENCODING && !readValue(offset, encoding)) ||
+      !readValue(offset, numberOfSegments)) {
+    error = "truncated header";
+    return false;
+  }
+
+  std::size_t sumOfSegmentSizes = 0;
+  for (uint32_t i = 0; i < numberOfSegments; ++i) {
+    uint32_t size = 0;
+    uint32_t nameLength = 0;
+    if (!readValue(offset, size) || !readValue(offset, nameLength) || offset + nameLength > mappingSize) {
+      error = "truncated segment table";
+      return false;
+    }
+    segments.push_back({std::string(mapping + offset, nameLength), size});
+    offset += nameLength;
+    sumOfSegmentSizes += size;
+  }
+  frameSize = storedFrameSize;
+  if (sumOfSegmentSizes != frameSize) {
+    error = "segment table does not match the frame size";
+    return false;
+  }
+
+  // a file that was closed properly ends with the block index, the blocks stop where it starts
+  std::size_t endOfBlocks = mappingSize;
+  if (mappingSize >= offset + 16) {
+    std::size_t footerOffset = mappingSize - 16;
+    uint64_t indexOffset = 0;
+    uint32_t numberOfBlocks = 0;
+    if (readValue(footerOffset, indexOffset) && readValue(footerOffset, numberOfBlocks) &&
+        std::memcmp(mapping + footerOffset, "FDRI", 4) == 0 && indexOffset >= offset && indexOffset <= mappingSize) {
+      endOfBlocks = indexOffset;
+    }
+  }
+
+  // the block headers carry the compressed sizes, so walking them is enough to find all blocks. A file that was not
+  // closed ends with a partially written block which is dropped.
+  const std::size_t blockHeaderSize = sizeof(uint32_t) + 2 * sizeof(double) + segments.size() * sizeof(uint32_t);
+  while (offset + blockHeaderSize <= endOfBlocks) {
+    Block block = {offset, offset + blockHeaderSize, 0};
+    std::memcpy(&block.numberOfTicks, mapping + offset, sizeof(uint32_t));
+
+    std::size_t compressedSize = 0;
+    for (std::size_t segment = 0; segment < segments.size(); ++segment) {
+      uint32_t size;
+      std::memcpy(&size, mapping + offset + sizeof(uint32_t) + 2 * sizeof(double) + segment * sizeof(uint32_t), sizeof(size));
+      compressedSize += size;
+    }
+    if (block.numberOfTicks == 0 || block.numberOfTicks > ticksPerBlock || block.dataOffset + compressedSize > endOfBlocks) {
+      break;
+    }
+    blocks.push_back(block);
+    offset = block.dataOffset + compressedSize;
+  }
+
+  columns.resize(numberOfThreads);
+  window.reserve(std::min(blocks.size(), numberOfThreads * BlocksPerThread) * ticksPerBlock * frameSize);
+  return true;
+}
+
+bool FdrFile::readGzipHeader(const FrameSizeOfVersion& frameSizeOfVersion) {
+  // 32 selects automatic detection of the gzip header
+  if (inflateInit2(&zStream, 32 + MAX_WBITS) != Z_OK) {
+    error = "cannot initialize zlib";
+    return false;
+  }
+  isStreamInitialized = true;
+
+  // the gzip stream starts with the interface version, followed by the frames
+  if (inflateStream(reinterpret_cast<char*>(&interfaceVersion), sizeof(interfaceVersion)) != sizeof(interfaceVersion)) {
+    error = "cannot read header";
+    return false;
+  }
+  frameSize = frameSizeOfVersion(interfaceVersion);
+  if (frameSize == 0) {
+    error = "interface version " + std::to_string(interfaceVersion) + " is not supported";
+    return false;
+  }
+  window.reserve(GzipFramesPerWindow * frameSize);
+  return true;
+}
+
+void FdrFile::close() {
+  if (isStreamInitialized) {
+    inflateEnd(&zStream);
+    isStreamInitialized = false;
+  }
+  zStream = {};
+  if (mapping != nullptr) {
+    munmap(const_cast<char*>(mapping), mappingSize);
+    mapping = nullptr;
+  }
+  mappingSize = 0;
+  isColumnarFile = false;
+  interfaceVersion = 0;
+  segments.clear();
+  blocks.clear();
+  window.clear();
+  framesInWindow = 0;
+  nextBlock = 0;
+  dataOffset = 0;
+}
+
+FdrFile::Iterator FdrFile::begin() {
+  if (mapping == nullptr) {
+    return end();
+  }
+
+  if (isColumnarFile) {
+    nextBlock = 0;
+  } else {
+    // the gzip stream cannot seek, inflate it from the beginning again and skip the interface version
+    inflateReset(&zStream);
+    zStream.avail_in = 0;
+    dataOffset = 0;
+    uint64_t version;
+    inflateStream(reinterpret_cast<char*>(&version), sizeof(version));
+  }
+
+  Iterator iterator;
+  if (decodeWindow()) {
+    iterator.file = this;
+    iterator.frame.frame = window.data();
+  }
+  return iterator;
+}
+
+bool FdrFile::decodeWindow() {
+  framesInWindow = 0;
+
+  if (!isColumnarFile) {
+    window.resize(GzipFramesPerWindow * frameSize);
+    const std::size_t produced = inflateStream(window.data(), window.size());
+    // a trailing partial frame is dropped, the recorder was stopped while writing it
+    framesInWindow = produced / frameSize;
+    return framesInWindow > 0;
+  }
+
+  const std::size_t firstBlock = nextBlock;
+  const std::size_t lastBlock = std::min(blocks.size(), firstBlock + numberOfThreads * BlocksPerThread);
+  if (firstBlock >= lastBlock) {
+    return false;
+  }
+
+  std::vector<std::size_t> blockFrames(lastBlock - firstBlock);
+  std::size_t numberOfFrames = 0;
+  for (std::size_t i = firstBlock; i < lastBlock; ++i) {
+    blockFrames[i - firstBlock] = numberOfFrames;
+    numberOfFrames += blocks[i].numberOfTicks;
+  }
+  window.resize(numberOfFrames * frameSize);
+
+  // blocks are claimed one at a time, the caller's thread takes part in the decoding
+  std::atomic<std::size_t> nextToDecode = firstBlock;
+  std::atomic<std::size_t> firstCorruptBlock = lastBlock;
+  auto decode = [&](std::size_t thread) {
+    for (std::size_t i = nextToDecode++; i < lastBlock; i = nextToDecode++) {
+      if (!decodeBlock(blocks[i], window.data() + blockFrames[i - firstBlock] * frameSize, columns[thread])) {
+        std::size_t expected = firstCorruptBlock;
+        while (i < expected && !firstCorruptBlock.compare_exchange_weak(expected, i)) {
+        }
+      }
+    }
+  };
+  const std::size_t numberOfWorkers = std::min(numberOfThreads, lastBlock - firstBlock);
+  std::vector<std::thread> threads;
+  for (std::size_t thread = 1; thread < numberOfWorkers; ++thread) {
+    threads.emplace_back(decode, thread);
+  }
+  decode(0);
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  // frames up to the corrupt block are still handed out, iteration stops after them
+  if (firstCorruptBlock < lastBlock) {
+    error = "corrupt block " + std::to_string(firstCorruptBlock.load());
+    nextBlock = blocks.size();
+    framesInWindow = blockFrames[firstCorruptBlock - firstBlock];
+    return framesInWindow > 0;
+  }
+
+  nextBlock = lastBlock;
+  framesInWindow = numberOfFrames;
+  return true;
+}
+
+bool FdrFile::decodeBlock(const Block& block, char* frames, std::vector<char>& scratch) const {
+  const std::size_t ticks = block.numberOfTicks;
+  const char* compressedSizes = mapping + block.headerOffset + sizeof(uint32_t) + 2 * sizeof(double);
+  const char* compressed = mapping + block.dataOffset;
+
+  std::size_t segmentOffset = 0;
+  for (std::size_t segment = 0; segment < segments.size(); ++segment) {
+    const std::size_t segmentSize = segments[segment].size;
+    uint32_t compressedSize;
+    std::memcpy(&compressedSize, compressedSizes + segment * sizeof(uint32_t), sizeof(compressedSize));
+
+    scratch.resize(segmentSize * ticks);
+    uLongf columnsSize = static_cast<uLongf>(scratch.size());
+    if (uncompress(reinterpret_cast<Bytef*>(scratch.data()), &columnsSize, reinterpret_cast<const Bytef*>(compressed),
+                   static_cast<uLong>(compressedSize)) != Z_OK ||
+        columnsSize != scratch.size()) {
+      return false;
+    }
+    compressed += compressedSize;
+
+    // Gather the columns back into frames, 8 ticks of 8 columns at a time. The first tick of a block is a keyframe,
+    // with the XorDelta encoding the others are stored relative to their predecessor and are restored on the way.
+    const bool isDelta = encoding == ColumnarFrameWriter::XorDelta;
+    const std::size_t fullTicks = ticks & ~std::size_t{7};
+    const std::size_t fullColumns = segmentSize & ~std::size_t{7};
+    for (std::size_t i = 0; i < fullColumns; i += 8) {
+      uint64_t previous = 0;
+      for (std::size_t tick = 0; tick < fullTicks; tick += 8) {
+        uint64_t rows[8];
+        for (std::size_t row = 0; row < 8; ++row) {
+          std::memcpy(&rows[row], scratch.data() + (i + row) * ticks + tick, sizeof(uint64_t));
+        }
+        transpose8x8(rows);
+        for (std::size_t row = 0; row < 8; ++row) {
+          if (isDelta) {
+            rows[row] ^= previous;
+            previous = rows[row];
+          }
+          std::memcpy(frames + (tick + row) * frameSize + segmentOffset + i, &rows[row], sizeof(uint64_t));
+        }
+      }
+    }
+    // remaining ticks of the full columns and the remaining columns, the previous tick is already decoded
+    for (std::size_t i = 0; i < segmentSize; ++i) {
+      char* destination = frames + segmentOffset + i;
+      for (std::size_t tick = i < fullColumns ? fullTicks : 0; tick < ticks; ++tick) {
+        char value = scratch[i * ticks + tick];
+        if (isDelta && tick > 0) {
+          value ^= destination[(tick - 1) * frameSize];
+        }
+        destination[tick * frameSize] = value;
+      }
+    }
+    segmentOffset += segmentSize;
+  }
+
+  return true;
+}
+
+std::size_t FdrFile::inflateStream(char* destination, std::size_t size) {
+  zStream.next_out = reinterpret_cast<Bytef*>(destination);
+  zStream.avail_out = static_cast<uInt>(size);
+
+  while (zStream.avail_out > 0) {
+    // avail_in is 32 bit, larger files are fed in chunks
+    if (zStream.avail_in == 0) {
+      if (dataOffset >= mappingSize) {
+        break;
+      }
+      const std::size_t chunk = std::min<std::size_t>(mappingSize - dataOffset, UINT_MAX);
+      zStream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(mapping + dataOffset));
+      zStream.avail_in = static_cast<uInt>(chunk);
+      dataOffset += chunk;
+    }
+
+    const int result = inflate(&zStream, Z_NO_FLUSH);
+    if (result == Z_STREAM_END) {
+      // concatenated gzip members are read as one stream
+      if (zStream.avail_in == 0 && dataOffset >= mappingSize) {
+        break;
+      }
+      inflateReset(&zStream);
+    } else if (result != Z_OK) {
+      // a file that was not closed ends without a trailer, this is not an error
+      if (result != Z_BUF_ERROR) {
+        error = "corrupt gzip stream";
+      }
+      break;
+    }
+  }
+
+  return size - zStream.avail_out;
+}
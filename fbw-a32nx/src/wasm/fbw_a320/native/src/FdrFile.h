@@ -0,0 +1,139 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "ColumnarFrameWriter.h"
+#include "zlib.h"
+
+// One decoded frame of a recording. The structs are the ones the FlightDataRecorder writes, e.g.
+// frame.get<BaseData>(FrameLayout::getSegmentOffset(segments, "base")).
+class FdrFrame {
+ public:
+  const char* data() const { return frame; }
+
+  // frames are packed without padding, so the value is copied out instead of referenced
+  template <typename T>
+  T get(std::ptrdiff_t offset) const {
+    static_assert(std::is_trivially_copyable_v<T>);
+    T value;
+    std::memcpy(&value, frame + offset, sizeof(T));
+    return value;
+  }
+
+ private:
+  friend class FdrFile;
+  const char* frame = nullptr;
+};
+
+// Reads a flight data recorder file through a read-only memory mapping. Both the gzip stream written by the plain and
+// buffered writers and the block based file of the ColumnarFrameWriter are supported.
+//
+// Frames are decoded in windows of several blocks into a buffer that is reused for the whole file, so iterating does
+// not allocate. The blocks of a columnar file are independent and the blocks of a window are inflated in parallel, the
+// gzip stream can only be inflated serially.
+//
+//   for (const FdrFrame& frame : file) { ... }
+class FdrFile {
+ public:
+  // single pass iterator, the frame it refers to is valid until the iterator leaves the current window
+  class Iterator {
+   public:
+    const FdrFrame& operator*() const { return frame; }
+    const FdrFrame* operator->() const { return &frame; }
+    Iterator& operator++();
+    bool operator==(const Iterator& other) const { return file == other.file; }
+    bool operator!=(const Iterator& other) const { return file != other.file; }
+
+   private:
+    friend class FdrFile;
+    FdrFile* file = nullptr;
+    std::size_t frameInWindow = 0;
+    FdrFrame frame;
+  };
+
+  FdrFile() = default;
+  ~FdrFile();
+
+  FdrFile(const FdrFile&) = delete;
+  FdrFile& operator=(const FdrFile&) = delete;
+
+  // returns the frame size of an interface version or 0 if the version is not supported
+  using FrameSizeOfVersion = std::function<std::size_t(uint64_t interfaceVersion)>;
+
+  // maps the file and reads its header, the gzip stream has no layout so its frame size is looked up by the interface
+  // version it starts with
+  // numberOfThreads: threads used to inflate blocks, 0 uses all cores
+  bool open(const std::string& filename, const FrameSizeOfVersion& frameSizeOfVersion, int numberOfThreads = 0);
+
+  void close();
+
+  // starts at the first frame of the file again
+  Iterator begin();
+  Iterator end() const { return {}; }
+
+  bool isColumnar() const { return isColumnarFile; }
+  uint64_t getInterfaceVersion() const { return interfaceVersion; }
+  std::size_t getFrameSize() const { return frameSize; }
+  // segment layout stored in the file, empty for the gzip stream
+  const std::vector<FrameSegment>& getSegments() const { return segments; }
+  // set when the file could not be opened or when it turned out to be truncated or corrupt while iterating
+  const std::string& getError() const { return error; }
+
+ private:
+  struct Block {
+    std::size_t headerOffset;
+    std::size_t dataOffset;
+    uint32_t numberOfTicks;
+  };
+
+  const char* mapping = nullptr;
+  std::size_t mappingSize = 0;
+
+  bool isColumnarFile = false;
+  uint32_t encoding = ColumnarFrameWriter::Plain;
+  uint64_t interfaceVersion = 0;
+  std::size_t frameSize = 0;
+  std::vector<FrameSegment> segments;
+  std::vector<Block> blocks;
+  std::size_t numberOfThreads = 1;
+  std::string error;
+
+  // decoded frames of the current window
+  std::vector<char> window;
+  std::size_t framesInWindow = 0;
+  std::size_t nextBlock = 0;
+  // one scratch buffer per decoding thread
+  std::vector<std::vector<char>> columns;
+
+  z_stream zStream = {};
+  bool isStreamInitialized = false;
+  std::size_t dataOffset = 0;
+
+  bool readColumnarHeader();
+
+  bool readGzipHeader(const FrameSizeOfVersion& frameSizeOfVersion);
+
+  // decodes the next window, returns false at the end of the file
+  bool decodeWindow();
+
+  bool decodeBlock(const Block& block, char* frames, std::vector<char>& scratch) const;
+
+  // inflates up to size bytes of the gzip stream, returns the number of bytes produced
+  std::size_t inflateStream(char* destination, std::size_t size);
+
+  template <typename T>
+  bool readValue(std::size_t& offset, T& value) const {
+    if (offset + sizeof(T) > mappingSize) {
+      return false;
+    }
+    std::memcpy(&value, mapping + offset, sizeof(T));
+    offset += sizeof(T);
+    return true;
+  }
+};
@@ -0,0 +1,228 @@
+#include "FdrSignals.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include "ElacComputer_types.h"
+#include "FacComputer_types.h"
+#include "SecComputer_types.h"
+#include "recording/FrameLayout.h"
+#include "recording/RecordingDataTypes.h"
+
+namespace {
+struct FieldDefinition {
+  const char* name;
+  std::size_t offset;
+  FdrSignal::Type type;
+};
+
+struct SegmentDefinition {
+  // segment name without the computer index, e.g. "elac.analog_outputs" for "elac_1.analog_outputs"
+  const char* name;
+  const FieldDefinition* fields;
+  std::size_t numberOfFields;
+};
+
+template <typename T>
+constexpr FdrSignal::Type fieldType() {
+  static_assert(std::is_same_v<T, double> || std::is_same_v<T, unsigned long long>, "unsupported signal type");
+  return std::is_same_v<T, double> ? FdrSignal::Double : FdrSignal::UnsignedInteger;
+}
+
+#define FDR_FIELD(STRUCT, FIELD) \
+  { #FIELD, offsetof(STRUCT, FIELD), fieldType<decltype(STRUCT::FIELD)>() }
+
+const FieldDefinition baseFields[] = {
+    FDR_FIELD(BaseData, simulation_time_s),
+    FDR_FIELD(BaseData, simulation_delta_time_s),
+    FDR_FIELD(BaseData, simulation_rate),
+    FDR_FIELD(BaseData, simulation_slew_on),
+    FDR_FIELD(BaseData, simulation_was_pause_on),
+    FDR_FIELD(BaseData, aircraft_position_latitude_deg),
+    FDR_FIELD(BaseData, aircraft_position_longitude_deg),
+    FDR_FIELD(BaseData, aircraft_Theta_deg),
+    FDR_FIELD(BaseData, aircraft_Phi_deg),
+    FDR_FIELD(BaseData, aircraft_Psi_magnetic_deg),
+    FDR_FIELD(BaseData, aircraft_Psi_magnetic_track_deg),
+    FDR_FIELD(BaseData, aircraft_Psi_true_deg),
+    FDR_FIELD(BaseData, aircraft_qk_deg_s),
+    FDR_FIELD(BaseData, aircraft_pk_deg_s),
+    FDR_FIELD(BaseData, aircraft_rk_deg_s),
+    FDR_FIELD(BaseData, aircraft_V_indicated_kn),
+    FDR_FIELD(BaseData, aircraft_V_true_kn),
+    FDR_FIELD(BaseData, aircraft_V_ground_kn),
+    FDR_FIELD(BaseData, aircraft_Ma_mach),
+    FDR_FIELD(BaseData, aircraft_alpha_deg),
+    FDR_FIELD(BaseData, aircraft_beta_deg),
+    FDR_FIELD(BaseData, aircraft_H_pressure_ft),
+    FDR_FIELD(BaseData, aircraft_H_indicated_ft),
+    FDR_FIELD(BaseData, aircraft_H_radio_ft),
+    FDR_FIELD(BaseData, aircraft_nz_g),
+    FDR_FIELD(BaseData, aircraft_ax_m_s2),
+    FDR_FIELD(BaseData, aircraft_ay_m_s2),
+    FDR_FIELD(BaseData, aircraft_az_m_s2),
+    FDR_FIELD(BaseData, aircraft_bx_m_s2),
+    FDR_FIELD(BaseData, aircraft_by_m_s2),
+    FDR_FIELD(BaseData, aircraft_bz_m_s2),
+    FDR_FIELD(BaseData, aircraft_eta_pos),
+    FDR_FIELD(BaseData, aircraft_eta_trim_deg),
+    FDR_FIELD(BaseData, aircraft_xi_pos),
+    FDR_FIELD(BaseData, aircraft_zeta_pos),
+    FDR_FIELD(BaseData, aircraft_zeta_trim_pos),
+    FDR_FIELD(BaseData, aircraft_total_air_temperature_deg_celsius),
+    FDR_FIELD(BaseData, aircraft_ice_structure_percent),
+    FDR_FIELD(BaseData, aircraft_dfdr_event_button_pressed),
+    FDR_FIELD(BaseData, atmosphere_ambient_pressure_mbar),
+    FDR_FIELD(BaseData, atmosphere_ambient_wind_velocity_kn),
+    FDR_FIELD(BaseData, atmosphere_ambient_wind_direction_deg),
+    FDR_FIELD(BaseData, simulation_input_sidestick_pitch_pos),
+    FDR_FIELD(BaseData, simulation_input_sidestick_roll_pos),
+    FDR_FIELD(BaseData, simulation_input_rudder_pos),
+    FDR_FIELD(BaseData, simulation_input_brake_pedal_left_pos),
+    FDR_FIELD(BaseData, simulation_input_brake_pedal_right_pos),
+    FDR_FIELD(BaseData, simulation_input_flaps_handle_pos),
+    FDR_FIELD(BaseData, simulation_input_flaps_handle_index),
+    FDR_FIELD(BaseData, simulation_input_spoilers_handle_pos),
+    FDR_FIELD(BaseData, simulation_input_spoilers_are_armed),
+    FDR_FIELD(BaseData, simulation_input_gear_handle_pos),
+    FDR_FIELD(BaseData, simulation_input_tiller_handle_pos),
+    FDR_FIELD(BaseData, simulation_input_parking_brake_switch_pos),
+    FDR_FIELD(BaseData, simulation_assistant_is_assisted_takeoff_enabled),
+    FDR_FIELD(BaseData, simulation_assistant_is_assisted_landing_enabled),
+    FDR_FIELD(BaseData, simulation_assistant_is_ai_automatic_trim_active),
+    FDR_FIELD(BaseData, simulation_assistant_is_ai_controls_active),
+};
+
+const FieldDefinition specificFields[] = {
+    FDR_FIELD(AircraftSpecificData, simulation_input_throttle_lever_1_pos),
+    FDR_FIELD(AircraftSpecificData, simulation_input_throttle_lever_2_pos),
+    FDR_FIELD(AircraftSpecificData, simulation_input_throttle_lever_1_angle),
+    FDR_FIELD(AircraftSpecificData, simulation_input_throttle_lever_2_angle),
+    FDR_FIELD(AircraftSpecificData, aircraft_engine_1_N1_percent),
+    FDR_FIELD(AircraftSpecificData, aircraft_engine_2_N1_percent),
+    FDR_FIELD(AircraftSpecificData, aircraft_hydraulic_system_green_pressure_psi),
+    FDR_FIELD(AircraftSpecificData, aircraft_hydraulic_system_blue_pressure_psi),
+    FDR_FIELD(AircraftSpecificData, aircraft_hydraulic_system_yellow_pressure_psi),
+    FDR_FIELD(AircraftSpecificData, aircraft_autobrake_system_armed_mode),
+    FDR_FIELD(AircraftSpecificData, aircraft_autobrake_system_is_decel_light_on),
+    FDR_FIELD(AircraftSpecificData, aircraft_gear_nosewheel_pos),
+    FDR_FIELD(AircraftSpecificData, aircraft_gear_nosewheel_compression_percent),
+    FDR_FIELD(AircraftSpecificData, aircraft_gear_main_left_compression_percent),
+    FDR_FIELD(AircraftSpecificData, aircraft_gear_main_right_compression_percent),
+    FDR_FIELD(AircraftSpecificData, aircraft_is_master_warning_active),
+    FDR_FIELD(AircraftSpecificData, aircraft_is_master_caution_active),
+    FDR_FIELD(AircraftSpecificData, aircraft_is_wing_anti_ice_active),
+    FDR_FIELD(AircraftSpecificData, aircraft_is_alpha_floor_condition_active),
+    FDR_FIELD(AircraftSpecificData, aircraft_is_high_aoa_protection_active),
+    FDR_FIELD(AircraftSpecificData, aircraft_settings_is_realistic_tiller_enabled),
+    FDR_FIELD(AircraftSpecificData, aircraft_settings_any_failures_active),
+};
+
+const FieldDefinition elacAnalogFields[] = {
+    FDR_FIELD(base_elac_analog_outputs, left_elev_pos_order_deg),
+    FDR_FIELD(base_elac_analog_outputs, right_elev_pos_order_deg),
+    FDR_FIELD(base_elac_analog_outputs, ths_pos_order),
+    FDR_FIELD(base_elac_analog_outputs, left_aileron_pos_order),
+    FDR_FIELD(base_elac_analog_outputs, right_aileron_pos_order),
+};
+
+const FieldDefinition secAnalogFields[] = {
+    FDR_FIELD(base_sec_analog_outputs, left_elev_pos_order_deg),
+    FDR_FIELD(base_sec_analog_outputs, right_elev_pos_order_deg),
+    FDR_FIELD(base_sec_analog_outputs, ths_pos_order_deg),
+    FDR_FIELD(base_sec_analog_outputs, left_spoiler_1_pos_order_deg),
+    FDR_FIELD(base_sec_analog_outputs, right_spoiler_1_pos_order_deg),
+    FDR_FIELD(base_sec_analog_outputs, left_spoiler_2_pos_order_deg),
+    FDR_FIELD(base_sec_analog_outputs, right_spoiler_2_pos_order_deg),
+};
+
+const FieldDefinition facAnalogFields[] = {
+    FDR_FIELD(base_fac_analog_outputs, yaw_damper_order_deg),
+    FDR_FIELD(base_fac_analog_outputs, rudder_trim_order_deg),
+    FDR_FIELD(base_fac_analog_outputs, rudder_travel_limit_order_deg),
+};
+
+#undef FDR_FIELD
+
+template <std::size_t N>
+constexpr SegmentDefinition segment(const char* name, const FieldDefinition (&fields)[N]) {
+  return {name, fields, N};
+}
+
+const SegmentDefinition segmentDefinitions[] = {
+    segment("base", baseFields),
+    segment("specific", specificFields),
+    segment("elac.analog_outputs", elacAnalogFields),
+    segment("sec.analog_outputs", secAnalogFields),
+    segment("fac.analog_outputs", facAnalogFields),
+};
+
+// "elac_1.analog_outputs" -> "elac.analog_outputs"
+std::string withoutIndex(const std::string& segmentName) {
+  const auto underscore = segmentName.find('_');
+  const auto dot = segmentName.find('.');
+  if (underscore == std::string::npos || dot == std::string::npos || underscore > dot) {
+    return segmentName;
+  }
+  return segmentName.substr(0, underscore) + segmentName.substr(dot);
+}
+}  // namespace
+
+double FdrSignal::read(const char* frame) const {
+  if (type == Double) {
+    double value;
+    std::memcpy(&value, frame + offset, sizeof(value));
+    return value;
+  }
+  uint64_t value;
+  std::memcpy(&value, frame + offset, sizeof(value));
+  return static_cast<double>(value);
+}
+
+bool FdrSignals::resolve(const std::vector<FrameSegment>& segments, const std::string& name, FdrSignal& signal) {
+  const auto separator = name.rfind('.');
+  if (separator == std::string::npos) {
+    return false;
+  }
+  const std::string segmentName = name.substr(0, separator);
+  const std::string fieldName = name.substr(separator + 1);
+
+  const std::ptrdiff_t segmentOffset = FrameLayout::getSegmentOffset(segments, segmentName);
+  if (segmentOffset < 0) {
+    return false;
+  }
+
+  const std::string definitionName = withoutIndex(segmentName);
+  for (const auto& definition : segmentDefinitions) {
+    if (definitionName != definition.name) {
+      continue;
+    }
+    for (std::size_t i = 0; i < definition.numberOfFields; i++) {
+      if (fieldName == definition.fields[i].name) {
+        signal.name = name;
+        signal.offset = segmentOffset + static_cast<std::ptrdiff_t>(definition.fields[i].offset);
+        signal.type = definition.fields[i].type;
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+std::vector<std::string> FdrSignals::getSignalNames() {
+  std::vector<std::string> names;
+  for (const auto& segment : FrameLayout::getFrameSegments(FrameLayout::INTERFACE_VERSION)) {
+    const std::string definitionName = withoutIndex(segment.name);
+    for (const auto& definition : segmentDefinitions) {
+      if (definitionName != definition.name) {
+        continue;
+      }
+      for (std::size_t i = 0; i < definition.numberOfFields; i++) {
+        names.push_back(segment.name + "." + definition.fields[i].name);
+      }
+    }
+  }
+  return names;
+}
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "ColumnarFrameWriter.h"
+
+// A scalar signal of a flight data recorder frame, named "<segment>.<field>", e.g. "base.aircraft_Theta_deg" or
+// "elac_1.analog_outputs.left_elev_pos_order_deg".
+struct FdrSignal {
+  enum Type { Double, UnsignedInteger };
+
+  std::string name;
+  std::ptrdiff_t offset = -1;
+  Type type = Double;
+
+  double read(const char* frame) const;
+};
+
+namespace FdrSignals {
+// looks the signal up in the given layout, returns false if the segment is not recorded or the field is unknown
+bool resolve(const std::vector<FrameSegment>& segments, const std::string& name, FdrSignal& signal);
+
+// names of all signals that can be resolved, they are part of both frame layouts
+std::vector<std::string> getSignalNames();
+}  // namespace FdrSignals
@@ -0,0 +1,411 @@
+#include "FlightControlSystem.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "recording/FrameLayout.h"
+#include "recording/RecordingDataTypes.h"
+
+namespace {
+constexpr double HydraulicPressurePsi = 3000;
+
+// Surface actuators are modelled as first order lags towards the order of the active computer.
+constexpr double SurfaceTimeConstant = 0.1;
+
+base_arinc_429 normalWord(double value) {
+  return {static_cast<uint32_t>(Arinc429SignStatus::NormalOperation), static_cast<float>(value)};
+}
+
+double followOrder(double position, double order, double deltaTime) {
+  return position + (order - position) * std::min(1.0, deltaTime / SurfaceTimeConstant);
+}
+}  // namespace
+
+FlightControlSystem::FlightControlSystem() {
+  for (auto& elac : elacs) {
+    elac.modelInputs.in.discrete_inputs.elac_engaged_from_switch = true;
+  }
+  for (auto& sec : secs) {
+    sec.modelInputs.in.discrete_inputs.sec_engaged_from_switch = true;
+  }
+  for (auto& fac : facs) {
+    fac.modelInputs.in.discrete_inputs.fac_engaged_from_switch = true;
+  }
+}
+
+// Same computer order as FlyByWireInterface::update, so each computer sees the outputs of the others from the
+// same point in the previous cycle as it does in the sim.
+void FlightControlSystem::update(double deltaTime, double simulationTime, const AircraftState& state, const PilotInputs& inputs) {
+  monotonicTime += deltaTime;
+
+  updateSensors(state);
+
+  updateFcu(deltaTime, simulationTime);
+
+  for (int i = 0; i < 2; i++) {
+    updateFmgc(deltaTime, simulationTime, i);
+  }
+
+  for (int i = 0; i < 2; i++) {
+    updateElac(deltaTime, simulationTime, inputs, i);
+  }
+
+  for (int i = 0; i < 3; i++) {
+    updateSec(deltaTime, simulationTime, inputs, i);
+  }
+
+  for (int i = 0; i < 2; i++) {
+    updateFac(deltaTime, simulationTime, i);
+  }
+
+  SurfaceOrders orders = getSurfaceOrders();
+  elevatorPosDeg = followOrder(elevatorPosDeg, orders.elevatorDeg, deltaTime);
+  aileronPosDeg = followOrder(aileronPosDeg, orders.aileronDeg, deltaTime);
+  thsPosDeg = followOrder(thsPosDeg, orders.thsDeg, deltaTime);
+}
+
+SurfaceOrders FlightControlSystem::getSurfaceOrders() const {
+  SurfaceOrders orders = {};
+
+  // ELAC 1 has priority over ELAC 2, which has priority over the SECs.
+  if (elacsDiscreteOutputs[0].pitch_axis_ok) {
+    orders.elevatorDeg = elacsAnalogOutputs[0].left_elev_pos_order_deg;
+    orders.thsDeg = elacsAnalogOutputs[0].ths_pos_order;
+  } else if (elacsDiscreteOutputs[1].pitch_axis_ok) {
+    orders.elevatorDeg = elacsAnalogOutputs[1].left_elev_pos_order_deg;
+    orders.thsDeg = elacsAnalogOutputs[1].ths_pos_order;
+  } else {
+    orders.elevatorDeg = secsAnalogOutputs[0].left_elev_pos_order_deg;
+    orders.thsDeg = secsAnalogOutputs[0].ths_pos_order_deg;
+  }
+
+  if (elacsDiscreteOutputs[0].left_aileron_active_mode) {
+    orders.aileronDeg = elacsAnalogOutputs[0].left_aileron_pos_order;
+  } else if (elacsDiscreteOutputs[1].left_aileron_active_mode) {
+    orders.aileronDeg = elacsAnalogOutputs[1].left_aileron_pos_order;
+  }
+
+  orders.yawDamperDeg = facsDiscreteOutputs[0].yaw_damper_engaged ? facsAnalogOutputs[0].yaw_damper_order_deg
+                                                                   : facsAnalogOutputs[1].yaw_damper_order_deg;
+
+  return orders;
+}
+
+void FlightControlSystem::writeRecorderFrame(char* frame,
+                                             const std::vector<FrameSegment>& segments,
+                                             double deltaTime,
+                                             double simulationTime,
+                                             const AircraftState& state,
+                                             const PilotInputs& inputs) const {
+  std::memset(frame, 0, FrameLayout::getFrameSize(segments));
+  auto put = [&](const std::string& name, const auto& value) {
+    std::ptrdiff_t offset = FrameLayout::getSegmentOffset(segments, name);
+    if (offset >= 0) {
+      std::memcpy(frame + offset, &value, sizeof(value));
+    }
+  };
+
+  BaseData baseData = {};
+  baseData.simulation_time_s = simulationTime;
+  baseData.simulation_delta_time_s = deltaTime;
+  baseData.simulation_rate = 1;
+  baseData.aircraft_Theta_deg = state.pitchDeg;
+  baseData.aircraft_Phi_deg = state.rollDeg;
+  baseData.aircraft_Psi_true_deg = state.headingDeg;
+  baseData.aircraft_qk_deg_s = state.pitchRateDegS;
+  baseData.aircraft_pk_deg_s = state.rollRateDegS;
+  baseData.aircraft_rk_deg_s = state.yawRateDegS;
+  baseData.aircraft_V_indicated_kn = state.computedAirspeedKn;
+  baseData.aircraft_V_true_kn = state.trueAirspeedKn;
+  baseData.aircraft_Ma_mach = state.mach;
+  baseData.aircraft_alpha_deg = state.alphaDeg;
+  baseData.aircraft_H_pressure_ft = state.altitudeFt;
+  baseData.aircraft_H_radio_ft = state.radioHeightFt;
+  baseData.aircraft_nz_g = state.normalAccelG;
+  baseData.simulation_input_sidestick_pitch_pos = inputs.pitchStick;
+  baseData.simulation_input_sidestick_roll_pos = inputs.rollStick;
+  baseData.simulation_input_rudder_pos = inputs.rudderPedal;
+  put("base", baseData);
+
+  for (int i = 0; i < 2; i++) {
+    const std::string name = "elac_" + std::to_string(i + 1);
+    put(name + ".bus_outputs", elacsBusOutputs[i]);
+    put(name + ".discrete_outputs", elacsDiscreteOutputs[i]);
+    put(name + ".analog_outputs", elacsAnalogOutputs[i]);
+    put(name + ".inputs", elacs[i].getDebugOutputs().data);
+  }
+  for (int i = 0; i < 3; i++) {
+    const std::string name = "sec_" + std::to_string(i + 1);
+    put(name + ".bus_outputs", secsBusOutputs[i]);
+    put(name + ".discrete_outputs", secsDiscreteOutputs[i]);
+    put(name + ".analog_outputs", secsAnalogOutputs[i]);
+    put(name + ".inputs", secs[i].getDebugOutputs().data);
+  }
+  for (int i = 0; i < 2; i++) {
+    const std::string name = "fac_" + std::to_string(i + 1);
+    put(name + ".bus_outputs", facsBusOutputs[i]);
+    put(name + ".discrete_outputs", facsDiscreteOutputs[i]);
+    put(name + ".analog_outputs", facsAnalogOutputs[i]);
+    put(name + ".inputs", facs[i].getDebugOutputs().data);
+  }
+
+  const fmgc_outputs& fmgc = fmgcs[0].getDebugOutputs();
+  put("fmgc_1.logic", fmgc.logic);
+  put("fmgc_1.ap_fd_logic", fmgc.ap_fd_logic);
+  put("fmgc_1.ap_fd_outer_loops", fmgc.ap_fd_outer_loops);
+  put("fmgc_1.athr", fmgc.athr);
+  put("fmgc_1.discrete_outputs", fmgc.discrete_outputs);
+  put("fmgc_1.bus_outputs", fmgc.bus_outputs);
+  put("fmgc_1.bus_inputs", fmgc.data.bus_inputs);
+  put("fmgc_1.discrete_inputs", fmgc.data.discrete_inputs);
+  put("fmgc_1.fms_inputs", fmgc.data.fms_inputs);
+  put("fmgc_1.time", fmgc.data.time);
+  put("fmgc_1.sim_data", fmgc.data.sim_data);
+}
+
+void FlightControlSystem::updateSensors(const AircraftState& state) {
+  for (int i = 0; i < 3; i++) {
+    adrBusOutputs[i].altitude_standard_ft = normalWord(state.altitudeFt);
+    adrBusOutputs[i].altitude_corrected_1_ft = normalWord(state.altitudeFt);
+    adrBusOutputs[i].altitude_corrected_2_ft = normalWord(state.altitudeFt);
+    adrBusOutputs[i].mach = normalWord(state.mach);
+    adrBusOutputs[i].airspeed_computed_kn = normalWord(state.computedAirspeedKn);
+    adrBusOutputs[i].airspeed_true_kn = normalWord(state.trueAirspeedKn);
+    adrBusOutputs[i].vertical_speed_ft_min = normalWord(state.verticalSpeedFtMin);
+    adrBusOutputs[i].aoa_corrected_deg = normalWord(state.alphaDeg);
+    adrBusOutputs[i].corrected_average_static_pressure = normalWord(1013.25);
+
+    irBusOutputs[i].ground_speed_kn = normalWord(state.trueAirspeedKn);
+    irBusOutputs[i].track_angle_true_deg = normalWord(state.headingDeg);
+    irBusOutputs[i].heading_true_deg = normalWord(state.headingDeg);
+    irBusOutputs[i].track_angle_magnetic_deg = normalWord(state.headingDeg);
+    irBusOutputs[i].heading_magnetic_deg = normalWord(state.headingDeg);
+    irBusOutputs[i].flight_path_angle_deg = normalWord(state.pitchDeg - state.alphaDeg);
+    irBusOutputs[i].pitch_angle_deg = normalWord(state.pitchDeg);
+    irBusOutputs[i].roll_angle_deg = normalWord(state.rollDeg);
+    irBusOutputs[i].body_pitch_rate_deg_s = normalWord(state.pitchRateDegS);
+    irBusOutputs[i].body_roll_rate_deg_s = normalWord(state.rollRateDegS);
+    irBusOutputs[i].body_yaw_rate_deg_s = normalWord(state.yawRateDegS);
+    irBusOutputs[i].body_long_accel_g = normalWord(0);
+    irBusOutputs[i].body_lat_accel_g = normalWord(0);
+    irBusOutputs[i].body_normal_accel_g = normalWord(state.normalAccelG);
+    irBusOutputs[i].pitch_att_rate_deg_s = normalWord(state.pitchRateDegS);
+    irBusOutputs[i].roll_att_rate_deg_s = normalWord(state.rollRateDegS);
+    irBusOutputs[i].inertial_vertical_speed_ft_s = normalWord(state.verticalSpeedFtMin / 60);
+  }
+
+  for (auto& ra : raBusOutputs) {
+    ra.radio_height_ft = normalWord(state.radioHeightFt);
+  }
+
+  for (auto& elac : elacs) {
+    elac.modelInputs.in.discrete_inputs.lgciu_1_nose_gear_pressed = state.onGround;
+    elac.modelInputs.in.discrete_inputs.lgciu_2_nose_gear_pressed = state.onGround;
+    elac.modelInputs.in.discrete_inputs.lgciu_1_right_main_gear_pressed = state.onGround;
+    elac.modelInputs.in.discrete_inputs.lgciu_2_right_main_gear_pressed = state.onGround;
+    elac.modelInputs.in.discrete_inputs.lgciu_1_left_main_gear_pressed = state.onGround;
+    elac.modelInputs.in.discrete_inputs.lgciu_2_left_main_gear_pressed = state.onGround;
+  }
+  for (auto& fac : facs) {
+    fac.modelInputs.in.discrete_inputs.nose_gear_pressed = state.onGround;
+  }
+}
+
+void FlightControlSystem::updateFcu(double deltaTime, double simulationTime) {
+  fcu.modelInputs.in.time.dt = deltaTime;
+  fcu.modelInputs.in.time.simulation_time = simulationTime;
+  fcu.modelInputs.in.time.monotonic_time = monotonicTime;
+
+  fcu.modelInputs.in.bus_inputs.fmgc_1_bus = fmgcsBusOutputs[0].fmgc_a_bus;
+  fcu.modelInputs.in.bus_inputs.fmgc_2_bus = fmgcsBusOutputs[1].fmgc_a_bus;
+
+  fcuHealthy = fcu.getDiscreteOutputs().fcu_healthy;
+
+  fcu.update(deltaTime, simulationTime, false, false, true, true);
+  fcuBusOutputs = fcu.getBusOutputs();
+}
+
+void FlightControlSystem::updateFmgc(double deltaTime, double simulationTime, int fmgcIndex) {
+  const int oppFmgcIndex = fmgcIndex == 0 ? 1 : 0;
+  auto& in = fmgcs[fmgcIndex].modelInputs.in;
+
+  in.time.dt = deltaTime;
+  in.time.simulation_time = simulationTime;
+  in.time.monotonic_time = monotonicTime;
+
+  in.discrete_inputs.is_unit_1 = fmgcIndex == 0;
+  in.discrete_inputs.athr_opp_engaged = fmgcsDiscreteOutputs[oppFmgcIndex].athr_own_engaged;
+  in.discrete_inputs.fd_opp_engaged = fmgcsDiscreteOutputs[oppFmgcIndex].fd_own_engaged;
+  in.discrete_inputs.ap_opp_engaged = fmgcsDiscreteOutputs[oppFmgcIndex].ap_own_engaged;
+  in.discrete_inputs.fcu_opp_healthy = fcuHealthy;
+  in.discrete_inputs.fcu_own_healthy = fcuHealthy;
+  in.discrete_inputs.fac_opp_healthy = facsDiscreteOutputs[oppFmgcIndex].fac_healthy;
+  in.discrete_inputs.fac_own_healthy = facsDiscreteOutputs[fmgcIndex].fac_healthy;
+  in.discrete_inputs.fmgc_opp_healthy = fmgcsDiscreteOutputs[oppFmgcIndex].fmgc_healthy;
+  in.discrete_inputs.fwc_opp_valid = true;
+  in.discrete_inputs.fwc_own_valid = true;
+  in.discrete_inputs.pfd_opp_valid = true;
+  in.discrete_inputs.pfd_own_valid = true;
+  in.discrete_inputs.bscu_opp_valid = true;
+  in.discrete_inputs.bscu_own_valid = true;
+  in.discrete_inputs.elac_opp_ap_disc = !elacsDiscreteOutputs[oppFmgcIndex].ap_1_authorised;
+  in.discrete_inputs.elac_own_ap_disc = !elacsDiscreteOutputs[fmgcIndex].ap_1_authorised;
+
+  in.bus_inputs.fac_opp_bus = facsBusOutputs[oppFmgcIndex];
+  in.bus_inputs.fac_own_bus = facsBusOutputs[fmgcIndex];
+  in.bus_inputs.adr_3_bus = adrBusOutputs[2];
+  in.bus_inputs.ir_3_bus = irBusOutputs[2];
+  in.bus_inputs.adr_opp_bus = adrBusOutputs[oppFmgcIndex];
+  in.bus_inputs.ir_opp_bus = irBusOutputs[oppFmgcIndex];
+  in.bus_inputs.adr_own_bus = adrBusOutputs[fmgcIndex];
+  in.bus_inputs.ir_own_bus = irBusOutputs[fmgcIndex];
+  in.bus_inputs.ra_opp_bus = raBusOutputs[oppFmgcIndex];
+  in.bus_inputs.ra_own_bus = raBusOutputs[fmgcIndex];
+  in.bus_inputs.fmgc_opp_bus = fmgcsBusOutputs[oppFmgcIndex].fmgc_a_bus;
+  in.bus_inputs.fcu_bus = fcuBusOutputs;
+
+  fmgcs[fmgcIndex].update(deltaTime, simulationTime, false, true);
+
+  fmgcsDiscreteOutputs[fmgcIndex] = fmgcs[fmgcIndex].getDiscreteOutputs();
+  fmgcsBusOutputs[fmgcIndex] = fmgcs[fmgcIndex].getBusOutputs();
+}
+
+void FlightControlSystem::updateElac(double deltaTime, double simulationTime, const PilotInputs& inputs, int elacIndex) {
+  const int oppElacIndex = elacIndex == 0 ? 1 : 0;
+  auto& in = elacs[elacIndex].modelInputs.in;
+
+  in.time.dt = deltaTime;
+  in.time.simulation_time = simulationTime;
+  in.time.monotonic_time = monotonicTime;
+
+  in.sim_data.tailstrike_protection_on = true;
+
+  in.discrete_inputs.ground_spoilers_active_1 = secsDiscreteOutputs[0].ground_spoiler_out;
+  in.discrete_inputs.ground_spoilers_active_2 = elacIndex == 0 ? secsDiscreteOutputs[1].ground_spoiler_out : secsDiscreteOutputs[2].ground_spoiler_out;
+  in.discrete_inputs.is_unit_1 = elacIndex == 0;
+  in.discrete_inputs.is_unit_2 = elacIndex == 1;
+  in.discrete_inputs.opp_axis_pitch_failure = !elacsDiscreteOutputs[oppElacIndex].pitch_axis_ok;
+  in.discrete_inputs.ap_1_disengaged = !fmgcsDiscreteOutputs[0].ap_own_engaged;
+  in.discrete_inputs.ap_2_disengaged = !fmgcsDiscreteOutputs[1].ap_own_engaged;
+  in.discrete_inputs.opp_left_aileron_lost = !elacsDiscreteOutputs[oppElacIndex].left_aileron_ok;
+  in.discrete_inputs.opp_right_aileron_lost = !elacsDiscreteOutputs[oppElacIndex].right_aileron_ok;
+  in.discrete_inputs.fac_1_yaw_control_lost = !facsDiscreteOutputs[0].yaw_damper_avail_for_norm_law;
+  in.discrete_inputs.fac_2_yaw_control_lost = !facsDiscreteOutputs[1].yaw_damper_avail_for_norm_law;
+
+  in.analog_inputs.capt_pitch_stick_pos = -inputs.pitchStick;
+  in.analog_inputs.capt_roll_stick_pos = -inputs.rollStick;
+  in.analog_inputs.rudder_pedal_pos = -inputs.rudderPedal;
+  in.analog_inputs.left_elevator_pos_deg = elevatorPosDeg;
+  in.analog_inputs.right_elevator_pos_deg = elevatorPosDeg;
+  in.analog_inputs.ths_pos_deg = thsPosDeg;
+  in.analog_inputs.left_aileron_pos_deg = aileronPosDeg;
+  in.analog_inputs.right_aileron_pos_deg = -aileronPosDeg;
+  in.analog_inputs.blue_hyd_pressure_psi = HydraulicPressurePsi;
+  in.analog_inputs.green_hyd_pressure_psi = HydraulicPressurePsi;
+  in.analog_inputs.yellow_hyd_pressure_psi = HydraulicPressurePsi;
+
+  in.bus_inputs.adr_1_bus = adrBusOutputs[0];
+  in.bus_inputs.adr_2_bus = adrBusOutputs[1];
+  in.bus_inputs.adr_3_bus = adrBusOutputs[2];
+  in.bus_inputs.ir_1_bus = irBusOutputs[0];
+  in.bus_inputs.ir_2_bus = irBusOutputs[1];
+  in.bus_inputs.ir_3_bus = irBusOutputs[2];
+  in.bus_inputs.fmgc_1_bus = fmgcsBusOutputs[0].fmgc_b_bus;
+  in.bus_inputs.fmgc_2_bus = fmgcsBusOutputs[1].fmgc_b_bus;
+  in.bus_inputs.ra_1_bus = raBusOutputs[0];
+  in.bus_inputs.ra_2_bus = raBusOutputs[1];
+  in.bus_inputs.sec_1_bus = secsBusOutputs[0];
+  in.bus_inputs.sec_2_bus = secsBusOutputs[1];
+  in.bus_inputs.elac_opp_bus = elacsBusOutputs[oppElacIndex];
+
+  elacs[elacIndex].update(deltaTime, simulationTime, false, true);
+
+  elacsDiscreteOutputs[elacIndex] = elacs[elacIndex].getDiscreteOutputs();
+  elacsAnalogOutputs[elacIndex] = elacs[elacIndex].getAnalogOutputs();
+  elacsBusOutputs[elacIndex] = elacs[elacIndex].getBusOutputs();
+}
+
+void FlightControlSystem::updateSec(double deltaTime, double simulationTime, const PilotInputs& inputs, int secIndex) {
+  const int oppSecIndex = secIndex == 0 ? 1 : 0;
+  auto& in = secs[secIndex].modelInputs.in;
+
+  in.time.dt = deltaTime;
+  in.time.simulation_time = simulationTime;
+  in.time.monotonic_time = monotonicTime;
+
+  in.sim_data.tailstrike_protection_on = true;
+
+  in.discrete_inputs.is_unit_1 = secIndex == 0;
+  in.discrete_inputs.is_unit_2 = secIndex == 1;
+  in.discrete_inputs.is_unit_3 = secIndex == 2;
+  if (secIndex < 2) {
+    in.discrete_inputs.pitch_not_avail_elac_1 = !elacsDiscreteOutputs[0].pitch_axis_ok;
+    in.discrete_inputs.pitch_not_avail_elac_2 = !elacsDiscreteOutputs[1].pitch_axis_ok;
+    in.discrete_inputs.left_elev_not_avail_sec_opp = !secsDiscreteOutputs[oppSecIndex].left_elevator_ok;
+    in.discrete_inputs.right_elev_not_avail_sec_opp = !secsDiscreteOutputs[oppSecIndex].right_elevator_ok;
+
+    in.analog_inputs.capt_pitch_stick_pos = -inputs.pitchStick;
+    in.analog_inputs.left_elevator_pos_deg = elevatorPosDeg;
+    in.analog_inputs.right_elevator_pos_deg = elevatorPosDeg;
+    in.analog_inputs.ths_pos_deg = thsPosDeg;
+  }
+  in.discrete_inputs.digital_output_failed_elac_1 = !elacsDiscreteOutputs[0].digital_output_validated;
+  in.discrete_inputs.digital_output_failed_elac_2 = !elacsDiscreteOutputs[1].digital_output_validated;
+
+  in.analog_inputs.capt_roll_stick_pos = -inputs.rollStick;
+
+  const int adirs1Index = secIndex == 2 ? 1 : 0;
+  const int adirs2Index = secIndex == 1 ? 1 : 2;
+  in.bus_inputs.adr_1_bus = adrBusOutputs[adirs1Index];
+  in.bus_inputs.adr_2_bus = adrBusOutputs[adirs2Index];
+  in.bus_inputs.ir_1_bus = irBusOutputs[adirs1Index];
+  in.bus_inputs.ir_2_bus = irBusOutputs[adirs2Index];
+  in.bus_inputs.elac_1_bus = elacsBusOutputs[0];
+  in.bus_inputs.elac_2_bus = elacsBusOutputs[1];
+
+  secs[secIndex].update(deltaTime, simulationTime, false, true);
+
+  secsDiscreteOutputs[secIndex] = secs[secIndex].getDiscreteOutputs();
+  secsAnalogOutputs[secIndex] = secs[secIndex].getAnalogOutputs();
+  secsBusOutputs[secIndex] = secs[secIndex].getBusOutputs();
+}
+
+void FlightControlSystem::updateFac(double deltaTime, double simulationTime, int facIndex) {
+  const int oppFacIndex = facIndex == 0 ? 1 : 0;
+  auto& in = facs[facIndex].modelInputs.in;
+
+  in.time.dt = deltaTime;
+  in.time.simulation_time = simulationTime;
+  in.time.monotonic_time = monotonicTime;
+
+  in.discrete_inputs.ap_own_engaged = fmgcsDiscreteOutputs[facIndex].ap_own_engaged;
+  in.discrete_inputs.ap_opp_engaged = fmgcsDiscreteOutputs[oppFacIndex].ap_own_engaged;
+  in.discrete_inputs.yaw_damper_opp_engaged = facsDiscreteOutputs[oppFacIndex].yaw_damper_engaged;
+  in.discrete_inputs.rudder_trim_opp_engaged = facsDiscreteOutputs[oppFacIndex].rudder_trim_engaged;
+  in.discrete_inputs.rudder_travel_lim_opp_engaged = facsDiscreteOutputs[oppFacIndex].rudder_travel_lim_engaged;
+  in.discrete_inputs.elac_1_healthy = elacsDiscreteOutputs[0].digital_output_validated;
+  in.discrete_inputs.elac_2_healthy = elacsDiscreteOutputs[1].digital_output_validated;
+  in.discrete_inputs.fac_opp_healthy = facsDiscreteOutputs[oppFacIndex].fac_healthy;
+  in.discrete_inputs.is_unit_1 = facIndex == 0;
+  in.discrete_inputs.rudder_trim_actuator_healthy = true;
+  in.discrete_inputs.rudder_travel_lim_actuator_healthy = true;
+  in.discrete_inputs.yaw_damper_has_hyd_press = true;
+
+  in.bus_inputs.fac_opp_bus = facsBusOutputs[oppFacIndex];
+  in.bus_inputs.adr_own_bus = adrBusOutputs[facIndex];
+  in.bus_inputs.adr_opp_bus = adrBusOutputs[oppFacIndex];
+  in.bus_inputs.adr_3_bus = adrBusOutputs[2];
+  in.bus_inputs.ir_own_bus = irBusOutputs[facIndex];
+  in.bus_inputs.ir_opp_bus = irBusOutputs[oppFacIndex];
+  in.bus_inputs.ir_3_bus = irBusOutputs[2];
+  in.bus_inputs.fmgc_own_bus = fmgcsBusOutputs[facIndex].fmgc_b_bus;
+  in.bus_inputs.fmgc_opp_bus = fmgcsBusOutputs[oppFacIndex].fmgc_b_bus;
+  in.bus_inputs.elac_1_bus = elacsBusOutputs[0];
+  in.bus_inputs.elac_2_bus = elacsBusOutputs[1];
+
+  facs[facIndex].update(deltaTime, simulationTime, false, true);
+
+  facsDiscreteOutputs[facIndex] = facs[facIndex].getDiscreteOutputs();
+  facsAnalogOutputs[facIndex] = facs[facIndex].getAnalogOutputs();
+  facsBusOutputs[facIndex] = facs[facIndex].getBusOutputs();
+}
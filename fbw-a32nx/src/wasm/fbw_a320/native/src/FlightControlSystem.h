@@ -0,0 +1,109 @@
+#pragma once
+
+#include <vector>
+
+#include "ColumnarFrameWriter.h"
+#include "elac/Elac.h"
+#include "fac/Fac.h"
+#include "fcu/Fcu.h"
+#include "fmgc/Fmgc.h"
+#include "sec/Sec.h"
+
+// Aircraft state as sensed by the ADIRUs and radio altimeters. Supplied by the driver each step.
+struct AircraftState {
+  double altitudeFt;
+  double radioHeightFt;
+  double computedAirspeedKn;
+  double trueAirspeedKn;
+  double mach;
+  double verticalSpeedFtMin;
+  double alphaDeg;
+  double pitchDeg;
+  double rollDeg;
+  double headingDeg;
+  double pitchRateDegS;
+  double rollRateDegS;
+  double yawRateDegS;
+  double normalAccelG;
+  bool onGround;
+};
+
+struct PilotInputs {
+  double pitchStick;
+  double rollStick;
+  double rudderPedal;
+};
+
+// Surface orders taken from the active computers after a step.
+struct SurfaceOrders {
+  double elevatorDeg;
+  double aileronDeg;
+  double thsDeg;
+  double yawDamperDeg;
+};
+
+// Wires the ELACs, SECs, FACs, FMGCs and the FCU together the same way FlyByWireInterface does, without any
+// SimConnect or local variable dependency. Inputs that only exist in the sim (hydraulics, electrics, pushbuttons)
+// are held at their nominal values.
+class FlightControlSystem {
+ public:
+  FlightControlSystem();
+
+  void update(double deltaTime, double simulationTime, const AircraftState& state, const PilotInputs& inputs);
+
+  SurfaceOrders getSurfaceOrders() const;
+
+  // fills a flight data recorder frame with the given layout, computers that are not simulated are left zeroed
+  void writeRecorderFrame(char* frame,
+                          const std::vector<FrameSegment>& segments,
+                          double deltaTime,
+                          double simulationTime,
+                          const AircraftState& state,
+                          const PilotInputs& inputs) const;
+
+ private:
+  void updateSensors(const AircraftState& state);
+
+  void updateFcu(double deltaTime, double simulationTime);
+
+  void updateFmgc(double deltaTime, double simulationTime, int fmgcIndex);
+
+  void updateElac(double deltaTime, double simulationTime, const PilotInputs& inputs, int elacIndex);
+
+  void updateSec(double deltaTime, double simulationTime, const PilotInputs& inputs, int secIndex);
+
+  void updateFac(double deltaTime, double simulationTime, int facIndex);
+
+  double monotonicTime = 0;
+
+  double elevatorPosDeg = 0;
+  double aileronPosDeg = 0;
+  double thsPosDeg = 0;
+
+  base_adr_bus adrBusOutputs[3] = {};
+  base_ir_bus irBusOutputs[3] = {};
+  base_ra_bus raBusOutputs[2] = {};
+
+  Elac elacs[2] = {Elac(true), Elac(false)};
+  base_elac_discrete_outputs elacsDiscreteOutputs[2] = {};
+  base_elac_analog_outputs elacsAnalogOutputs[2] = {};
+  base_elac_out_bus elacsBusOutputs[2] = {};
+
+  Sec secs[3] = {Sec(true, false), Sec(false, false), Sec(false, true)};
+  base_sec_discrete_outputs secsDiscreteOutputs[3] = {};
+  base_sec_analog_outputs secsAnalogOutputs[3] = {};
+  base_sec_out_bus secsBusOutputs[3] = {};
+
+  Fmgc fmgcs[2] = {Fmgc(true), Fmgc(false)};
+  base_fmgc_discrete_outputs fmgcsDiscreteOutputs[2] = {};
+  base_fmgc_bus_outputs fmgcsBusOutputs[2] = {};
+
+  Fcu fcu = Fcu();
+  base_fcu_bus fcuBusOutputs = {};
+  bool fcuHealthy = false;
+
+  Fac facs[2] = {Fac(true), Fac(false)};
+  base_fac_discrete_outputs facsDiscreteOutputs[2] = {};
+  base_fac_analog_outputs facsAnalogOutputs[2] = {};
+  base_fac_bus facsBusOutputs[2] = {};
+};
@@ -0,0 +1,325 @@
+#include "ReplayEngine.h"
+
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+
+#include "model/ElacComputer.h"
+#include "model/FacComputer.h"
+#include "model/FmgcComputer.h"
+#include "model/SecComputer.h"
+#include "recording/FrameLayout.h"
+#include "recording/RecordingDataTypes.h"
+
+namespace {
+enum class SignalType {
+  Arinc429,
+  Real,
+  Boolean,
+};
+
+// copies a recorded segment into the model input struct
+struct InputSource {
+  std::string segment;
+  std::size_t inputOffset;
+  std::size_t size;
+  std::ptrdiff_t frameOffset = -1;
+};
+
+// compares a recorded segment against a part of the model output struct
+struct OutputCheck {
+  std::string segment;
+  std::size_t outputOffset;
+  std::size_t size;
+  SignalType type;
+  std::ptrdiff_t frameOffset = -1;
+};
+
+// recorded discrete that tells whether the wrapper passed the model outputs through
+struct HealthSignal {
+  std::string segment;
+  std::size_t offset;
+  bool isFailureSignal;
+  std::ptrdiff_t frameOffset = -1;
+};
+
+bool isWithinTolerance(double recorded, double replayed, double tolerance) {
+  if (std::isnan(recorded) || std::isnan(replayed)) {
+    return std::isnan(recorded) && std::isnan(replayed);
+  }
+  return std::abs(recorded - replayed) <= tolerance * std::max(1.0, std::abs(recorded));
+}
+}  // namespace
+
+class ComputerReplay {
+ public:
+  explicit ComputerReplay(std::string name) { statistics.computer = std::move(name); }
+  virtual ~ComputerReplay() = default;
+
+  bool resolve(const std::vector<FrameSegment>& segments, std::string& error) {
+    auto find = [&](const std::string& name, std::size_t size) {
+      std::ptrdiff_t offset = FrameLayout::getSegmentOffset(segments, name);
+      if (offset < 0) {
+        error = "missing segment " + name;
+      }
+      for (const auto& segment : segments) {
+        if (segment.name == name && size != 0 && segment.size != size) {
+          error = "unexpected size of segment " + name;
+          offset = -1;
+        }
+      }
+      return offset;
+    };
+
+    for (auto& input : inputs) {
+      input.frameOffset = find(input.segment, input.size);
+    }
+    for (auto& output : outputs) {
+      output.frameOffset = find(output.segment, output.size);
+    }
+    if (health) {
+      // only the offset of the discrete within the segment is needed
+      health->frameOffset = find(health->segment, 0);
+      if (health->frameOffset >= 0) {
+        health->frameOffset += health->offset;
+      }
+    }
+    return error.empty();
+  }
+
+  void replay(const char* frame, uint64_t tick, double simulationTime, bool isCompareEnabled, double tolerance) {
+    // assemble the input struct, unchanged inputs mean that the computer was not stepped
+    for (const auto& input : inputs) {
+      std::memcpy(inputBuffer() + input.inputOffset, frame + input.frameOffset, input.size);
+    }
+    if (hasPreviousInputs && std::memcmp(inputBuffer(), previousInputs.data(), previousInputs.size()) == 0) {
+      return;
+    }
+    std::memcpy(previousInputs.data(), inputBuffer(), previousInputs.size());
+    hasPreviousInputs = true;
+
+    step();
+    statistics.steppedTicks++;
+
+    if (!isCompareEnabled) {
+      return;
+    }
+    if (health && static_cast<bool>(frame[health->frameOffset]) == health->isFailureSignal) {
+      return;
+    }
+    statistics.comparedTicks++;
+
+    bool isTickDiverged = false;
+    for (const auto& output : outputs) {
+      if (compare(output, frame + output.frameOffset, outputBuffer() + output.outputOffset, tick, simulationTime, tolerance)) {
+        isTickDiverged = true;
+      }
+    }
+    if (isTickDiverged) {
+      statistics.divergedTicks++;
+    }
+  }
+
+  ReplayStatistics statistics;
+
+ protected:
+  std::vector<InputSource> inputs;
+  std::vector<OutputCheck> outputs;
+  std::unique_ptr<HealthSignal> health;
+  std::vector<char> previousInputs;
+  bool hasPreviousInputs = false;
+
+  virtual char* inputBuffer() = 0;
+
+  virtual const char* outputBuffer() const = 0;
+
+  virtual void step() = 0;
+
+ private:
+  // returns true if any signal of the segment differs
+  bool compare(const OutputCheck& check, const char* recorded, const char* replayed, uint64_t tick, double simulationTime, double tolerance) {
+    bool isDiverged = false;
+    auto report = [&](std::size_t index, double recordedValue, double replayedValue) {
+      isDiverged = true;
+      if (!statistics.hasDiverged) {
+        statistics.hasDiverged = true;
+        statistics.firstDivergenceTick = tick;
+        statistics.firstDivergenceSimulationTime = simulationTime;
+        statistics.firstDivergenceSignal = check.segment + "[" + std::to_string(index) + "]";
+        statistics.firstDivergenceRecorded = recordedValue;
+        statistics.firstDivergenceReplayed = replayedValue;
+      }
+    };
+
+    switch (check.type) {
+      case SignalType::Arinc429:
+        for (std::size_t i = 0; i < check.size / sizeof(base_arinc_429); ++i) {
+          base_arinc_429 a, b;
+          std::memcpy(&a, recorded + i * sizeof(base_arinc_429), sizeof(a));
+          std::memcpy(&b, replayed + i * sizeof(base_arinc_429), sizeof(b));
+          if (a.SSM != b.SSM) {
+            report(i, a.SSM, b.SSM);
+          } else if (!isWithinTolerance(a.Data, b.Data, tolerance)) {
+            report(i, a.Data, b.Data);
+          }
+        }
+        break;
+      case SignalType::Real:
+        for (std::size_t i = 0; i < check.size / sizeof(real_T); ++i) {
+          real_T a, b;
+          std::memcpy(&a, recorded + i * sizeof(real_T), sizeof(a));
+          std::memcpy(&b, replayed + i * sizeof(real_T), sizeof(b));
+          if (!isWithinTolerance(a, b, tolerance)) {
+            report(i, a, b);
+          }
+        }
+        break;
+      case SignalType::Boolean:
+        for (std::size_t i = 0; i < check.size; ++i) {
+          if ((recorded[i] != 0) != (replayed[i] != 0)) {
+            report(i, recorded[i] != 0, replayed[i] != 0);
+          }
+        }
+        break;
+    }
+    return isDiverged;
+  }
+};
+
+namespace {
+template <typename Model, typename ExternalInputs>
+class ModelReplay : public ComputerReplay {
+ public:
+  explicit ModelReplay(std::string name) : ComputerReplay(std::move(name)), model(std::make_unique<Model>()) {
+    model->initialize();
+    previousInputs.resize(sizeof(ExternalInputs));
+  }
+
+ protected:
+  char* inputBuffer() override { return reinterpret_cast<char*>(&externalInputs); }
+
+  const char* outputBuffer() const override { return reinterpret_cast<const char*>(&model->getExternalOutputs().out); }
+
+  void step() override {
+    model->setExternalInputs(&externalInputs);
+    model->step();
+  }
+
+  // ELAC, SEC and FAC record their complete model inputs in one segment
+  template <typename Outputs>
+  void addFlightControlComputer(const std::string& name, std::size_t busSize, std::size_t discreteSize, std::size_t analogSize) {
+    inputs.push_back({name + ".inputs", 0, sizeof(ExternalInputs::in)});
+    outputs.push_back({name + ".bus_outputs", offsetof(Outputs, bus_outputs), busSize, SignalType::Arinc429});
+    outputs.push_back({name + ".discrete_outputs", offsetof(Outputs, discrete_outputs), discreteSize, SignalType::Boolean});
+    outputs.push_back({name + ".analog_outputs", offsetof(Outputs, analog_outputs), analogSize, SignalType::Real});
+  }
+
+  std::unique_ptr<Model> model;
+  ExternalInputs externalInputs = {};
+};
+
+class ElacReplay : public ModelReplay<ElacComputer, ElacComputer::ExternalInputs_ElacComputer_T> {
+ public:
+  explicit ElacReplay(int index) : ModelReplay("elac_" + std::to_string(index)) {
+    addFlightControlComputer<elac_outputs>(statistics.computer, sizeof(base_elac_out_bus), sizeof(base_elac_discrete_outputs),
+                                           sizeof(base_elac_analog_outputs));
+    health = std::make_unique<HealthSignal>(
+        HealthSignal{statistics.computer + ".discrete_outputs", offsetof(base_elac_discrete_outputs, digital_output_validated), false});
+  }
+};
+
+class SecReplay : public ModelReplay<SecComputer, SecComputer::ExternalInputs_SecComputer_T> {
+ public:
+  explicit SecReplay(int index) : ModelReplay("sec_" + std::to_string(index)) {
+    addFlightControlComputer<sec_outputs>(statistics.computer, sizeof(base_sec_out_bus), sizeof(base_sec_discrete_outputs),
+                                          sizeof(base_sec_analog_outputs));
+    health = std::make_unique<HealthSignal>(
+        HealthSignal{statistics.computer + ".discrete_outputs", offsetof(base_sec_discrete_outputs, sec_failed), true});
+  }
+};
+
+class FacReplay : public ModelReplay<FacComputer, FacComputer::ExternalInputs_FacComputer_T> {
+ public:
+  explicit FacReplay(int index) : ModelReplay("fac_" + std::to_string(index)) {
+    addFlightControlComputer<fac_outputs>(statistics.computer, sizeof(base_fac_bus), sizeof(base_fac_discrete_outputs),
+                                          sizeof(base_fac_analog_outputs));
+    health = std::make_unique<HealthSignal>(
+        HealthSignal{statistics.computer + ".discrete_outputs", offsetof(base_fac_discrete_outputs, fac_healthy), false});
+  }
+};
+
+// the FMGC outputs are recorded straight from the model, so they are always compared
+class FmgcReplay : public ModelReplay<FmgcComputer, FmgcComputer::ExternalInputs_FmgcComputer_T> {
+ public:
+  FmgcReplay() : ModelReplay("fmgc_1") {
+    inputs.push_back({"fmgc_1.time", offsetof(fmgc_inputs, time), sizeof(base_time)});
+    inputs.push_back({"fmgc_1.sim_data", offsetof(fmgc_inputs, sim_data), sizeof(base_sim_data)});
+    inputs.push_back({"fmgc_1.discrete_inputs", offsetof(fmgc_inputs, discrete_inputs), sizeof(base_fmgc_discrete_inputs)});
+    inputs.push_back({"fmgc_1.fms_inputs", offsetof(fmgc_inputs, fms_inputs), sizeof(base_fms_inputs)});
+    inputs.push_back({"fmgc_1.bus_inputs", offsetof(fmgc_inputs, bus_inputs), sizeof(base_fmgc_bus_inputs)});
+    outputs.push_back(
+        {"fmgc_1.discrete_outputs", offsetof(fmgc_outputs, discrete_outputs), sizeof(base_fmgc_discrete_outputs), SignalType::Boolean});
+    outputs.push_back({"fmgc_1.bus_outputs", offsetof(fmgc_outputs, bus_outputs), sizeof(base_fmgc_bus_outputs), SignalType::Arinc429});
+  }
+};
+}  // namespace
+
+ReplayEngine::ReplayEngine(const std::vector<FrameSegment>& segments, double tolerance, double warmupTime)
+    : tolerance(tolerance), warmupTime(warmupTime) {
+  for (uint32_t i = 1; i <= FrameLayout::NUMBER_OF_ELAC_TO_WRITE; ++i) {
+    computers.push_back(std::make_unique<ElacReplay>(i));
+  }
+  for (uint32_t i = 1; i <= FrameLayout::NUMBER_OF_SEC_TO_WRITE; ++i) {
+    computers.push_back(std::make_unique<SecReplay>(i));
+  }
+  for (uint32_t i = 1; i <= FrameLayout::NUMBER_OF_FAC_TO_WRITE; ++i) {
+    computers.push_back(std::make_unique<FacReplay>(i));
+  }
+  computers.push_back(std::make_unique<FmgcReplay>());
+
+  baseOffset = FrameLayout::getSegmentOffset(segments, "base");
+  if (baseOffset < 0) {
+    error = "missing segment base";
+  }
+  for (auto& computer : computers) {
+    if (!computer->resolve(segments, error)) {
+      break;
+    }
+  }
+}
+
+ReplayEngine::~ReplayEngine() = default;
+
+bool ReplayEngine::isValid() const {
+  return error.empty();
+}
+
+const std::string& ReplayEngine::getError() const {
+  return error;
+}
+
+void ReplayEngine::replayFrame(const char* frame) {
+  BaseData baseData;
+  std::memcpy(&baseData, frame + baseOffset, sizeof(baseData));
+  if (numberOfTicks == 0) {
+    startTime = baseData.simulation_time_s;
+  }
+
+  const bool isCompareEnabled = baseData.simulation_time_s - startTime >= warmupTime;
+  for (auto& computer : computers) {
+    computer->replay(frame, numberOfTicks, baseData.simulation_time_s, isCompareEnabled, tolerance);
+  }
+  numberOfTicks++;
+}
+
+uint64_t ReplayEngine::getNumberOfTicks() const {
+  return numberOfTicks;
+}
+
+std::vector<ReplayStatistics> ReplayEngine::getStatistics() const {
+  std::vector<ReplayStatistics> statistics;
+  for (const auto& computer : computers) {
+    statistics.push_back(computer->statistics);
+  }
+  return statistics;
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "ColumnarFrameWriter.h"
+
+struct ReplayStatistics {
+  std::string computer;
+  uint64_t steppedTicks = 0;
+  uint64_t comparedTicks = 0;
+  uint64_t divergedTicks = 0;
+
+  // first signal that differed by more than the tolerance
+  bool hasDiverged = false;
+  uint64_t firstDivergenceTick = 0;
+  double firstDivergenceSimulationTime = 0;
+  std::string firstDivergenceSignal;
+  double firstDivergenceRecorded = 0;
+  double firstDivergenceReplayed = 0;
+};
+
+class ComputerReplay;
+
+// Re-runs the ELACs, SECs, FACs and FMGC 1 on the model inputs stored in a flight data recorder frame and compares the
+// outputs against the recorded ones. The FADEC is not replayed, the recorder only stores its bus outputs and not its
+// model inputs.
+//
+// A computer is only stepped when its recorded inputs changed since the previous frame. The monotonic time is part of
+// the inputs, so unchanged inputs mean the computer was not stepped in the sim either (e.g. FAC during a short power
+// failure). Outputs of a computer that reported itself as failed are masked by its wrapper and are not compared.
+class ReplayEngine {
+ public:
+  // warmupTime: divergences within this many seconds of simulation time after the first frame are not reported, the
+  // internal states of the models start from their initial values which a recording started mid-flight does not
+  ReplayEngine(const std::vector<FrameSegment>& segments, double tolerance, double warmupTime);
+  ~ReplayEngine();
+
+  ReplayEngine(const ReplayEngine&) = delete;
+  ReplayEngine& operator=(const ReplayEngine&) = delete;
+
+  // false if the layout lacks a segment needed for the replay, see getError()
+  bool isValid() const;
+  const std::string& getError() const;
+
+  void replayFrame(const char* frame);
+
+  uint64_t getNumberOfTicks() const;
+  std::vector<ReplayStatistics> getStatistics() const;
+
+ private:
+  std::vector<std::unique_ptr<ComputerReplay>> computers;
+  std::ptrdiff_t baseOffset = -1;
+  double tolerance = 0;
+  double warmupTime = 0;
+  double startTime = 0;
+  uint64_t numberOfTicks = 0;
+  std::string error;
+};
@@ -0,0 +1,109 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "FdrFile.h"
+#include "ReplayEngine.h"
+#include "recording/FrameLayout.h"
+
+namespace {
+struct Options {
+  std::vector<std::string> files;
+  double tolerance = 1e-6;
+  double warmupTime = 0;
+};
+
+void printUsage(const char* program) {
+  std::printf("usage: %s [--tolerance RELATIVE] [--warmup SECONDS] FILE...\n", program);
+  std::printf("\n");
+  std::printf("Replays the ELACs, SECs, FACs and FMGC 1 and compares their outputs against the recording.\n");
+  std::printf("The FADEC is not replayed, the recorder only stores its bus outputs and not its model inputs.\n");
+  std::printf("The files need to be recorded with REPLAY_INPUTS_ENABLED in the recorder configuration.\n");
+}
+
+bool parseOptions(int argc, char* argv[], Options& options) {
+  for (int i = 1; i < argc; i++) {
+    if (std::strcmp(argv[i], "--tolerance") == 0 && i + 1 < argc) {
+      options.tolerance = std::atof(argv[++i]);
+    } else if (std::strcmp(argv[i], "--warmup") == 0 && i + 1 < argc) {
+      options.warmupTime = std::atof(argv[++i]);
+    } else if (argv[i][0] == '-') {
+      return false;
+    } else {
+      options.files.emplace_back(argv[i]);
+    }
+  }
+  return !options.files.empty() && options.tolerance >= 0;
+}
+
+// returns true if the outputs of all computers matched the recording
+bool replayFile(const std::string& filename, const Options& options) {
+  FdrFile file;
+  if (!file.open(filename, [](uint64_t version) { return FrameLayout::getFrameSize(FrameLayout::getFrameSegments(version)); })) {
+    std::printf("%s: %s\n", filename.c_str(), file.getError().c_str());
+    return false;
+  }
+  // the replay needs the model inputs, which are only recorded when enabled in the recorder configuration
+  if (file.getInterfaceVersion() != FrameLayout::INTERFACE_VERSION_WITH_INPUTS) {
+    std::printf("%s: interface version %llu is not supported, expected %llu (recorded with REPLAY_INPUTS_ENABLED)\n", filename.c_str(),
+                static_cast<unsigned long long>(file.getInterfaceVersion()),
+                static_cast<unsigned long long>(FrameLayout::INTERFACE_VERSION_WITH_INPUTS));
+    return false;
+  }
+
+  // the columnar file carries its own layout, the engine finds the segments by name
+  ReplayEngine engine(file.isColumnar() ? file.getSegments() : FrameLayout::getFrameSegments(file.getInterfaceVersion()),
+                      options.tolerance, options.warmupTime);
+  if (!engine.isValid()) {
+    std::printf("%s: %s\n", filename.c_str(), engine.getError().c_str());
+    return false;
+  }
+
+  const auto start = std::chrono::steady_clock::now();
+  for (const FdrFrame& frame : file) {
+    engine.replayFrame(frame.data());
+  }
+  const double wallTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  if (!file.getError().empty()) {
+    std::printf("%s: %s, replay stopped\n", filename.c_str(), file.getError().c_str());
+  }
+
+  std::printf("%s: %llu ticks in %.3f s (%.0f ticks/s)\n", filename.c_str(), static_cast<unsigned long long>(engine.getNumberOfTicks()),
+              wallTime, engine.getNumberOfTicks() / std::max(wallTime, 1e-9));
+
+  bool isMatching = true;
+  for (const auto& statistics : engine.getStatistics()) {
+    std::printf("  %-7s stepped %8llu  compared %8llu  diverged %8llu", statistics.computer.c_str(),
+                static_cast<unsigned long long>(statistics.steppedTicks), static_cast<unsigned long long>(statistics.comparedTicks),
+                static_cast<unsigned long long>(statistics.divergedTicks));
+    if (statistics.hasDiverged) {
+      isMatching = false;
+      std::printf("  first at tick %llu (t = %.3f s) %s: recorded %g replayed %g",
+                  static_cast<unsigned long long>(statistics.firstDivergenceTick), statistics.firstDivergenceSimulationTime,
+                  statistics.firstDivergenceSignal.c_str(), statistics.firstDivergenceRecorded, statistics.firstDivergenceReplayed);
+    }
+    std::printf("\n");
+  }
+
+  return isMatching;
+}
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  Options options;
+  if (!parseOptions(argc, argv, options)) {
+    printUsage(argv[0]);
+    return 1;
+  }
+
+  bool isMatching = true;
+  for (const auto& file : options.files) {
+    isMatching &= replayFile(file, options);
+  }
+
+  return isMatching ? 0 : 2;
+}
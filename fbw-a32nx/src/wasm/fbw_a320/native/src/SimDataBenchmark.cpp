@@ -0,0 +1,110 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <utility>
+
+#include "interface/SimConnectData.h"
+
+// Compares the two ways FlyByWireInterface::update hands the sim data to its update functions: every function taking
+// its own copy from the SimConnectInterface, or one snapshot per tick passed by const reference. The update functions
+// read a few fields around calls the compiler cannot see through, like LocalVariable::set in the real code, so the
+// copies cannot be optimized away.
+
+namespace {
+// number of update functions that read the sim data per tick, counting the per computer calls
+constexpr int NumberOfReaders = 25;
+// of which also read the sim input
+constexpr int NumberOfInputReaders = 4;
+
+struct Interface {
+  SimData simData;
+  SimInput simInput;
+
+  [[gnu::noinline]] SimData& getSimData() { return simData; }
+  [[gnu::noinline]] SimInput& getSimInput() { return simInput; }
+};
+
+Interface interface;
+volatile double sinkValue;
+
+[[gnu::noinline]] void sink(double value) {
+  sinkValue = value;
+  // may touch any memory as far as the caller knows
+  asm volatile("" ::: "memory");
+}
+
+template <int N>
+[[gnu::noinline]] bool updateCopying() {
+  SimData simData = interface.getSimData();
+  sink(simData.Theta_deg + N);
+  sink(simData.H_radio_ft * N);
+  if constexpr (N < NumberOfInputReaders) {
+    SimInput simInput = interface.getSimInput();
+    sink(simInput.inputs[N % 3]);
+  }
+  sink(simData.simulationTime);
+  return true;
+}
+
+template <int N>
+[[gnu::noinline]] bool updateByReference(const SimData& simData, const SimInput& simInput) {
+  sink(simData.Theta_deg + N);
+  sink(simData.H_radio_ft * N);
+  if constexpr (N < NumberOfInputReaders) {
+    sink(simInput.inputs[N % 3]);
+  }
+  sink(simData.simulationTime);
+  return true;
+}
+
+template <int... N>
+bool tickCopying(std::integer_sequence<int, N...>) {
+  SimData simData = interface.getSimData();
+  sink(simData.slew_on);
+  return (updateCopying<N>() & ...);
+}
+
+template <int... N>
+bool tickByReference(std::integer_sequence<int, N...>) {
+  const SimData simData = interface.getSimData();
+  const SimInput simInput = interface.getSimInput();
+  sink(simData.slew_on);
+  return (updateByReference<N>(simData, simInput) & ...);
+}
+
+template <typename Tick>
+double measure(long ticks, Tick tick) {
+  const auto start = std::chrono::steady_clock::now();
+  bool result = true;
+  for (long i = 0; i < ticks; i++) {
+    interface.simData.simulationTime = i * 0.02;
+    result &= tick();
+  }
+  const double wallTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  sink(result);
+  return wallTime / ticks * 1e9;
+}
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  long ticks = 1000000;
+  if (argc == 3 && std::strcmp(argv[1], "--ticks") == 0) {
+    ticks = std::atol(argv[2]);
+  } else if (argc != 1) {
+    std::printf("usage: %s [--ticks N]\n", argv[0]);
+    return 1;
+  }
+
+  const auto readers = std::make_integer_sequence<int, NumberOfReaders>();
+  const double copyingTime = measure(ticks, [&]() { return tickCopying(readers); });
+  const double referenceTime = measure(ticks, [&]() { return tickByReference(readers); });
+
+  const std::size_t copyingBytes = (NumberOfReaders + 1) * sizeof(SimData) + NumberOfInputReaders * sizeof(SimInput);
+  const std::size_t referenceBytes = sizeof(SimData) + sizeof(SimInput);
+  std::printf("sizeof(SimData): %zu bytes, %d readers per tick\n", sizeof(SimData), NumberOfReaders);
+  std::printf("copy per function:  %8.1f ns/tick, %6zu bytes copied/tick\n", copyingTime, copyingBytes);
+  std::printf("snapshot per tick:  %8.1f ns/tick, %6zu bytes copied/tick\n", referenceTime, referenceBytes);
+  std::printf("speed-up: %.2fx\n", copyingTime / referenceTime);
+  return 0;
+}
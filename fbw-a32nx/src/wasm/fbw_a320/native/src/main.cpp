@@ -0,0 +1,234 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "FlightControlSystem.h"
+#include "recording/FrameLayout.h"
+
+namespace {
+struct Options {
+  int variants = 1;
+  double duration = 60;
+  double dt = 0.02;
+  int threads = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+  unsigned seed = 1;
+  std::string recordFile;
+  // write the gzip stream of the plain writer instead of the columnar file
+  bool recordGzip = false;
+};
+
+struct VariantResult {
+  double maxPitchDeg;
+  double maxRollDeg;
+  bool finite;
+};
+
+void printUsage(const char* program) {
+  std::printf("usage: %s [--variants N] [--duration SECONDS] [--dt SECONDS] [--threads N] [--seed N] [--record FILE] [--record-gzip FILE]\n", program);
+}
+
+bool parseOptions(int argc, char* argv[], Options& options) {
+  for (int i = 1; i < argc; i++) {
+    if (i + 1 >= argc) {
+      return false;
+    }
+    const char* value = argv[++i];
+    if (std::strcmp(argv[i - 1], "--variants") == 0) {
+      options.variants = std::atoi(value);
+    } else if (std::strcmp(argv[i - 1], "--duration") == 0) {
+      options.duration = std::atof(value);
+    } else if (std::strcmp(argv[i - 1], "--dt") == 0) {
+      options.dt = std::atof(value);
+    } else if (std::strcmp(argv[i - 1], "--threads") == 0) {
+      options.threads = std::atoi(value);
+    } else if (std::strcmp(argv[i - 1], "--seed") == 0) {
+      options.seed = static_cast<unsigned>(std::atoi(value));
+    } else if (std::strcmp(argv[i - 1], "--record") == 0) {
+      options.recordFile = value;
+      options.recordGzip = false;
+    } else if (std::strcmp(argv[i - 1], "--record-gzip") == 0) {
+      options.recordFile = value;
+      options.recordGzip = true;
+    } else {
+      return false;
+    }
+  }
+  return options.variants > 0 && options.duration > 0 && options.dt > 0 && options.threads > 0;
+}
+
+// Writes the frames in either of the formats of the FlightDataRecorder
+class Recorder {
+ public:
+  ~Recorder() { close(); }
+
+  // the recordings are made for the replay, so they contain the model inputs
+  static constexpr uint64_t INTERFACE_VERSION = FrameLayout::INTERFACE_VERSION_WITH_INPUTS;
+
+  bool open(const std::string& filename, bool isGzip) {
+    const auto segments = FrameLayout::getFrameSegments(INTERFACE_VERSION);
+    frameSize = FrameLayout::getFrameSize(segments);
+    if (!isGzip) {
+      return columnarWriter.open(filename, INTERFACE_VERSION, segments, 128, ColumnarFrameWriter::XorDelta);
+    }
+    gzStream = gzopen(filename.c_str(), "wb");
+    const uint64_t interfaceVersion = INTERFACE_VERSION;
+    return gzStream != nullptr && gzwrite(gzStream, &interfaceVersion, sizeof(interfaceVersion)) == sizeof(interfaceVersion);
+  }
+
+  bool isOpen() const { return gzStream != nullptr || columnarWriter.isOpen(); }
+
+  void write(const char* frame, double simulationTime) {
+    if (gzStream != nullptr) {
+      gzwrite(gzStream, frame, static_cast<unsigned>(frameSize));
+    } else {
+      columnarWriter.writeFrame(frame, simulationTime);
+      // same budget as the FlightDataRecorder, one frame per tick
+      columnarWriter.process(frameSize);
+    }
+  }
+
+  void close() {
+    if (gzStream != nullptr) {
+      gzclose(gzStream);
+      gzStream = nullptr;
+    }
+    // the remaining blocks are written over several ticks as after a file change of the FlightDataRecorder
+    columnarWriter.finish();
+    while (columnarWriter.isOpen()) {
+      columnarWriter.process(frameSize);
+    }
+  }
+
+ private:
+  ColumnarFrameWriter columnarWriter;
+  gzFile gzStream = nullptr;
+  std::size_t frameSize = 0;
+};
+
+// Runs one scenario variant: a cruise segment with randomised speed, altitude and sinusoidal stick inputs. The
+// airframe response is a crude rate model driven by the surface positions, good enough to close the loop around
+// the control laws but not a flight model. When a writer is given, every tick is recorded in the flight data recorder
+// format.
+VariantResult runVariant(const Options& options, int variant, Recorder* recorder) {
+  std::mt19937 rng(options.seed * 7919u + static_cast<unsigned>(variant));
+  std::uniform_real_distribution<double> speedDist(220, 320);
+  std::uniform_real_distribution<double> altitudeDist(5000, 35000);
+  std::uniform_real_distribution<double> amplitudeDist(0, 0.6);
+  std::uniform_real_distribution<double> periodDist(2, 20);
+
+  auto fcs = std::make_unique<FlightControlSystem>();
+  const auto segments = FrameLayout::getFrameSegments(Recorder::INTERFACE_VERSION);
+  std::vector<char> frame(recorder != nullptr ? FrameLayout::getFrameSize(segments) : 0);
+
+  AircraftState state = {};
+  state.altitudeFt = altitudeDist(rng);
+  state.radioHeightFt = 2500;
+  state.computedAirspeedKn = speedDist(rng);
+  state.trueAirspeedKn = state.computedAirspeedKn * (1 + state.altitudeFt / 50000);
+  state.mach = state.trueAirspeedKn / 661.5;
+  state.alphaDeg = 2.5;
+  state.pitchDeg = 2.5;
+  state.normalAccelG = 1;
+
+  const double pitchAmplitude = amplitudeDist(rng);
+  const double rollAmplitude = amplitudeDist(rng);
+  const double pitchPeriod = periodDist(rng);
+  const double rollPeriod = periodDist(rng);
+
+  VariantResult result = {0, 0, true};
+  const long steps = std::lround(options.duration / options.dt);
+  for (long step = 0; step < steps; step++) {
+    const double simulationTime = step * options.dt;
+
+    PilotInputs inputs = {};
+    inputs.pitchStick = pitchAmplitude * std::sin(2 * M_PI * simulationTime / pitchPeriod);
+    inputs.rollStick = rollAmplitude * std::sin(2 * M_PI * simulationTime / rollPeriod);
+
+    fcs->update(options.dt, simulationTime, state, inputs);
+    SurfaceOrders orders = fcs->getSurfaceOrders();
+
+    if (recorder != nullptr) {
+      fcs->writeRecorderFrame(frame.data(), segments, options.dt, simulationTime, state, inputs);
+      recorder->write(frame.data(), simulationTime);
+    }
+
+    state.pitchRateDegS += (-0.8 * orders.elevatorDeg - 1.5 * state.pitchRateDegS) * options.dt;
+    state.rollRateDegS += (0.6 * orders.aileronDeg - 2.0 * state.rollRateDegS) * options.dt;
+    state.pitchDeg += state.pitchRateDegS * options.dt;
+    state.rollDeg += state.rollRateDegS * options.dt;
+    state.normalAccelG = 1 + state.pitchRateDegS * state.trueAirspeedKn / 1100;
+    state.verticalSpeedFtMin = 101.3 * state.trueAirspeedKn * std::sin((state.pitchDeg - state.alphaDeg) * M_PI / 180);
+    state.altitudeFt += state.verticalSpeedFtMin / 60 * options.dt;
+
+    result.maxPitchDeg = std::max(result.maxPitchDeg, std::abs(state.pitchDeg));
+    result.maxRollDeg = std::max(result.maxRollDeg, std::abs(state.rollDeg));
+    if (!std::isfinite(state.pitchDeg) || !std::isfinite(state.rollDeg)) {
+      result.finite = false;
+      break;
+    }
+  }
+
+  return result;
+}
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  Options options;
+  if (!parseOptions(argc, argv, options)) {
+    printUsage(argv[0]);
+    return 1;
+  }
+
+  std::vector<VariantResult> results(options.variants);
+  std::atomic<int> nextVariant = 0;
+
+  // only the first variant is recorded
+  Recorder recorder;
+  if (!options.recordFile.empty() && !recorder.open(options.recordFile, options.recordGzip)) {
+    std::printf("cannot create %s\n", options.recordFile.c_str());
+    return 1;
+  }
+
+  const auto start = std::chrono::steady_clock::now();
+
+  std::vector<std::thread> workers;
+  for (int i = 0; i < std::min(options.threads, options.variants); i++) {
+    workers.emplace_back([&]() {
+      for (int variant = nextVariant++; variant < options.variants; variant = nextVariant++) {
+        results[variant] = runVariant(options, variant, variant == 0 && recorder.isOpen() ? &recorder : nullptr);
+      }
+    });
+  }
+  for (auto& worker : workers) {
+    worker.join();
+  }
+
+  const double wallTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  recorder.close();
+  const double simulatedTime = options.variants * options.duration;
+
+  int diverged = 0;
+  double maxPitchDeg = 0;
+  double maxRollDeg = 0;
+  for (const auto& result : results) {
+    diverged += result.finite ? 0 : 1;
+    maxPitchDeg = std::max(maxPitchDeg, result.maxPitchDeg);
+    maxRollDeg = std::max(maxRollDeg, result.maxRollDeg);
+  }
+
+  std::printf("variants: %d, dt: %.3f s, simulated: %.0f s, wall: %.3f s, speed-up: %.0fx (%.0fx per thread)\n", options.variants,
+              options.dt, simulatedTime, wallTime, simulatedTime / wallTime,
+              simulatedTime / wallTime / std::min(options.threads, options.variants));
+  std::printf("max |pitch|: %.1f deg, max |roll|: %.1f deg, diverged: %d\n", maxPitchDeg, maxRollDeg, diverged);
+
+  return diverged == 0 ? 0 : 2;
+}
@@ -29,6 +29,8 @@ bool FlyByWireInterface::connect() {
   flightDataRecorder.initialize();
 
   // connect to sim connect
+  simConnectInterface.setClientDataChangeSuppressionEnabled(clientDataChangeSuppressionEnabled);
+  simConnectInterface.setClientDataRefreshTicks(clientDataRefreshTicks);
   bool success =
       simConnectInterface.connect(clientDataEnabled, elacDisabled, secDisabled, facDisabled, fmgcDisabled, fcuDisabled, throttleAxis,
                                   spoilersHandler, flightControlsKeyChangeAileron, flightControlsKeyChangeElevator,
@@ -67,20 +69,21 @@ bool FlyByWireInterface::update(double sampleTime) {
   // get data & inputs
   result &= readDataAndLocalVariables(sampleTime);
 
-  // get sim data
-  SimData simData = simConnectInterface.getSimData();
+  // take one snapshot of the sim data and inputs per tick, every update function reads it by reference
+  const SimData simData = simConnectInterface.getSimData();
+  const SimInput simInput = simConnectInterface.getSimInput();
 
   // update performance monitoring
-  result &= updatePerformanceMonitoring(sampleTime);
+  result &= updatePerformanceMonitoring(sampleTime, simData);
 
   // handle simulation rate reduction
-  result &= handleSimulationRate(sampleTime);
+  result &= handleSimulationRate(sampleTime, simData);
 
   // update radio receivers
-  result &= updateRadioReceiver(sampleTime);
+  result &= updateRadioReceiver(sampleTime, simData);
 
   // handle initialization
-  result &= handleFcuInitialization(calculatedSampleTime);
+  result &= handleFcuInitialization(calculatedSampleTime, simData);
 
   // do not process laws in pause or slew
   if (simData.slew_on) {
@@ -91,10 +94,10 @@ bool FlyByWireInterface::update(double sampleTime) {
   }
 
   // update altimeter setting
-  result &= updateAltimeterSetting(calculatedSampleTime);
+  result &= updateAltimeterSetting(calculatedSampleTime, simData);
 
   // update fly-by-wire
-  result &= updateFlyByWire(calculatedSampleTime);
+  result &= updateFlyByWire(calculatedSampleTime, simInput);
 
   for (int i = 0; i < 2; i++) {
     result &= updateRa(i);
@@ -113,7 +116,7 @@ bool FlyByWireInterface::update(double sampleTime) {
   }
 
   for (int i = 0; i < 2; i++) {
-    result &= updateIls(i);
+    result &= updateIls(i, simData);
   }
 
   for (int i = 0; i < 3; i++) {
@@ -122,26 +125,26 @@ bool FlyByWireInterface::update(double sampleTime) {
 
   result &= updateTcas();
 
-  result &= updateFcu(calculatedSampleTime);
+  result &= updateFcu(calculatedSampleTime, simData);
 
-  result &= updateFcuShim();
+  result &= updateFcuShim(simData);
 
   for (int i = 0; i < 2; i++) {
-    result &= updateFmgc(calculatedSampleTime, i);
+    result &= updateFmgc(calculatedSampleTime, i, simData);
   }
 
-  result &= updateFmgcShim(calculatedSampleTime);
+  result &= updateFmgcShim(calculatedSampleTime, simData);
 
   for (int i = 0; i < 2; i++) {
-    result &= updateElac(calculatedSampleTime, i);
+    result &= updateElac(calculatedSampleTime, i, simData, simInput);
   }
 
   for (int i = 0; i < 3; i++) {
-    result &= updateSec(calculatedSampleTime, i);
+    result &= updateSec(calculatedSampleTime, i, simData, simInput);
   }
 
   for (int i = 0; i < 2; i++) {
-    result &= updateFac(calculatedSampleTime, i);
+    result &= updateFac(calculatedSampleTime, i, simData);
   }
 
   for (int i = 0; i < 2; i++) {
@@ -149,17 +152,23 @@ bool FlyByWireInterface::update(double sampleTime) {
   }
 
   for (int i = 0; i < 2; i++) {
-    result &= updateFadec(calculatedSampleTime, i);
+    result &= updateFadec(calculatedSampleTime, i, simData);
   }
 
   result &= updateServoSolenoidStatus();
 
+  // publish the client data update counters
+  if (clientDataEnabled) {
+    idClientDataSentCount->set(simConnectInterface.getClientDataSentCount());
+    idClientDataSuppressedCount->set(simConnectInterface.getClientDataSuppressedCount());
+  }
+
   // update recording data
-  result &= updateBaseData(calculatedSampleTime);
-  result &= updateAircraftSpecificData(calculatedSampleTime);
+  result &= updateBaseData(calculatedSampleTime, simData, simInput);
+  result &= updateAircraftSpecificData(calculatedSampleTime, simData);
 
   // update spoilers
-  result &= updateSpoilers(calculatedSampleTime);
+  result &= updateSpoilers(calculatedSampleTime, simData);
 
   // do not further process when active pause is on
   if (!simConnectInterface.isSimInActivePause()) {
@@ -199,9 +208,13 @@ void FlyByWireInterface::loadConfiguration() {
   // if any model is deactivated we need to enable client data
   clientDataEnabled =
       (elacDisabled != -1 || secDisabled != -1 || facDisabled != -1 || fmgcDisabled != -1 || fcuDisabled || fadecDisabled != -1);
+  clientDataChangeSuppressionEnabled = INITypeConversion::getBoolean(iniStructure, "MODEL", "CLIENT_DATA_CHANGE_SUPPRESSION_ENABLED", false);
+  clientDataRefreshTicks = std::max(1, INITypeConversion::getInteger(iniStructure, "MODEL", "CLIENT_DATA_REFRESH_TICKS", 60));
 
   // print configuration into console
   std::cout << "WASM: MODEL     : CLIENT_DATA_ENABLED (auto)           = " << clientDataEnabled << std::endl;
+  std::cout << "WASM: MODEL     : CLIENT_DATA_CHANGE_SUPPRESSION_ENABLED = " << clientDataChangeSuppressionEnabled << std::endl;
+  std::cout << "WASM: MODEL     : CLIENT_DATA_REFRESH_TICKS            = " << clientDataRefreshTicks << std::endl;
   std::cout << "WASM: MODEL     : ELAC_DISABLED                        = " << elacDisabled << std::endl;
   std::cout << "WASM: MODEL     : SEC_DISABLED                         = " << secDisabled << std::endl;
   std::cout << "WASM: MODEL     : FAC_DISABLED                         = " << facDisabled << std::endl;
@@ -313,6 +326,10 @@ void FlyByWireInterface::setupLocalVariables() {
   // register L variable for FDR event
   idFdrEvent = std::make_unique<LocalVariable>("A32NX_DFDR_EVENT_ON");
 
+  // register L variables for the client data update counters
+  idClientDataSentCount = std::make_unique<LocalVariable>("A32NX_CLIENT_DATA_SENT_COUNT");
+  idClientDataSuppressedCount = std::make_unique<LocalVariable>("A32NX_CLIENT_DATA_SUPPRESSED_COUNT");
+
   // register L variables for the sidestick
   idSideStickPositionX = std::make_unique<LocalVariable>("A32NX_SIDESTICK_POSITION_X");
   idSideStickPositionY = std::make_unique<LocalVariable>("A32NX_SIDESTICK_POSITION_Y");
@@ -833,15 +850,12 @@ void FlyByWireInterface::setupLocalVariables() {
   }
 }
 
-bool FlyByWireInterface::handleFcuInitialization(double sampleTime) {
+bool FlyByWireInterface::handleFcuInitialization(double sampleTime, const SimData& simData) {
   // init should be run only once and only when is ready is signaled
   if (wasFcuInitialized || !idIsReady->get()) {
     return true;
   }
 
-  // get sim data
-  auto simData = simConnectInterface.getSimData();
-
   // remember simulation of ready signal
   if (simulationTimeReady == 0.0) {
     simulationTimeReady = simData.simulationTime;
@@ -896,7 +910,7 @@ bool FlyByWireInterface::readDataAndLocalVariables(double sampleTime) {
   }
 
   // get sim data
-  SimData simData = simConnectInterface.getSimData();
+  const SimData& simData = simConnectInterface.getSimData();
 
   // update all local variables
   LocalVariable::readAll();
@@ -938,7 +952,7 @@ bool FlyByWireInterface::readDataAndLocalVariables(double sampleTime) {
   return true;
 }
 
-bool FlyByWireInterface::updatePerformanceMonitoring(double sampleTime) {
+bool FlyByWireInterface::updatePerformanceMonitoring(double sampleTime, const SimData& simData) {
   // check calculated delta time for performance issues (to also take sim rate into account)
   if (calculatedSampleTime > MAX_ACCEPTABLE_SAMPLE_TIME && lowPerformanceTimer < LOW_PERFORMANCE_TIMER_THRESHOLD) {
     // performance is low -> increase counter
@@ -953,7 +967,7 @@ bool FlyByWireInterface::updatePerformanceMonitoring(double sampleTime) {
     if (idPerformanceWarningActive->get() <= 0) {
       idPerformanceWarningActive->set(1);
       std::cout << "WASM: WARNING Performance issues detected, at least stable ";
-      std::cout << std::round(simConnectInterface.getSimData().simulation_rate / MAX_ACCEPTABLE_SAMPLE_TIME);
+      std::cout << std::round(simData.simulation_rate / MAX_ACCEPTABLE_SAMPLE_TIME);
       std::cout << " fps or more are needed at this simrate!";
       std::cout << std::endl;
     }
@@ -965,10 +979,7 @@ bool FlyByWireInterface::updatePerformanceMonitoring(double sampleTime) {
   return true;
 }
 
-bool FlyByWireInterface::handleSimulationRate(double sampleTime) {
-  // get sim data
-  auto simData = simConnectInterface.getSimData();
-
+bool FlyByWireInterface::handleSimulationRate(double sampleTime, const SimData& simData) {
   // check if target simulation rate was modified and there is a mismatch
   if (targetSimulationRateModified && simData.simulation_rate != targetSimulationRate) {
     // wait until target simulation rate is reached
@@ -1007,8 +1018,8 @@ bool FlyByWireInterface::handleSimulationRate(double sampleTime) {
                            Arinc429Utils::bitFromValueOr(fmgcsBusOutputs[1].fmgc_a_bus.discrete_word_4, 29, false);
 
   // check if simulation rate should be reduced
-  if (idPerformanceWarningActive->get() == 1 || abs(simConnectInterface.getSimData().Phi_deg) > 33 ||
-      simConnectInterface.getSimData().Theta_deg < -20 || simConnectInterface.getSimData().Theta_deg > 10 || elac1ProtActive ||
+  if (idPerformanceWarningActive->get() == 1 || abs(simData.Phi_deg) > 33 ||
+      simData.Theta_deg < -20 || simData.Theta_deg > 10 || elac1ProtActive ||
       elac2ProtActive || apSpeedProtActive) {
     // set target simulation rate
     targetSimulationRateModified = true;
@@ -1027,10 +1038,7 @@ bool FlyByWireInterface::handleSimulationRate(double sampleTime) {
   return true;
 }
 
-bool FlyByWireInterface::updateRadioReceiver(double sampleTime) {
-  // get sim data
-  auto simData = simConnectInterface.getSimData();
-
+bool FlyByWireInterface::updateRadioReceiver(double sampleTime, const SimData& simData) {
   // get localizer data
   auto localizer = radioReceiver.calculateLocalizerDeviation(
       simData.nav_loc_valid, simData.nav_loc_deg, simData.nav_loc_magvar_deg, simData.nav_loc_pos.Latitude, simData.nav_loc_pos.Longitude,
@@ -1060,9 +1068,7 @@ bool FlyByWireInterface::updateRadioReceiver(double sampleTime) {
   return true;
 }
 
-bool FlyByWireInterface::updateBaseData(double sampleTime) {
-  auto simData = simConnectInterface.getSimData();
-  auto simInputs = simConnectInterface.getSimInput();
+bool FlyByWireInterface::updateBaseData(double sampleTime, const SimData& simData, const SimInput& simInput) {
 
   // constants
   double g = 9.81;
@@ -1126,9 +1132,9 @@ bool FlyByWireInterface::updateBaseData(double sampleTime) {
   baseData.atmosphere_ambient_pressure_mbar = simData.ambient_pressure_mbar;
   baseData.atmosphere_ambient_wind_velocity_kn = simData.ambient_wind_velocity_kn;
   baseData.atmosphere_ambient_wind_direction_deg = simData.ambient_wind_direction_deg;
-  baseData.simulation_input_sidestick_pitch_pos = simInputs.inputs[0];
-  baseData.simulation_input_sidestick_roll_pos = simInputs.inputs[1];
-  baseData.simulation_input_rudder_pos = simInputs.inputs[2];
+  baseData.simulation_input_sidestick_pitch_pos = simInput.inputs[0];
+  baseData.simulation_input_sidestick_roll_pos = simInput.inputs[1];
+  baseData.simulation_input_rudder_pos = simInput.inputs[2];
   baseData.simulation_input_brake_pedal_left_pos = simData.brakeLeftPosition;
   baseData.simulation_input_brake_pedal_right_pos = simData.brakeRightPosition;
   baseData.simulation_input_flaps_handle_pos = idFlapsHandlePercent->get();
@@ -1146,8 +1152,7 @@ bool FlyByWireInterface::updateBaseData(double sampleTime) {
   return true;
 }
 
-bool FlyByWireInterface::updateAircraftSpecificData(double sampleTime) {
-  auto simData = simConnectInterface.getSimData();
+bool FlyByWireInterface::updateAircraftSpecificData(double sampleTime, const SimData& simData) {
 
   aircraftSpecificData.simulation_input_throttle_lever_1_pos = simData.throttle_lever_1_pos;
   aircraftSpecificData.simulation_input_throttle_lever_2_pos = simData.throttle_lever_1_pos;
@@ -1233,8 +1238,7 @@ bool FlyByWireInterface::updateFadec(int fadecIndex) {
   return true;
 }
 
-bool FlyByWireInterface::updateIls(int ilsIndex) {
-  SimData simData = simConnectInterface.getSimData();
+bool FlyByWireInterface::updateIls(int ilsIndex, const SimData& simData) {
 
   bool nav_loc_valid;
   double nav_loc_error_deg;
@@ -1355,15 +1359,13 @@ bool FlyByWireInterface::updateTcas() {
   return true;
 }
 
-bool FlyByWireInterface::updateElac(double sampleTime, int elacIndex) {
+bool FlyByWireInterface::updateElac(double sampleTime, int elacIndex, const SimData& simData, const SimInput& simInput) {
   // do not further process when active pause is on
   if (simConnectInterface.isSimInActivePause()) {
     return true;
   }
 
   const int oppElacIndex = elacIndex == 0 ? 1 : 0;
-  SimData simData = simConnectInterface.getSimData();
-  SimInput simInput = simConnectInterface.getSimInput();
 
   elacs[elacIndex].modelInputs.in.time.dt = sampleTime;
   elacs[elacIndex].modelInputs.in.time.simulation_time = simData.simulationTime;
@@ -1497,15 +1499,13 @@ bool FlyByWireInterface::updateElac(double sampleTime, int elacIndex) {
   return true;
 }
 
-bool FlyByWireInterface::updateSec(double sampleTime, int secIndex) {
+bool FlyByWireInterface::updateSec(double sampleTime, int secIndex, const SimData& simData, const SimInput& simInput) {
   // do not further process when active pause is on
   if (simConnectInterface.isSimInActivePause()) {
     return true;
   }
 
   const int oppSecIndex = secIndex == 0 ? 1 : 0;
-  SimData simData = simConnectInterface.getSimData();
-  SimInput simInput = simConnectInterface.getSimInput();
 
   secs[secIndex].modelInputs.in.time.dt = sampleTime;
   secs[secIndex].modelInputs.in.time.simulation_time = simData.simulationTime;
@@ -1724,10 +1724,9 @@ bool FlyByWireInterface::updateFcdc(double sampleTime, int fcdcIndex) {
   return true;
 }
 
-bool FlyByWireInterface::updateFmgc(double sampleTime, int fmgcIndex) {
+bool FlyByWireInterface::updateFmgc(double sampleTime, int fmgcIndex, const SimData& simData) {
   const int oppFmgcIndex = fmgcIndex == 0 ? 1 : 0;
-  SimData simData = simConnectInterface.getSimData();
-  SimInputAutopilot simInputAutopilot = simConnectInterface.getSimInputAutopilot();
+  const SimInputAutopilot& simInputAutopilot = simConnectInterface.getSimInputAutopilot();
 
   fmgcs[fmgcIndex].modelInputs.in.time.dt = sampleTime;
   fmgcs[fmgcIndex].modelInputs.in.time.simulation_time = simData.simulationTime;
@@ -1900,7 +1899,7 @@ bool FlyByWireInterface::updateFmgc(double sampleTime, int fmgcIndex) {
 }
 
 // Update the AP/FMGC shim Lvars. They are always driven by the master FMGC.
-bool FlyByWireInterface::updateFmgcShim(double sampleTime) {
+bool FlyByWireInterface::updateFmgcShim(double sampleTime, const SimData& simData) {
   bool fmgc1Priority =
       fmgcsDiscreteOutputs[0].ap_own_engaged || (!fmgcsDiscreteOutputs[1].ap_own_engaged && fmgcsDiscreteOutputs[0].fd_own_engaged) ||
       (!fmgcsDiscreteOutputs[1].ap_own_engaged && !fmgcsDiscreteOutputs[1].fd_own_engaged && fmgcsDiscreteOutputs[0].athr_own_engaged) ||
@@ -2034,8 +2033,6 @@ bool FlyByWireInterface::updateFmgcShim(double sampleTime) {
   }
 
   // Autoland warning
-  SimData simData = simConnectInterface.getSimData();
-
   // if at least one AP engaged and LAND or FLARE mode -> latch
   if (simData.H_radio_ft < 200 && (fmgcsDiscreteOutputs[0].ap_own_engaged || fmgcsDiscreteOutputs[1].ap_own_engaged) &&
       (verticalMode == 32 || verticalMode == 33)) {
@@ -2091,9 +2088,8 @@ bool FlyByWireInterface::updateFmgcShim(double sampleTime) {
   return true;
 }
 
-bool FlyByWireInterface::updateFcu(double sampleTime) {
-  SimData simData = simConnectInterface.getSimData();
-  SimInputAutopilot simInputAutopilot = simConnectInterface.getSimInputAutopilot();
+bool FlyByWireInterface::updateFcu(double sampleTime, const SimData& simData) {
+  const SimInputAutopilot& simInputAutopilot = simConnectInterface.getSimInputAutopilot();
 
   fcu.modelInputs.in.time.dt = sampleTime;
   fcu.modelInputs.in.time.simulation_time = simData.simulationTime;
@@ -2270,7 +2266,7 @@ bool FlyByWireInterface::updateFcu(double sampleTime) {
   return true;
 }
 
-bool FlyByWireInterface::updateFcuShim() {
+bool FlyByWireInterface::updateFcuShim(const SimData& simData) {
   // update the FCU Shim EFIS Lvars
   auto getNavaidMode = [](bool adfBit, bool vorBit) {
     if (adfBit) {
@@ -2329,8 +2325,6 @@ bool FlyByWireInterface::updateFcuShim() {
     }
   };
 
-  SimData simData = simConnectInterface.getSimData();
-
   idFcuShimLeftNavaid1Mode->set(getNavaidMode(Arinc429Utils::bitFromValueOr(fcuBusOutputs.eis_discrete_word_2_left, 24, false),
                                               Arinc429Utils::bitFromValueOr(fcuBusOutputs.eis_discrete_word_2_left, 26, true)));
   idFcuShimLeftNavaid2Mode->set(getNavaidMode(Arinc429Utils::bitFromValueOr(fcuBusOutputs.eis_discrete_word_2_left, 25, true),
@@ -2392,15 +2386,14 @@ bool FlyByWireInterface::updateFcuShim() {
   return true;
 }
 
-bool FlyByWireInterface::updateFac(double sampleTime, int facIndex) {
+bool FlyByWireInterface::updateFac(double sampleTime, int facIndex, const SimData& simData) {
   // do not further process when active pause is on
   if (simConnectInterface.isSimInActivePause()) {
     return true;
   }
 
   const int oppFacIndex = facIndex == 0 ? 1 : 0;
-  SimData simData = simConnectInterface.getSimData();
-  SimInputRudderTrim trimInput = simConnectInterface.getSimInputRudderTrim();
+  const SimInputRudderTrim& trimInput = simConnectInterface.getSimInputRudderTrim();
 
   facs[facIndex].modelInputs.in.time.dt = sampleTime;
   facs[facIndex].modelInputs.in.time.simulation_time = simData.simulationTime;
@@ -2581,10 +2574,8 @@ bool FlyByWireInterface::updateServoSolenoidStatus() {
   return true;
 }
 
-bool FlyByWireInterface::updateFlyByWire(double sampleTime) {
+bool FlyByWireInterface::updateFlyByWire(double sampleTime, const SimInput& simInput) {
   // get data from interface ------------------------------------------------------------------------------------------
-  SimData simData = simConnectInterface.getSimData();
-  SimInput simInput = simConnectInterface.getSimInput();
 
   // write sidestick position
   idSideStickPositionX->set(-1.0 * simInput.inputs[1]);
@@ -2600,9 +2591,8 @@ bool FlyByWireInterface::updateFlyByWire(double sampleTime) {
   return true;
 }
 
-bool FlyByWireInterface::updateFadec(double sampleTime, int fadecIndex) {
+bool FlyByWireInterface::updateFadec(double sampleTime, int fadecIndex, const SimData& simData) {
   // get sim data
-  SimData simData = simConnectInterface.getSimData();
 
   // set ground / flight for throttle handling
   if (idLgciuLeftMainGearCompressed[0]->get() || idLgciuLeftMainGearCompressed[1]->get() || idLgciuRightMainGearCompressed[0]->get() ||
@@ -2706,10 +2696,7 @@ bool FlyByWireInterface::updateFadec(double sampleTime, int fadecIndex) {
   return true;
 }
 
-bool FlyByWireInterface::updateSpoilers(double sampleTime) {
-  // get sim data
-  auto simData = simConnectInterface.getSimData();
-
+bool FlyByWireInterface::updateSpoilers(double sampleTime, const SimData& simData) {
   // initialize position if needed
   if (!spoilersHandler->getIsInitialized()) {
     spoilersHandler->setInitialPosition(idSpoilersArmed->get(), simData.spoilers_handle_position);
@@ -2723,10 +2710,7 @@ bool FlyByWireInterface::updateSpoilers(double sampleTime) {
   return true;
 }
 
-bool FlyByWireInterface::updateAltimeterSetting(double sampleTime) {
-  // get sim data
-  auto simData = simConnectInterface.getSimData();
-
+bool FlyByWireInterface::updateAltimeterSetting(double sampleTime, const SimData& simData) {
   // determine if change is needed
   if (simData.kohlsmanSettingStd_3 == 0) {
     SimOutputAltimeter out = {true};
@@ -97,6 +97,8 @@ class FlyByWireInterface {
   bool enableRudder2AxisMode = false;
 
   bool clientDataEnabled = false;
+  bool clientDataChangeSuppressionEnabled = false;
+  int clientDataRefreshTicks = 60;
 
   bool last_fd1_active = false;
   bool last_fd2_active = false;
@@ -194,6 +196,9 @@ class FlyByWireInterface {
 
   std::unique_ptr<LocalVariable> idFdrEvent;
 
+  std::unique_ptr<LocalVariable> idClientDataSentCount;
+  std::unique_ptr<LocalVariable> idClientDataSuppressedCount;
+
   std::unique_ptr<LocalVariable> idSideStickPositionX;
   std::unique_ptr<LocalVariable> idSideStickPositionY;
   std::unique_ptr<LocalVariable> idRudderPedalPosition;
@@ -665,20 +670,20 @@ class FlyByWireInterface {
   void loadConfiguration();
   void setupLocalVariables();
 
-  bool handleFcuInitialization(double sampleTime);
+  bool handleFcuInitialization(double sampleTime, const SimData& simData);
 
   bool readDataAndLocalVariables(double sampleTime);
 
-  bool updatePerformanceMonitoring(double sampleTime);
-  bool handleSimulationRate(double sampleTime);
+  bool updatePerformanceMonitoring(double sampleTime, const SimData& simData);
+  bool handleSimulationRate(double sampleTime, const SimData& simData);
 
-  bool updateRadioReceiver(double sampleTime);
+  bool updateRadioReceiver(double sampleTime, const SimData& simData);
 
-  bool updateBaseData(double sampleTime);
-  bool updateAircraftSpecificData(double sampleTime);
+  bool updateBaseData(double sampleTime, const SimData& simData, const SimInput& simInput);
+  bool updateAircraftSpecificData(double sampleTime, const SimData& simData);
 
-  bool updateFlyByWire(double sampleTime);
-  bool updateFadec(double sampleTime, int fadecIndex);
+  bool updateFlyByWire(double sampleTime, const SimInput& simInput);
+  bool updateFadec(double sampleTime, int fadecIndex, const SimData& simData);
 
   bool updateRa(int raIndex);
 
@@ -688,31 +693,31 @@ class FlyByWireInterface {
 
   bool updateFadec(int fadecIndex);
 
-  bool updateIls(int ilsIndex);
+  bool updateIls(int ilsIndex, const SimData& simData);
 
   bool updateAdirs(int adirsIndex);
 
   bool updateTcas();
 
-  bool updateElac(double sampleTime, int elacIndex);
+  bool updateElac(double sampleTime, int elacIndex, const SimData& simData, const SimInput& simInput);
 
-  bool updateSec(double sampleTime, int secIndex);
+  bool updateSec(double sampleTime, int secIndex, const SimData& simData, const SimInput& simInput);
 
   bool updateFcdc(double sampleTime, int fcdcIndex);
 
-  bool updateFmgc(double sampleTime, int fmgcIndex);
+  bool updateFmgc(double sampleTime, int fmgcIndex, const SimData& simData);
 
-  bool updateFmgcShim(double sampleTime);
+  bool updateFmgcShim(double sampleTime, const SimData& simData);
 
-  bool updateFcu(double sampleTime);
+  bool updateFcu(double sampleTime, const SimData& simData);
 
-  bool updateFcuShim();
+  bool updateFcuShim(const SimData& simData);
 
-  bool updateFac(double sampleTime, int facIndex);
+  bool updateFac(double sampleTime, int facIndex, const SimData& simData);
 
   bool updateServoSolenoidStatus();
 
-  bool updateSpoilers(double sampleTime);
+  bool updateSpoilers(double sampleTime, const SimData& simData);
 
-  bool updateAltimeterSetting(double sampleTime);
+  bool updateAltimeterSetting(double sampleTime, const SimData& simData);
 };
@@ -159,3 +159,7 @@ base_elac_analog_outputs Elac::getAnalogOutputs() {
 
   return output;
 }
+
+const elac_outputs& Elac::getDebugOutputs() const {
+  return elacComputer.getExternalOutputs().out;
+}
@@ -23,6 +23,8 @@ class Elac {
 
   base_elac_analog_outputs getAnalogOutputs();
 
+  const elac_outputs& getDebugOutputs() const;
+
   ElacComputer::ExternalInputs_ElacComputer_T modelInputs = {};
 
  private:
@@ -40,22 +42,22 @@ class Elac {
 
   // Model
   ElacComputer elacComputer;
-  elac_outputs modelOutputs;
+  elac_outputs modelOutputs = {};
 
   // Computer Self-monitoring vars
-  bool monitoringHealthy;
+  bool monitoringHealthy = false;
 
-  bool prevEngageButtonWasPressed;
+  bool prevEngageButtonWasPressed = false;
 
   // Power Supply monitoring
-  double powerSupplyOutageTime;
+  double powerSupplyOutageTime = 0;
 
-  bool powerSupplyFault;
+  bool powerSupplyFault = false;
 
   // Selftest vars
-  double selfTestTimer;
+  double selfTestTimer = 0;
 
-  bool selfTestComplete;
+  bool selfTestComplete = false;
 
   // Constants
   const bool isUnit1;
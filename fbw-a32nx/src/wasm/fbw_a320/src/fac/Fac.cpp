@@ -153,3 +153,7 @@ base_fac_analog_outputs Fac::getAnalogOutputs() {
 
   return output;
 }
+
+const fac_outputs& Fac::getDebugOutputs() const {
+  return facComputer.getExternalOutputs().out;
+}
@@ -20,6 +20,8 @@ class Fac {
 
   base_fac_analog_outputs getAnalogOutputs();
 
+  const fac_outputs& getDebugOutputs() const;
+
   FacComputer::ExternalInputs_FacComputer_T modelInputs = {};
 
  private:
@@ -35,26 +37,26 @@ class Fac {
 
   // Model
   FacComputer facComputer;
-  fac_outputs modelOutputs;
+  fac_outputs modelOutputs = {};
 
   // Computer Self-monitoring vars
-  bool facHealthy;
+  bool facHealthy = false;
 
   SRFlipFlop facHealthyFlipFlop = SRFlipFlop(false);
 
   PulseNode pushbuttonPulse = PulseNode(true);
 
   // Power Supply monitoring
-  double powerSupplyOutageTime;
+  double powerSupplyOutageTime = 0;
 
-  bool longPowerFailure;
+  bool longPowerFailure = false;
 
-  bool shortPowerFailure;
+  bool shortPowerFailure = false;
 
   // Selftest vars
-  double selfTestTimer;
+  double selfTestTimer = 0;
 
-  bool selfTestComplete;
+  bool selfTestComplete = false;
 
   // Constants
   const bool isUnit1;
@@ -15,3 +15,40 @@ enum class Failures {
   Fcdc1 = 27005,
   Fcdc2 = 27006,
 };
+
+constexpr int NUMBER_OF_FAILURES = 13;
+
+// Position of the failure in the failure state and bit in the bulk failure words, -1 for unknown identifiers.
+// IMPORTANT: positions must not change, they are part of the A32NX_FAILURE_BULK_* interface and match A320BulkFailures
+//            in fbw-a32nx/src/systems/failures/src/a320.ts
+constexpr int getFailureIndex(Failures failure) {
+  switch (failure) {
+    case Failures::Fac1:
+      return 0;
+    case Failures::Fac2:
+      return 1;
+    case Failures::Fmgc1:
+      return 2;
+    case Failures::Fmgc2:
+      return 3;
+    case Failures::Fcu1:
+      return 4;
+    case Failures::Fcu2:
+      return 5;
+    case Failures::Elac1:
+      return 6;
+    case Failures::Elac2:
+      return 7;
+    case Failures::Sec1:
+      return 8;
+    case Failures::Sec2:
+      return 9;
+    case Failures::Sec3:
+      return 10;
+    case Failures::Fcdc1:
+      return 11;
+    case Failures::Fcdc2:
+      return 12;
+  }
+  return -1;
+}
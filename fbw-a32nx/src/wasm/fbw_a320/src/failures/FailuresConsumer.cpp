@@ -1,35 +1,25 @@
 #include "FailuresConsumer.h"
-#include <algorithm>
-#include <utility>
-
-FailuresConsumer::FailuresConsumer() {
-  activeFailures.emplace(std::make_pair<Failures, bool>(Failures::Elac1, false));
-  activeFailures.emplace(std::make_pair<Failures, bool>(Failures::Elac2, false));
-  activeFailures.emplace(std::make_pair<Failures, bool>(Failures::Sec1, false));
-  activeFailures.emplace(std::make_pair<Failures, bool>(Failures::Sec2, false));
-  activeFailures.emplace(std::make_pair<Failures, bool>(Failures::Sec3, false));
-  activeFailures.emplace(std::make_pair<Failures, bool>(Failures::Fac1, false));
-  activeFailures.emplace(std::make_pair<Failures, bool>(Failures::Fac2, false));
-  activeFailures.emplace(std::make_pair<Failures, bool>(Failures::Fcdc1, false));
-  activeFailures.emplace(std::make_pair<Failures, bool>(Failures::Fcdc2, false));
-  activeFailures.emplace(std::make_pair<Failures, bool>(Failures::Fcu1, false));
-  activeFailures.emplace(std::make_pair<Failures, bool>(Failures::Fcu2, false));
-  activeFailures.emplace(std::make_pair<Failures, bool>(Failures::Fmgc1, false));
-  activeFailures.emplace(std::make_pair<Failures, bool>(Failures::Fmgc2, false));
-}
+#include <cstdint>
+#include <limits>
 
 void FailuresConsumer::initialize() {
   activateLvar = std::make_unique<LocalVariable>("A32NX_FAILURE_ACTIVATE");
   deactivateLvar = std::make_unique<LocalVariable>("A32NX_FAILURE_DEACTIVATE");
+  bulkActivateLvar = std::make_unique<LocalVariable>("A32NX_FAILURE_BULK_ACTIVATE");
+  bulkDeactivateLvar = std::make_unique<LocalVariable>("A32NX_FAILURE_BULK_DEACTIVATE");
+  bulkActivatedLvar = std::make_unique<LocalVariable>("A32NX_FAILURE_BULK_ACTIVATED");
+  bulkDeactivatedLvar = std::make_unique<LocalVariable>("A32NX_FAILURE_BULK_DEACTIVATED");
 }
 
 void FailuresConsumer::update() {
   updateActivate();
   updateDeactivate();
+  updateBulk();
 }
 
 bool FailuresConsumer::isActive(Failures failure) {
-  return (*activeFailures.find(failure)).second;
+  int index = getFailureIndex(failure);
+  return index >= 0 && activeFailures.test(index);
 }
 
 void FailuresConsumer::updateActivate() {
@@ -46,19 +36,65 @@ void FailuresConsumer::updateDeactivate() {
   }
 }
 
+void FailuresConsumer::updateBulk() {
+  double activateValue = bulkActivateLvar->get();
+  double deactivateValue = bulkDeactivateLvar->get();
+  if (activateValue != 0 || deactivateValue != 0) {
+    // bits beyond the known failures are ignored
+    uint32_t knownFailures = (uint32_t{1} << NUMBER_OF_FAILURES) - 1;
+    uint32_t activate = toBulkWord(activateValue) & knownFailures;
+    uint32_t deactivate = toBulkWord(deactivateValue) & knownFailures & ~activate;
+
+    activeFailures &= ~std::bitset<NUMBER_OF_FAILURES>(deactivate);
+    activeFailures |= std::bitset<NUMBER_OF_FAILURES>(activate);
+
+    // the latest change of a failure wins if the orchestrator did not take over the previous acknowledgement yet
+    pendingBulkActivated = (pendingBulkActivated & ~deactivate) | activate;
+    pendingBulkDeactivated = (pendingBulkDeactivated & ~activate) | deactivate;
+
+    if (activateValue != 0) {
+      bulkActivateLvar->set(0);
+    }
+    if (deactivateValue != 0) {
+      bulkDeactivateLvar->set(0);
+    }
+  }
+
+  acknowledgeBulk();
+}
+
+void FailuresConsumer::acknowledgeBulk() {
+  if (pendingBulkActivated == 0 && pendingBulkDeactivated == 0) {
+    return;
+  }
+  // the orchestrator resets both once it took over the changes
+  if (bulkActivatedLvar->get() != 0 || bulkDeactivatedLvar->get() != 0) {
+    return;
+  }
+
+  bulkActivatedLvar->set(pendingBulkActivated);
+  bulkDeactivatedLvar->set(pendingBulkDeactivated);
+  pendingBulkActivated = 0;
+  pendingBulkDeactivated = 0;
+}
+
+uint32_t FailuresConsumer::toBulkWord(double value) {
+  // the cast is only defined for values within the range of the word
+  if (!(value >= 0 && value <= std::numeric_limits<uint32_t>::max())) {
+    return 0;
+  }
+  return static_cast<uint32_t>(value);
+}
+
 bool FailuresConsumer::setIfFound(double identifier, bool value) {
-  auto pair = activeFailures.find(static_cast<Failures>(identifier));
-  if (pair == activeFailures.end()) {
+  int index = getFailureIndex(static_cast<Failures>(identifier));
+  if (index < 0) {
     return false;
-  } else {
-    (*pair).second = value;
-    return true;
   }
+  activeFailures.set(index, value);
+  return true;
 }
 
 bool FailuresConsumer::isAnyActive() {
-  if (std::any_of(activeFailures.begin(), activeFailures.end(), [](auto pair) { return pair.second; })) {
-    return true;
-  }
-  return false;
+  return activeFailures.any();
 }
@@ -1,14 +1,21 @@
 #pragma once
 
-#include <map>
+#include <bitset>
+#include <cstdint>
 #include <memory>
 #include "../LocalVariable.h"
 #include "FailureList.h"
 
+// Applies the failures requested through local variables:
+//  - A32NX_FAILURE_ACTIVATE / A32NX_FAILURE_DEACTIVATE take one failure identifier, they are reset to 0 once applied
+//  - A32NX_FAILURE_BULK_ACTIVATE / A32NX_FAILURE_BULK_DEACTIVATE take a bit mask over getFailureIndex(), all changes of
+//    both masks are applied in the same tick and the masks are reset to 0 afterwards. A failure in both masks is
+//    activated. Values that are not a valid 32 bit mask are ignored.
+//  - A32NX_FAILURE_BULK_ACTIVATED / A32NX_FAILURE_BULK_DEACTIVATED acknowledge the applied masks to the failures
+//    orchestrator, which sends the changed failures to all other consumers and resets both to 0. Changes applied
+//    before the orchestrator took over the previous acknowledgement are accumulated.
 class FailuresConsumer {
  public:
-  FailuresConsumer();
-
   void update();
 
   bool isActive(Failures failure);
@@ -18,15 +25,35 @@ class FailuresConsumer {
   void initialize();
 
  private:
-  std::map<Failures, bool> activeFailures;
+  static_assert(NUMBER_OF_FAILURES <= 32, "the bulk failure words hold 32 failures");
+
+  std::bitset<NUMBER_OF_FAILURES> activeFailures;
 
   void updateActivate();
 
   void updateDeactivate();
 
+  void updateBulk();
+
+  void acknowledgeBulk();
+
+  static uint32_t toBulkWord(double value);
+
   bool setIfFound(double identifier, bool value);
 
   std::unique_ptr<LocalVariable> activateLvar;
 
   std::unique_ptr<LocalVariable> deactivateLvar;
+
+  std::unique_ptr<LocalVariable> bulkActivateLvar;
+
+  std::unique_ptr<LocalVariable> bulkDeactivateLvar;
+
+  std::unique_ptr<LocalVariable> bulkActivatedLvar;
+
+  std::unique_ptr<LocalVariable> bulkDeactivatedLvar;
+
+  uint32_t pendingBulkActivated = 0;
+
+  uint32_t pendingBulkDeactivated = 0;
 };
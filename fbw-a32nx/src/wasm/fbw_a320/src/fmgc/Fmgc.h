@@ -30,22 +30,22 @@ class Fmgc {
 
   // Model
   FmgcComputer fmgcComputer;
-  fmgc_outputs modelOutputs;
+  fmgc_outputs modelOutputs = {};
 
   // Computer Self-monitoring vars
-  bool monitoringHealthy;
+  bool monitoringHealthy = false;
 
-  bool cpuStopped;
+  bool cpuStopped = false;
 
   // Power Supply monitoring
-  double powerSupplyOutageTime;
+  double powerSupplyOutageTime = 0;
 
-  bool powerSupplyFault;
+  bool powerSupplyFault = false;
 
   // Selftest vars
-  double selfTestTimer;
+  double selfTestTimer = 0;
 
-  bool selfTestComplete;
+  bool selfTestComplete = false;
 
   // Constants
   const bool isUnit1;
@@ -1,5 +1,6 @@
 #include "SimConnectInterface.h"
 #include <cmath>
+#include <cstring>
 #include <iostream>
 #include <map>
 #include <vector>
@@ -99,12 +100,18 @@ void SimConnectInterface::disconnect() {
     SimConnect_UnsubscribeFromSystemEvent(hSimConnect, Events::SYSTEM_EVENT_PAUSE);
     // info message
     std::cout << "WASM: Disconnecting..." << std::endl;
+    if (clientDataEnabled) {
+      std::cout << "WASM: Client data updates sent: " << clientDataSentCount << ", suppressed: " << clientDataSuppressedCount
+                << std::endl;
+    }
     // close connection
     SimConnect_Close(hSimConnect);
     // set flag
     isConnected = false;
     // reset handle
     hSimConnect = 0;
+    // a new connection starts without any client data
+    sentClientData.clear();
     // info message
     std::cout << "WASM: Disconnected" << std::endl;
   }
@@ -1034,6 +1041,9 @@ bool SimConnectInterface::readData() {
     return false;
   }
 
+  // client data sent from here on belongs to the next tick
+  clientDataTick++;
+
   // get next dispatch message(s) and process them
   DWORD cbData;
   SIMCONNECT_RECV* pData;
@@ -1385,6 +1395,22 @@ bool SimConnectInterface::setClientDataFadec(base_ecu_bus& output, int fadecInde
   return sendClientData(ClientData::FADEC_1_BUS + fadecIndex, sizeof(output), &output);
 }
 
+void SimConnectInterface::setClientDataChangeSuppressionEnabled(bool enabled) {
+  clientDataChangeSuppressionEnabled = enabled;
+}
+
+void SimConnectInterface::setClientDataRefreshTicks(uint64_t ticks) {
+  clientDataRefreshTicks = ticks;
+}
+
+uint64_t SimConnectInterface::getClientDataSentCount() {
+  return clientDataSentCount;
+}
+
+uint64_t SimConnectInterface::getClientDataSuppressedCount() {
+  return clientDataSuppressedCount;
+}
+
 void SimConnectInterface::setLoggingFlightControlsEnabled(bool enabled) {
   loggingFlightControlsEnabled = enabled;
 }
@@ -3092,6 +3118,17 @@ bool SimConnectInterface::sendClientData(SIMCONNECT_DATA_DEFINITION_ID id, DWORD
     return true;
   }
 
+  // skip the update if the content is the same as last sent, the area still holds it
+  if (id >= sentClientData.size()) {
+    sentClientData.resize(id + 1);
+  }
+  SentClientData& sent = sentClientData[id];
+  if (clientDataChangeSuppressionEnabled && sent.content.size() == size && std::memcmp(sent.content.data(), data, size) == 0 &&
+      clientDataTick - sent.tick < clientDataRefreshTicks) {
+    clientDataSuppressedCount++;
+    return true;
+  }
+
   // set output data
   HRESULT result = SimConnect_SetClientData(hSimConnect, id, id, SIMCONNECT_CLIENT_DATA_SET_FLAG_DEFAULT, 0, size, data);
 
@@ -3101,6 +3138,12 @@ bool SimConnectInterface::sendClientData(SIMCONNECT_DATA_DEFINITION_ID id, DWORD
     return false;
   }
 
+  // remember what was sent
+  const char* bytes = static_cast<const char*>(data);
+  sent.content.assign(bytes, bytes + size);
+  sent.tick = clientDataTick;
+  clientDataSentCount++;
+
   // success
   return true;
 }
@@ -2,6 +2,7 @@
 
 #include <MSFS/Legacy/gauges.h>
 #include <SimConnect.h>
+#include <cstdint>
 #include <string>
 #include <vector>
 
@@ -338,6 +339,16 @@ class SimConnectInterface {
   bool setClientDataTcas(base_tcas_bus& output);
   bool setClientDataFadec(base_ecu_bus& output, int fadecIndex);
 
+  // when enabled, client data that did not change since it was last sent is not sent again
+  void setClientDataChangeSuppressionEnabled(bool enabled);
+
+  // unchanged client data is still sent again after this number of ticks
+  void setClientDataRefreshTicks(uint64_t ticks);
+
+  // number of client data updates sent, and of updates skipped because the content did not change
+  uint64_t getClientDataSentCount();
+  uint64_t getClientDataSuppressedCount();
+
   void setLoggingFlightControlsEnabled(bool enabled);
   bool getLoggingFlightControlsEnabled();
 
@@ -460,6 +471,20 @@ class SimConnectInterface {
 
   athr_output clientDataFadecOutputs = {};
 
+  // unchanged client data is not sent again, except every clientDataRefreshTicks ticks so that a client that
+  // connects later or requested the data only once still gets the current content
+  bool clientDataChangeSuppressionEnabled = false;
+  uint64_t clientDataRefreshTicks = 60;
+  struct SentClientData {
+    std::vector<char> content;
+    uint64_t tick = 0;
+  };
+  // indexed by the client data id
+  std::vector<SentClientData> sentClientData;
+  uint64_t clientDataTick = 0;
+  uint64_t clientDataSentCount = 0;
+  uint64_t clientDataSuppressedCount = 0;
+
   // change to non-static when aileron events can be processed via SimConnect
   static double flightControlsKeyChangeAileron;
   double flightControlsKeyChangeElevator = 0.0;
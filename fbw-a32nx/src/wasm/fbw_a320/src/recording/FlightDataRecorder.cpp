@@ -1,12 +1,7 @@
-#include <dirent.h>
 #include <ini.h>
 #include <ini_type_conversion.h>
-#include <stdio.h>
-#include <chrono>
-#include <fstream>
-#include <iomanip>
 #include <iostream>
-#include <sstream>
+#include <string>
 #include <vector>
 
 #include "FlightDataRecorder.h"
@@ -18,15 +13,49 @@ void FlightDataRecorder::initialize() {
   idIsEnabled = std::make_unique<LocalVariable>("A32NX_FDR_ENABLED");
   idMaximumFileCount = std::make_unique<LocalVariable>("A32NX_FDR_MAXIMUM_NUMBER_OF_FILES");
   idMaximumSampleCounter = std::make_unique<LocalVariable>("A32NX_FDR_MAXIMUM_NUMBER_OF_ENTRIES_PER_FILE");
+  idBufferedWriterEnabled = std::make_unique<LocalVariable>("A32NX_FDR_BUFFERED_WRITER_ENABLED");
+  idBufferedWriterNumberOfFrames = std::make_unique<LocalVariable>("A32NX_FDR_BUFFERED_WRITER_NUMBER_OF_FRAMES");
+  idBufferedWriterSliceSize = std::make_unique<LocalVariable>("A32NX_FDR_BUFFERED_WRITER_SLICE_SIZE");
+  idBufferedBytes = std::make_unique<LocalVariable>("A32NX_FDR_BUFFERED_BYTES");
+  idCompressionTime = std::make_unique<LocalVariable>("A32NX_FDR_COMPRESSION_TIME_US");
+  idBufferOverruns = std::make_unique<LocalVariable>("A32NX_FDR_BUFFER_OVERRUNS");
+  idDroppedFrames = std::make_unique<LocalVariable>("A32NX_FDR_DROPPED_FRAMES");
+  idFileFormatVersion = std::make_unique<LocalVariable>("A32NX_FDR_FILE_FORMAT_VERSION");
+  idTicksPerBlock = std::make_unique<LocalVariable>("A32NX_FDR_TICKS_PER_BLOCK");
+  idDeltaEncodingEnabled = std::make_unique<LocalVariable>("A32NX_FDR_DELTA_ENCODING_ENABLED");
+  idReplayInputsEnabled = std::make_unique<LocalVariable>("A32NX_FDR_REPLAY_INPUTS_ENABLED");
 
   // load configuration
   loadConfiguration();
 
+  // prepare the recorder, the file is created with the first frame
+  FrameRecorder::Configuration configuration;
+  configuration.isBufferedWriterEnabled = idBufferedWriterEnabled->get() == 1;
+  configuration.bufferedWriterNumberOfFrames = idBufferedWriterNumberOfFrames->get();
+  configuration.bufferedWriterSliceSize = idBufferedWriterSliceSize->get();
+  configuration.fileFormatVersion = idFileFormatVersion->get();
+  configuration.ticksPerBlock = idTicksPerBlock->get();
+  configuration.isDeltaEncodingEnabled = idDeltaEncodingEnabled->get() == 1;
+  isReplayInputsEnabled = idReplayInputsEnabled->get() == 1;
+  interfaceVersion = isReplayInputsEnabled ? FrameLayout::INTERFACE_VERSION_WITH_INPUTS : FrameLayout::INTERFACE_VERSION;
+  recorder.initialize(interfaceVersion, FrameLayout::getFrameSegments(interfaceVersion), configuration);
+
   // print configuration
   std::cout << "WASM: Flight Data Recorder Configuration : Enabled                        = " << idIsEnabled->get() << std::endl;
   std::cout << "WASM: Flight Data Recorder Configuration : MaximumNumberOfFiles           = " << idMaximumFileCount->get() << std::endl;
   std::cout << "WASM: Flight Data Recorder Configuration : MaximumNumberOfEntriesPerFile  = " << idMaximumSampleCounter->get() << std::endl;
-  std::cout << "WASM: Flight Data Recorder Configuration : Interface Version              = " << INTERFACE_VERSION << std::endl;
+  std::cout << "WASM: Flight Data Recorder Configuration : BufferedWriterEnabled          = " << recorder.isBufferedWriterEnabled()
+            << std::endl;
+  std::cout << "WASM: Flight Data Recorder Configuration : BufferedWriterNumberOfFrames   = " << idBufferedWriterNumberOfFrames->get()
+            << std::endl;
+  std::cout << "WASM: Flight Data Recorder Configuration : BufferedWriterSliceSize        = " << recorder.getBufferedWriterSliceSize()
+            << std::endl;
+  std::cout << "WASM: Flight Data Recorder Configuration : FileFormatVersion              = " << idFileFormatVersion->get() << std::endl;
+  std::cout << "WASM: Flight Data Recorder Configuration : TicksPerBlock                  = " << idTicksPerBlock->get() << std::endl;
+  std::cout << "WASM: Flight Data Recorder Configuration : DeltaEncodingEnabled           = " << idDeltaEncodingEnabled->get() << std::endl;
+  std::cout << "WASM: Flight Data Recorder Configuration : ReplayInputsEnabled            = " << isReplayInputsEnabled << std::endl;
+  std::cout << "WASM: Flight Data Recorder Configuration : Frame Size                     = " << recorder.getFrameSize() << std::endl;
+  std::cout << "WASM: Flight Data Recorder Configuration : Interface Version              = " << interfaceVersion << std::endl;
 }
 
 void FlightDataRecorder::update(const BaseData& baseData,
@@ -42,13 +71,15 @@ void FlightDataRecorder::update(const BaseData& baseData,
     return;
   }
 
-  manageFlightDataRecorderFiles();
+  // change the file if it is full and start the frame
+  recorder.setFileLimits(idMaximumFileCount->get(), idMaximumSampleCounter->get());
+  recorder.beginFrame();
 
   // write base data
-  fileStream->write((char*)(&baseData), sizeof(baseData));
+  recorder.write((char*)(&baseData), sizeof(baseData));
 
   // write aircraft specific data
-  fileStream->write((char*)(&aircraftSpecificData), sizeof(aircraftSpecificData));
+  recorder.write((char*)(&aircraftSpecificData), sizeof(aircraftSpecificData));
 
   // write ELAC data
   for (int i = 0; i < NUMBER_OF_ELAC_TO_WRITE; ++i) {
@@ -73,58 +104,85 @@ void FlightDataRecorder::update(const BaseData& baseData,
   for (int i = 0; i < NUMBER_OF_FADEC_TO_WRITE; ++i) {
     writeFadec(fadecs[i]);
   }
+
+  // complete frame and compress a slice of the buffered data
+  recorder.endFrame(baseData.simulation_time_s);
+
+  // update cost counters
+  if (recorder.isBufferedWriterEnabled() || recorder.isColumnarFormat()) {
+    idBufferedBytes->set(recorder.getBufferedBytes());
+    idCompressionTime->set(recorder.getCompressionTime());
+    idBufferOverruns->set(recorder.getBufferOverruns());
+    idDroppedFrames->set(recorder.getDroppedFrames());
+  }
 }
 
 void FlightDataRecorder::writeElac(Elac& elac) {
   auto bus_outputs = elac.getBusOutputs();
-  fileStream->write((char*)(&bus_outputs), sizeof(bus_outputs));
+  recorder.write((char*)(&bus_outputs), sizeof(bus_outputs));
   auto discrete_outputs = elac.getDiscreteOutputs();
-  fileStream->write((char*)(&discrete_outputs), sizeof(discrete_outputs));
+  recorder.write((char*)(&discrete_outputs), sizeof(discrete_outputs));
   auto analog_outputs = elac.getAnalogOutputs();
-  fileStream->write((char*)(&analog_outputs), sizeof(analog_outputs));
+  recorder.write((char*)(&analog_outputs), sizeof(analog_outputs));
+  // model inputs as seen by the last step, needed to replay the computer
+  if (isReplayInputsEnabled) {
+    const auto& inputs = elac.getDebugOutputs().data;
+    recorder.write((char*)(&inputs), sizeof(inputs));
+  }
 }
 
 void FlightDataRecorder::writeSec(Sec& sec) {
   auto bus_outputs = sec.getBusOutputs();
-  fileStream->write((char*)(&bus_outputs), sizeof(bus_outputs));
+  recorder.write((char*)(&bus_outputs), sizeof(bus_outputs));
   auto discrete_outputs = sec.getDiscreteOutputs();
-  fileStream->write((char*)(&discrete_outputs), sizeof(discrete_outputs));
+  recorder.write((char*)(&discrete_outputs), sizeof(discrete_outputs));
   auto analog_outputs = sec.getAnalogOutputs();
-  fileStream->write((char*)(&analog_outputs), sizeof(analog_outputs));
+  recorder.write((char*)(&analog_outputs), sizeof(analog_outputs));
+  // model inputs as seen by the last step, needed to replay the computer
+  if (isReplayInputsEnabled) {
+    const auto& inputs = sec.getDebugOutputs().data;
+    recorder.write((char*)(&inputs), sizeof(inputs));
+  }
 }
 
 void FlightDataRecorder::writeFac(Fac& fac) {
   auto bus_outputs = fac.getBusOutputs();
-  fileStream->write((char*)(&bus_outputs), sizeof(bus_outputs));
+  recorder.write((char*)(&bus_outputs), sizeof(bus_outputs));
   auto discrete_outputs = fac.getDiscreteOutputs();
-  fileStream->write((char*)(&discrete_outputs), sizeof(discrete_outputs));
+  recorder.write((char*)(&discrete_outputs), sizeof(discrete_outputs));
   auto analog_outputs = fac.getAnalogOutputs();
-  fileStream->write((char*)(&analog_outputs), sizeof(analog_outputs));
+  recorder.write((char*)(&analog_outputs), sizeof(analog_outputs));
+  // model inputs as seen by the last step, needed to replay the computer
+  if (isReplayInputsEnabled) {
+    const auto& inputs = fac.getDebugOutputs().data;
+    recorder.write((char*)(&inputs), sizeof(inputs));
+  }
 }
 
 void FlightDataRecorder::writeFmgc(const fmgc_outputs& fmgc) {
-  fileStream->write((char*)(&fmgc.logic), sizeof(fmgc.logic));
-  fileStream->write((char*)(&fmgc.ap_fd_logic), sizeof(fmgc.ap_fd_logic));
-  fileStream->write((char*)(&fmgc.ap_fd_outer_loops), sizeof(fmgc.ap_fd_outer_loops));
-  fileStream->write((char*)(&fmgc.athr), sizeof(fmgc.athr));
-  fileStream->write((char*)(&fmgc.discrete_outputs), sizeof(fmgc.discrete_outputs));
-  fileStream->write((char*)(&fmgc.bus_outputs), sizeof(fmgc.bus_outputs));
-  fileStream->write((char*)(&fmgc.data.bus_inputs), sizeof(fmgc.data.bus_inputs));
-  fileStream->write((char*)(&fmgc.data.discrete_inputs), sizeof(fmgc.data.discrete_inputs));
-  fileStream->write((char*)(&fmgc.data.fms_inputs), sizeof(fmgc.data.fms_inputs));
+  recorder.write((char*)(&fmgc.logic), sizeof(fmgc.logic));
+  recorder.write((char*)(&fmgc.ap_fd_logic), sizeof(fmgc.ap_fd_logic));
+  recorder.write((char*)(&fmgc.ap_fd_outer_loops), sizeof(fmgc.ap_fd_outer_loops));
+  recorder.write((char*)(&fmgc.athr), sizeof(fmgc.athr));
+  recorder.write((char*)(&fmgc.discrete_outputs), sizeof(fmgc.discrete_outputs));
+  recorder.write((char*)(&fmgc.bus_outputs), sizeof(fmgc.bus_outputs));
+  recorder.write((char*)(&fmgc.data.bus_inputs), sizeof(fmgc.data.bus_inputs));
+  recorder.write((char*)(&fmgc.data.discrete_inputs), sizeof(fmgc.data.discrete_inputs));
+  recorder.write((char*)(&fmgc.data.fms_inputs), sizeof(fmgc.data.fms_inputs));
+  if (isReplayInputsEnabled) {
+    recorder.write((char*)(&fmgc.data.time), sizeof(fmgc.data.time));
+    recorder.write((char*)(&fmgc.data.sim_data), sizeof(fmgc.data.sim_data));
+  }
 }
 
 void FlightDataRecorder::writeFadec(FadecComputer& fadec) {
   auto outputs = fadec.getExternalOutputs().out;
-  fileStream->write((char*)(&outputs.fadec_bus_output), sizeof(outputs.fadec_bus_output));
-  fileStream->write((char*)(&outputs.output), sizeof(outputs.output));
+  recorder.write((char*)(&outputs.fadec_bus_output), sizeof(outputs.fadec_bus_output));
+  recorder.write((char*)(&outputs.output), sizeof(outputs.output));
 }
 
 void FlightDataRecorder::terminate() {
-  if (fileStream) {
-    fileStream->close();
-    fileStream.reset();
-  }
+  recorder.terminate();
   writeConfiguration();
 }
 
@@ -137,6 +195,13 @@ void FlightDataRecorder::loadConfiguration() {
     iniStructure["FLIGHT_DATA_RECORDER"]["ENABLED"] = "true";
     iniStructure["FLIGHT_DATA_RECORDER"]["MAXIMUM_NUMBER_OF_FILES"] = "15";
     iniStructure["FLIGHT_DATA_RECORDER"]["MAXIMUM_NUMBER_OF_ENTRIES_PER_FILE"] = "864000";
+    iniStructure["FLIGHT_DATA_RECORDER"]["BUFFERED_WRITER_ENABLED"] = "false";
+    iniStructure["FLIGHT_DATA_RECORDER"]["BUFFERED_WRITER_NUMBER_OF_FRAMES"] = "64";
+    iniStructure["FLIGHT_DATA_RECORDER"]["BUFFERED_WRITER_SLICE_SIZE"] = "8192";
+    iniStructure["FLIGHT_DATA_RECORDER"]["FILE_FORMAT_VERSION"] = "1";
+    iniStructure["FLIGHT_DATA_RECORDER"]["TICKS_PER_BLOCK"] = "128";
+    iniStructure["FLIGHT_DATA_RECORDER"]["DELTA_ENCODING_ENABLED"] = "true";
+    iniStructure["FLIGHT_DATA_RECORDER"]["REPLAY_INPUTS_ENABLED"] = "false";
     iniFile.write(iniStructure, true);
   }
 
@@ -145,6 +210,14 @@ void FlightDataRecorder::loadConfiguration() {
   idMaximumFileCount->set(INITypeConversion::getInteger(iniStructure, "FLIGHT_DATA_RECORDER", "MAXIMUM_NUMBER_OF_FILES", 15));
   idMaximumSampleCounter->set(
       INITypeConversion::getInteger(iniStructure, "FLIGHT_DATA_RECORDER", "MAXIMUM_NUMBER_OF_ENTRIES_PER_FILE", 864000));
+  idBufferedWriterEnabled->set(INITypeConversion::getBoolean(iniStructure, "FLIGHT_DATA_RECORDER", "BUFFERED_WRITER_ENABLED", false));
+  idBufferedWriterNumberOfFrames->set(
+      INITypeConversion::getInteger(iniStructure, "FLIGHT_DATA_RECORDER", "BUFFERED_WRITER_NUMBER_OF_FRAMES", 64));
+  idBufferedWriterSliceSize->set(INITypeConversion::getInteger(iniStructure, "FLIGHT_DATA_RECORDER", "BUFFERED_WRITER_SLICE_SIZE", 8192));
+  idFileFormatVersion->set(INITypeConversion::getInteger(iniStructure, "FLIGHT_DATA_RECORDER", "FILE_FORMAT_VERSION", 1));
+  idTicksPerBlock->set(INITypeConversion::getInteger(iniStructure, "FLIGHT_DATA_RECORDER", "TICKS_PER_BLOCK", 128));
+  idDeltaEncodingEnabled->set(INITypeConversion::getBoolean(iniStructure, "FLIGHT_DATA_RECORDER", "DELTA_ENCODING_ENABLED", true));
+  idReplayInputsEnabled->set(INITypeConversion::getBoolean(iniStructure, "FLIGHT_DATA_RECORDER", "REPLAY_INPUTS_ENABLED", false));
 }
 
 void FlightDataRecorder::writeConfiguration() {
@@ -157,81 +230,15 @@ void FlightDataRecorder::writeConfiguration() {
   iniStructure["FLIGHT_DATA_RECORDER"]["MAXIMUM_NUMBER_OF_FILES"] = std::to_string(static_cast<int>(idMaximumFileCount->get()));
   iniStructure["FLIGHT_DATA_RECORDER"]["MAXIMUM_NUMBER_OF_ENTRIES_PER_FILE"] =
       std::to_string(static_cast<int>(idMaximumSampleCounter->get()));
+  iniStructure["FLIGHT_DATA_RECORDER"]["BUFFERED_WRITER_ENABLED"] = idBufferedWriterEnabled->get() == 1 ? "true" : "false";
+  iniStructure["FLIGHT_DATA_RECORDER"]["BUFFERED_WRITER_NUMBER_OF_FRAMES"] =
+      std::to_string(static_cast<int>(idBufferedWriterNumberOfFrames->get()));
+  iniStructure["FLIGHT_DATA_RECORDER"]["BUFFERED_WRITER_SLICE_SIZE"] = std::to_string(static_cast<int>(idBufferedWriterSliceSize->get()));
+  iniStructure["FLIGHT_DATA_RECORDER"]["FILE_FORMAT_VERSION"] = std::to_string(static_cast<int>(idFileFormatVersion->get()));
+  iniStructure["FLIGHT_DATA_RECORDER"]["TICKS_PER_BLOCK"] = std::to_string(static_cast<int>(idTicksPerBlock->get()));
+  iniStructure["FLIGHT_DATA_RECORDER"]["DELTA_ENCODING_ENABLED"] = idDeltaEncodingEnabled->get() == 1 ? "true" : "false";
+  iniStructure["FLIGHT_DATA_RECORDER"]["REPLAY_INPUTS_ENABLED"] = idReplayInputsEnabled->get() == 1 ? "true" : "false";
 
   // write file
   iniFile.write(iniStructure, true);
 }
-
-void FlightDataRecorder::manageFlightDataRecorderFiles() {
-  // increase sample counter
-  sampleCounter++;
-
-  // check if file is considered full
-  if (sampleCounter >= idMaximumSampleCounter->get()) {
-    // close file and delete
-    if (fileStream) {
-      fileStream->close();
-      fileStream.reset();
-    }
-    // reset counter
-    sampleCounter = 0;
-  }
-
-  if (!fileStream) {
-    // create new file
-    fileStream = std::make_shared<gzofstream>(getFlightDataRecorderFilename().c_str());
-    // write version to file
-    fileStream->write((char*)&INTERFACE_VERSION, sizeof(INTERFACE_VERSION));
-    // clean up directory
-    cleanUpFlightDataRecorderFiles();
-  }
-}
-
-std::string FlightDataRecorder::getFlightDataRecorderFilename() {
-  // get time
-  auto in_time_t = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
-
-  // get filepath based on time
-  std::stringstream result;
-  result << std::put_time(std::gmtime(&in_time_t), "\\work\\%Y-%m-%d-%H-%M-%S.fdr");
-
-  // return result
-  return result.str();
-}
-
-void FlightDataRecorder::cleanUpFlightDataRecorderFiles() {
-  // std::vector for directory entries
-  std::vector<std::string> files;
-
-  // extension
-  std::string extension = "fdr";
-
-  // structure representing an directory entry
-  struct dirent* directoryEntry;
-
-  // open directory
-  DIR* directory = opendir("\\work");
-
-  // read directory until end
-  while ((directoryEntry = readdir(directory)) != NULL) {
-    // get filename as std::string
-    std::string filename = directoryEntry->d_name;
-
-    // check if file has right extension
-    if (filename.find(extension, (filename.length() - extension.length())) != std::string::npos) {
-      files.push_back(std::move(filename));
-    }
-  }
-
-  // close directory
-  closedir(directory);
-
-  // sort std::vector
-  std::sort(files.begin(), files.end(), std::greater<>());
-
-  // remove older files
-  while (files.size() > idMaximumFileCount->get()) {
-    bool result = remove(("\\work\\" + files.back()).c_str());
-    files.pop_back();
-  }
-}
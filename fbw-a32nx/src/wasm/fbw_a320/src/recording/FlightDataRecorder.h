@@ -7,19 +7,19 @@
 #include "../model/FadecComputer.h"
 #include "../model/FmgcComputer_types.h"
 #include "../sec/Sec.h"
+#include "FrameLayout.h"
+#include "FrameRecorder.h"
 #include "LocalVariable.h"
 #include "RecordingDataTypes.h"
-#include "zfstream.h"
 
 class FlightDataRecorder {
  public:
-  // IMPORTANT: this constant needs to increased with every interface change
-  const uint64_t INTERFACE_VERSION = 3200004;
+  // IMPORTANT: the interface versions and frame layouts are defined in FrameLayout.h
 
-  const uint32_t NUMBER_OF_ELAC_TO_WRITE = 2;
-  const uint32_t NUMBER_OF_SEC_TO_WRITE = 3;
-  const uint32_t NUMBER_OF_FAC_TO_WRITE = 2;
-  const uint32_t NUMBER_OF_FADEC_TO_WRITE = 1;
+  const uint32_t NUMBER_OF_ELAC_TO_WRITE = FrameLayout::NUMBER_OF_ELAC_TO_WRITE;
+  const uint32_t NUMBER_OF_SEC_TO_WRITE = FrameLayout::NUMBER_OF_SEC_TO_WRITE;
+  const uint32_t NUMBER_OF_FAC_TO_WRITE = FrameLayout::NUMBER_OF_FAC_TO_WRITE;
+  const uint32_t NUMBER_OF_FADEC_TO_WRITE = FrameLayout::NUMBER_OF_FADEC_TO_WRITE;
 
   void initialize();
 
@@ -40,14 +40,25 @@ class FlightDataRecorder {
   std::unique_ptr<LocalVariable> idIsEnabled;
   std::unique_ptr<LocalVariable> idMaximumSampleCounter;
   std::unique_ptr<LocalVariable> idMaximumFileCount;
-  int sampleCounter = 0;
-  std::shared_ptr<gzofstream> fileStream;
-
-  void manageFlightDataRecorderFiles();
-
-  std::string getFlightDataRecorderFilename();
-
-  void cleanUpFlightDataRecorderFiles();
+  std::unique_ptr<LocalVariable> idBufferedWriterEnabled;
+  std::unique_ptr<LocalVariable> idBufferedWriterNumberOfFrames;
+  std::unique_ptr<LocalVariable> idBufferedWriterSliceSize;
+  std::unique_ptr<LocalVariable> idBufferedBytes;
+  std::unique_ptr<LocalVariable> idCompressionTime;
+  std::unique_ptr<LocalVariable> idBufferOverruns;
+  std::unique_ptr<LocalVariable> idDroppedFrames;
+  std::unique_ptr<LocalVariable> idFileFormatVersion;
+  std::unique_ptr<LocalVariable> idTicksPerBlock;
+  std::unique_ptr<LocalVariable> idDeltaEncodingEnabled;
+  std::unique_ptr<LocalVariable> idReplayInputsEnabled;
+
+  // the model inputs are only recorded when enabled, they are only needed to replay the computers and increase the
+  // frame size a lot, the layout is selected by the interface version of the file
+  bool isReplayInputsEnabled = false;
+  uint64_t interfaceVersion = FrameLayout::INTERFACE_VERSION;
+
+  // buffers, compresses and rotates the recorded frames
+  FrameRecorder recorder;
 
   void loadConfiguration();
 
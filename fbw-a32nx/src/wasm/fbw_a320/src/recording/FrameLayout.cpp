@@ -0,0 +1,84 @@
+#include "FrameLayout.h"
+
+#include "../model/ElacComputer_types.h"
+#include "../model/FacComputer_types.h"
+#include "../model/FadecComputer_types.h"
+#include "../model/FmgcComputer_types.h"
+#include "../model/SecComputer_types.h"
+#include "RecordingDataTypes.h"
+
+namespace FrameLayout {
+
+std::vector<FrameSegment> getFrameSegments(uint64_t interfaceVersion) {
+  if (interfaceVersion != INTERFACE_VERSION && interfaceVersion != INTERFACE_VERSION_WITH_INPUTS) {
+    return {};
+  }
+  const bool hasInputs = interfaceVersion == INTERFACE_VERSION_WITH_INPUTS;
+
+  // the names match the columns of fdr2csv
+  std::vector<FrameSegment> segments = {{"base", sizeof(BaseData)}, {"specific", sizeof(AircraftSpecificData)}};
+  auto addComputer = [&segments, hasInputs](const std::string& name, std::size_t busSize, std::size_t discreteSize,
+                                            std::size_t analogSize, std::size_t inputsSize) {
+    segments.push_back({name + ".bus_outputs", busSize});
+    segments.push_back({name + ".discrete_outputs", discreteSize});
+    segments.push_back({name + ".analog_outputs", analogSize});
+    if (hasInputs) {
+      segments.push_back({name + ".inputs", inputsSize});
+    }
+  };
+
+  for (uint32_t i = 1; i <= NUMBER_OF_ELAC_TO_WRITE; ++i) {
+    addComputer("elac_" + std::to_string(i), sizeof(base_elac_out_bus), sizeof(base_elac_discrete_outputs),
+                sizeof(base_elac_analog_outputs), sizeof(elac_inputs));
+  }
+  for (uint32_t i = 1; i <= NUMBER_OF_SEC_TO_WRITE; ++i) {
+    addComputer("sec_" + std::to_string(i), sizeof(base_sec_out_bus), sizeof(base_sec_discrete_outputs), sizeof(base_sec_analog_outputs),
+                sizeof(sec_inputs));
+  }
+  for (uint32_t i = 1; i <= NUMBER_OF_FAC_TO_WRITE; ++i) {
+    addComputer("fac_" + std::to_string(i), sizeof(base_fac_bus), sizeof(base_fac_discrete_outputs), sizeof(base_fac_analog_outputs),
+                sizeof(fac_inputs));
+  }
+
+  segments.push_back({"fmgc_1.logic", sizeof(base_fmgc_logic_outputs)});
+  segments.push_back({"fmgc_1.ap_fd_logic", sizeof(base_fmgc_ap_fd_logic_outputs)});
+  segments.push_back({"fmgc_1.ap_fd_outer_loops", sizeof(ap_raw_output)});
+  segments.push_back({"fmgc_1.athr", sizeof(base_fmgc_athr_outputs)});
+  segments.push_back({"fmgc_1.discrete_outputs", sizeof(base_fmgc_discrete_outputs)});
+  segments.push_back({"fmgc_1.bus_outputs", sizeof(base_fmgc_bus_outputs)});
+  segments.push_back({"fmgc_1.bus_inputs", sizeof(base_fmgc_bus_inputs)});
+  segments.push_back({"fmgc_1.discrete_inputs", sizeof(base_fmgc_discrete_inputs)});
+  segments.push_back({"fmgc_1.fms_inputs", sizeof(base_fms_inputs)});
+  if (hasInputs) {
+    segments.push_back({"fmgc_1.time", sizeof(base_time)});
+    segments.push_back({"fmgc_1.sim_data", sizeof(base_sim_data)});
+  }
+
+  for (uint32_t i = 1; i <= NUMBER_OF_FADEC_TO_WRITE; ++i) {
+    segments.push_back({"fadec_" + std::to_string(i) + ".bus_outputs", sizeof(base_ecu_bus)});
+    segments.push_back({"fadec_" + std::to_string(i) + ".outputs", sizeof(athr_output)});
+  }
+
+  return segments;
+}
+
+std::size_t getFrameSize(const std::vector<FrameSegment>& segments) {
+  std::size_t size = 0;
+  for (const auto& segment : segments) {
+    size += segment.size;
+  }
+  return size;
+}
+
+std::ptrdiff_t getSegmentOffset(const std::vector<FrameSegment>& segments, const std::string& name) {
+  std::size_t offset = 0;
+  for (const auto& segment : segments) {
+    if (segment.name == name) {
+      return static_cast<std::ptrdiff_t>(offset);
+    }
+    offset += segment.size;
+  }
+  return -1;
+}
+
+}  // namespace FrameLayout
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "ColumnarFrameWriter.h"
+
+// Layout of a flight data recorder frame. It is used by the FlightDataRecorder and by the host side tools that read
+// the recordings back, so it must not depend on the simulator.
+namespace FrameLayout {
+// IMPORTANT: these constants need to increased with every interface change
+constexpr uint64_t INTERFACE_VERSION = 3200004;
+// the layout additionally contains the model inputs needed to replay the computers, only recorded when enabled
+constexpr uint64_t INTERFACE_VERSION_WITH_INPUTS = 3200005;
+
+constexpr uint32_t NUMBER_OF_ELAC_TO_WRITE = 2;
+constexpr uint32_t NUMBER_OF_SEC_TO_WRITE = 3;
+constexpr uint32_t NUMBER_OF_FAC_TO_WRITE = 2;
+constexpr uint32_t NUMBER_OF_FADEC_TO_WRITE = 1;
+
+// IMPORTANT: this needs to be kept in sync with the data written in FlightDataRecorder::update()
+// returns the layout of the interface version stored in the file header or an empty layout for an unknown version
+std::vector<FrameSegment> getFrameSegments(uint64_t interfaceVersion);
+
+std::size_t getFrameSize(const std::vector<FrameSegment>& segments);
+
+// returns the byte offset of the named segment within a frame or -1 if there is no such segment
+std::ptrdiff_t getSegmentOffset(const std::vector<FrameSegment>& segments, const std::string& name);
+}  // namespace FrameLayout
@@ -157,3 +157,7 @@ base_sec_analog_outputs Sec::getAnalogOutputs() {
 
   return output;
 }
+
+const sec_outputs& Sec::getDebugOutputs() const {
+  return secComputer.getExternalOutputs().out;
+}
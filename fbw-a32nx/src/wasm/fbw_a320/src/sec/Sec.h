@@ -22,6 +22,8 @@ class Sec {
 
   base_sec_analog_outputs getAnalogOutputs();
 
+  const sec_outputs& getDebugOutputs() const;
+
   SecComputer::ExternalInputs_SecComputer_T modelInputs = {};
 
  private:
@@ -37,26 +39,26 @@ class Sec {
 
   // Model
   SecComputer secComputer;
-  sec_outputs modelOutputs;
+  sec_outputs modelOutputs = {};
 
   // Computer Self-monitoring vars
-  bool monitoringHealthy;
+  bool monitoringHealthy = false;
 
-  bool cpuStopped;
+  bool cpuStopped = false;
 
   SRFlipFlop cpuStoppedFlipFlop = SRFlipFlop(true);
 
   PulseNode resetPulseNode = PulseNode(false);
 
   // Power Supply monitoring
-  double powerSupplyOutageTime;
+  double powerSupplyOutageTime = 0;
 
-  bool powerSupplyFault;
+  bool powerSupplyFault = false;
 
   // Selftest vars
-  double selfTestTimer;
+  double selfTestTimer = 0;
 
-  bool selfTestComplete;
+  bool selfTestComplete = false;
 
   // Constants
   const bool isUnit1;
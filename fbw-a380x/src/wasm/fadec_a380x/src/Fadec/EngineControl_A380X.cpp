@@ -11,14 +11,15 @@
 #include "EngineRatios.hpp"
 #include "Polynomials_A380X.hpp"
 #include "Table1502_A380X.hpp"
-#include "ThrustLimits_A380X.hpp"
 
 #include <algorithm>
+#include <array>
 
 void EngineControl_A380X::initialize(MsfsHandler* msfsHandler) {
   this->msfsHandlerPtr = msfsHandler;
   this->dataManagerPtr = &msfsHandler->getDataManager();
   this->simData.initialize(dataManagerPtr);
+  this->thrustLimitCache.initialize();
   LOG_INFO("Fadec::EngineControl_A380X::initialize() - initialized");
 }
 
@@ -53,6 +54,21 @@ void EngineControl_A380X::update() {
 
   generateIdleParameters(pressureAltitude, mach, ambientTemperature, ambientPressure);
 
+  // The corrected fuel flow and EGT polynomials of all engines share the terms that only depend on mach and
+  // altitude, so they are evaluated for all engines in one call.
+  std::array<double, 4> simCN1{};
+  for (int engineIdx = 0; engineIdx < 4; engineIdx++) {
+    simCN1[engineIdx] = simData.engineCorrectedN1DataPtr[engineIdx]->data().correctedN1;
+  }
+  std::array<double, 4> correctedFuelFlow{};
+  Polynomial_A380X::correctedFuelFlow(simCN1, mach, pressureAltitude, correctedFuelFlow);
+  // the EGT is calculated from the corrected fuel flow in whole lbs/hour
+  std::array<double, 4> correctedFuelFlowTruncated{};
+  std::transform(correctedFuelFlow.begin(), correctedFuelFlow.end(), correctedFuelFlowTruncated.begin(),
+                 [](double cff) { return static_cast<int>(cff); });
+  std::array<double, 4> correctedEGT{};
+  Polynomial_A380X::correctedEGT(simCN1, correctedFuelFlowTruncated, mach, pressureAltitude, correctedEGT);
+
   // Update engine states
   for (int engine = 1; engine <= 4; engine++) {
     const int engineIdx = engine - 1;
@@ -71,7 +87,6 @@ void EngineControl_A380X::update() {
 
     const bool   simOnGround   = msfsHandlerPtr->getSimOnGround();
     const double engineTimer   = simData.engineTimer[engineIdx]->get();
-    const double simCN1        = simData.engineCorrectedN1DataPtr[engineIdx]->data().correctedN1;
     const double simN1         = simData.simVarsDataPtr->data().simEngineN1[engineIdx];
     const double simN3         = simData.simVarsDataPtr->data().simEngineN2[engineIdx];  // as the sim does not have N3, we use N2
     const double deltaN3       = simN3 - prevSimEngineN3[engineIdx];
@@ -85,12 +100,12 @@ void EngineControl_A380X::update() {
         break;
       case SHUTTING:
         engineShutdownProcedure(engine, deltaTime, engineTimer, simN1, ambientTemperature);
-        updateFF(engine, simCN1, mach, pressureAltitude, ambientTemperature, ambientPressure);
+        updateFF(engine, correctedFuelFlow[engineIdx], mach, ambientTemperature, ambientPressure);
         break;
       default:
         updatePrimaryParameters(engine, simN1, simN3);
-        double correctedFuelFlow = updateFF(engine, simCN1, mach, pressureAltitude, ambientTemperature, ambientPressure);
-        updateEGT(engine, engineState, deltaTime, simCN1, correctedFuelFlow, mach, pressureAltitude, ambientTemperature, simOnGround);
+        updateFF(engine, correctedFuelFlow[engineIdx], mach, ambientTemperature, ambientPressure);
+        updateEGT(engine, engineState, deltaTime, correctedEGT[engineIdx], mach, ambientTemperature, simOnGround);
         updateSecondaryParameters(engine, engineState, deltaTime, simOnGround, ambientTemperature, deltaN3);
         break;
     }
@@ -492,18 +507,15 @@ void EngineControl_A380X::engineShutdownProcedure(int    engine,
 #endif
 }
 
-int EngineControl_A380X::updateFF(int    engine,
-                                  double simCN1,
-                                  double mach,
-                                  double pressureAltitude,
-                                  double ambientTemperature,
-                                  double ambientPressure) {
+void EngineControl_A380X::updateFF(int    engine,
+                                   double correctedFuelFlow,
+                                   double mach,
+                                   double ambientTemperature,
+                                   double ambientPressure) {
 #ifdef PROFILING
   profilerUpdateFF.start();
 #endif
 
-  const double correctedFuelFlow = Polynomial_A380X::correctedFuelFlow(simCN1, mach, pressureAltitude);  // in lbs/hr.
-
   // Checking Fuel Logic and final Fuel Flow
   double outFlow = 0;  // kg/hour
   if (correctedFuelFlow >= 1) {
@@ -516,8 +528,6 @@ int EngineControl_A380X::updateFF(int    engine,
 #ifdef PROFILING
   profilerUpdateFF.stop();
 #endif
-
-  return correctedFuelFlow;
 }
 
 void EngineControl_A380X::updatePrimaryParameters(int engine, double simN1, double simN3) {
@@ -556,10 +566,8 @@ void EngineControl_A380X::updateSecondaryParameters(int          engine,
 void EngineControl_A380X::updateEGT(int          engine,
                                     double       engineState,
                                     double       deltaTime,
-                                    double       simCN1,
-                                    int          correctedFuelFlow,
+                                    double       correctedEGT,
                                     const double mach,
-                                    const double pressureAltitude,
                                     const double ambientTemperature,
                                     bool         simOnGround) {
 #ifdef PROFILING
@@ -571,7 +579,6 @@ void EngineControl_A380X::updateEGT(int          engine,
   if (simOnGround && engineState == 0) {
     simData.engineEgt[engineIdx]->set(ambientTemperature);
   } else {
-    const double correctedEGT    = Polynomial_A380X::correctedEGT(simCN1, correctedFuelFlow, mach, pressureAltitude);
     const double egtFbwPrevious  = simData.engineEgt[engineIdx]->get();
     double       egtFbwActualEng = (correctedEGT * EngineRatios::theta2(mach, ambientTemperature));
     egtFbwActualEng              = egtFbwActualEng + (egtFbwPrevious - egtFbwActualEng) * std::exp(-0.1 * deltaTime);
@@ -918,16 +925,16 @@ void EngineControl_A380X::updateThrustLimits(double simulationTime,
 
   // Write all N1 Limits
   const double altitude = std::min(16600.0, pressAltitude);
-  const double to       = ThrustLimits_A380X::limitN1(0, altitude, ambientTemperature, ambientPressure, 0, packs, nai, wai);
-  const double ga       = ThrustLimits_A380X::limitN1(1, altitude, ambientTemperature, ambientPressure, 0, packs, nai, wai);
+  const double to       = thrustLimitCache.limitN1(0, altitude, ambientTemperature, ambientPressure, 0, packs, nai, wai);
+  const double ga       = thrustLimitCache.limitN1(1, altitude, ambientTemperature, ambientPressure, 0, packs, nai, wai);
   double       flex_to  = 0;
   double       flex_ga  = 0;
   if (flexTemp > 0) {
-    flex_to = ThrustLimits_A380X::limitN1(0, altitude, ambientTemperature, ambientPressure, flexTemp, packs, nai, wai);
-    flex_ga = ThrustLimits_A380X::limitN1(1, altitude, ambientTemperature, ambientPressure, flexTemp, packs, nai, wai);
+    flex_to = thrustLimitCache.limitN1(0, altitude, ambientTemperature, ambientPressure, flexTemp, packs, nai, wai);
+    flex_ga = thrustLimitCache.limitN1(1, altitude, ambientTemperature, ambientPressure, flexTemp, packs, nai, wai);
   }
-  double clb = ThrustLimits_A380X::limitN1(2, pressAltitude, ambientTemperature, ambientPressure, 0, packs, nai, wai);
-  double mct = ThrustLimits_A380X::limitN1(3, pressAltitude, ambientTemperature, ambientPressure, 0, packs, nai, wai);
+  double clb = thrustLimitCache.limitN1(2, pressAltitude, ambientTemperature, ambientPressure, 0, packs, nai, wai);
+  double mct = thrustLimitCache.limitN1(3, pressAltitude, ambientTemperature, ambientPressure, 0, packs, nai, wai);
 
   // transition between TO and GA limit -----------------------------------------------------------------------------
   const double machFactorLow = std::max(0.0, std::min(1.0, (mach - 0.04) / 0.04));
@@ -8,6 +8,8 @@
 
 #include "FadecSimData_A380X.hpp"
 #include "FuelConfiguration_A380X.h"
+#include "ThrustLimitCache.hpp"
+#include "ThrustLimits_A380X.hpp"
 
 #define FILENAME_FADEC_CONF_DIRECTORY "\\work\\AircraftStates\\"
 #define FILENAME_FADEC_CONF_FILE_EXTENSION ".ini"
@@ -39,6 +41,9 @@ class EngineControl_A380X {
   // Fuel configuration for loading and storing fuel levels
   FuelConfiguration_A380X fuelConfiguration{};
 
+  // N1 thrust limits precomputed over altitude and temperature
+  ThrustLimitCache<ThrustLimits_A380X> thrustLimitCache{};
+
   // Remember last fuel save time to allow saving fuel only every 5 seconds
   FLOAT64                 lastFuelSaveTime   = 0;
   static constexpr double FUEL_SAVE_INTERVAL = 5.0;  // seconds
@@ -197,14 +202,12 @@ class EngineControl_A380X {
    * @brief Updates the fuel flow of the engine.
    *
    * @param engine The engine number (1-4).
-   * @param simCN1 The current corrected fan speed value from the simulator.
+   * @param correctedFuelFlow The corrected fuel flow of the engine in lbs/hour (see Polynomial_A380X::correctedFuelFlow).
    * @param mach The current Mach number of the aircraft.
-   * @param pressureAltitude The current pressure altitude of the aircraft in feet.
    * @param ambientTemperature The current ambient temperature in degrees Celsius to calculate the engine's operating temperature.
    * @param ambientPressure The current ambient pressure in hPa.
-   * @return The updated fuel flow as a double in kg/hour.
    */
-  int updateFF(int engine, FLOAT64 simCN1, FLOAT64 mach, FLOAT64 altitude, FLOAT64 temperature, FLOAT64 pressure);
+  void updateFF(int engine, FLOAT64 correctedFuelFlow, FLOAT64 mach, FLOAT64 temperature, FLOAT64 pressure);
 
   /**
    * @brief Updates the primary custom parameters (LVars) of the engine when not starting or stopping the engine
@@ -242,10 +245,8 @@ class EngineControl_A380X {
    * @param deltaTime The time difference since the last update to calculate the rate of change of various parameters.
    * @param simOnGround The on ground status of the aircraft (0 or 1).
    * @param engineState The current state of the engine.
-   * @param simCN1 The current corrected fan speed value from the simulator.
-   * @param correctedFuelFlow The current custom fuel flow of the engine (FBW corrected).
+   * @param correctedEGT The corrected EGT of the engine in degree Celsius (see Polynomial_A380X::correctedEGT).
    * @param mach The current Mach number of the aircraft.
-   * @param pressureAltitude The current pressure altitude of the aircraft in feet.
    * @param ambientTemperature The current ambient pressure in hPa.
    *
    * @see EngineState
@@ -253,10 +254,8 @@ class EngineControl_A380X {
   void updateEGT(int          engine,
                  double       engineState,
                  double       deltaTime,
-                 double       simCN1,
-                 int          customFuelFlow,
+                 double       correctedEGT,
                  const double mach,
-                 const double pressureAltitude,
                  const double ambientPressure,
                  bool         simOnGround);
 
@@ -31,6 +31,7 @@ class Fadec_A380X : public Fadec {
   bool update(sGaugeDrawData* pData) override;
   bool postUpdate(sGaugeDrawData*) override { return true; }
   bool shutdown() override;
+  [[nodiscard]] std::string getName() const override { return "Fadec_A380X"; }
 };
 
 #endif  // FLYBYWIRE_AIRCRAFT_FADEC_A380X_H
@@ -1,7 +1,11 @@
 #ifndef FLYBYWIRE_AIRCRAFT_POLYNOMIAL_H
 #define FLYBYWIRE_AIRCRAFT_POLYNOMIAL_H
 
+#include <array>
 #include <cmath>
+#include <cstddef>
+
+#include "math_utils.hpp"
 
 /**
  * @class Polynomial
@@ -12,6 +16,10 @@
  * Oil Temperature, Oil Gulping, and Oil Pressure.
  * Each method takes specific inputs related to the engine state and returns the calculated parameter value.
  *
+ * The polynomials are evaluated in Horner form (helper::Math::horner) instead of summing up std::pow() terms.
+ * The corrected EGT and Fuel Flow have batch variants for all four engines that evaluate the terms which only
+ * depend on Mach and altitude once.
+ *
  * TODO: Many of the values/polynomials used in these methods are identical to the A32NX values and
  *       likely need to be adjusted to match the A380X engine model.
  */
@@ -53,10 +61,7 @@ class Polynomial_A380X {
     };
 
     // Calculate the N3 value during engine startup using a polynomial model
-    double outN3 = 0;
-    for (int i = 0; i < 16; i++) {
-      outN3 += coefficients[i] * (std::pow)(normalizedN3, i);
-    }
+    double outN3 = helper::Math::horner(coefficients, normalizedN3);
     outN3 *= currentSimN3;
 
     // Ensure the calculated N3 value is within the expected range
@@ -97,12 +102,9 @@ class Polynomial_A380X {
     };
 
     // Calculate the N1 value during engine startup using a polynomial model
-    double normalN1pre =
-        (-2.4698087 * (std::pow)(normalizedN3, 3)) + (0.9662026 * (std::pow)(normalizedN3, 2)) + (0.0701367 * normalizedN3);
-    double normalN1post = 0;
-    for (int i = 0; i < 9; i++) {
-      normalN1post += coefficients[i] * (std::pow)(normalizedN3, i);
-    }
+    constexpr double preCoefficients[4] = {0.0, 0.0701367, 0.9662026, -2.4698087};
+    double           normalN1pre        = helper::Math::horner(preCoefficients, normalizedN3);
+    double           normalN1post       = helper::Math::horner(coefficients, normalizedN3);
 
     // Return the calculated N1 value
     if (normalN1post >= normalN1pre) {
@@ -142,9 +144,7 @@ class Polynomial_A380X {
 
     // Calculate the normalized Fuel Flow value using a polynomial model if the normalized N3 value is greater than 0.37
     if (normalizedN3 > 0.37) {
-      for (int i = 0; i < 9; i++) {
-        normalizedFF += coefficients[i] * (std::pow)(normalizedN3, i);
-      }
+      normalizedFF = helper::Math::horner(coefficients, normalizedN3);
     }
 
     // Ensure the calculated normalized Fuel Flow value is non-negative
@@ -190,9 +190,7 @@ class Polynomial_A380X {
       };
 
       // Calculate the normalized EGT value using a polynomial model
-      for (int i = 0; i < 9; i++) {
-        normalizedEGT += egtCoefficients[i] * (std::pow)(normalizedN3, i);
-      }
+      normalizedEGT = helper::Math::horner(egtCoefficients, normalizedN3);
     }
 
     // Calculate and return the EGT value
@@ -282,47 +280,29 @@ class Polynomial_A380X {
    * @return The calculated corrected EGT in Celsius.
    */
   static double correctedEGT(double cn1, double cff, double mach, double alt) {
-    // TODO: Adjust the corrected fuel flow to account for the A380 double fuel flow. Will have to be taken care of.
-    // Divide by 3 to lower EGT. Very hacky.
-    cff = cff / 3;
-
-    // Coefficients for the polynomial calculation
-    double c_EGT[16] = {
-        3.2636e+02,   // coefficient for x^0
-        0.0000e+00,   // coefficient for x^1
-        9.2893e-01,   // coefficient for x^2
-        3.9505e-02,   // coefficient for x^3
-        3.9070e+02,   // coefficient for x^4
-        -4.7911e-04,  // coefficient for x^5
-        7.7679e-03,   // coefficient for x^6
-        5.8361e-05,   // coefficient for x^7
-        -2.5566e+00,  // coefficient for x^8
-        5.1227e-06,   // coefficient for x^9
-        1.0178e-07,   // coefficient for x^10
-        -7.4602e-03,  // coefficient for x^11
-        1.2106e-07,   // coefficient for x^12
-        -5.1639e+01,  // coefficient for x^13
-        -2.7356e-03,  // coefficient for x^14
-        1.9312e-08    // coefficient for x^15
-    };
+    const std::array<double, 3> c = correctedEGTTerms(mach, alt);
+    return correctedEGTFromTerms(c, cn1, cff);
+  }
 
-    // Calculate and return the Corrected EGT value using a polynomial model
-    return c_EGT[0]                             //
-           + c_EGT[1]                           //
-           + (c_EGT[2] * cn1)                   //
-           + (c_EGT[3] * cff)                   //
-           + (c_EGT[4] * mach)                  //
-           + (c_EGT[5] * alt)                   //
-           + (c_EGT[6] * (std::pow)(cn1, 2))    //
-           + (c_EGT[7] * cn1 * cff)             //
-           + (c_EGT[8] * cn1 * mach)            //
-           + (c_EGT[9] * cn1 * alt)             //
-           + (c_EGT[10] * (std::pow)(cff, 2))   //
-           + (c_EGT[11] * mach * cff)           //
-           + (c_EGT[12] * cff * alt)            //
-           + (c_EGT[13] * (std::pow)(mach, 2))  //
-           + (c_EGT[14] * mach * alt)           //
-           + (c_EGT[15] * (std::pow)(alt, 2));  //
+  /**
+   * @brief Calculates the corrected EGT of several engines at once.
+   *
+   * @param cn1 The corrected fan speed of each engine in percent.
+   * @param cff The corrected fuel flow of each engine in pounds per hour.
+   * @param mach The Mach number.
+   * @param alt The altitude in feet.
+   * @param correctedEGTs Receives the calculated corrected EGT of each engine in Celsius.
+   */
+  template <std::size_t N>
+  static void correctedEGT(const std::array<double, N>& cn1,
+                           const std::array<double, N>& cff,
+                           double                       mach,
+                           double                       alt,
+                           std::array<double, N>&       correctedEGTs) {
+    const std::array<double, 3> c = correctedEGTTerms(mach, alt);
+    for (std::size_t i = 0; i < N; ++i) {
+      correctedEGTs[i] = correctedEGTFromTerms(c, cn1[i], cff[i]);
+    }
   }
 
   /**
@@ -335,54 +315,24 @@ class Polynomial_A380X {
    * @return The calculated Corrected Fuel Flow value in pounds per hour.
    */
   static double correctedFuelFlow(double cn1, double mach, double alt) {
-    double c_Flow[21] = {
-        -1.7630e+02,  // coefficient for x^0
-        -2.1542e-01,  // coefficient for x^1
-        4.7119e+01,   // coefficient for x^2
-        6.1519e+02,   // coefficient for x^3
-        1.8047e-03,   // coefficient for x^4
-        -4.4554e-01,  // coefficient for x^5
-        -4.3940e+01,  // coefficient for x^6
-        4.0459e-05,   // coefficient for x^7
-        -3.2912e+01,  // coefficient for x^8
-        -6.2894e-03,  // coefficient for x^9
-        -1.2544e-07,  // coefficient for x^10
-        1.0938e-02,   // coefficient for x^11
-        4.0936e-01,   // coefficient for x^12
-        -5.5841e-06,  // coefficient for x^13
-        -2.3829e+01,  // coefficient for x^14
-        9.3269e-04,   // coefficient for x^15
-        2.0273e-11,   // coefficient for x^16
-        -2.4100e+02,  // coefficient for x^17
-        1.4171e-02,   // coefficient for x^18
-        -9.5581e-07,  // coefficient for x^19
-        1.2728e-11    // coefficient for x^20
-    };
-
-    double outCFF = c_Flow[0]                                   //
-                    + c_Flow[1]                                 //
-                    + (c_Flow[2] * cn1)                         //
-                    + (c_Flow[3] * mach)                        //
-                    + (c_Flow[4] * alt)                         //
-                    + (c_Flow[5] * (std::pow)(cn1, 2))          //
-                    + (c_Flow[6] * cn1 * mach)                  //
-                    + (c_Flow[7] * cn1 * alt)                   //
-                    + (c_Flow[8] * (std::pow)(mach, 2))         //
-                    + (c_Flow[9] * mach * alt)                  //
-                    + (c_Flow[10] * (std::pow)(alt, 2))         //
-                    + (c_Flow[11] * (std::pow)(cn1, 3))         //
-                    + (c_Flow[12] * (std::pow)(cn1, 2) * mach)  //
-                    + (c_Flow[13] * (std::pow)(cn1, 2) * alt)   //
-                    + (c_Flow[14] * cn1 * (std::pow)(mach, 2))  //
-                    + (c_Flow[15] * cn1 * mach * alt)           //
-                    + (c_Flow[16] * cn1 * (std::pow)(alt, 2))   //
-                    + (c_Flow[17] * (std::pow)(mach, 3))        //
-                    + (c_Flow[18] * (std::pow)(mach, 2) * alt)  //
-                    + (c_Flow[19] * mach * (std::pow)(alt, 2))  //
-                    + (c_Flow[20] * (std::pow)(alt, 3));        //
-
     // TODO: Adjust the corrected fuel flow to account for the A380 double fuel flow. Will have to be taken care of.
-    return 2.8 * outCFF;
+    return 2.8 * helper::Math::horner(correctedFuelFlowCn1Coefficients(mach, alt), cn1);
+  }
+
+  /**
+   * @brief Calculates the corrected fuel flow of several engines at once.
+   *
+   * @param cn1 The corrected fan speed of each engine in percent.
+   * @param mach The Mach number.
+   * @param alt The altitude in feet.
+   * @param correctedFuelFlows Receives the calculated corrected fuel flow of each engine in pounds per hour.
+   */
+  template <std::size_t N>
+  static void correctedFuelFlow(const std::array<double, N>& cn1, double mach, double alt, std::array<double, N>& correctedFuelFlows) {
+    const std::array<double, 4> c = correctedFuelFlowCn1Coefficients(mach, alt);
+    for (std::size_t i = 0; i < N; ++i) {
+      correctedFuelFlows[i] = 2.8 * helper::Math::horner(c, cn1[i]);
+    }
   }
 
   /**
@@ -429,8 +379,7 @@ class Polynomial_A380X {
    */
   static double oilGulpPct(double thrust) {
     const double oilGulpCoefficients[3] = {20.1968848, -1.2270302e-6, 1.78442e-10};
-    const double oilGulpPercentage =
-        oilGulpCoefficients[0] + (oilGulpCoefficients[1] * thrust) + (oilGulpCoefficients[2] * (std::pow)(thrust, 2));
+    const double oilGulpPercentage      = helper::Math::horner(oilGulpCoefficients, thrust);
     return oilGulpPercentage / 100;
   }
 
@@ -443,7 +392,103 @@ class Polynomial_A380X {
    */
   static double oilPressure(double simN3) {
     double oilPressureCoefficients[3] = {-0.88921, 0.23711, 0.00682};
-    return oilPressureCoefficients[0] + (oilPressureCoefficients[1] * simN3) + (oilPressureCoefficients[2] * (std::pow)(simN3, 2));
+    return helper::Math::horner(oilPressureCoefficients, simN3);
+  }
+ private:
+  /**
+   * @brief Coefficients of the corrected EGT regression.
+   *
+   * EGT = c0 + c1 + c2*cn1 + c3*cff + c4*mach + c5*alt + c6*cn1^2 + c7*cn1*cff + c8*cn1*mach + c9*cn1*alt
+   *       + c10*cff^2 + c11*mach*cff + c12*cff*alt + c13*mach^2 + c14*mach*alt + c15*alt^2
+   */
+  static constexpr double cEGT[16] = {
+      3.2636e+02,   // coefficient for x^0
+      0.0000e+00,   // coefficient for x^1
+      9.2893e-01,   // coefficient for x^2
+      3.9505e-02,   // coefficient for x^3
+      3.9070e+02,   // coefficient for x^4
+      -4.7911e-04,  // coefficient for x^5
+      7.7679e-03,   // coefficient for x^6
+      5.8361e-05,   // coefficient for x^7
+      -2.5566e+00,  // coefficient for x^8
+      5.1227e-06,   // coefficient for x^9
+      1.0178e-07,   // coefficient for x^10
+      -7.4602e-03,  // coefficient for x^11
+      1.2106e-07,   // coefficient for x^12
+      -5.1639e+01,  // coefficient for x^13
+      -2.7356e-03,  // coefficient for x^14
+      1.9312e-08    // coefficient for x^15
+  };
+
+  /**
+   * @brief Coefficients of the corrected fuel flow regression.
+   *
+   * FF = c0 + c1 + c2*cn1 + c3*mach + c4*alt + c5*cn1^2 + c6*cn1*mach + c7*cn1*alt + c8*mach^2 + c9*mach*alt + c10*alt^2
+   *      + c11*cn1^3 + c12*cn1^2*mach + c13*cn1^2*alt + c14*cn1*mach^2 + c15*cn1*mach*alt + c16*cn1*alt^2
+   *      + c17*mach^3 + c18*mach^2*alt + c19*mach*alt^2 + c20*alt^3
+   */
+  static constexpr double cFlow[21] = {
+      -1.7630e+02,  // coefficient for x^0
+      -2.1542e-01,  // coefficient for x^1
+      4.7119e+01,   // coefficient for x^2
+      6.1519e+02,   // coefficient for x^3
+      1.8047e-03,   // coefficient for x^4
+      -4.4554e-01,  // coefficient for x^5
+      -4.3940e+01,  // coefficient for x^6
+      4.0459e-05,   // coefficient for x^7
+      -3.2912e+01,  // coefficient for x^8
+      -6.2894e-03,  // coefficient for x^9
+      -1.2544e-07,  // coefficient for x^10
+      1.0938e-02,   // coefficient for x^11
+      4.0936e-01,   // coefficient for x^12
+      -5.5841e-06,  // coefficient for x^13
+      -2.3829e+01,  // coefficient for x^14
+      9.3269e-04,   // coefficient for x^15
+      2.0273e-11,   // coefficient for x^16
+      -2.4100e+02,  // coefficient for x^17
+      1.4171e-02,   // coefficient for x^18
+      -9.5581e-07,  // coefficient for x^19
+      1.2728e-11    // coefficient for x^20
+  };
+
+  /**
+   * @brief The terms of the corrected EGT regression that do not depend on the engine.
+   * @return {sum of the mach/altitude only terms, factor of cn1, factor of cff}
+   */
+  static std::array<double, 3> correctedEGTTerms(double mach, double alt) {
+    return {
+        cEGT[0] + cEGT[1] + mach * (cEGT[4] + cEGT[13] * mach + cEGT[14] * alt) + alt * (cEGT[5] + cEGT[15] * alt),
+        cEGT[2] + cEGT[8] * mach + cEGT[9] * alt,
+        cEGT[3] + cEGT[11] * mach + cEGT[12] * alt,
+    };
+  }
+
+  /**
+   * @brief Completes the corrected EGT regression with the engine dependent terms.
+   * @param c The result of correctedEGTTerms()
+   */
+  static double correctedEGTFromTerms(const std::array<double, 3>& c, double cn1, double cff) {
+    // TODO: Adjust the corrected fuel flow to account for the A380 double fuel flow. Will have to be taken care of.
+    // Divide by 3 to lower EGT. Very hacky.
+    cff = cff / 3;
+
+    return c[0] + cn1 * (c[1] + cEGT[6] * cn1 + cEGT[7] * cff) + cff * (c[2] + cEGT[10] * cff);
+  }
+
+  /**
+   * @brief Collects the corrected fuel flow regression into a cubic polynomial in cn1 for the given mach and altitude.
+   * @return The coefficients of the cubic in ascending order of the power of cn1
+   */
+  static std::array<double, 4> correctedFuelFlowCn1Coefficients(double mach, double alt) {
+    const double machTerms =
+        mach * (cFlow[3] + mach * (cFlow[8] + cFlow[17] * mach + cFlow[18] * alt) + alt * (cFlow[9] + cFlow[19] * alt));
+    const double altTerms = alt * (cFlow[4] + alt * (cFlow[10] + cFlow[20] * alt));
+    return {
+        cFlow[0] + cFlow[1] + machTerms + altTerms,
+        cFlow[2] + mach * (cFlow[6] + cFlow[14] * mach + cFlow[15] * alt) + alt * (cFlow[7] + cFlow[16] * alt),
+        cFlow[5] + cFlow[12] * mach + cFlow[13] * alt,
+        cFlow[11],
+    };
   }
 };
 
@@ -145,6 +145,10 @@ clang++ \
   "${DIR}/src/Arinc429.cpp" \
   "${DIR}/src/Arinc429Utils.cpp" \
   "${COMMON_DIR}/fbw_common/src/LocalVariable.cpp" \
+  "${COMMON_DIR}/fbw_common/src/LocalVariableStore.cpp" \
+  "${COMMON_DIR}/fbw_common/src/ColumnarFrameWriter.cpp" \
+  "${COMMON_DIR}/fbw_common/src/FrameRecorder.cpp" \
+  "${COMMON_DIR}/fbw_common/src/FrameRingBuffer.cpp" \
   "${COMMON_DIR}/fbw_common/src/InterpolatingLookupTable.cpp" \
   "${DIR}/src/SpoilersHandler.cpp" \
   "${COMMON_DIR}/fbw_common/src/ThrottleAxisMapping.cpp" \
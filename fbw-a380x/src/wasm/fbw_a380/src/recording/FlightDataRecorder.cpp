@@ -1,12 +1,7 @@
-#include <dirent.h>
 #include <ini.h>
 #include <ini_type_conversion.h>
-#include <stdio.h>
-#include <chrono>
-#include <fstream>
-#include <iomanip>
 #include <iostream>
-#include <sstream>
+#include <string>
 #include <vector>
 
 #include "FlightDataRecorder.h"
@@ -18,14 +13,44 @@ void FlightDataRecorder::initialize() {
   idIsEnabled = std::make_unique<LocalVariable>("A32NX_FDR_ENABLED");
   idMaximumFileCount = std::make_unique<LocalVariable>("A32NX_FDR_MAXIMUM_NUMBER_OF_FILES");
   idMaximumSampleCounter = std::make_unique<LocalVariable>("A32NX_FDR_MAXIMUM_NUMBER_OF_ENTRIES_PER_FILE");
+  idBufferedWriterEnabled = std::make_unique<LocalVariable>("A32NX_FDR_BUFFERED_WRITER_ENABLED");
+  idBufferedWriterNumberOfFrames = std::make_unique<LocalVariable>("A32NX_FDR_BUFFERED_WRITER_NUMBER_OF_FRAMES");
+  idBufferedWriterSliceSize = std::make_unique<LocalVariable>("A32NX_FDR_BUFFERED_WRITER_SLICE_SIZE");
+  idBufferedBytes = std::make_unique<LocalVariable>("A32NX_FDR_BUFFERED_BYTES");
+  idCompressionTime = std::make_unique<LocalVariable>("A32NX_FDR_COMPRESSION_TIME_US");
+  idBufferOverruns = std::make_unique<LocalVariable>("A32NX_FDR_BUFFER_OVERRUNS");
+  idDroppedFrames = std::make_unique<LocalVariable>("A32NX_FDR_DROPPED_FRAMES");
+  idFileFormatVersion = std::make_unique<LocalVariable>("A32NX_FDR_FILE_FORMAT_VERSION");
+  idTicksPerBlock = std::make_unique<LocalVariable>("A32NX_FDR_TICKS_PER_BLOCK");
+  idDeltaEncodingEnabled = std::make_unique<LocalVariable>("A32NX_FDR_DELTA_ENCODING_ENABLED");
 
   // load configuration
   loadConfiguration();
 
+  // prepare the recorder, the file is created with the first frame
+  FrameRecorder::Configuration configuration;
+  configuration.isBufferedWriterEnabled = idBufferedWriterEnabled->get() == 1;
+  configuration.bufferedWriterNumberOfFrames = idBufferedWriterNumberOfFrames->get();
+  configuration.bufferedWriterSliceSize = idBufferedWriterSliceSize->get();
+  configuration.fileFormatVersion = idFileFormatVersion->get();
+  configuration.ticksPerBlock = idTicksPerBlock->get();
+  configuration.isDeltaEncodingEnabled = idDeltaEncodingEnabled->get() == 1;
+  recorder.initialize(INTERFACE_VERSION, getFrameSegments(), configuration);
+
   // print configuration
   std::cout << "WASM: Flight Data Recorder Configuration : Enabled                        = " << idIsEnabled->get() << std::endl;
   std::cout << "WASM: Flight Data Recorder Configuration : MaximumNumberOfFiles           = " << idMaximumFileCount->get() << std::endl;
   std::cout << "WASM: Flight Data Recorder Configuration : MaximumNumberOfEntriesPerFile  = " << idMaximumSampleCounter->get() << std::endl;
+  std::cout << "WASM: Flight Data Recorder Configuration : BufferedWriterEnabled          = " << recorder.isBufferedWriterEnabled()
+            << std::endl;
+  std::cout << "WASM: Flight Data Recorder Configuration : BufferedWriterNumberOfFrames   = " << idBufferedWriterNumberOfFrames->get()
+            << std::endl;
+  std::cout << "WASM: Flight Data Recorder Configuration : BufferedWriterSliceSize        = " << recorder.getBufferedWriterSliceSize()
+            << std::endl;
+  std::cout << "WASM: Flight Data Recorder Configuration : FileFormatVersion              = " << idFileFormatVersion->get() << std::endl;
+  std::cout << "WASM: Flight Data Recorder Configuration : TicksPerBlock                  = " << idTicksPerBlock->get() << std::endl;
+  std::cout << "WASM: Flight Data Recorder Configuration : DeltaEncodingEnabled           = " << idDeltaEncodingEnabled->get() << std::endl;
+  std::cout << "WASM: Flight Data Recorder Configuration : Frame Size                     = " << recorder.getFrameSize() << std::endl;
   std::cout << "WASM: Flight Data Recorder Configuration : Interface Version              = " << INTERFACE_VERSION << std::endl;
 }
 
@@ -43,14 +68,15 @@ void FlightDataRecorder::update(const BaseData& baseData,
     return;
   }
 
-  // do file management
-  manageFlightDataRecorderFiles();
+  // change the file if it is full and start the frame
+  recorder.setFileLimits(idMaximumFileCount->get(), idMaximumSampleCounter->get());
+  recorder.beginFrame();
 
   // write base data
-  fileStream->write((char*)(&baseData), sizeof(baseData));
+  recorder.write((char*)(&baseData), sizeof(baseData));
 
   // write aircraft specific data
-  fileStream->write((char*)(&aircraftSpecificData), sizeof(aircraftSpecificData));
+  recorder.write((char*)(&aircraftSpecificData), sizeof(aircraftSpecificData));
 
   // write PRIM data
   for (int i = 0; i < NUMBER_OF_PRIM_TO_WRITE; ++i) {
@@ -69,52 +95,60 @@ void FlightDataRecorder::update(const BaseData& baseData,
 
   // write AP state machine data
   auto autopilotStateMachineOut = autopilotStateMachine.getExternalOutputs().out;
-  fileStream->write((char*)(&autopilotStateMachineOut), sizeof(autopilotStateMachineOut));
+  recorder.write((char*)(&autopilotStateMachineOut), sizeof(autopilotStateMachineOut));
 
   // write AP laws data
   auto autopilotLawsOut = autopilotLaws.getExternalOutputs().out;
-  fileStream->write((char*)(&autopilotLawsOut), sizeof(autopilotLawsOut));
+  recorder.write((char*)(&autopilotLawsOut), sizeof(autopilotLawsOut));
 
   // write ATHR data
   auto autoThrustOut = autoThrust.getExternalOutputs().out;
-  fileStream->write((char*)(&autoThrustOut), sizeof(autoThrustOut));
+  recorder.write((char*)(&autoThrustOut), sizeof(autoThrustOut));
 
   // write fuel system data
-  fileStream->write((char*)(&fuelSystemData), sizeof(fuelSystemData));
+  recorder.write((char*)(&fuelSystemData), sizeof(fuelSystemData));
+
+  // complete frame and compress a slice of the buffered data
+  recorder.endFrame(baseData.simulation_time_s);
+
+  // update cost counters
+  if (recorder.isBufferedWriterEnabled() || recorder.isColumnarFormat()) {
+    idBufferedBytes->set(recorder.getBufferedBytes());
+    idCompressionTime->set(recorder.getCompressionTime());
+    idBufferOverruns->set(recorder.getBufferOverruns());
+    idDroppedFrames->set(recorder.getDroppedFrames());
+  }
 }
 
 void FlightDataRecorder::writePrim(Prim& prim) {
   auto bus_outputs = prim.getBusOutputs();
-  fileStream->write((char*)(&bus_outputs), sizeof(bus_outputs));
+  recorder.write((char*)(&bus_outputs), sizeof(bus_outputs));
   auto discrete_outputs = prim.getDiscreteOutputs();
-  fileStream->write((char*)(&discrete_outputs), sizeof(discrete_outputs));
+  recorder.write((char*)(&discrete_outputs), sizeof(discrete_outputs));
   auto analog_outputs = prim.getAnalogOutputs();
-  fileStream->write((char*)(&analog_outputs), sizeof(analog_outputs));
+  recorder.write((char*)(&analog_outputs), sizeof(analog_outputs));
 }
 
 void FlightDataRecorder::writeSec(Sec& sec) {
   auto bus_outputs = sec.getBusOutputs();
-  fileStream->write((char*)(&bus_outputs), sizeof(bus_outputs));
+  recorder.write((char*)(&bus_outputs), sizeof(bus_outputs));
   auto discrete_outputs = sec.getDiscreteOutputs();
-  fileStream->write((char*)(&discrete_outputs), sizeof(discrete_outputs));
+  recorder.write((char*)(&discrete_outputs), sizeof(discrete_outputs));
   auto analog_outputs = sec.getAnalogOutputs();
-  fileStream->write((char*)(&analog_outputs), sizeof(analog_outputs));
+  recorder.write((char*)(&analog_outputs), sizeof(analog_outputs));
 }
 
 void FlightDataRecorder::writeFac(Fac& fac) {
   auto bus_outputs = fac.getBusOutputs();
-  fileStream->write((char*)(&bus_outputs), sizeof(bus_outputs));
+  recorder.write((char*)(&bus_outputs), sizeof(bus_outputs));
   auto discrete_outputs = fac.getDiscreteOutputs();
-  fileStream->write((char*)(&discrete_outputs), sizeof(discrete_outputs));
+  recorder.write((char*)(&discrete_outputs), sizeof(discrete_outputs));
   auto analog_outputs = fac.getAnalogOutputs();
-  fileStream->write((char*)(&analog_outputs), sizeof(analog_outputs));
+  recorder.write((char*)(&analog_outputs), sizeof(analog_outputs));
 }
 
 void FlightDataRecorder::terminate() {
-  if (fileStream) {
-    fileStream->close();
-    fileStream.reset();
-  }
+  recorder.terminate();
   writeConfiguration();
 }
 
@@ -127,6 +161,12 @@ void FlightDataRecorder::loadConfiguration() {
     iniStructure["FLIGHT_DATA_RECORDER"]["ENABLED"] = "true";
     iniStructure["FLIGHT_DATA_RECORDER"]["MAXIMUM_NUMBER_OF_FILES"] = "15";
     iniStructure["FLIGHT_DATA_RECORDER"]["MAXIMUM_NUMBER_OF_ENTRIES_PER_FILE"] = "864000";
+    iniStructure["FLIGHT_DATA_RECORDER"]["BUFFERED_WRITER_ENABLED"] = "false";
+    iniStructure["FLIGHT_DATA_RECORDER"]["BUFFERED_WRITER_NUMBER_OF_FRAMES"] = "64";
+    iniStructure["FLIGHT_DATA_RECORDER"]["BUFFERED_WRITER_SLICE_SIZE"] = "8192";
+    iniStructure["FLIGHT_DATA_RECORDER"]["FILE_FORMAT_VERSION"] = "1";
+    iniStructure["FLIGHT_DATA_RECORDER"]["TICKS_PER_BLOCK"] = "128";
+    iniStructure["FLIGHT_DATA_RECORDER"]["DELTA_ENCODING_ENABLED"] = "true";
     iniFile.write(iniStructure, true);
   }
 
@@ -135,6 +175,13 @@ void FlightDataRecorder::loadConfiguration() {
   idMaximumFileCount->set(INITypeConversion::getInteger(iniStructure, "FLIGHT_DATA_RECORDER", "MAXIMUM_NUMBER_OF_FILES", 15));
   idMaximumSampleCounter->set(
       INITypeConversion::getInteger(iniStructure, "FLIGHT_DATA_RECORDER", "MAXIMUM_NUMBER_OF_ENTRIES_PER_FILE", 864000));
+  idBufferedWriterEnabled->set(INITypeConversion::getBoolean(iniStructure, "FLIGHT_DATA_RECORDER", "BUFFERED_WRITER_ENABLED", false));
+  idBufferedWriterNumberOfFrames->set(
+      INITypeConversion::getInteger(iniStructure, "FLIGHT_DATA_RECORDER", "BUFFERED_WRITER_NUMBER_OF_FRAMES", 64));
+  idBufferedWriterSliceSize->set(INITypeConversion::getInteger(iniStructure, "FLIGHT_DATA_RECORDER", "BUFFERED_WRITER_SLICE_SIZE", 8192));
+  idFileFormatVersion->set(INITypeConversion::getInteger(iniStructure, "FLIGHT_DATA_RECORDER", "FILE_FORMAT_VERSION", 1));
+  idTicksPerBlock->set(INITypeConversion::getInteger(iniStructure, "FLIGHT_DATA_RECORDER", "TICKS_PER_BLOCK", 128));
+  idDeltaEncodingEnabled->set(INITypeConversion::getBoolean(iniStructure, "FLIGHT_DATA_RECORDER", "DELTA_ENCODING_ENABLED", true));
 }
 
 void FlightDataRecorder::writeConfiguration() {
@@ -147,81 +194,42 @@ void FlightDataRecorder::writeConfiguration() {
   iniStructure["FLIGHT_DATA_RECORDER"]["MAXIMUM_NUMBER_OF_FILES"] = std::to_string(static_cast<int>(idMaximumFileCount->get()));
   iniStructure["FLIGHT_DATA_RECORDER"]["MAXIMUM_NUMBER_OF_ENTRIES_PER_FILE"] =
       std::to_string(static_cast<int>(idMaximumSampleCounter->get()));
+  iniStructure["FLIGHT_DATA_RECORDER"]["BUFFERED_WRITER_ENABLED"] = idBufferedWriterEnabled->get() == 1 ? "true" : "false";
+  iniStructure["FLIGHT_DATA_RECORDER"]["BUFFERED_WRITER_NUMBER_OF_FRAMES"] =
+      std::to_string(static_cast<int>(idBufferedWriterNumberOfFrames->get()));
+  iniStructure["FLIGHT_DATA_RECORDER"]["BUFFERED_WRITER_SLICE_SIZE"] = std::to_string(static_cast<int>(idBufferedWriterSliceSize->get()));
+  iniStructure["FLIGHT_DATA_RECORDER"]["FILE_FORMAT_VERSION"] = std::to_string(static_cast<int>(idFileFormatVersion->get()));
+  iniStructure["FLIGHT_DATA_RECORDER"]["TICKS_PER_BLOCK"] = std::to_string(static_cast<int>(idTicksPerBlock->get()));
+  iniStructure["FLIGHT_DATA_RECORDER"]["DELTA_ENCODING_ENABLED"] = idDeltaEncodingEnabled->get() == 1 ? "true" : "false";
 
   // write file
   iniFile.write(iniStructure, true);
 }
 
-void FlightDataRecorder::manageFlightDataRecorderFiles() {
-  // increase sample counter
-  sampleCounter++;
-
-  // check if file is considered full
-  if (sampleCounter >= idMaximumSampleCounter->get()) {
-    // close file and delete
-    if (fileStream) {
-      fileStream->close();
-      fileStream.reset();
-    }
-    // reset counter
-    sampleCounter = 0;
+std::vector<FrameSegment> FlightDataRecorder::getFrameSegments() const {
+  // IMPORTANT: this needs to be kept in sync with the data written in update(), the names match the columns of fdr2csv
+  std::vector<FrameSegment> segments = {{"base", sizeof(BaseData)}, {"specific", sizeof(AircraftSpecificData)}};
+  auto addComputer = [&segments](const std::string& name, std::size_t busSize, std::size_t discreteSize, std::size_t analogSize) {
+    segments.push_back({name + ".bus_outputs", busSize});
+    segments.push_back({name + ".discrete_outputs", discreteSize});
+    segments.push_back({name + ".analog_outputs", analogSize});
+  };
+
+  for (uint32_t i = 1; i <= NUMBER_OF_PRIM_TO_WRITE; ++i) {
+    addComputer("prim_" + std::to_string(i), sizeof(base_prim_out_bus), sizeof(base_prim_discrete_outputs),
+                sizeof(base_prim_analog_outputs));
   }
-
-  if (!fileStream) {
-    // create new file
-    fileStream = std::make_shared<gzofstream>(getFlightDataRecorderFilename().c_str());
-    // write version to file
-    fileStream->write((char*)&INTERFACE_VERSION, sizeof(INTERFACE_VERSION));
-    // clean up directory
-    cleanUpFlightDataRecorderFiles();
+  for (uint32_t i = 1; i <= NUMBER_OF_SEC_TO_WRITE; ++i) {
+    addComputer("sec_" + std::to_string(i), sizeof(base_sec_out_bus), sizeof(base_sec_discrete_outputs), sizeof(base_sec_analog_outputs));
   }
-}
-
-std::string FlightDataRecorder::getFlightDataRecorderFilename() {
-  // get time
-  auto in_time_t = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
-
-  // get filepath based on time
-  std::stringstream result;
-  result << std::put_time(std::gmtime(&in_time_t), "\\work\\%Y-%m-%d-%H-%M-%S.fdr");
-
-  // return result
-  return result.str();
-}
-
-void FlightDataRecorder::cleanUpFlightDataRecorderFiles() {
-  // std::vector for directory entries
-  std::vector<std::string> files;
-
-  // extension
-  std::string extension = "fdr";
-
-  // structure representing an directory entry
-  struct dirent* directoryEntry;
-
-  // open directory
-  DIR* directory = opendir("\\work");
-
-  // read directory until end
-  while ((directoryEntry = readdir(directory)) != NULL) {
-    // get filename as std::string
-    std::string filename = directoryEntry->d_name;
-
-    // check if file has right extension
-    if (filename.find(extension, (filename.length() - extension.length())) != std::string::npos) {
-      files.push_back(std::move(filename));
-    }
+  for (uint32_t i = 1; i <= NUMBER_OF_FAC_TO_WRITE; ++i) {
+    addComputer("fac_" + std::to_string(i), sizeof(base_fac_bus), sizeof(base_fac_discrete_outputs), sizeof(base_fac_analog_outputs));
   }
 
-  // close directory
-  closedir(directory);
+  segments.push_back({"ap_sm", sizeof(ap_sm_output)});
+  segments.push_back({"ap_law", sizeof(ap_laws_output)});
+  segments.push_back({"athr", sizeof(athr_out)});
+  segments.push_back({"fuel", sizeof(FuelSystemData)});
 
-  // sort std::vector
-  std::sort(files.begin(), files.end(), std::greater<>());
-
-  // remove older files
-  while (files.size() > idMaximumFileCount->get()) {
-    bool result = remove(("\\work\\" + files.back()).c_str());
-    files.pop_back();
-  }
+  return segments;
 }
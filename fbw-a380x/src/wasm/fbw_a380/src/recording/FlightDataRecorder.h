@@ -9,9 +9,9 @@
 #include "../model/Autothrust.h"
 #include "../prim/Prim.h"
 #include "../sec/Sec.h"
+#include "FrameRecorder.h"
 #include "LocalVariable.h"
 #include "RecordingDataTypes.h"
-#include "zlib/zfstream.h"
 
 class FlightDataRecorder {
  public:
@@ -42,19 +42,26 @@ class FlightDataRecorder {
   std::unique_ptr<LocalVariable> idIsEnabled;
   std::unique_ptr<LocalVariable> idMaximumSampleCounter;
   std::unique_ptr<LocalVariable> idMaximumFileCount;
-  int sampleCounter = 0;
-  std::shared_ptr<gzofstream> fileStream;
-
-  void manageFlightDataRecorderFiles();
-
-  std::string getFlightDataRecorderFilename();
-
-  void cleanUpFlightDataRecorderFiles();
+  std::unique_ptr<LocalVariable> idBufferedWriterEnabled;
+  std::unique_ptr<LocalVariable> idBufferedWriterNumberOfFrames;
+  std::unique_ptr<LocalVariable> idBufferedWriterSliceSize;
+  std::unique_ptr<LocalVariable> idBufferedBytes;
+  std::unique_ptr<LocalVariable> idCompressionTime;
+  std::unique_ptr<LocalVariable> idBufferOverruns;
+  std::unique_ptr<LocalVariable> idDroppedFrames;
+  std::unique_ptr<LocalVariable> idFileFormatVersion;
+  std::unique_ptr<LocalVariable> idTicksPerBlock;
+  std::unique_ptr<LocalVariable> idDeltaEncodingEnabled;
+
+  // buffers, compresses and rotates the recorded frames
+  FrameRecorder recorder;
 
   void loadConfiguration();
 
   void writeConfiguration();
 
+  std::vector<FrameSegment> getFrameSegments() const;
+
   void writePrim(Prim& prim);
 
   void writeSec(Sec& sec);
@@ -67,11 +67,13 @@ import './toast.css';
 
 export interface EfbWrapperProps {
   failures: FailureDefinition[]; // TODO: Move failure definition into VFS
+  /** failure identifiers in the order of the bits of the bulk failure masks */
+  bulkFailures?: number[];
   aircraftSetup?: () => void;
   eventBus: EventBus;
 }
 
-export const EfbWrapper: React.FC<EfbWrapperProps> = ({ failures, aircraftSetup, eventBus }) => {
+export const EfbWrapper: React.FC<EfbWrapperProps> = ({ failures, bulkFailures, aircraftSetup, eventBus }) => {
   const setSessionId = () => {
     const ALPHABET = '0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ';
     const SESSION_ID_LENGTH = 14;
@@ -131,7 +133,12 @@ export const EfbWrapper: React.FC<EfbWrapperProps> = ({ failures, aircraftSetup,
 
   return (
     <Provider store={store}>
-      <EfbInstrument failures={failures} aircraftChecklists={aircraftChecklists} eventBus={eventBus} />
+      <EfbInstrument
+        failures={failures}
+        bulkFailures={bulkFailures}
+        aircraftChecklists={aircraftChecklists}
+        eventBus={eventBus}
+      />
     </Provider>
   );
 };
@@ -512,11 +519,17 @@ export const useEventBus = () => useContext(Context);
 
 interface EfbInstrumentProps {
   failures: FailureDefinition[];
+  bulkFailures?: number[];
   aircraftChecklists: ChecklistJsonDefinition[];
   eventBus: EventBus;
 }
 
-export const EfbInstrument: React.FC<EfbInstrumentProps> = ({ failures, aircraftChecklists, eventBus }) => {
+export const EfbInstrument: React.FC<EfbInstrumentProps> = ({
+  failures,
+  bulkFailures,
+  aircraftChecklists,
+  eventBus,
+}) => {
   const [, setSessionId] = usePersistentProperty('A32NX_SENTRY_SESSION_ID');
 
   useEffect(() => () => setSessionId(''), []);
@@ -525,7 +538,7 @@ export const EfbInstrument: React.FC<EfbInstrumentProps> = ({ failures, aircraft
 
   return (
     <TroubleshootingContextProvider eventBus={eventBus}>
-      <FailuresOrchestratorProvider failures={failures}>
+      <FailuresOrchestratorProvider failures={failures} bulkFailures={bulkFailures}>
         <ErrorBoundary FallbackComponent={ErrorFallback} onReset={() => setErr(false)} resetKeys={[err]}>
           <Router>
             <ModalProvider>
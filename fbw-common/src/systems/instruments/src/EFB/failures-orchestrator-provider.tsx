@@ -12,7 +12,8 @@ interface FailuresOrchestratorContext {
   deactivate(identifier: number): Promise<void>;
 }
 
-const createOrchestrator = (failures: FailureDefinition[]) => new FailuresOrchestrator('A32NX', failures);
+const createOrchestrator = (failures: FailureDefinition[], bulkFailures?: number[]) =>
+  new FailuresOrchestrator('A32NX', failures, bulkFailures);
 
 const Context = React.createContext<FailuresOrchestratorContext>({
   allFailures: [],
@@ -24,13 +25,15 @@ const Context = React.createContext<FailuresOrchestratorContext>({
 
 export interface FailuresOrchestratorProviderProps {
   failures: FailureDefinition[];
+  bulkFailures?: number[];
 }
 
 export const FailuresOrchestratorProvider: React.FC<PropsWithChildren<FailuresOrchestratorProviderProps>> = ({
   failures,
+  bulkFailures,
   children,
 }) => {
-  const [orchestrator] = useState(() => createOrchestrator(failures));
+  const [orchestrator] = useState(() => createOrchestrator(failures, bulkFailures));
 
   const [allFailures] = useState(() => orchestrator.getAllFailures());
   const [activeFailures, setActiveFailures] = useState<Set<number>>(() => new Set<number>());
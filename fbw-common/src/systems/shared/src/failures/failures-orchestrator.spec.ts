@@ -1,6 +1,11 @@
 import { describe, test, expect } from 'vitest';
 import { FailuresOrchestrator } from '.';
-import { getActivateFailureSimVarName, getDeactivateFailureSimVarName } from './sim-vars';
+import {
+  getActivateFailureSimVarName,
+  getBulkActivatedFailuresSimVarName,
+  getBulkDeactivatedFailuresSimVarName,
+  getDeactivateFailureSimVarName,
+} from './sim-vars';
 import { flushPromises } from './test-functions';
 
 describe('FailuresOrchestrator', () => {
@@ -59,6 +64,17 @@ describe('FailuresOrchestrator', () => {
         expect(o.isChanging(identifier)).toBe(false);
       });
 
+      test('while a bulk activated failure is taken over', async () => {
+        const o = bulkOrchestrator();
+
+        await SimVar.SetSimVarValue(bulkActivatedSimVarName, 'number', 2);
+        o.update();
+
+        expect(o.isChanging(identifier)).toBe(true);
+        expect(o.isChanging(otherIdentifier)).toBe(false);
+        expect(SimVar.GetSimVarValue(bulkActivatedSimVarName, 'number')).toBe(0);
+      });
+
       test('while failure is deactivating', async () => {
         const o = orchestrator();
 
@@ -77,19 +93,62 @@ describe('FailuresOrchestrator', () => {
       });
     });
   });
+
+  describe('bulk failures', () => {
+    test('are activated and deactivated through the regular activation', async () => {
+      const o = bulkOrchestrator();
+
+      await SimVar.SetSimVarValue(bulkActivatedSimVarName, 'number', 2);
+      o.update();
+      await flushPromises();
+      expect(SimVar.GetSimVarValue(activateSimVarName, 'number')).toBe(identifier);
+      await SimVar.SetSimVarValue(activateSimVarName, 'number', 0);
+      o.update();
+      await flushPromises();
+
+      expect(o.isActive(identifier)).toBe(true);
+      expect(o.isActive(otherIdentifier)).toBe(false);
+
+      await SimVar.SetSimVarValue(bulkDeactivatedSimVarName, 'number', 2);
+      o.update();
+      await flushPromises();
+      expect(SimVar.GetSimVarValue(deactivateSimVarName, 'number')).toBe(identifier);
+      await SimVar.SetSimVarValue(deactivateSimVarName, 'number', 0);
+      o.update();
+      await flushPromises();
+
+      expect(o.isActive(identifier)).toBe(false);
+      expect(SimVar.GetSimVarValue(bulkDeactivatedSimVarName, 'number')).toBe(0);
+    });
+  });
 });
 
 const prefix = 'PREFIX';
 const activateSimVarName = getActivateFailureSimVarName(prefix);
 const deactivateSimVarName = getDeactivateFailureSimVarName(prefix);
+const bulkActivatedSimVarName = getBulkActivatedFailuresSimVarName(prefix);
+const bulkDeactivatedSimVarName = getBulkDeactivatedFailuresSimVarName(prefix);
 
 const identifier = 123;
 const name = 'test';
+const otherIdentifier = 456;
 
 function orchestrator() {
   return new FailuresOrchestrator(prefix, [[0, identifier, name]]);
 }
 
+// the bulk masks hold the other failure in bit 0 and the failure in bit 1
+function bulkOrchestrator() {
+  return new FailuresOrchestrator(
+    prefix,
+    [
+      [0, identifier, name],
+      [0, otherIdentifier, 'other'],
+    ],
+    [otherIdentifier, identifier],
+  );
+}
+
 function activateFailure(o: FailuresOrchestrator) {
   return activateOrDeactivateFailure(o, true);
 }
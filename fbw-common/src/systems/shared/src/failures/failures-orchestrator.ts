@@ -4,7 +4,12 @@
 
 import { AtaChapterNumber } from '../ata';
 import { QueuedSimVarWriter, SimVarReaderWriter } from './communication';
-import { getActivateFailureSimVarName, getDeactivateFailureSimVarName } from './sim-vars';
+import {
+  getActivateFailureSimVarName,
+  getBulkActivatedFailuresSimVarName,
+  getBulkDeactivatedFailuresSimVarName,
+  getDeactivateFailureSimVarName,
+} from './sim-vars';
 
 export interface Failure {
   ata: AtaChapterNumber;
@@ -18,6 +23,10 @@ export type FailureDefinition = [AtaChapterNumber, number, string];
  * Orchestrates the activation and deactivation of failures.
  *
  * Only a single instance of the orchestrator should exist within the whole application.
+ *
+ * Failures can also be changed in bulk by writing bit masks directly to the failure consumer in the sim. The consumer
+ * acknowledges the applied masks, the orchestrator then takes over the changed failures and sends them through the
+ * regular activation and deactivation so that all consumers share the same state.
  */
 export class FailuresOrchestrator {
   private failures: Failure[] = [];
@@ -30,13 +39,26 @@ export class FailuresOrchestrator {
 
   private deactivateFailureQueue: QueuedSimVarWriter;
 
-  constructor(simVarPrefix: string, failures: FailureDefinition[]) {
+  private bulkActivatedSimVarName: string;
+
+  private bulkDeactivatedSimVarName: string;
+
+  /**
+   * @param bulkFailures the failure identifiers in the order of the bits of the bulk failure masks
+   */
+  constructor(
+    simVarPrefix: string,
+    failures: FailureDefinition[],
+    private readonly bulkFailures: number[] = [],
+  ) {
     this.activateFailureQueue = new QueuedSimVarWriter(
       new SimVarReaderWriter(getActivateFailureSimVarName(simVarPrefix)),
     );
     this.deactivateFailureQueue = new QueuedSimVarWriter(
       new SimVarReaderWriter(getDeactivateFailureSimVarName(simVarPrefix)),
     );
+    this.bulkActivatedSimVarName = getBulkActivatedFailuresSimVarName(simVarPrefix);
+    this.bulkDeactivatedSimVarName = getBulkDeactivatedFailuresSimVarName(simVarPrefix);
     failures.forEach((failure) => {
       this.failures.push({
         ata: failure[0],
@@ -47,6 +69,7 @@ export class FailuresOrchestrator {
   }
 
   update() {
+    this.updateBulk();
     this.activateFailureQueue.update();
     this.deactivateFailureQueue.update();
   }
@@ -86,6 +109,33 @@ export class FailuresOrchestrator {
     return this.changingFailures.has(identifier);
   }
 
+  /**
+   * Takes over the failures acknowledged by the consumer that applied the bulk failure masks.
+   */
+  private updateBulk() {
+    if (this.bulkFailures.length === 0) {
+      return;
+    }
+
+    const activated = SimVar.GetSimVarValue(this.bulkActivatedSimVarName, 'number');
+    const deactivated = SimVar.GetSimVarValue(this.bulkDeactivatedSimVarName, 'number');
+    if (!activated && !deactivated) {
+      return;
+    }
+
+    // the consumer only acknowledges further changes once both are reset
+    SimVar.SetSimVarValue(this.bulkActivatedSimVarName, 'number', 0);
+    SimVar.SetSimVarValue(this.bulkDeactivatedSimVarName, 'number', 0);
+
+    this.bulkFailures.forEach((identifier, bit) => {
+      if (isBitSet(activated, bit)) {
+        this.activate(identifier);
+      } else if (isBitSet(deactivated, bit)) {
+        this.deactivate(identifier);
+      }
+    });
+  }
+
   getAllFailures(): Readonly<Readonly<Failure>[]> {
     return this.failures;
   }
@@ -98,3 +148,7 @@ export class FailuresOrchestrator {
     return new Set(this.changingFailures);
   }
 }
+
+function isBitSet(mask: number, bit: number): boolean {
+  return Math.floor(mask / 2 ** bit) % 2 === 1;
+}
@@ -5,3 +5,11 @@ export function getActivateFailureSimVarName(prefix: string) {
 export function getDeactivateFailureSimVarName(prefix: string) {
   return `L:${prefix}_FAILURE_DEACTIVATE`;
 }
+
+export function getBulkActivatedFailuresSimVarName(prefix: string) {
+  return `L:${prefix}_FAILURE_BULK_ACTIVATED`;
+}
+
+export function getBulkDeactivatedFailuresSimVarName(prefix: string) {
+  return `L:${prefix}_FAILURE_BULK_DEACTIVATED`;
+}
@@ -138,6 +138,12 @@ bool ExampleModule::initialize() {
   if (!exampleDataPtr->requestPeriodicDataFromSim(SIMCONNECT_PERIOD_VISUAL_FRAME)) {
     LOG_ERROR("Failed to request periodic data from sim");
   }
+  // Callbacks can be registered for specific fields (by the index of their data definition) so they
+  // are not called when only other fields changed - e.g. the time fields which change every frame.
+  exampleDataPtr->addFieldCallback(exampleDataPtr->fieldBit(0) | exampleDataPtr->fieldBit(1), [&]() {
+    LOG_INFO("Field callback: light switches changed to strobe=" + std::to_string(exampleDataPtr->data().strobeLightSwitch) +
+             " wing=" + std::to_string(exampleDataPtr->data().wingLightSwitch));
+  });
 #endif
 
 #ifdef CLIENT_DATA_AREA_EXAMPLE
@@ -180,6 +180,7 @@ class ExampleModule : public Module {
   bool update(sGaugeDrawData* pData) override;
   bool postUpdate(sGaugeDrawData* pData) override;
   bool shutdown() override;
+  [[nodiscard]] std::string getName() const override { return "ExampleModule"; }
 
  private:
 #ifdef KEY_EVENT_EXAMPLE
@@ -25,24 +25,34 @@ bool DataManager::preUpdate([[maybe_unused]] sGaugeDrawData* pData) const {
   const UINT64  tickCounter = msfsHandlerPtr->getTickCounter();
 
   // get all variables set to automatically read
-  for (const auto& var : variables) {
-    if (var.second->isAutoRead()) {
-      var.second->updateFromSim(timeStamp, tickCounter);
-    }
+  refreshAutoVariables();
+  // reset the changed flag of the scheduled variables refreshed or set in the last tick
+  CacheableVariable::resetQueuedChangedFlags(timeStamp, tickCounter);
+  for (CacheableVariable* var : autoReadVariables) {
+    var->updateFromSim(timeStamp, tickCounter);
   }
+  autoReadVariableScheduler.update(timeStamp, tickCounter, [&](CacheableVariable* var) {
+    var->updateFromSim(timeStamp, tickCounter);
+    var->queueChangedFlagReset();
+  });
 
   // request all data definitions set to automatically read
-  for (const auto& simObject : simObjects) {
-    if (simObject.second->isAutoRead()) {
-      if (!simObject.second->requestUpdateFromSim(timeStamp, tickCounter)) {
-        LOG_ERROR("DataManager::preUpdate(): requestUpdateFromSim() failed for " + simObject.second->getName());
-      }
+  const auto requestUpdate = [&](SimObjectBase* simObject) {
+    if (!simObject->requestUpdateFromSim(timeStamp, tickCounter)) {
+      LOG_ERROR("DataManager::preUpdate(): requestUpdateFromSim() failed for {}", simObject->getName());
     }
+  };
+  for (SimObjectBase* simObject : autoReadSimObjects) {
+    requestUpdate(simObject);
   }
+  autoReadSimObjectScheduler.update(timeStamp, tickCounter, requestUpdate);
 
   // get requested sim object data
   getRequestedData();
 
+  // call the callbacks of the coalesced key events received since the last tick
+  keyEventDispatchTable.dispatchCoalesced();
+
   LOG_TRACE("DataManager::preUpdate() - done");
   return true;
 }
@@ -65,17 +75,16 @@ bool DataManager::postUpdate([[maybe_unused]] sGaugeDrawData* pData) const {
   }
 
   // write all variables set to automatically write
-  for (const auto& var : variables) {
-    if (var.second->isAutoWrite()) {
-      var.second->updateToSim();
-    }
+  refreshAutoVariables();
+  for (CacheableVariable* var : autoWriteVariables) {
+    var->updateToSim();
   }
 
   // write all data definitions set to automatically write
   for (const auto& ddv : simObjects) {
     if (ddv.second->isAutoWrite()) {
       if (!ddv.second->writeDataToSim()) {
-        LOG_ERROR("DataManager::postUpdate(): updateDataToSim() failed for " + ddv.second->getName());
+        LOG_ERROR("DataManager::postUpdate(): updateDataToSim() failed for {}", ddv.second->getName());
       }
     }
   }
@@ -86,9 +95,16 @@ bool DataManager::postUpdate([[maybe_unused]] sGaugeDrawData* pData) const {
 
 bool DataManager::shutdown() {
   isInitialized = false;
+  autoReadVariables.clear();
+  autoWriteVariables.clear();
+  autoReadVariableScheduler.clear();
+  autoReadSimObjects.clear();
+  autoReadSimObjectScheduler.clear();
+  variableIndices.clear();
   variables.clear();
   simObjects.clear();
   clientEvents.clear();
+  keyEventDispatchTable.clear();
   LOG_INFO("DataManager::shutdown()");
   return true;
 }
@@ -124,30 +140,31 @@ NamedVariablePtr DataManager::make_named_var(const std::string& varName,
   // Check which update method and frequency to use - if two variables are the same,
   // then use the update method and frequency of the automated one with faster
   // update frequency
-  const auto pair = variables.find(uniqueName);
-  if (pair != variables.end()) {
-    if (!pair->second->isAutoRead() && (updateMode & UpdateMode::AUTO_READ)) {
-      pair->second->setAutoRead(true);
+  const auto pair = variableIndices.find(uniqueName);
+  if (pair != variableIndices.end()) {
+    const CacheableVariablePtr& existing = variables[pair->second];
+    if (!existing->isAutoRead() && (updateMode & UpdateMode::AUTO_READ)) {
+      existing->setAutoRead(true);
     }
-    if (pair->second->getMaxAgeTime() > maxAgeTime) {
-      pair->second->setMaxAgeTime(maxAgeTime);
+    if (existing->getMaxAgeTime() > maxAgeTime) {
+      existing->setMaxAgeTime(maxAgeTime);
     }
-    if (pair->second->getMaxAgeTicks() > maxAgeTicks) {
-      pair->second->setMaxAgeTicks(maxAgeTicks);
+    if (existing->getMaxAgeTicks() > maxAgeTicks) {
+      existing->setMaxAgeTicks(maxAgeTicks);
     }
-    if (!pair->second->isAutoWrite() & (updateMode & UpdateMode::AUTO_WRITE)) {
-      pair->second->setAutoWrite(true);
+    if (!existing->isAutoWrite() & (updateMode & UpdateMode::AUTO_WRITE)) {
+      existing->setAutoWrite(true);
     }
-    LOG_DEBUG("DataManager::make_named_var(): already exists: " + pair->second->str());
-    return std::dynamic_pointer_cast<NamedVariable>(pair->second);
+    LOG_DEBUG("DataManager::make_named_var(): already exists: {}", uniqueName);
+    return std::dynamic_pointer_cast<NamedVariable>(existing);
   }
 
   // Create new var and store it in the map
   // We can set the noPrefix flag to true as we already checked and added the prefix above
-  NamedVariablePtr var  = NamedVariablePtr(new NamedVariable(prefixedVarName, unit, updateMode, maxAgeTime, maxAgeTicks, true));
-  variables[uniqueName] = var;
+  NamedVariablePtr var = NamedVariablePtr(new NamedVariable(prefixedVarName, unit, updateMode, maxAgeTime, maxAgeTicks, true));
+  addVariable(uniqueName, var);
 
-  LOG_DEBUG("DataManager::make_named_var(): created variable " + var->str());
+  LOG_DEBUG("DataManager::make_named_var(): created variable {}", uniqueName);
   return var;
 }
 
@@ -168,22 +185,23 @@ AircraftVariablePtr DataManager::make_aircraft_var(const std::string&    varName
   // Check if variable already exists.
   // Check which update method and frequency to use - if two variables are the same
   // use the update method and frequency of the automated one with faster update frequency
-  const auto pair = variables.find(uniqueName);
-  if (pair != variables.end()) {
-    if (!pair->second->isAutoRead() && (updateMode & UpdateMode::AUTO_READ)) {
-      pair->second->setAutoRead(true);
+  const auto pair = variableIndices.find(uniqueName);
+  if (pair != variableIndices.end()) {
+    const CacheableVariablePtr& existing = variables[pair->second];
+    if (!existing->isAutoRead() && (updateMode & UpdateMode::AUTO_READ)) {
+      existing->setAutoRead(true);
     }
-    if (pair->second->getMaxAgeTime() > maxAgeTime) {
-      pair->second->setMaxAgeTime(maxAgeTime);
+    if (existing->getMaxAgeTime() > maxAgeTime) {
+      existing->setMaxAgeTime(maxAgeTime);
     }
-    if (pair->second->getMaxAgeTicks() > maxAgeTicks) {
-      pair->second->setMaxAgeTicks(maxAgeTicks);
+    if (existing->getMaxAgeTicks() > maxAgeTicks) {
+      existing->setMaxAgeTicks(maxAgeTicks);
     }
-    if (!pair->second->isAutoWrite() & (updateMode & UpdateMode::AUTO_WRITE)) {
-      pair->second->setAutoWrite(true);
+    if (!existing->isAutoWrite() & (updateMode & UpdateMode::AUTO_WRITE)) {
+      existing->setAutoWrite(true);
     }
-    LOG_DEBUG("DataManager::make_aircraft_var(): already exists: " + pair->second->str());
-    return std::dynamic_pointer_cast<AircraftVariable>(pair->second);
+    LOG_DEBUG("DataManager::make_aircraft_var(): already exists: {}", uniqueName);
+    return std::dynamic_pointer_cast<AircraftVariable>(existing);
   }
 
   // Create new var and store it in the map
@@ -192,9 +210,9 @@ AircraftVariablePtr DataManager::make_aircraft_var(const std::string&    varName
           ? AircraftVariablePtr(new AircraftVariable(varName, index, setterEvent, unit, updateMode, maxAgeTime, maxAgeTicks))
           : AircraftVariablePtr(
                 new AircraftVariable(varName, index, std::move(setterEventName), unit, updateMode, maxAgeTime, maxAgeTicks));
-  variables[uniqueName] = var;
+  addVariable(uniqueName, var);
 
-  LOG_DEBUG("DataManager::make_aircraft_var(): created variable " + var->str());
+  LOG_DEBUG("DataManager::make_aircraft_var(): created variable {}", uniqueName);
   return var;
 }
 
@@ -204,7 +222,7 @@ ClientEventPtr DataManager::make_client_event(const std::string&               c
   // find existing event instance for this event
   for (const auto& event : clientEvents) {
     if (event.second->getClientEventName() == clientEventName) {
-      LOG_DEBUG("DataManager::make_event(): already exists: " + event.second->str());
+      LOG_DEBUG("DataManager::make_event(): already exists: {}", clientEventName);
       return event.second;
     }
   }
@@ -218,7 +236,7 @@ ClientEventPtr DataManager::make_client_event(const std::string&               c
   if (notificationGroupId != SIMCONNECT_UNUSED) {
     clientEvent->addClientEventToNotificationGroup(notificationGroupId);
   }
-  LOG_DEBUG("DataManager::make_client_event(): created client event " + clientEvent->str());
+  LOG_DEBUG("DataManager::make_client_event(): created client event {} with ID {}", clientEventName, clientEvent->getClientEventId());
   return clientEvent;
 }
 
@@ -228,60 +246,112 @@ ClientEventPtr DataManager::make_client_event(const std::string&               c
 
 KeyEventCallbackID DataManager::addKeyEventCallback(KeyEventID keyEventId, const KeyEventCallbackFunction& callback) {
   auto id = keyEventCallbackIDGen.getNextId();
-  if (!keyEventCallbacks.contains(keyEventId)) {
-    keyEventCallbacks.insert({keyEventId, {{id, callback}}});
-  } else {
-    keyEventCallbacks[keyEventId].insert({id, callback});
-  }
-  LOG_DEBUG("Added callback to key event " + std::to_string(keyEventId) + " with ID " + std::to_string(id) + " and " +
-            std::to_string(keyEventCallbacks[keyEventId].size()) + " callbacks");
+  keyEventDispatchTable.add(keyEventId, id, callback);
+  LOG_DEBUG("Added callback to key event {} with ID {} and {} callbacks", keyEventId, id, keyEventDispatchTable.size(keyEventId));
   return id;
 }
 
 bool DataManager::removeKeyEventCallback(KeyEventID keyEventId, KeyEventCallbackID callbackId) {
-  const auto eventPair = keyEventCallbacks.find(keyEventId);
-  if (eventPair != keyEventCallbacks.end()) {
-    const auto callbackPair = eventPair->second.find(callbackId);
-    if (callbackPair != eventPair->second.end()) {
-      eventPair->second.erase(callbackPair);
-      LOG_DEBUG("Removed callback from key event " + std::to_string(keyEventId) + " with ID " + std::to_string(callbackId) + " and " +
-                std::to_string(eventPair->second.size()) + " callbacks left");
-      if (eventPair->second.empty()) {
-        keyEventCallbacks.erase(eventPair);
-      }
-      return true;
-    }
+  if (keyEventDispatchTable.remove(keyEventId, callbackId)) {
+    LOG_DEBUG("Removed callback from key event {} with ID {} and {} callbacks left", keyEventId, callbackId,
+              keyEventDispatchTable.size(keyEventId));
+    return true;
   }
-  LOG_WARN("Failed to remove callback from key event" + std::to_string(keyEventId) + "with ID " + std::to_string(callbackId));
+  LOG_WARN("Failed to remove callback from key event {} with ID {}", keyEventId, callbackId);
   return false;
 }
 
+void DataManager::setKeyEventCoalescing(KeyEventID keyEventId, bool coalescing) {
+  keyEventDispatchTable.setCoalescing(keyEventId, coalescing);
+  LOG_DEBUG("Set coalescing of key event {} to {}", keyEventId, coalescing);
+}
+
 bool DataManager::sendKeyEvent(KeyEventID keyEventId, DWORD param0, DWORD param1, DWORD param2, DWORD param3, DWORD param4) {
   auto result = trigger_key_event_EX1(keyEventId, param0, param1, param2, param3, param4);
   if (result == 0) {
-    LOG_VERBOSE("Sent key event " + std::to_string(keyEventId) + " with params " + std::to_string(param0) + ", " + std::to_string(param1) +
-                ", " + std::to_string(param2) + ", " + std::to_string(param3) + ", " + std::to_string(param4));
+    LOG_VERBOSE("Sent key event {} with params {}, {}, {}, {}, {}", keyEventId, param0, param1, param2, param3, param4);
     return true;
   }
-  LOG_WARN("Failed to send key event " + std::to_string(keyEventId) + " with params " + std::to_string(param0) + ", " +
-           std::to_string(param1) + ", " + std::to_string(param2) + ", " + std::to_string(param3) + ", " + std::to_string(param4) +
-           " with error code " + std::to_string(result));
+  LOG_WARN("Failed to send key event {} with params {}, {}, {}, {}, {} with error code {}", keyEventId, param0, param1, param2, param3,
+           param4, result);
   return false;
 }
 
 void DataManager::processKeyEvent(KeyEventID keyEventId, UINT32 evdata0, UINT32 evdata1, UINT32 evdata2, UINT32 evdata3, UINT32 evdata4) {
-  const auto eventPair = keyEventCallbacks.find(keyEventId);
-  if (eventPair != keyEventCallbacks.end()) {
-    for (const auto& callbackPair : eventPair->second) {
-      callbackPair.second(evdata0, evdata1, evdata2, evdata3, evdata4);
-    }
-  }
+  keyEventDispatchTable.process(keyEventId, evdata0, evdata1, evdata2, evdata3, evdata4);
 }
 
 // =================================================================================================
 // Private methods
 // =================================================================================================
 
+void DataManager::addVariable(const std::string& uniqueName, const CacheableVariablePtr& var) {
+  variableIndices[uniqueName] = variables.size();
+  variables.push_back(var);
+  if (var->isAutoRead()) {
+    addAutoReadVariable(var.get(), variables.size() - 1);
+  }
+  if (var->isAutoWrite()) {
+    autoWriteVariables.push_back(var.get());
+  }
+}
+
+void DataManager::addSimObject(const SimObjectBasePtr& simObject) {
+  simObjects.insert({simObject->getRequestId(), simObject});
+  if (simObject->isAutoRead()) {
+    addAutoReadSimObject(simObject.get());
+  }
+}
+
+void DataManager::addAutoReadVariable(CacheableVariable* var, std::size_t index, bool isRescheduled) const {
+  if (var->hasMaxAge() && isRescheduled) {
+    autoReadVariableScheduler.reschedule(var, index);
+  } else if (var->hasMaxAge()) {
+    autoReadVariableScheduler.add(var, index);
+  } else {
+    autoReadVariables.push_back(var);
+  }
+}
+
+void DataManager::addAutoReadSimObject(SimObjectBase* simObject, bool isRescheduled) const {
+  if (simObject->hasMaxAge() && isRescheduled) {
+    autoReadSimObjectScheduler.reschedule(simObject, simObject->getRequestId());
+  } else if (simObject->hasMaxAge()) {
+    autoReadSimObjectScheduler.add(simObject, simObject->getRequestId());
+  } else {
+    autoReadSimObjects.push_back(simObject);
+  }
+}
+
+void DataManager::refreshAutoVariables() const {
+  const UINT64 updateModeChangeCounter = ManagedDataObjectBase::getUpdateModeChangeCounter();
+  if (updateModeChangeCounter == autoVariablesUpdateModeChangeCounter) {
+    return;
+  }
+  autoVariablesUpdateModeChangeCounter = updateModeChangeCounter;
+
+  autoReadVariables.clear();
+  autoWriteVariables.clear();
+  autoReadVariableScheduler.clear();
+  for (std::size_t i = 0; i < variables.size(); i++) {
+    CacheableVariable* var = variables[i].get();
+    if (var->isAutoRead()) {
+      addAutoReadVariable(var, i, true);
+    }
+    if (var->isAutoWrite()) {
+      autoWriteVariables.push_back(var);
+    }
+  }
+
+  autoReadSimObjects.clear();
+  autoReadSimObjectScheduler.clear();
+  for (const auto& [_, simObject] : simObjects) {
+    if (simObject->isAutoRead()) {
+      addAutoReadSimObject(simObject.get(), true);
+    }
+  }
+}
+
 void DataManager::processDispatchMessage(SIMCONNECT_RECV* pRecv, [[maybe_unused]] DWORD* cbData) const {
   switch (pRecv->dwID) {
     case SIMCONNECT_RECV_ID_SIMOBJECT_DATA:  // fallthrough
@@ -308,14 +378,14 @@ void DataManager::processDispatchMessage(SIMCONNECT_RECV* pRecv, [[maybe_unused]
     case SIMCONNECT_RECV_ID_EXCEPTION: {
       auto* const pException = reinterpret_cast<SIMCONNECT_RECV_EXCEPTION*>(pRecv);
       std::ignore            = pException;
-      LOG_ERROR("DataManager: Exception in SimConnect connection: " +
-                SimconnectExceptionStrings::getSimConnectExceptionString(static_cast<SIMCONNECT_EXCEPTION>(pException->dwException)) +
-                " send_id:" + std::to_string(pException->dwSendID) + " index:" + std::to_string(pException->dwIndex));
+      LOG_ERROR("DataManager: Exception in SimConnect connection: {} send_id:{} index:{}",
+                SimconnectExceptionStrings::getSimConnectExceptionString(static_cast<SIMCONNECT_EXCEPTION>(pException->dwException)),
+                pException->dwSendID, pException->dwIndex);
       break;
     }
 
     default:
-      LOG_WARN("DataManager: Unknown/Unimplemented SimConnect message received: " + std::to_string(pRecv->dwID));
+      LOG_WARN("DataManager: Unknown/Unimplemented SimConnect message received: {}", pRecv->dwID);
       break;
   }
 }
@@ -327,7 +397,7 @@ void DataManager::processSimObjectData(SIMCONNECT_RECV* pData) const {
     pair->second->processSimData(pData, msfsHandlerPtr->getTimeStamp(), msfsHandlerPtr->getTickCounter());
     return;
   }
-  LOG_ERROR("DataManager::processSimObjectData() - unknown request id: " + std::to_string(pSimobjectData->dwRequestID));
+  LOG_ERROR("DataManager::processSimObjectData() - unknown request id: {}", pSimobjectData->dwRequestID);
 }
 
 void DataManager::processEvent(const SIMCONNECT_RECV_EVENT* pRecv) const {
@@ -336,7 +406,7 @@ void DataManager::processEvent(const SIMCONNECT_RECV_EVENT* pRecv) const {
     pair->second->processEvent(pRecv->dwData);
     return;
   }
-  LOG_WARN("DataManager::processEvent() - unknown event id: " + std::to_string(pRecv->uEventID));
+  LOG_WARN("DataManager::processEvent() - unknown event id: {}", pRecv->uEventID);
 }
 
 void DataManager::processEvent(const SIMCONNECT_RECV_EVENT_EX1* pRecv) const {
@@ -345,5 +415,5 @@ void DataManager::processEvent(const SIMCONNECT_RECV_EVENT_EX1* pRecv) const {
     pair->second->processEvent(pRecv->dwData0, pRecv->dwData1, pRecv->dwData2, pRecv->dwData3, pRecv->dwData4);
     return;
   }
-  LOG_WARN("DataManager::processEvent() - unknown event id: " + std::to_string(pRecv->uEventID));
+  LOG_WARN("DataManager::processEvent() - unknown event id: {}", pRecv->uEventID);
 }
@@ -8,12 +8,16 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 #include <MSFS/Legacy/gauges.h>
 #include <MSFS/MSFS.h>
 #include <SimConnect.h>
 
 #include "IDGenerator.h"
+#include "KeyEventDispatchTable.hpp"
+#include "RefreshScheduler.hpp"
 #include "SimUnits.h"
 #include "logging.h"
 #include "simple_assert.h"
@@ -74,22 +78,42 @@ class DataManager {
   // Handle to the simconnect instance.
   HANDLE hSimConnect{};
 
-  // A map of all registered variables.
-  // Map over the variable name to quickly find the variable.
+  // All registered variables stored contiguously in the order of registration.
+  std::vector<CacheableVariablePtr> variables{};
+
+  // Hashed lookup from the unique name of a variable to its index in the variables vector.
   // De-duplication of variables happens via this map. So each aspect of a variable needs to be
   // part of the unique name - e.g. the index or unit.
-  std::map<std::string, CacheableVariablePtr> variables{};
+  std::unordered_map<std::string, std::size_t> variableIndices{};
+
+  // Dense lists of the variables marked for automatic reading and writing so the update loops do
+  // not need to check every registered variable every tick.
+  // Auto read variables with a max age are not in the list but filed by their next due tick or time
+  // in the scheduler so each tick only touches the variables which are due.
+  // These are maintained when variables are registered and rebuilt when the update mode or max age of
+  // any variable has changed (see ManagedDataObjectBase::getUpdateModeChangeCounter()).
+  mutable std::vector<CacheableVariable*>     autoReadVariables{};
+  mutable std::vector<CacheableVariable*>     autoWriteVariables{};
+  mutable RefreshScheduler<CacheableVariable> autoReadVariableScheduler{};
+  mutable UINT64                              autoVariablesUpdateModeChangeCounter = 0;
 
   // A map of all registered SimObjects.
   // Map over the request id to quickly find the SimObject.
   std::map<SIMCONNECT_DATA_REQUEST_ID, SimObjectBasePtr> simObjects{};
 
+  // The auto read SimObjects requested every tick in the order of their request id and the
+  // scheduler for the auto read SimObjects with a max age.
+  mutable std::vector<SimObjectBase*>     autoReadSimObjects{};
+  mutable RefreshScheduler<SimObjectBase> autoReadSimObjectScheduler{};
+
   // A map of all registered events.
   // Map over the event id to quickly find the event.
   std::map<SIMCONNECT_CLIENT_EVENT_ID, ClientEventPtr> clientEvents{};
 
-  // Map of callback maps to be called when a key event is triggered in the sim.
-  std::map<KeyEventID, std::map<KeyEventCallbackID, KeyEventCallbackFunction>> keyEventCallbacks{};
+  // Dispatch table of the callbacks to be called when a key event is triggered in the sim.
+  // Indexed by the key event id with the callbacks of each key event stored contiguously.
+  // Mutable as the coalesced key events are dispatched in preUpdate().
+  mutable KeyEventDispatchTable<KeyEventCallbackFunction> keyEventDispatchTable{};
 
   // Flag to indicate if the data manager is initialized.
   bool isInitialized = false;
@@ -278,7 +302,7 @@ class DataManager {
     }
     DataDefinitionVariablePtr<T> var = DataDefinitionVariablePtr<T>(new DataDefinitionVariable<T>(
         hSimConnect, name, dataDefinitions, dataDefIDGen.getNextId(), dataReqIDGen.getNextId(), updateMode, maxAgeTime, maxAgeTicks));
-    simObjects.insert({var->getRequestId(), var});
+    addSimObject(var);
     LOG_DEBUG("DataManager::make_datadefinition_var(): " + name);
     return var;
   }
@@ -339,7 +363,7 @@ class DataManager {
     ClientDataAreaVariablePtr<T> var = ClientDataAreaVariablePtr<T>(
         new ClientDataAreaVariable<T>(hSimConnect, clientDataName, clientDataIDGen.getNextId(), dataDefIDGen.getNextId(),
                                       dataReqIDGen.getNextId(), sizeof(T), updateMode, maxAgeTime, maxAgeTicks));
-    simObjects.insert({var->getRequestId(), var});
+    addSimObject(var);
     LOG_DEBUG("DataManager::make_datadefinition_var(): " + clientDataName);
     return var;
   }
@@ -384,7 +408,7 @@ class DataManager {
         StreamingClientDataAreaVariablePtr<T, ChunkSize>(new StreamingClientDataAreaVariable<T, ChunkSize>(
             hSimConnect, clientDataName, clientDataIDGen.getNextId(), dataDefIDGen.getNextId(), dataReqIDGen.getNextId(), updateMode,
             maxAgeTime, maxAgeTicks));
-    simObjects.insert({var->getRequestId(), var});
+    addSimObject(var);
     LOG_DEBUG("DataManager::make_clientdataarea_buffered_var(): " + clientDataName);
     return var;
   }
@@ -509,6 +533,25 @@ class DataManager {
    */
   bool removeKeyEventCallback(KeyEventID keyEventId, KeyEventCallbackID callbackId);
 
+  /**
+   * Sets if a key event is coalesced.<br/>
+   * The callbacks of a coalesced key event are not called for every key event received from the sim
+   * but once per tick in preUpdate() with the parameters of the latest key event received since the
+   * last tick. This is meant for high frequency key events where only the latest value matters (e.g.
+   * KEY_AXIS_ELEVATOR_SET) and must not be used for key events where each occurrence matters (e.g.
+   * KEY_INCREMENT_* or indexed key events).<br/>
+   * OBS: The callbacks of a coalesced key event are not called while the sim is paused.
+   * @param keyEventId The ID of the key event.
+   * @param coalescing true to coalesce the key event, false to call its callbacks for every key event
+   */
+  void setKeyEventCoalescing(KeyEventID keyEventId, bool coalescing);
+
+  /**
+   * @param keyEventId The ID of the key event.
+   * @return true if the key event is coalesced, false otherwise
+   */
+  [[nodiscard]] bool isKeyEventCoalescing(KeyEventID keyEventId) const { return keyEventDispatchTable.isCoalescing(keyEventId); }
+
   /**
    * Sends a key event to the sim.
    * Specifies up to 5 additional integer values (param0-4).
@@ -554,6 +597,43 @@ class DataManager {
   // Private methods
   // =================================================================================================
 
+  /**
+   * @brief Adds a new variable to the registry and to the lists of auto read and auto write variables.
+   * @param uniqueName the unique name of the variable used for de-duplication
+   * @param var the variable to add
+   */
+  void addVariable(const std::string& uniqueName, const CacheableVariablePtr& var);
+
+  /**
+   * @brief Adds a new SimObject to the registry and to the list or scheduler of auto read SimObjects.
+   * @param simObject the SimObject to add
+   */
+  void addSimObject(const SimObjectBasePtr& simObject);
+
+  /**
+   * @brief Adds an auto read variable to the list of variables read every tick or to the scheduler
+   * if it has a max age.
+   * @param var the variable to add
+   * @param index the index of the variable in the variables vector
+   * @param isRescheduled true if the variable keeps its stamps in the scheduler instead of being due in the next tick
+   */
+  void addAutoReadVariable(CacheableVariable* var, std::size_t index, bool isRescheduled = false) const;
+
+  /**
+   * @brief Adds an auto read SimObject to the list of SimObjects requested every tick or to the
+   * scheduler if it has a max age.
+   * @param simObject the SimObject to add
+   * @param isRescheduled true if the SimObject keeps its stamps in the scheduler instead of being due in the next tick
+   */
+  void addAutoReadSimObject(SimObjectBase* simObject, bool isRescheduled = false) const;
+
+  /**
+   * @brief Rebuilds the lists and schedulers of auto read and auto write variables and SimObjects
+   * if the update mode or max age of any variable has changed since the last call. Scheduled variables and
+   * SimObjects keep their stamps, so they are not all due in the same tick after a rebuild.
+   */
+  void refreshAutoVariables() const;
+
   /**
    * This is called everytime we receive a message from the sim in getRequestedData().
    * @param pRecv
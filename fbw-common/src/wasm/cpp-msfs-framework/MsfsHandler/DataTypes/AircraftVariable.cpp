@@ -7,12 +7,12 @@
 
 FLOAT64 AircraftVariable::rawReadFromSim() const {
   if (dataID == -1) {
-    LOG_ERROR("Aircraft variable " + name + " not found in the Simulator");
+    LOG_ERROR("Aircraft variable {} not found in the Simulator", name);
     return FLOAT64{};
   }
   const FLOAT64 value = aircraft_varget(dataID, unit.id, index);
-  LOG_TRACE("AircraftVariable::rawReadFromSim() " + this->name + std::to_string(this->index) + " fromSim = " + std::to_string(value) +
-            " cached  = " + std::to_string(cachedValue.value_or(-999999)) + " as " + unit.name);
+  LOG_TRACE("AircraftVariable::rawReadFromSim() {}{} fromSim = {} cached  = {} as {}", this->name, this->index, value,
+            cachedValue.value_or(-999999), unit.name);
   return value;
 }
 
@@ -11,21 +11,21 @@
 FLOAT64 CacheableVariable::get() const {
   if (cachedValue.has_value()) {
     if (_warnIfDirty && dirty) {
-      LOG_WARN("CacheableVariable::get() called on " + name + " but the value is dirty");
+      LOG_WARN("CacheableVariable::get() called on {} but the value is dirty", name);
     }
     return cachedValue.value();
   }
-  LOG_ERROR("CacheableVariable::get() called on " + name + " but no value is cached");
+  LOG_ERROR("CacheableVariable::get() called on {} but no value is cached", name);
   return 0.0;
 }
 
 FLOAT64 CacheableVariable::updateFromSim(FLOAT64 timeStamp, UINT64 tickCounter) {
   if (cachedValue.has_value() && !needsUpdateFromSim(timeStamp, tickCounter)) {
     setChanged(false);
-    LOG_TRACE("CacheableVariable::updateFromSim() - from cache " + this->name + " " + str());
+    LOG_TRACE("CacheableVariable::updateFromSim() - from cache {} {}", this->name, str());
     return cachedValue.value();
   }
-  LOG_TRACE("CacheableVariable::updateFromSim() - read from sim " + this->name + " " + str());
+  LOG_TRACE("CacheableVariable::updateFromSim() - read from sim {} {}", this->name, str());
   updateStamps(timeStamp, tickCounter);
   return readFromSim();
 }
@@ -48,6 +48,10 @@ void CacheableVariable::set(FLOAT64 value) {
   cachedValue = value;
   dirty       = true;
   setChanged(true);
+  // variables updated every tick reset their changed flag in the next tick anyway
+  if (isAutoRead() && hasMaxAge()) {
+    queueChangedFlagReset();
+  }
 }
 
 void CacheableVariable::updateToSim() {
@@ -67,5 +71,5 @@ void CacheableVariable::writeToSim() {
     rawWriteToSim();
     return;
   }
-  LOG_ERROR("CacheableVariable::writeDataToSim() called on [" + name + "] but no value is cached");
+  LOG_ERROR("CacheableVariable::writeDataToSim() called on [{}] but no value is cached", name);
 }
@@ -9,6 +9,7 @@
 
 #include <MSFS/Legacy/gauges.h>
 
+#include "DeferredNotificationQueue.hpp"
 #include "ManagedDataObjectBase.hpp"
 #include "SimUnits.h"
 #include "UpdateMode.h"
@@ -56,6 +57,16 @@ class CacheableVariable : public ManagedDataObjectBase {
    */
   bool _warnIfDirty = false;
 
+  // Flag to indicate if the variable is in the queue of variables to reset the changed flag of.
+  bool changedFlagResetQueuedFlag = false;
+
+  /**
+   * The auto read variables with a max age which were refreshed or set in the last tick. These are
+   * updated once more by the DataManager in the next tick so their changed flag is reset as for the
+   * variables updated every tick.
+   */
+  inline static DeferredNotificationQueue<CacheableVariable, &CacheableVariable::changedFlagResetQueuedFlag> changedFlagResetQueue{};
+
  protected:
   /**
    * The epsilon required to change a variable after a read from the sim. This is used to
@@ -87,6 +98,11 @@ class CacheableVariable : public ManagedDataObjectBase {
   CacheableVariable(CacheableVariable&&)                 = delete;  // no move constructor
   CacheableVariable& operator=(CacheableVariable&&)      = delete;  // no move assignment
 
+  /**
+   * Removes the variable from the queue of variables to reset the changed flag of.
+   */
+  ~CacheableVariable() override { changedFlagResetQueue.remove(this); }
+
   /**
    * Returns the cached value or the default value (FLOAT64{}) if the cache is empty.<p/>
    *
@@ -139,8 +155,32 @@ class CacheableVariable : public ManagedDataObjectBase {
    */
   [[nodiscard]] virtual FLOAT64 rawReadFromSim() const = 0;
 
+  /**
+   * Queues the variable to be updated once more in the next tick so its changed flag is reset
+   * if it is not due for a refresh from the sim then.<p/>
+   * Used for auto read variables with a max age, which are not updated every tick.
+   */
+  void queueChangedFlagReset() { changedFlagResetQueue.push(this); }
+
+  /**
+   * Resets the changed flag of the variables queued by queueChangedFlagReset() since the last call
+   * by updating them from the cache. Variables due for a refresh from the sim are skipped as they are
+   * refreshed by the DataManager's scheduler in this tick, which sets their changed flag.<p/>
+   * Called by the DataManager once per tick before the auto read variables are refreshed.
+   * @param timeStamp the current sim time (taken from the sim update event)
+   * @param tickCounter the current tick counter (taken from a custom counter at each update event
+   */
+  static void resetQueuedChangedFlags(FLOAT64 timeStamp, UINT64 tickCounter) {
+    changedFlagResetQueue.dispatch([&](CacheableVariable* var) {
+      if (!var->needsUpdateFromSim(timeStamp, tickCounter)) {
+        var->updateFromSim(timeStamp, tickCounter);
+      }
+    });
+  }
+
   /**
    * Sets the cache value and marks the variable as dirty.<p/>
+   * Auto read variables with a max age are queued to reset their changed flag in the next tick.<p/>
    * Does not write the value to the sim or update the time and tick stamps.
    * Check this variable's updateMode to see if the value will be written automatically to the sim or
    * if you need to write it manually.
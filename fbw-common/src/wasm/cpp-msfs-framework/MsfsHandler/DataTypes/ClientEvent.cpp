@@ -105,32 +105,30 @@ void ClientEvent::setNotificationGroupPriority(SIMCONNECT_NOTIFICATION_GROUP_ID
 
 void ClientEvent::trigger(DWORD data0) const {
   if (!registeredToSim) {
-    LOG_ERROR("Cannot trigger event " + clientEventName + " as it is not registered to the sim");
+    LOG_ERROR("Cannot trigger event {} as it is not registered to the sim", clientEventName);
     return;
   }
   if (!SUCCEEDED(SimConnect_TransmitClientEvent(hSimConnect, SIMCONNECT_OBJECT_ID_USER, clientEventId, data0,
                                                 SIMCONNECT_GROUP_PRIORITY_HIGHEST, SIMCONNECT_EVENT_FLAG_GROUPID_IS_PRIORITY))) {
-    LOG_ERROR("Failed to trigger event " + clientEventName + " with client event " + std::to_string(clientEventId));
+    LOG_ERROR("Failed to trigger event {} with client event {}", clientEventName, clientEventId);
     return;
   }
-  LOG_VERBOSE("Triggered event " + clientEventName + " with client event " + std::to_string(clientEventId) + " with data " +
-              std::to_string(data0));
+  LOG_VERBOSE("Triggered event {} with client event {} with data {}", clientEventName, clientEventId, data0);
 }
 
 void ClientEvent::trigger_ex1(DWORD data0, DWORD data1, DWORD data2, DWORD data3, DWORD data4) const {
   if (!registeredToSim) {
-    LOG_ERROR("Cannot trigger_ex1 event " + clientEventName + " as it is not registered to the sim");
+    LOG_ERROR("Cannot trigger_ex1 event {} as it is not registered to the sim", clientEventName);
     return;
   }
   if (!SUCCEEDED(SimConnect_TransmitClientEvent_EX1(hSimConnect, SIMCONNECT_OBJECT_ID_USER, clientEventId,
                                                     SIMCONNECT_GROUP_PRIORITY_HIGHEST, SIMCONNECT_EVENT_FLAG_GROUPID_IS_PRIORITY, data0,
                                                     data1, data2, data3, data4))) {
-    LOG_ERROR("Failed to trigger_ex1 event " + clientEventName + " with client ID " + std::to_string(clientEventId));
+    LOG_ERROR("Failed to trigger_ex1 event {} with client ID {}", clientEventName, clientEventId);
     return;
   }
-  LOG_VERBOSE("Triggered_ex1 event " + clientEventName + " with client ID " + std::to_string(clientEventId) + " with data " +
-              std::to_string(data0) + ", " + std::to_string(data1) + ", " + std::to_string(data2) + ", " + std::to_string(data3) + ", " +
-              std::to_string(data4));
+  LOG_VERBOSE("Triggered_ex1 event {} with client ID {} with data {}, {}, {}, {}, {}", clientEventName, clientEventId, data0, data1,
+              data2, data3, data4);
 }
 
 // =================================================================================================
@@ -6,6 +6,8 @@
 
 #include <memory>
 
+#include "CallbackList.hpp"
+#include "FieldRanges.hpp"
 #include "SimObjectBase.hpp"
 #include "SimUnits.h"
 #include "UpdateMode.h"
@@ -65,7 +67,13 @@ struct DataDefinition {
  * data by using this method to request the data: requestPeriodicUpdateFromSim().<p/>
  *
  * It is recommended to use the DataManager's make_datadefinition_var() to create instances of
- * DataDefinitionVariable as it ensures unique ids for the data definition and request.
+ * DataDefinitionVariable as it ensures unique ids for the data definition and request.<p/>
+ *
+ * The data received from the sim is compared field by field using the sizes of the data definitions'
+ * data types (SimConnect sends the fields packed in the order of the definitions). The changed fields
+ * are available as a bitmask (bit i for data definition i) and callbacks can be registered for
+ * changes of specific fields with addFieldCallback(). Data definitions beyond the 64th share the
+ * last bit.
  *
  * @tparam T The data struct type that will be used to store the data from the sim.
  * @see requestPeriodicUpdateFromSim()
@@ -86,6 +94,19 @@ class DataDefinitionVariable : public SimObjectBase {
   // The data struct that will be used to store the data from the sim.
   T dataStruct{};
 
+  // Byte ranges of the fields in the order of the data definitions - clipped to the size of T
+  FieldRanges fieldRanges{sizeof(T)};
+
+  // Bitmask of the fields which changed with the last data received from the sim
+  UINT64 changedFields = 0;
+
+  // Bitmask of the changed fields not yet notified to the field callbacks (accumulated for
+  // deferred notifications)
+  UINT64 unnotifiedFields = 0;
+
+  // Callbacks with the bitmask of the fields they are registered for - in the order of registration.
+  CallbackList fieldCallbacks{};
+
   /**
    * Creates a new instance of a DataDefinitionVariable.<p/>
    *
@@ -125,6 +146,71 @@ class DataDefinitionVariable : public SimObjectBase {
         LOG_ERROR("Failed to add " + definition.name + " to data definition.");
       }
     }
+    initFieldRanges();
+  }
+
+  /**
+   * Calculates the byte range of each data definition's field in the data struct from the sizes of
+   * the data types. A data type of unknown size (e.g. SIMCONNECT_DATATYPE_STRINGV) extends to the
+   * end of the struct.
+   */
+  void initFieldRanges() {
+    for (const auto& definition : dataDefinitions) {
+      fieldRanges.add(dataTypeSize(definition.dataType));
+    }
+    if (fieldRanges.declaredSize() != sizeof(T)) {
+      LOG_WARN("DataDefinitionVariable: Size of the data definitions (" + std::to_string(fieldRanges.declaredSize()) +
+               ") does not match the size of the data struct (" + std::to_string(sizeof(T)) + "): " + name);
+    }
+  }
+
+  /**
+   * @param dataType the SimConnect data type
+   * @return the size of the data type in bytes or 0 if the size is variable or unknown
+   */
+  static std::size_t dataTypeSize(SIMCONNECT_DATATYPE dataType) {
+    switch (dataType) {
+      case SIMCONNECT_DATATYPE_INT32:
+      case SIMCONNECT_DATATYPE_FLOAT32:
+        return 4;
+      case SIMCONNECT_DATATYPE_INT64:
+      case SIMCONNECT_DATATYPE_FLOAT64:
+      case SIMCONNECT_DATATYPE_STRING8:
+        return 8;
+      case SIMCONNECT_DATATYPE_STRING32:
+        return 32;
+      case SIMCONNECT_DATATYPE_STRING64:
+        return 64;
+      case SIMCONNECT_DATATYPE_STRING128:
+        return 128;
+      case SIMCONNECT_DATATYPE_STRING256:
+        return 256;
+      case SIMCONNECT_DATATYPE_STRING260:
+        return 260;
+      case SIMCONNECT_DATATYPE_LATLONALT:
+      case SIMCONNECT_DATATYPE_XYZ:
+        return 24;
+      default:
+        return 0;
+    }
+  }
+
+  /**
+   * Compares the received data with the data struct field by field.
+   * @param data the received data
+   * @return the bitmask of the changed fields
+   */
+  UINT64 compareFields(const void* data) const { return fieldRanges.compare(data, &dataStruct); }
+
+  /**
+   * Calls the registered callbacks and then the field callbacks registered for any of the fields
+   * changed since the last notification.
+   */
+  void notifyCallbacks() override {
+    ManagedDataObjectBase::notifyCallbacks();
+    const UINT64 fields = unnotifiedFields;
+    unnotifiedFields    = 0;
+    fieldCallbacks.notify(fields);
   }
 
  public:
@@ -212,10 +298,12 @@ class DataDefinitionVariable : public SimObjectBase {
     const auto pSimobjectData = reinterpret_cast<const SIMCONNECT_RECV_SIMOBJECT_DATA*>(pData);
 
     // if not required, then skip the rather expensive check for change
-    if (skipChangeCheckFlag || std::memcmp(&pSimobjectData->dwData, &this->dataStruct, sizeof(T)) != 0) {
+    changedFields = skipChangeCheckFlag ? ~UINT64{0} : compareFields(&pSimobjectData->dwData);
+    if (changedFields != 0) {
       LOG_TRACE("DataDefinitionVariable: Data has changed: " + name);
       std::memcpy(&this->dataStruct, &pSimobjectData->dwData, sizeof(T));
       updateStamps(simTime, tickCounter);
+      unnotifiedFields |= changedFields;
       setChanged(true);
       return;
     }
@@ -232,8 +320,53 @@ class DataDefinitionVariable : public SimObjectBase {
     return true;
   };
 
+  /**
+   * Adds a callback function to be called when any of the given fields changed.<p/>
+   * The callbacks registered with addCallback() are called for any change and before the field callbacks.
+   * @param fieldMask bitmask of the fields (see fieldBit())
+   * @param callback the callback function
+   * @return The ID of the callback required for removing a callback.
+   */
+  CallbackID addFieldCallback(UINT64 fieldMask, const CallbackFunction& callback) {
+    const auto id = fieldCallbacks.add(callback, fieldMask);
+    LOG_DEBUG("Added field callback to data definition variable " + name + " with callback ID " + std::to_string(id));
+    return id;
+  }
+
+  /**
+   * Removes a field callback from the data definition variable.
+   * @param callbackId The ID received when adding the field callback.
+   * @return true if the callback was removed, false otherwise
+   */
+  bool removeFieldCallback(CallbackID callbackId) {
+    if (fieldCallbacks.remove(callbackId)) {
+      LOG_DEBUG("Removed field callback from data definition variable " + name + " with callback ID " + std::to_string(callbackId));
+      return true;
+    }
+    LOG_WARN("Failed to remove field callback with ID " + std::to_string(callbackId) + " from data definition variable " + name);
+    return false;
+  }
+
   // Getters and setters
 
+  /**
+   * @param fieldIndex the index of the field's data definition
+   * @return the bit of the field in the changed fields bitmask
+   */
+  [[nodiscard]] static constexpr UINT64 fieldBit(std::size_t fieldIndex) { return FieldRanges::fieldBit(fieldIndex); }
+
+  /**
+   * @return the bitmask of the fields which changed with the last data received from the sim (all bits
+   *         if the change check is skipped)
+   */
+  [[nodiscard]] UINT64 getChangedFields() const { return changedFields; }
+
+  /**
+   * @param fieldIndex the index of the field's data definition
+   * @return true if the field changed with the last data received from the sim
+   */
+  [[nodiscard]] bool hasFieldChanged(std::size_t fieldIndex) const { return getChangedFields() & fieldBit(fieldIndex); }
+
   /**
    * @return a constant reference to the data definition vector
    */
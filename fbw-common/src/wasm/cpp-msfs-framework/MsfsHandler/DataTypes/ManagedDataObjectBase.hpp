@@ -5,21 +5,21 @@
 #define FLYBYWIRE_A32NX_MANAGEDDATAOBJECTBASE_H
 
 #include <cstdint>
-#include <map>
 #include <string>
 
 #include <MSFS/Legacy/gauges.h>
 
+#include "CallbackList.hpp"
 #include "DataObjectBase.hpp"
-#include "IDGenerator.h"
+#include "DeferredNotificationQueue.hpp"
 #include "UpdateMode.h"
 #include "logging.h"
 
 // Used for callback registration to allow removal of callbacks
-using CallbackID = uint64_t;
+using CallbackID = CallbackList::ID;
 
 // Callback function type
-using CallbackFunction = std::function<void()>;
+using CallbackFunction = CallbackList::Function;
 
 /**
  * @brief The ManagedDataObjectBase class is the base class for all data objects and provides auto
@@ -28,25 +28,43 @@ using CallbackFunction = std::function<void()>;
  * Adds the ability to autoRead, autoWrite variables considering max age based on
  * time- and tick-stamps.
  * Also adds a hasChanged flag and the ability to register callbacks for when
- * the variable changes.
+ * the variable changes.<p/>
+ *
+ * By default the callbacks are called immediately when the changed flag is set. With
+ * setDeferredNotification(true) a change only queues a notification for the object, which is
+ * dispatched once per tick by the MsfsHandler (dispatchDeferredNotifications()) no matter how often
+ * the object changed since the last dispatch.
  */
 class ManagedDataObjectBase : public DataObjectBase {
  private:
   /**
-   * Used to generate unique IDs for callbacks.
+   * Callbacks to be called when the data changed - in the order of registration.
    */
-  IDGenerator callbackIdGen{};
+  CallbackList callbacks{};
+
+  // Flag to indicate if change notifications are queued and dispatched once per tick.
+  bool deferredNotificationFlag = false;
+
+  // Flag to indicate if the object is in the queue of deferred notifications.
+  bool notificationQueuedFlag = false;
 
   /**
-   * Map of callbacks to be called when the event is triggered in the sim.
+   * The managed data objects with a queued change notification in the order of their first change.
    */
-  std::map<CallbackID, CallbackFunction> callbacks{};
+  inline static DeferredNotificationQueue<ManagedDataObjectBase, &ManagedDataObjectBase::notificationQueuedFlag> deferredNotificationQueue{};
 
   // Flag to indicate if the variable has changed compared to the last read/write from the sim.
   // Private because it should only be set by the setChanged() method so callbacks from
   // listeners can be triggered.
   bool changedFlag = false;
 
+  /**
+   * Counts the changes of the update mode and the max age of all managed data objects.
+   * Used by the DataManager to detect when its lists of auto read and auto write variables and its
+   * refresh schedulers need to be refreshed without checking every variable every tick.
+   */
+  inline static UINT64 updateModeChangeCounter = 0;
+
  protected:
   /**
    * Flag to indicate if the check for data changes should be skipped to save performance when the
@@ -108,19 +126,34 @@ class ManagedDataObjectBase : public DataObjectBase {
   void setChanged(bool changed) {
     changedFlag = changed;
     if (changedFlag) {
-      for (const auto& [_, callback] : callbacks) {
-        callback();
+      if (!deferredNotificationFlag) {
+        notifyCallbacks();
+      } else {
+        deferredNotificationQueue.push(this);
       }
     }
   }
 
+  /**
+   * Calls all registered callbacks.
+   * Callbacks added by a callback are called from the next notification on, callbacks removed by a
+   * callback are not called anymore.
+   * Derived classes with additional callbacks override this and call the base class method.
+   */
+  virtual void notifyCallbacks() { callbacks.notify(); }
+
  public:
-  ManagedDataObjectBase()                                        = delete;   // no default constructor
-  ManagedDataObjectBase(const ManagedDataObjectBase&)            = delete;   // no copy constructor
-  ManagedDataObjectBase& operator=(const ManagedDataObjectBase&) = delete;   // no copy assignment
-  ManagedDataObjectBase(ManagedDataObjectBase&&)                 = delete;   // no move constructor
-  ManagedDataObjectBase& operator=(ManagedDataObjectBase&&)      = delete;   // no move assignment
-  virtual ~ManagedDataObjectBase()                               = default;  // so derived classes can be destroyed with base class pointer
+  ManagedDataObjectBase()                                        = delete;  // no default constructor
+  ManagedDataObjectBase(const ManagedDataObjectBase&)            = delete;  // no copy constructor
+  ManagedDataObjectBase& operator=(const ManagedDataObjectBase&) = delete;  // no copy assignment
+  ManagedDataObjectBase(ManagedDataObjectBase&&)                 = delete;  // no move constructor
+  ManagedDataObjectBase& operator=(ManagedDataObjectBase&&)      = delete;  // no move assignment
+
+  /**
+   * Virtual so derived classes can be destroyed with base class pointer.
+   * Removes a queued deferred notification of the object.
+   */
+  virtual ~ManagedDataObjectBase() { deferredNotificationQueue.remove(this); }
 
   /**
    * Adds a callback function to be called when the data object's data changed.<p/>
@@ -128,8 +161,7 @@ class ManagedDataObjectBase : public DataObjectBase {
    * @return The ID of the callback required for removing a callback.
    */
   CallbackID addCallback(const CallbackFunction& callback) {
-    const auto id = callbackIdGen.getNextId();
-    callbacks.insert({id, callback});
+    const auto id = callbacks.add(callback);
     LOG_DEBUG("Added callback to data object " + name + " with callback ID " + std::to_string(id));
     return id;
   }
@@ -139,8 +171,7 @@ class ManagedDataObjectBase : public DataObjectBase {
    * @param callbackId The ID receive when adding the callback.
    */
   bool removeCallback(CallbackID callbackId) {
-    if (auto pair = callbacks.find(callbackId); pair != callbacks.end()) {
-      callbacks.erase(pair);
+    if (callbacks.remove(callbackId)) {
       LOG_DEBUG("Removed callback from data object " + name + " with callback ID " + std::to_string(callbackId));
       return true;
     }
@@ -161,6 +192,16 @@ class ManagedDataObjectBase : public DataObjectBase {
     return (nextUpdateTimeStamp < timeStamp && nextUpdateTickStamp < tickCounter);
   }
 
+  /**
+   * @return the sim time after which the next update from the sim is done
+   */
+  [[nodiscard]] FLOAT64 getNextUpdateTimeStamp() const { return nextUpdateTimeStamp; }
+
+  /**
+   * @return the tick counter after which the next update from the sim is done
+   */
+  [[nodiscard]] UINT64 getNextUpdateTickStamp() const { return nextUpdateTickStamp; }
+
   /**
    * Updates the time stamps and stamps for the next update from the sim.
    * @param timeStamp - current sim time
@@ -173,6 +214,28 @@ class ManagedDataObjectBase : public DataObjectBase {
     nextUpdateTickStamp = tickCounter + maxAgeTicks;
   }
 
+  /**
+   * @return true if change notifications are queued and dispatched once per tick
+   */
+  [[nodiscard]] bool isDeferredNotification() const { return deferredNotificationFlag; }
+
+  /**
+   * Sets if change notifications are queued and dispatched once per tick by
+   * dispatchDeferredNotifications() instead of calling the callbacks on every change.
+   * An already queued notification is still dispatched.
+   * @param deferredNotification true to queue the change notifications
+   */
+  void setDeferredNotification(bool deferredNotification) { deferredNotificationFlag = deferredNotification; }
+
+  /**
+   * Calls the callbacks of all objects with a queued change notification once and clears the queue.
+   * Notifications queued by the callbacks are dispatched in the next call.
+   * Called by the MsfsHandler once per tick after the DataManager's preUpdate().
+   */
+  static void dispatchDeferredNotifications() {
+    deferredNotificationQueue.dispatch([](ManagedDataObjectBase* object) { object->notifyCallbacks(); });
+  }
+
   /**
    * @return true if the value has changed since the last read from the sim.
    */
@@ -201,7 +264,7 @@ class ManagedDataObjectBase : public DataObjectBase {
    * otherwise
    */
   virtual void setAutoRead(bool autoRead) {
-    updateMode = static_cast<UpdateMode>(autoRead ? updateMode | UpdateMode::AUTO_READ : updateMode & ~UpdateMode::AUTO_READ);
+    setUpdateMode(static_cast<UpdateMode>(autoRead ? updateMode | UpdateMode::AUTO_READ : updateMode & ~UpdateMode::AUTO_READ));
   }
 
   /**
@@ -216,7 +279,7 @@ class ManagedDataObjectBase : public DataObjectBase {
    * otherwise
    */
   virtual void setAutoWrite(bool autoWrite) {
-    updateMode = static_cast<UpdateMode>(autoWrite ? updateMode | UpdateMode::AUTO_WRITE : updateMode & ~UpdateMode::AUTO_WRITE);
+    setUpdateMode(static_cast<UpdateMode>(autoWrite ? updateMode | UpdateMode::AUTO_WRITE : updateMode & ~UpdateMode::AUTO_WRITE));
   }
 
   /**
@@ -228,7 +291,17 @@ class ManagedDataObjectBase : public DataObjectBase {
    * @brief Sets the update mode.
    * @param updateMode the new update mode
    */
-  void setUpdateMode(UpdateMode updateMode) { this->updateMode = updateMode; }
+  void setUpdateMode(UpdateMode updateMode) {
+    if (this->updateMode != updateMode) {
+      this->updateMode = updateMode;
+      updateModeChangeCounter++;
+    }
+  }
+
+  /**
+   * @return the number of update mode and max age changes of all managed data objects so far
+   */
+  [[nodiscard]] static UINT64 getUpdateModeChangeCounter() { return updateModeChangeCounter; }
 
   /**
    * @return the time stamp of the last read from the sim
@@ -244,7 +317,14 @@ class ManagedDataObjectBase : public DataObjectBase {
    * Sets the maximum age of the variable in seconds
    * @param maxAgeTimeInMilliseconds
    */
-  void setMaxAgeTime(FLOAT64 maxAgeTimeInMilliseconds) { maxAgeTime = maxAgeTimeInMilliseconds; }
+  void setMaxAgeTime(FLOAT64 maxAgeTimeInMilliseconds) {
+    if (maxAgeTime != maxAgeTimeInMilliseconds) {
+      maxAgeTime = maxAgeTimeInMilliseconds;
+      // the next update keeps the phase of the last update
+      nextUpdateTimeStamp = timeStampSimTime + maxAgeTime;
+      updateModeChangeCounter++;
+    }
+  }
 
   /**
    * @return the tick count when variable was last read from the sim
@@ -260,7 +340,19 @@ class ManagedDataObjectBase : public DataObjectBase {
    * Sets the maximum age of the variable in ticks
    * @param maxAgeTicksInTicks the maximum age of the variable in ticks
    */
-  void setMaxAgeTicks(UINT64 maxAgeTicksInTicks) { maxAgeTicks = maxAgeTicksInTicks; }
+  void setMaxAgeTicks(UINT64 maxAgeTicksInTicks) {
+    if (maxAgeTicks != maxAgeTicksInTicks) {
+      maxAgeTicks = maxAgeTicksInTicks;
+      // the next update keeps the phase of the last update
+      nextUpdateTickStamp = tickStamp + maxAgeTicks;
+      updateModeChangeCounter++;
+    }
+  }
+
+  /**
+   * @return true if the variable has a max age in sim time or ticks and is not updated every tick
+   */
+  [[nodiscard]] bool hasMaxAge() const { return maxAgeTime > 0.0 || maxAgeTicks > 0; }
 };
 
 #endif  // FLYBYWIRE_A32NX_MANAGEDDATAOBJECTBASE_H
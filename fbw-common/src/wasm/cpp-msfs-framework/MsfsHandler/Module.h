@@ -6,6 +6,8 @@
 
 #include <MSFS/Legacy/gauges.h>
 
+#include <string>
+
 #include "MsfsHandler.h"
 
 /**
@@ -85,6 +87,11 @@ class Module {
    */
   virtual bool shutdown() = 0;
 
+  /**
+   * @return the name of the module, used e.g. to identify the module in the profiler output.
+   */
+  [[nodiscard]] virtual std::string getName() const { return "Module"; }
+
   /**
    * @return true if the module has been initialized, false otherwise.
    */
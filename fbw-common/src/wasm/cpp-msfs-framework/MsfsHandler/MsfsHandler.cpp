@@ -3,6 +3,7 @@
 
 #include <algorithm>
 #include <functional>
+#include <iostream>
 
 #include "Callback.h"
 #include "ClientEvent.h"
@@ -10,6 +11,7 @@
 #include "MsfsHandler.h"
 #include "NamedVariable.h"
 #include "UpdateMode.h"
+#include "string_utils.hpp"
 
 // =================================================================================================
 // PUBLIC METHODS
@@ -94,8 +96,30 @@ bool MsfsHandler::initialize() {
   }
   LOG_INFO(simConnectName + ": Initialized modules");
 
+  // Profiler sections for the DataManager and all modules - runtime toggle via LVARs
+  profilerUpdateSection       = profiler.addSection("MsfsHandler::update");
+  profilerDataManagerSections = {profiler.addSection("DataManager::preUpdate"), profiler.addSection("DataManager::update"),
+                                 profiler.addSection("DataManager::postUpdate")};
+  for (const Module* pModule : modules) {
+    const std::string name = pModule->getName();
+    profilerModuleSections.push_back(
+        {profiler.addSection(name + "::preUpdate"), profiler.addSection(name + "::update"), profiler.addSection(name + "::postUpdate")});
+  }
+
+  // all framework modules of an aircraft share the aircraft prefix - the profiler and logger LVARs are
+  // scoped to this module
+  std::string moduleVarPrefix = simConnectName + "_";
+  helper::StringUtils::toUpperCase(moduleVarPrefix);
+  profilerEnabled    = dataManager.make_named_var(moduleVarPrefix + "PROFILER_ENABLED", UNITS.Number, UpdateMode::AUTO_READ);
+  profilerWriteTrace = dataManager.make_named_var(moduleVarPrefix + "PROFILER_WRITE_TRACE", UNITS.Number, UpdateMode::AUTO_READ);
+  logWriteDump       = dataManager.make_named_var(moduleVarPrefix + "LOG_WRITE_DUMP", UNITS.Number, UpdateMode::AUTO_READ);
+  logPrintLevel      = dataManager.make_named_var(moduleVarPrefix + "LOG_PRINT_LEVEL", UNITS.Number, UpdateMode::AUTO_READ);
+
   LOG_INFO(simConnectName + ": Initialized");
   isInitialized = result;
+
+  // from now on log messages are printed at the start of the next tick
+  logger->setDeferred(true);
   return result;
 }
 
@@ -105,9 +129,8 @@ bool MsfsHandler::update(sGaugeDrawData* pData) {
     return false;
   }
 
-#ifdef PROFILING
-  profiler.start();
-#endif
+  // print the log messages recorded since the last tick - returns right away if there are none
+  logger->flush(LOG_FLUSH_LIMIT);
 
   // Initial request of data from sim to retrieve all requests which have
   // periodic updates enabled. This includes the base sim data for pause detection.
@@ -136,52 +159,40 @@ bool MsfsHandler::update(sGaugeDrawData* pData) {
   // are called.
 
   bool result = true;
+  {
+    TickProfiler::Scope updateScope{profiler, profilerUpdateSection, tickCounter};
+
+    // PRE UPDATE
+    {
+      TickProfiler::Scope scope{profiler, profilerDataManagerSections[PRE_UPDATE], tickCounter};
+      result &= dataManager.preUpdate(pData);
+      // once all variables are updated from the sim, notify the callbacks of objects with deferred
+      // notifications which changed since the last tick
+      ManagedDataObjectBase::dispatchDeferredNotifications();
+    }
+    result &= updateModules(PRE_UPDATE, &Module::preUpdate, pData);
 
-  // PRE UPDATE
-#ifdef PROFILING
-  preUpdate.start();
-#endif
-  result &= dataManager.preUpdate(pData);
-  result &= std::all_of(modules.begin(), modules.end(), [&pData](Module* pModule) { return pModule->preUpdate(pData); });
-#ifdef PROFILING
-  preUpdate.stop();
-#endif
-
-  // UPDATE
-#ifdef PROFILING
-  mainUpdate.start();
-#endif
-  result &= dataManager.update(pData);
-  result &= std::all_of(modules.begin(), modules.end(), [&pData](Module* pModule) { return pModule->update(pData); });
-#ifdef PROFILING
-  mainUpdate.stop();
-#endif
-
-  // POST UPDATE
-#ifdef PROFILING
-  postUpdate.start();
-#endif
-  result &= dataManager.postUpdate(pData);
-  result &= std::all_of(modules.begin(), modules.end(), [&pData](Module* pModule) { return pModule->postUpdate(pData); });
-#ifdef PROFILING
-  postUpdate.stop();
-#endif
+    // UPDATE
+    {
+      TickProfiler::Scope scope{profiler, profilerDataManagerSections[UPDATE], tickCounter};
+      result &= dataManager.update(pData);
+    }
+    result &= updateModules(UPDATE, &Module::update, pData);
+
+    // POST UPDATE
+    {
+      TickProfiler::Scope scope{profiler, profilerDataManagerSections[POST_UPDATE], tickCounter};
+      result &= dataManager.postUpdate(pData);
+    }
+    result &= updateModules(POST_UPDATE, &Module::postUpdate, pData);
+  }
 
   if (!result) {
     LOG_ERROR(simConnectName + ": MsfsHandler::update() - failed");
   }
 
-#ifdef PROFILING
-  profiler.stop();
-  if (tickCounter % 100 == 0) {
-    LOG_INFO("Profiler Info for " + this->simConnectName);
-    preUpdate.print();
-    mainUpdate.print();
-    postUpdate.print();
-    profiler.print();
-    std::cout << std::endl;
-  }
-#endif
+  updateProfiler();
+  updateLogger();
 
   return result;
 }
@@ -197,5 +208,61 @@ bool MsfsHandler::shutdown() {
     simConnectInitialized = false;
     hSimConnect           = 0;
   }
+  // print all remaining log messages and print new messages right away
+  logger->setDeferred(false);
   return result;
 }
+
+// =================================================================================================
+// PRIVATE METHODS
+// =================================================================================================
+
+bool MsfsHandler::updateModules(UpdatePhase phase, bool (Module::*method)(sGaugeDrawData*), sGaugeDrawData* pData) {
+  for (std::size_t i = 0; i < modules.size(); ++i) {
+    TickProfiler::Scope scope{profiler, profilerModuleSections[i][phase], tickCounter};
+    if (!(modules[i]->*method)(pData)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void MsfsHandler::updateProfiler() {
+  if (profilerEnabled->getAsBool() != profiler.isEnabled()) {
+    // each recording starts with empty histograms, otherwise the summary covers all former recordings
+    if (profilerEnabled->getAsBool()) {
+      profiler.reset();
+    }
+    profiler.setEnabled(profilerEnabled->getAsBool());
+    LOG_INFO("{}: Profiler {}", simConnectName, profiler.isEnabled() ? "enabled" : "disabled");
+  }
+  if (profilerWriteTrace->getAsBool()) {
+    const std::string filename = "\\work\\" + simConnectName + "_profile.trace";
+    // printed right away as the summary is longer than a log record can hold
+    std::cout << "Profiler Info for " << simConnectName << "\n" << profiler.str() << std::endl;
+    if (profiler.writeTrace(filename)) {
+      LOG_INFO("{}: Profiler trace written to {}", simConnectName, filename);
+    } else {
+      LOG_ERROR("{}: Failed to write profiler trace to {}", simConnectName, filename);
+    }
+    profilerWriteTrace->setAndWriteToSim(0);
+  }
+}
+
+void MsfsHandler::updateLogger() {
+  const INT64         level      = logPrintLevel->getAsInt64();
+  const std::uint32_t printLevel = level > 0 ? static_cast<std::uint32_t>(level) : Logger::DEFERRED_PRINT_LEVEL;
+  if (printLevel != logger->getDeferredPrintLevel()) {
+    logger->setDeferredPrintLevel(printLevel);
+    LOG_INFO("{}: Log print level set to {}", simConnectName, printLevel);
+  }
+  if (logWriteDump->getAsBool()) {
+    const std::string filename = "\\work\\" + simConnectName + "_log.dump";
+    if (logger->writeDump(filename)) {
+      LOG_INFO("{}: Log dump written to {}", simConnectName, filename);
+    } else {
+      LOG_ERROR("{}: Failed to write log dump to {}", simConnectName, filename);
+    }
+    logWriteDump->setAndWriteToSim(0);
+  }
+}
@@ -8,11 +8,12 @@
 #include <MSFS/MSFS.h>
 #include <SimConnect.h>
 
+#include <array>
 #include <string>
 #include <vector>
 
 #include "DataManager.h"
-#include "SimpleProfiler.hpp"
+#include "TickProfiler.hpp"
 
 class Module;
 
@@ -111,14 +112,41 @@ class MsfsHandler {
   // Callback function for register_key_event_handler_EX1
   GAUGE_KEY_EVENT_HANDLER_EX1 keyEventHandlerEx1 = nullptr;
 
-  // Allows immediate view on runtime performance issue. Add additional instances into
-  // Modules while developing and profiling a module's performance.
-#ifdef PROFILING
-  SimpleProfiler preUpdate{"MsfsHandler::preUpdate()", 100};
-  SimpleProfiler mainUpdate{"MsfsHandler::mainUpdate()", 100};
-  SimpleProfiler postUpdate{"MsfsHandler::postUpdate()", 100};
-  SimpleProfiler profiler{"MsfsHandler::update()", 100};
-#endif
+  /**
+   * The update phases of the DataManager and the modules. Used to index the profiler sections.
+   */
+  enum UpdatePhase { PRE_UPDATE = 0, UPDATE = 1, POST_UPDATE = 2, NUMBER_OF_UPDATE_PHASES = 3 };
+  using PhaseSections = std::array<std::size_t, NUMBER_OF_UPDATE_PHASES>;
+
+  /**
+   * Records the execution time of each update phase of the DataManager and of each module per tick.
+   * It is disabled by default and can be enabled at runtime by setting the LVAR <name>_PROFILER_ENABLED
+   * to 1, enabling it discards the former records and histograms. Setting the LVAR
+   * <name>_PROFILER_WRITE_TRACE to 1 prints a summary to the console and writes the recorded ticks to
+   * "\work\<simconnect name>_profile.trace" (see tools/ticktrace). Like the logger LVARs the LVARs are
+   * scoped to the module by the upper case simconnect name (with aircraft prefix).
+   */
+  static constexpr std::size_t PROFILER_CAPACITY = 1 << 14;  // ~10 sections per tick for ~25s at 60 fps
+  TickProfiler                 profiler{PROFILER_CAPACITY};
+  std::size_t                  profilerUpdateSection{};
+  PhaseSections                profilerDataManagerSections{};
+  std::vector<PhaseSections>   profilerModuleSections{};
+  NamedVariablePtr             profilerEnabled;
+  NamedVariablePtr             profilerWriteTrace;
+
+  /**
+   * After initialization log messages are only formatted and printed at the start of the next tick,
+   * at most LOG_FLUSH_LIMIT per tick (see Logger). All messages are kept in the ring buffer.
+   * The logger LVARs are scoped to the module by the upper case simconnect name (with aircraft prefix,
+   * e.g. A32NX_GAUGE_FADEC_A32NX_LOG_WRITE_DUMP):
+   * - <name>_LOG_PRINT_LEVEL sets the highest printed log level (e.g. 3 for warnings, 0 for the default
+   *   LOG_LEVEL) - levels above LOG_LEVEL are not recorded at all
+   * - <name>_LOG_WRITE_DUMP set to 1 writes the most recent log messages to
+   *   "\work\<simconnect name>_log.dump" (see tools/logdecode)
+   */
+  static constexpr std::size_t LOG_FLUSH_LIMIT = 64;
+  NamedVariablePtr             logWriteDump;
+  NamedVariablePtr             logPrintLevel;
 
  public:
   /**
@@ -126,8 +154,11 @@ class MsfsHandler {
    * @param name string containing an appropriate simconnect name for the client program.
    * @param aircraftPrefix string containing the prefix for all named variables (LVARs).
    *                       E.g. "A32NX_" for the A32NX aircraft or "A380X_" for the A380X aircraft.
+   * @param logBufferCapacity size of the log ring buffer in bytes (default: Logger::BUFFER_CAPACITY).
    */
-  explicit MsfsHandler(std::string&& name, const std::string& aircraftPrefix) : dataManager(this), simConnectName(std::move(name)) {
+  explicit MsfsHandler(std::string&& name, const std::string& aircraftPrefix, std::size_t logBufferCapacity = Logger::BUFFER_CAPACITY)
+      : dataManager(this), simConnectName(std::move(name)) {
+    logger->setCapacity(logBufferCapacity);
     LOG_INFO("Creating MsfsHandler instance with Simconnect name " + simConnectName + " and aircraft prefix " + aircraftPrefix);
     NamedVariable::setAircraftPrefix(aircraftPrefix);
   }
@@ -162,8 +193,34 @@ class MsfsHandler {
    */
   void registerModule(Module* pModule);
 
+ private:
+  /**
+   * Calls one of the update methods on all modules in the order of registration and records the
+   * execution time of each module. Stops at the first module that fails.
+   * @param phase the update phase used to select the profiler section
+   * @param method the update method to call
+   * @param pData pointer to the sGaugeDrawData struct.
+   * @return true if all modules were updated successfully, false otherwise.
+   */
+  bool updateModules(UpdatePhase phase, bool (Module::*method)(sGaugeDrawData*), sGaugeDrawData* pData);
+
+  /**
+   * Applies the profiler LVARs: enables or disables the profiler and writes the trace file if requested.
+   */
+  void updateProfiler();
+
+  /**
+   * Applies the logger LVARs: sets the print level and writes the log dump file if requested.
+   */
+  void updateLogger();
+
   // Getters and setters
  public:
+  /**
+   * @return a modifiable reference to the profiler, e.g. to add sections for parts of a module.
+   */
+  TickProfiler& getProfiler() { return profiler; }
+
   /**
    * @return a modifiable reference to the data manager.
    */
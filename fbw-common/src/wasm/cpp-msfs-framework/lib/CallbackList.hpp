@@ -0,0 +1,124 @@
+// Copyright (c) 2024 FlyByWire Simulations
+// SPDX-License-Identifier: GPL-3.0
+
+#ifndef FLYBYWIRE_AIRCRAFT_CALLBACKLIST_HPP
+#define FLYBYWIRE_AIRCRAFT_CALLBACKLIST_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+/**
+ * @brief Callbacks in the order of registration, stored in a contiguous vector as most objects have none
+ * or very few callbacks.
+ *
+ * @details Each callback has a mask and notify() only calls the callbacks whose mask shares a bit with the
+ * given mask (e.g. the changed fields of a data definition variable). Callbacks added without a mask are
+ * called by every notification.
+ *
+ * Callbacks may add and remove callbacks while being called. Added callbacks are called from the next
+ * notification on, removed callbacks are not called anymore. The vector is only changed after the
+ * outermost notification, so no callback is skipped.
+ *
+ * @usage
+ *   - Add a callback (e.g. const auto id = callbacks.add([]() { ... });)<br/>
+ *   - Call notify() or notify(mask) on a change<br/>
+ *   - Remove the callback with the ID received when adding it (e.g. callbacks.remove(id);)<br/>
+ */
+class CallbackList {
+ public:
+  using ID       = std::uint64_t;
+  using Function = std::function<void()>;
+
+  static constexpr std::uint64_t ALL = ~std::uint64_t{0};
+
+ private:
+  struct Callback {
+    ID            id;
+    std::uint64_t mask;
+    Function      function;
+    bool          removed;
+  };
+
+  std::vector<Callback> _callbacks{};
+  ID                    _nextId = 0;
+
+  // callbacks added and if callbacks were removed while callbacks are being called
+  int                   _notifyDepth = 0;
+  std::vector<Callback> _addedCallbacks{};
+  bool                  _hasRemovedCallbacks = false;
+
+ public:
+  /**
+   * @brief Adds a callback.
+   * @param function the callback function
+   * @param mask the callback is only called by notifications sharing a bit with this mask (default: all)
+   * @return the ID of the callback required for removing it
+   */
+  ID add(const Function& function, std::uint64_t mask = ALL) {
+    const ID id = _nextId++;
+    (_notifyDepth > 0 ? _addedCallbacks : _callbacks).push_back({id, mask, function, false});
+    return id;
+  }
+
+  /**
+   * @brief Removes a callback.
+   * @param id the ID received when adding the callback
+   * @return true if the callback was found and removed, false otherwise
+   */
+  bool remove(ID id) {
+    const auto added = std::find_if(_addedCallbacks.begin(), _addedCallbacks.end(), [id](const Callback& c) { return c.id == id; });
+    if (added != _addedCallbacks.end()) {
+      _addedCallbacks.erase(added);
+      return true;
+    }
+    const auto callback = std::find_if(_callbacks.begin(), _callbacks.end(), [id](const Callback& c) { return c.id == id && !c.removed; });
+    if (callback == _callbacks.end()) {
+      return false;
+    }
+    if (_notifyDepth > 0) {
+      // the callback might be running - it is erased after the notification
+      callback->removed    = true;
+      _hasRemovedCallbacks = true;
+    } else {
+      _callbacks.erase(callback);
+    }
+    return true;
+  }
+
+  /**
+   * @brief Calls the callbacks whose mask shares a bit with the given mask in the order of registration.
+   * @param mask the mask of the notification (default: all)
+   */
+  void notify(std::uint64_t mask = ALL) {
+    _notifyDepth++;
+    for (const Callback& callback : _callbacks) {
+      if (!callback.removed && (callback.mask & mask)) {
+        callback.function();
+      }
+    }
+    if (--_notifyDepth == 0 && (_hasRemovedCallbacks || !_addedCallbacks.empty())) {
+      _callbacks.erase(std::remove_if(_callbacks.begin(), _callbacks.end(), [](const Callback& c) { return c.removed; }), _callbacks.end());
+      _callbacks.insert(_callbacks.end(), _addedCallbacks.begin(), _addedCallbacks.end());
+      _addedCallbacks.clear();
+      _hasRemovedCallbacks = false;
+    }
+  }
+
+  /**
+   * @return the number of callbacks
+   */
+  [[nodiscard]] std::size_t size() const {
+    return _addedCallbacks.size() +
+           static_cast<std::size_t>(std::count_if(_callbacks.begin(), _callbacks.end(), [](const Callback& c) { return !c.removed; }));
+  }
+
+  /**
+   * @return true if there are no callbacks
+   */
+  [[nodiscard]] bool empty() const { return size() == 0; }
+};
+
+#endif  // FLYBYWIRE_AIRCRAFT_CALLBACKLIST_HPP
@@ -0,0 +1,87 @@
+// Copyright (c) 2024 FlyByWire Simulations
+// SPDX-License-Identifier: GPL-3.0
+
+#ifndef FLYBYWIRE_AIRCRAFT_DEFERREDNOTIFICATIONQUEUE_HPP
+#define FLYBYWIRE_AIRCRAFT_DEFERREDNOTIFICATIONQUEUE_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+/**
+ * @brief Queue of objects with a change notification to be dispatched later, e.g. once per tick.
+ *
+ * @details An object is queued once no matter how often it changed before the next dispatch, so its
+ * notification is coalesced. Whether an object is queued is kept in a flag of the object given by the
+ * Queued member pointer, so queuing is constant time. Objects are dispatched in the order of their first
+ * change since the last dispatch. Objects queued while dispatching are dispatched by the next dispatch.
+ *
+ * @usage
+ *   - Queue an object on every change (e.g. queue.push(this);)<br/>
+ *   - Remove the object when it is destroyed (e.g. queue.remove(this);)<br/>
+ *   - Dispatch once per tick (e.g. queue.dispatch([](Object* object) { object->notify(); });)<br/>
+ *
+ * @tparam T the type of the queued objects
+ * @tparam Queued the member of T flagging if the object is queued
+ */
+template <typename T, bool T::*Queued>
+class DeferredNotificationQueue {
+ private:
+  // queued objects in the order of their first change - entries of removed objects are nullptr
+  std::vector<T*> _queue{};
+
+ public:
+  /**
+   * @brief Queues the notification of an object unless it is already queued.
+   * @param object the changed object
+   * @return true if the object was queued, false if it already was
+   */
+  bool push(T* object) {
+    if (object->*Queued) {
+      return false;
+    }
+    object->*Queued = true;
+    _queue.push_back(object);
+    return true;
+  }
+
+  /**
+   * @brief Removes the queued notification of an object (e.g. when the object is destroyed).
+   * @param object the object
+   */
+  void remove(T* object) {
+    if (object->*Queued) {
+      object->*Queued = false;
+      std::replace(_queue.begin(), _queue.end(), object, static_cast<T*>(nullptr));
+    }
+  }
+
+  /**
+   * @brief Calls the given function once for each queued object and clears the queue.
+   * @param notify the function called with each queued object
+   * @return the number of dispatched objects
+   */
+  template <typename Notify>
+  std::size_t dispatch(Notify&& notify) {
+    const std::size_t count      = _queue.size();
+    std::size_t       dispatched = 0;
+    for (std::size_t i = 0; i < count; i++) {
+      // the function might queue objects, which reallocates the queue
+      T* object = _queue[i];
+      if (object != nullptr) {
+        object->*Queued = false;
+        notify(object);
+        dispatched++;
+      }
+    }
+    _queue.erase(_queue.begin(), _queue.begin() + static_cast<std::ptrdiff_t>(count));
+    return dispatched;
+  }
+
+  /**
+   * @return the number of entries in the queue including removed objects
+   */
+  [[nodiscard]] std::size_t size() const { return _queue.size(); }
+};
+
+#endif  // FLYBYWIRE_AIRCRAFT_DEFERREDNOTIFICATIONQUEUE_HPP
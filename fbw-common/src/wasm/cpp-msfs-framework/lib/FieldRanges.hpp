@@ -0,0 +1,92 @@
+// Copyright (c) 2024 FlyByWire Simulations
+// SPDX-License-Identifier: GPL-3.0
+
+#ifndef FLYBYWIRE_AIRCRAFT_FIELDRANGES_HPP
+#define FLYBYWIRE_AIRCRAFT_FIELDRANGES_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+/**
+ * @brief Byte ranges of the fields of a packed data struct to compare two instances field by field.
+ *
+ * @details The fields are added in the order in which they are packed into the struct. The result of a
+ * comparison is a bitmask with bit i for field i, fields beyond the 64th share the last bit. Fields are
+ * clipped to the size of the struct, a field of size 0 (unknown size) extends to the end of the struct.
+ *
+ * @usage
+ *   - Create the ranges with the size of the struct (e.g. FieldRanges ranges(sizeof(Data));)<br/>
+ *   - Add the size of each field (e.g. ranges.add(8);)<br/>
+ *   - Compare two instances (e.g. const std::uint64_t changed = ranges.compare(&received, &current);)<br/>
+ */
+class FieldRanges {
+ private:
+  struct Range {
+    std::size_t offset;
+    std::size_t size;
+  };
+
+  std::size_t        _dataSize;
+  std::size_t        _declaredSize = 0;
+  std::vector<Range> _ranges{};
+
+ public:
+  /**
+   * @param dataSize the size of the data struct in bytes
+   */
+  explicit FieldRanges(std::size_t dataSize) : _dataSize{dataSize} {}
+
+  /**
+   * @param fieldIndex the index of the field
+   * @return the bit of the field in the bitmask of changed fields
+   */
+  [[nodiscard]] static constexpr std::uint64_t fieldBit(std::size_t fieldIndex) {
+    return std::uint64_t{1} << (std::min<std::size_t>)(fieldIndex, 63);
+  }
+
+  /**
+   * @brief Adds the next field of the struct.
+   * @param size the size of the field in bytes or 0 if the size is variable or unknown
+   */
+  void add(std::size_t size) {
+    const std::size_t fieldSize = size == 0 ? _dataSize : size;
+    const std::size_t start     = (std::min)(_declaredSize, _dataSize);
+    _ranges.push_back({start, (std::min)(_declaredSize + fieldSize, _dataSize) - start});
+    _declaredSize += fieldSize;
+  }
+
+  /**
+   * @brief Compares two instances of the struct field by field.
+   * @param data the first instance
+   * @param other the second instance
+   * @return the bitmask of the fields which differ
+   */
+  [[nodiscard]] std::uint64_t compare(const void* data, const void* other) const {
+    const auto*   lhs     = static_cast<const unsigned char*>(data);
+    const auto*   rhs     = static_cast<const unsigned char*>(other);
+    std::uint64_t changed = 0;
+    for (std::size_t i = 0; i < _ranges.size(); i++) {
+      const Range& range = _ranges[i];
+      if (std::memcmp(lhs + range.offset, rhs + range.offset, range.size) != 0) {
+        changed |= fieldBit(i);
+      }
+    }
+    return changed;
+  }
+
+  /**
+   * @return the number of fields
+   */
+  [[nodiscard]] std::size_t size() const { return _ranges.size(); }
+
+  /**
+   * @return the sum of the sizes of all fields before clipping - differs from the size of the struct if the
+   *         fields do not match the struct
+   */
+  [[nodiscard]] std::size_t declaredSize() const { return _declaredSize; }
+};
+
+#endif  // FLYBYWIRE_AIRCRAFT_FIELDRANGES_HPP
@@ -0,0 +1,280 @@
+// Copyright (c) 2024 FlyByWire Simulations
+// SPDX-License-Identifier: GPL-3.0
+
+#ifndef FLYBYWIRE_AIRCRAFT_KEYEVENTDISPATCHTABLE_HPP
+#define FLYBYWIRE_AIRCRAFT_KEYEVENTDISPATCHTABLE_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <vector>
+
+/**
+ * @brief Dispatch table from key event IDs to the callbacks registered for the key event.
+ *
+ * @details The slots of the key events are indexed directly by the key event ID relative to the lowest
+ * registered ID (key event IDs are small and close to each other, see the KEY_ defines in gauges.h), so a
+ * key event is dispatched with one bounds check and the callbacks of a key event are stored contiguously.
+ * IDs which would grow the dense range beyond MAX_DENSE_RANGE are kept in an ordered map instead.
+ *
+ * A key event can be set to be coalesced (e.g. high frequency axis events like AXIS_ELEVATOR_SET). A
+ * coalesced key event only stores its latest parameters when it is processed and its callbacks are called
+ * once with these by dispatchCoalesced(). So only use this for key events where the latest parameters
+ * replace all former ones.
+ *
+ * Callbacks may add and remove callbacks while being called. Added callbacks are called from the next
+ * key event on, removed callbacks are not called anymore.
+ *
+ * @usage
+ *   - Add callbacks with a unique callback ID (e.g. table.add(KEY_AXIS_ELEVATOR_SET, id, callback);)<br/>
+ *   - Optionally coalesce a key event (e.g. table.setCoalescing(KEY_AXIS_ELEVATOR_SET, true);)<br/>
+ *   - Call process() for every key event received from the sim<br/>
+ *   - Call dispatchCoalesced() once per frame<br/>
+ *
+ * @tparam Function the callback function type, callable with the five key event parameters
+ */
+template <typename Function>
+class KeyEventDispatchTable {
+ public:
+  using EventId    = std::int32_t;
+  using CallbackId = std::uint64_t;
+
+  static constexpr std::size_t MAX_DENSE_RANGE = 4096;
+
+ private:
+  struct Callback {
+    CallbackId id;
+    Function   function;
+    bool       removed;
+  };
+
+  struct Slot {
+    std::vector<Callback> callbacks{};
+    bool                  coalescing = false;
+    bool                  pending    = false;
+    std::uint32_t         data[5]{};
+  };
+
+  // the dense slots from _base on (nullptr for key events without a slot) and the slots outside of the range
+  std::vector<std::unique_ptr<Slot>> _slots{};
+  std::int64_t                       _base = 0;
+  std::map<EventId, Slot>            _sparse{};
+
+  // the coalesced key events with parameters not yet dispatched, in the order of their first occurrence
+  std::vector<EventId> _pending{};
+
+  // callbacks added and slots with removed callbacks while callbacks are being called
+  int                                      _dispatchDepth = 0;
+  std::vector<std::pair<EventId, Callback>> _addedCallbacks{};
+  std::vector<Slot*>                       _removedCallbackSlots{};
+
+ public:
+  /**
+   * @brief Adds a callback to a key event. Callbacks of a key event are called in the order they were added.
+   * @param eventId the key event ID
+   * @param callbackId the unique ID of the callback required for removing it
+   * @param function the callback function
+   */
+  void add(EventId eventId, CallbackId callbackId, const Function& function) {
+    if (_dispatchDepth > 0) {
+      _addedCallbacks.push_back({eventId, {callbackId, function, false}});
+      return;
+    }
+    getOrCreateSlot(eventId).callbacks.push_back({callbackId, function, false});
+  }
+
+  /**
+   * @brief Removes a callback from a key event.
+   * @param eventId the key event ID
+   * @param callbackId the ID given when adding the callback
+   * @return true if the callback was found and removed, false otherwise
+   */
+  bool remove(EventId eventId, CallbackId callbackId) {
+    const auto added = std::find_if(_addedCallbacks.begin(), _addedCallbacks.end(), [&](const auto& pair) {
+      return pair.first == eventId && pair.second.id == callbackId;
+    });
+    if (added != _addedCallbacks.end()) {
+      _addedCallbacks.erase(added);
+      return true;
+    }
+    Slot* slot = findSlot(eventId);
+    if (slot == nullptr) {
+      return false;
+    }
+    const auto callback = std::find_if(slot->callbacks.begin(), slot->callbacks.end(),
+                                       [&](const Callback& c) { return c.id == callbackId && !c.removed; });
+    if (callback == slot->callbacks.end()) {
+      return false;
+    }
+    if (_dispatchDepth > 0) {
+      // the callback might be running - it is erased after the dispatch
+      callback->removed = true;
+      _removedCallbackSlots.push_back(slot);
+    } else {
+      slot->callbacks.erase(callback);
+    }
+    return true;
+  }
+
+  /**
+   * @param eventId the key event ID
+   * @return the number of callbacks of the key event
+   */
+  [[nodiscard]] std::size_t size(EventId eventId) const {
+    const Slot* slot = findSlot(eventId);
+    std::size_t count =
+        slot == nullptr ? 0 : std::count_if(slot->callbacks.begin(), slot->callbacks.end(), [](const Callback& c) { return !c.removed; });
+    for (const auto& added : _addedCallbacks) {
+      count += added.first == eventId;
+    }
+    return count;
+  }
+
+  /**
+   * @brief Sets if a key event is coalesced. Pending parameters of a key event are still dispatched by the
+   * next dispatchCoalesced() when coalescing is turned off.
+   * @param eventId the key event ID
+   * @param coalescing true if the callbacks of the key event are only called by dispatchCoalesced()
+   */
+  void setCoalescing(EventId eventId, bool coalescing) { getOrCreateSlot(eventId).coalescing = coalescing; }
+
+  /**
+   * @param eventId the key event ID
+   * @return true if the key event is coalesced, false otherwise
+   */
+  [[nodiscard]] bool isCoalescing(EventId eventId) const {
+    const Slot* slot = findSlot(eventId);
+    return slot != nullptr && slot->coalescing;
+  }
+
+  /**
+   * @brief Calls the callbacks of a key event or stores the parameters of a coalesced key event.
+   * @return true if the key event has callbacks or is coalesced, false otherwise
+   */
+  bool process(EventId eventId, std::uint32_t data0, std::uint32_t data1, std::uint32_t data2, std::uint32_t data3, std::uint32_t data4) {
+    Slot* slot = findSlot(eventId);
+    if (slot == nullptr) {
+      return false;
+    }
+    if (slot->coalescing) {
+      slot->data[0] = data0;
+      slot->data[1] = data1;
+      slot->data[2] = data2;
+      slot->data[3] = data3;
+      slot->data[4] = data4;
+      if (!slot->pending) {
+        slot->pending = true;
+        _pending.push_back(eventId);
+      }
+      return true;
+    }
+    call(*slot, data0, data1, data2, data3, data4);
+    return !slot->callbacks.empty();
+  }
+
+  /**
+   * @brief Calls the callbacks of each pending coalesced key event once with its latest parameters.
+   * Key events coalesced by these callbacks are dispatched in the next call.
+   * @return the number of dispatched key events
+   */
+  std::size_t dispatchCoalesced() {
+    const std::size_t count = _pending.size();
+    for (std::size_t i = 0; i < count; i++) {
+      Slot* slot = findSlot(_pending[i]);
+      if (slot == nullptr || !slot->pending) {
+        continue;
+      }
+      slot->pending = false;
+      call(*slot, slot->data[0], slot->data[1], slot->data[2], slot->data[3], slot->data[4]);
+    }
+    _pending.erase(_pending.begin(), _pending.begin() + static_cast<std::ptrdiff_t>(count));
+    return count;
+  }
+
+  /**
+   * @return the number of coalesced key events waiting for dispatchCoalesced()
+   */
+  [[nodiscard]] std::size_t pendingCount() const { return _pending.size(); }
+
+  /**
+   * @brief Removes all callbacks, coalescing settings and pending key events.
+   */
+  void clear() {
+    _slots.clear();
+    _sparse.clear();
+    _pending.clear();
+    _addedCallbacks.clear();
+    _removedCallbackSlots.clear();
+    _base = 0;
+  }
+
+ private:
+  [[nodiscard]] Slot* findSlot(EventId eventId) const {
+    const auto index = static_cast<std::uint64_t>(eventId - _base);
+    if (index < _slots.size() && _slots[index] != nullptr) {
+      return _slots[index].get();
+    }
+    if (_sparse.empty()) {
+      return nullptr;
+    }
+    const auto sparse = _sparse.find(eventId);
+    return sparse == _sparse.end() ? nullptr : const_cast<Slot*>(&sparse->second);
+  }
+
+  Slot& getOrCreateSlot(EventId eventId) {
+    if (Slot* slot = findSlot(eventId)) {
+      return *slot;
+    }
+    const std::int64_t id = eventId;
+    if (_slots.empty()) {
+      _base = id;
+    }
+    const std::int64_t first = (std::min)(_base, id);
+    const std::int64_t last  = (std::max)(_base + static_cast<std::int64_t>(_slots.size()) - 1, id);
+    if (static_cast<std::uint64_t>(last - first) >= MAX_DENSE_RANGE) {
+      return _sparse[eventId];
+    }
+    if (id < _base) {
+      const auto shift = static_cast<std::size_t>(_base - id);
+      _slots.resize(_slots.size() + shift);
+      std::move_backward(_slots.begin(), _slots.end() - static_cast<std::ptrdiff_t>(shift), _slots.end());
+      _base = id;
+    }
+    const auto index = static_cast<std::size_t>(id - _base);
+    if (index >= _slots.size()) {
+      _slots.resize(index + 1);
+    }
+    _slots[index] = std::make_unique<Slot>();
+    return *_slots[index];
+  }
+
+  void call(Slot& slot, std::uint32_t data0, std::uint32_t data1, std::uint32_t data2, std::uint32_t data3, std::uint32_t data4) {
+    _dispatchDepth++;
+    for (const Callback& callback : slot.callbacks) {
+      if (!callback.removed) {
+        callback.function(data0, data1, data2, data3, data4);
+      }
+    }
+    if (--_dispatchDepth == 0 && (!_addedCallbacks.empty() || !_removedCallbackSlots.empty())) {
+      applyChanges();
+    }
+  }
+
+  // erases the callbacks removed and adds the callbacks added while callbacks were being called
+  void applyChanges() {
+    for (Slot* slot : _removedCallbackSlots) {
+      slot->callbacks.erase(std::remove_if(slot->callbacks.begin(), slot->callbacks.end(), [](const Callback& c) { return c.removed; }),
+                            slot->callbacks.end());
+    }
+    _removedCallbackSlots.clear();
+    std::vector<std::pair<EventId, Callback>> added;
+    added.swap(_addedCallbacks);
+    for (auto& pair : added) {
+      getOrCreateSlot(pair.first).callbacks.push_back(std::move(pair.second));
+    }
+  }
+};
+
+#endif  // FLYBYWIRE_AIRCRAFT_KEYEVENTDISPATCHTABLE_HPP
@@ -0,0 +1,427 @@
+// Copyright (c) 2024 FlyByWire Simulations
+// SPDX-License-Identifier: GPL-3.0
+
+#ifndef FLYBYWIRE_AIRCRAFT_LOGBUFFER_HPP
+#define FLYBYWIRE_AIRCRAFT_LOGBUFFER_HPP
+
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "fmt/args.h"
+#include "fmt/format.h"
+
+/**
+ * @brief Ring buffer of binary log records which are only formatted to text when they are drained.
+ *
+ * @details A log record is the ID of a registered format string plus its raw arguments. Recording copies
+ * the arguments into a preallocated byte ring buffer (strings are truncated to MAX_STRING_SIZE) and does not
+ * allocate. The oldest records are overwritten when the buffer is full - records overwritten before they
+ * were drained are counted as dropped.
+ *
+ * drain() formats the records recorded since the last drain with fmt, off the hot path and with a limit of
+ * records per call. Records with a level above the drain level are passed over without being formatted and
+ * are not counted as dropped when they are overwritten. The retained records (drained or not) can be written
+ * to a binary dump file which is decoded to text on the host (see tools/logdecode).
+ *
+ * The format strings are checked against the argument types at compile time by fmt (see Logger::log) and
+ * the arguments are stored in a type compatible with their formatting (integers as 64 bit, float as double).
+ *
+ * @usage
+ *   - Register a format once (e.g. static const auto id = buffer.addFormat(DEBUG_LVL, "{} is {}", __FILE__, __LINE__);)<br/>
+ *   - Record (e.g. buffer.record(id, name, value);)<br/>
+ *   - Drain (e.g. buffer.drain(32, [](const LogBuffer::Format& format, const std::string& text) { print(text); });)<br/>
+ *   - Write a dump (e.g. buffer.writeDump("\\work\\log.dump");)<br/>
+ *
+ * Dump file format (little endian):<br/>
+ *   - char[4] magic "FBWL", uint32 version, uint32 number of formats<br/>
+ *   - per format: uint32 level, uint32 line, uint32 file length, file characters, uint32 format length, format characters<br/>
+ *   - uint64 number of dropped records, uint64 number of records<br/>
+ *   - per record (oldest first): uint32 format id, uint32 argument bytes, uint64 time stamp in nanoseconds, arguments<br/>
+ *   - per argument: uint8 type (1 bool, 2 char, 3 int64, 4 uint64, 5 double, 6 string, 7 pointer), then the value:
+ *     uint8 for bool and char, 8 bytes for the numbers and pointers, uint16 length plus characters for strings<br/>
+ */
+class LogBuffer {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  static constexpr char          DUMP_MAGIC[4]   = {'F', 'B', 'W', 'L'};
+  static constexpr std::uint32_t DUMP_VERSION    = 1;
+  static constexpr std::size_t   MAX_STRING_SIZE = 1024;
+  static constexpr std::uint32_t ALL_LEVELS      = ~std::uint32_t{0};
+
+  enum class ArgType : std::uint8_t { BOOL = 1, CHAR = 2, INT = 3, UINT = 4, DOUBLE = 5, STRING = 6, POINTER = 7 };
+
+  /**
+   * @brief A registered format string and the log level and source location of its call site.
+   */
+  struct Format {
+    std::uint32_t level;
+    std::uint32_t line;
+    std::string   file;
+    std::string   format;
+  };
+
+ private:
+  static constexpr std::size_t HEADER_SIZE = 16;  // format id, argument bytes, time stamp
+
+  std::vector<std::uint8_t> _buffer{};
+  std::uint64_t             _mask       = 0;
+  std::uint64_t             _head       = 0;  // write position
+  std::uint64_t             _tail       = 0;  // oldest retained record
+  std::uint64_t             _drained    = 0;  // oldest record not drained yet
+  std::uint64_t             _dropped    = 0;
+  std::uint64_t             _count      = 0;  // retained records
+  std::size_t               _pending    = 0;  // records at or below the drain level not drained yet
+  std::uint32_t             _drainLevel = ALL_LEVELS;
+  std::vector<Format>       _formats{};
+  Clock::time_point         _start      = Clock::now();
+
+ public:
+  /**
+   * @brief Creates a log buffer.
+   * @param capacity the size of the ring buffer in bytes - rounded up to the next power of two
+   */
+  explicit LogBuffer(std::size_t capacity) { resize(capacity); }
+
+  /**
+   * @brief Changes the size of the ring buffer. The retained records are discarded, the formats are kept.
+   * @param capacity the size of the ring buffer in bytes - rounded up to the next power of two
+   */
+  void resize(std::size_t capacity) {
+    _buffer.assign(std::bit_ceil((std::max)(capacity, std::size_t{256})), 0);
+    _buffer.shrink_to_fit();
+    _mask    = _buffer.size() - 1;
+    _head    = 0;
+    _tail    = 0;
+    _drained = 0;
+    _count   = 0;
+    _pending = 0;
+  }
+
+  /**
+   * @brief Sets the highest level of the records passed to the sink by drain(). Records above the former
+   * drain level which are not drained yet are passed over, so only drain all records before lowering it.
+   * @param level the highest log level to drain (default: ALL_LEVELS)
+   */
+  void setDrainLevel(std::uint32_t level) {
+    while (_drained != _head && !isDrained(readFormatId(_drained))) {
+      _drained += HEADER_SIZE + readArgBytes(_drained);
+    }
+    _drainLevel = level;
+    _pending    = 0;
+    for (std::uint64_t position = _drained; position != _head; position += HEADER_SIZE + readArgBytes(position)) {
+      _pending += isDrained(readFormatId(position));
+    }
+  }
+
+  /**
+   * @return the highest level of the records passed to the sink by drain()
+   */
+  [[nodiscard]] std::uint32_t drainLevel() const { return _drainLevel; }
+
+  /**
+   * @brief Registers a format string.
+   * @param level the log level of the format
+   * @param format the fmt format string
+   * @param file the source file of the call site
+   * @param line the source line of the call site
+   * @return the ID of the format used for recording
+   */
+  std::uint32_t addFormat(std::uint32_t level, std::string_view format, std::string_view file, std::uint32_t line) {
+    _formats.push_back({level, line, std::string{file}, std::string{format}});
+    return static_cast<std::uint32_t>(_formats.size() - 1);
+  }
+
+  /**
+   * @brief Registers a fixed message as a format string (braces are escaped).
+   * @see addFormat()
+   */
+  std::uint32_t addMessage(std::uint32_t level, std::string_view message, std::string_view file, std::uint32_t line) {
+    std::string format;
+    format.reserve(message.size());
+    for (const char c : message) {
+      format += c;
+      if (c == '{' || c == '}') {
+        format += c;
+      }
+    }
+    return addFormat(level, format, file, line);
+  }
+
+  /**
+   * @brief Records the arguments for a format. Does not allocate.
+   * @param formatId the ID returned by addFormat()
+   * @param args the arguments - bool, characters, integers, floating point numbers, strings and pointers
+   * @return true if the record was stored, false if it is larger than the buffer
+   */
+  template <typename... Args>
+  bool record(std::uint32_t formatId, const Args&... args) {
+    const std::size_t argBytes = (std::size_t{0} + ... + argSize(args));
+    const std::size_t size     = HEADER_SIZE + argBytes;
+    if (size > _buffer.size()) {
+      _dropped++;
+      return false;
+    }
+    while (_buffer.size() - (_head - _tail) < size) {
+      evictOldest();
+    }
+    const auto argBytes32 = static_cast<std::uint32_t>(argBytes);
+    const auto elapsed    = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - _start);
+    const auto timeStamp  = static_cast<std::uint64_t>(elapsed.count());
+    writeBytes(&formatId, sizeof(formatId));
+    writeBytes(&argBytes32, sizeof(argBytes32));
+    writeBytes(&timeStamp, sizeof(timeStamp));
+    (writeArg(args), ...);
+    _count++;
+    _pending += isDrained(formatId);
+    return true;
+  }
+
+  /**
+   * @brief Formats and passes the records at or below the drain level not drained yet to the sink (oldest
+   * first). Returns right away if there are none.
+   * @param maxRecords the maximum number of records to drain
+   * @param sink function called with the Format and the formatted text of each record
+   * @return the number of drained records
+   */
+  template <typename Sink>
+  std::size_t drain(std::size_t maxRecords, Sink&& sink) {
+    std::size_t drained = 0;
+    while (_pending > 0 && drained < maxRecords) {
+      const std::uint32_t formatId = readFormatId(_drained);
+      const std::uint32_t argBytes = readArgBytes(_drained);
+      const std::uint64_t position = _drained;
+      _drained += HEADER_SIZE + argBytes;
+      if (isDrained(formatId)) {
+        _pending--;
+        drained++;
+        sink(_formats[formatId], formatRecord(_formats[formatId], position + HEADER_SIZE, argBytes));
+      }
+    }
+    return drained;
+  }
+
+  /**
+   * @return the number of records at or below the drain level not drained yet
+   */
+  [[nodiscard]] std::size_t pending() const { return _pending; }
+
+  /**
+   * @return the number of records at or below the drain level overwritten before they were drained or too
+   *         large for the buffer
+   */
+  [[nodiscard]] std::uint64_t dropped() const { return _dropped; }
+
+  /**
+   * @return the number of records in the ring buffer (drained or not)
+   */
+  [[nodiscard]] std::size_t size() const { return _count; }
+
+  /**
+   * @return the size of the ring buffer in bytes
+   */
+  [[nodiscard]] std::size_t capacity() const { return _buffer.size(); }
+
+  /**
+   * @return the registered formats
+   */
+  [[nodiscard]] const std::vector<Format>& formats() const { return _formats; }
+
+  /**
+   * @brief Writes the formats and the records of the ring buffer in the dump format to a stream.
+   * @param os the stream to write to (binary)
+   * @return true if the dump was written successfully, false otherwise
+   */
+  bool writeDump(std::ostream& os) const {
+    os.write(DUMP_MAGIC, sizeof(DUMP_MAGIC));
+    writeValue(os, DUMP_VERSION);
+    writeValue(os, static_cast<std::uint32_t>(_formats.size()));
+    for (const auto& format : _formats) {
+      writeValue(os, format.level);
+      writeValue(os, format.line);
+      writeValue(os, static_cast<std::uint32_t>(format.file.size()));
+      os.write(format.file.data(), static_cast<std::streamsize>(format.file.size()));
+      writeValue(os, static_cast<std::uint32_t>(format.format.size()));
+      os.write(format.format.data(), static_cast<std::streamsize>(format.format.size()));
+    }
+    writeValue(os, _dropped);
+    writeValue(os, static_cast<std::uint64_t>(_count));
+    // the records are contiguous in the ring, so at most two parts
+    const std::uint64_t begin = _tail & _mask;
+    const std::uint64_t bytes = _head - _tail;
+    const std::uint64_t first = (std::min)(bytes, _buffer.size() - begin);
+    os.write(reinterpret_cast<const char*>(_buffer.data() + begin), static_cast<std::streamsize>(first));
+    os.write(reinterpret_cast<const char*>(_buffer.data()), static_cast<std::streamsize>(bytes - first));
+    return os.good();
+  }
+
+  /**
+   * @brief Writes the formats and the records of the ring buffer in the dump format to a file.
+   * @param filename the file to write - an existing file is overwritten
+   * @return true if the dump was written successfully, false otherwise
+   */
+  bool writeDump(const std::string& filename) const {
+    std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+      return false;
+    }
+    return writeDump(file);
+  }
+
+ private:
+  template <typename T>
+  static constexpr bool isString = std::is_convertible_v<const T&, std::string_view>;
+
+  template <typename T>
+  static std::size_t argSize(const T& arg) {
+    if constexpr (isString<T>) {
+      return 3 + (std::min)(std::string_view{arg}.size(), MAX_STRING_SIZE);
+    } else if constexpr (std::is_same_v<T, bool> || std::is_same_v<T, char>) {
+      return 2;
+    } else {
+      static_assert(std::is_arithmetic_v<T> || std::is_pointer_v<T>,
+                    "LogBuffer: unsupported argument type - format it to a string before logging");
+      return 9;
+    }
+  }
+
+  template <typename T>
+  void writeArg(const T& arg) {
+    if constexpr (isString<T>) {
+      const std::string_view str{arg};
+      const auto             length = static_cast<std::uint16_t>((std::min)(str.size(), MAX_STRING_SIZE));
+      writeType(ArgType::STRING);
+      writeBytes(&length, sizeof(length));
+      writeBytes(str.data(), length);
+    } else if constexpr (std::is_same_v<T, bool> || std::is_same_v<T, char>) {
+      writeType(std::is_same_v<T, bool> ? ArgType::BOOL : ArgType::CHAR);
+      writeBytes(&arg, 1);
+    } else if constexpr (std::is_pointer_v<T>) {
+      const auto value = static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(arg));
+      writeType(ArgType::POINTER);
+      writeBytes(&value, sizeof(value));
+    } else if constexpr (std::is_floating_point_v<T>) {
+      const auto value = static_cast<double>(arg);
+      writeType(ArgType::DOUBLE);
+      writeBytes(&value, sizeof(value));
+    } else if constexpr (std::is_signed_v<T>) {
+      const auto value = static_cast<std::int64_t>(arg);
+      writeType(ArgType::INT);
+      writeBytes(&value, sizeof(value));
+    } else {
+      const auto value = static_cast<std::uint64_t>(arg);
+      writeType(ArgType::UINT);
+      writeBytes(&value, sizeof(value));
+    }
+  }
+
+  void writeType(ArgType type) { writeBytes(&type, 1); }
+
+  void writeBytes(const void* data, std::size_t size) {
+    const std::uint64_t begin = _head & _mask;
+    const std::size_t   first = (std::min)(size, static_cast<std::size_t>(_buffer.size() - begin));
+    std::memcpy(_buffer.data() + begin, data, first);
+    std::memcpy(_buffer.data(), static_cast<const std::uint8_t*>(data) + first, size - first);
+    _head += size;
+  }
+
+  void readBytes(std::uint64_t position, void* data, std::size_t size) const {
+    const std::uint64_t begin = position & _mask;
+    const std::size_t   first = (std::min)(size, static_cast<std::size_t>(_buffer.size() - begin));
+    std::memcpy(data, _buffer.data() + begin, first);
+    std::memcpy(static_cast<std::uint8_t*>(data) + first, _buffer.data(), size - first);
+  }
+
+  [[nodiscard]] std::uint32_t readFormatId(std::uint64_t position) const {
+    std::uint32_t formatId;
+    readBytes(position, &formatId, sizeof(formatId));
+    return formatId;
+  }
+
+  [[nodiscard]] std::uint32_t readArgBytes(std::uint64_t position) const {
+    std::uint32_t argBytes;
+    readBytes(position + 4, &argBytes, sizeof(argBytes));
+    return argBytes;
+  }
+
+  [[nodiscard]] bool isDrained(std::uint32_t formatId) const {
+    return formatId < _formats.size() && _formats[formatId].level <= _drainLevel;
+  }
+
+  void evictOldest() {
+    const std::uint32_t formatId = readFormatId(_tail);
+    _tail += HEADER_SIZE + readArgBytes(_tail);
+    _count--;
+    if (_drained < _tail) {
+      _drained = _tail;
+      if (isDrained(formatId)) {
+        _pending--;
+        _dropped++;
+      }
+    }
+  }
+
+  std::string formatRecord(const Format& format, std::uint64_t position, std::uint32_t argBytes) const {
+    fmt::dynamic_format_arg_store<fmt::format_context> store;
+    const std::uint64_t                                end = position + argBytes;
+    while (position < end) {
+      ArgType type;
+      readBytes(position++, &type, 1);
+      switch (type) {
+        case ArgType::BOOL:
+        case ArgType::CHAR: {
+          char value;
+          readBytes(position, &value, 1);
+          position += 1;
+          if (type == ArgType::BOOL) {
+            store.push_back(value != 0);
+          } else {
+            store.push_back(value);
+          }
+          break;
+        }
+        case ArgType::STRING: {
+          std::uint16_t length;
+          readBytes(position, &length, sizeof(length));
+          std::string value(length, '\0');
+          readBytes(position + 2, value.data(), length);
+          position += 2 + length;
+          store.push_back(std::move(value));
+          break;
+        }
+        default: {
+          std::uint64_t bits;
+          readBytes(position, &bits, sizeof(bits));
+          position += 8;
+          if (type == ArgType::INT) {
+            store.push_back(static_cast<std::int64_t>(bits));
+          } else if (type == ArgType::DOUBLE) {
+            store.push_back(std::bit_cast<double>(bits));
+          } else if (type == ArgType::POINTER) {
+            store.push_back(reinterpret_cast<const void*>(static_cast<std::uintptr_t>(bits)));
+          } else {
+            store.push_back(bits);
+          }
+          break;
+        }
+      }
+    }
+    return fmt::vformat(format.format, store);
+  }
+
+  template <typename T>
+  static void writeValue(std::ostream& os, T value) {
+    os.write(reinterpret_cast<const char*>(&value), sizeof(T));
+  }
+};
+
+#endif  // FLYBYWIRE_AIRCRAFT_LOGBUFFER_HPP
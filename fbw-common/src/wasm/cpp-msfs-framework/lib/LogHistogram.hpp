@@ -0,0 +1,154 @@
+// Copyright (c) 2024 FlyByWire Simulations
+// SPDX-License-Identifier: GPL-3.0
+
+#ifndef FLYBYWIRE_AIRCRAFT_LOGHISTOGRAM_HPP
+#define FLYBYWIRE_AIRCRAFT_LOGHISTOGRAM_HPP
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <limits>
+
+/**
+ * @brief A histogram with logarithmic buckets to calculate percentiles of a stream of values without
+ * storing or sorting the values.
+ * @details Each power of two is divided into SUB_BUCKETS linear sub-buckets (similar to an HDR histogram),
+ * so the relative error of a percentile is at most 1/(2 * SUB_BUCKETS). Values smaller than SUB_BUCKETS are
+ * counted exactly. Recording and removing a value is constant time, a percentile query walks the
+ * fixed number of buckets.
+ */
+class LogHistogram {
+ public:
+  static constexpr std::size_t SUB_BUCKET_BITS = 3;
+  static constexpr std::size_t SUB_BUCKETS     = 1 << SUB_BUCKET_BITS;
+  static constexpr std::size_t BUCKETS         = (64 - SUB_BUCKET_BITS + 1) * SUB_BUCKETS;
+
+ private:
+  std::array<std::uint64_t, BUCKETS> _counts{};
+  std::uint64_t                      _count   = 0;
+  std::uint64_t                      _sum     = 0;
+  std::uint64_t                      _minimum = std::numeric_limits<std::uint64_t>::max();
+  std::uint64_t                      _maximum = 0;
+
+ public:
+  /**
+   * @brief Get the bucket index of a value.
+   * @param value the value
+   * @return index of the bucket that counts the value
+   */
+  [[nodiscard]] static constexpr std::size_t bucketIndex(std::uint64_t value) {
+    if (value < SUB_BUCKETS) {
+      return static_cast<std::size_t>(value);
+    }
+    const std::size_t exponent = static_cast<std::size_t>(std::bit_width(value)) - 1;
+    const std::size_t shift    = exponent - SUB_BUCKET_BITS;
+    return (shift + 1) * SUB_BUCKETS + static_cast<std::size_t>((value >> shift) & (SUB_BUCKETS - 1));
+  }
+
+  /**
+   * @brief Get the smallest value that is counted in a bucket.
+   * @param index the bucket index
+   * @return the lower bound of the bucket
+   */
+  [[nodiscard]] static constexpr std::uint64_t bucketLowerBound(std::size_t index) {
+    if (index < SUB_BUCKETS) {
+      return index;
+    }
+    const std::size_t shift = index / SUB_BUCKETS - 1;
+    return (static_cast<std::uint64_t>(SUB_BUCKETS + index % SUB_BUCKETS)) << shift;
+  }
+
+  /**
+   * @brief Count a value.
+   * @param value the value to count
+   */
+  void record(std::uint64_t value) {
+    _counts[bucketIndex(value)]++;
+    _count++;
+    _sum += value;
+    _minimum = std::min(_minimum, value);
+    _maximum = std::max(_maximum, value);
+  }
+
+  /**
+   * @brief Remove a previously recorded value, e.g. when it leaves a sliding window.
+   * @details The minimum and maximum are not updated as they can not be restored without the values,
+   * percentiles are still calculated from the remaining values.
+   * @param value the value to remove
+   */
+  void remove(std::uint64_t value) {
+    std::uint64_t& bucket = _counts[bucketIndex(value)];
+    if (bucket == 0) {
+      return;
+    }
+    bucket--;
+    _count--;
+    _sum -= value;
+  }
+
+  /**
+   * @brief Remove all values.
+   */
+  void reset() {
+    _counts.fill(0);
+    _count   = 0;
+    _sum     = 0;
+    _minimum = std::numeric_limits<std::uint64_t>::max();
+    _maximum = 0;
+  }
+
+  /**
+   * @brief Get the value at a percentile of the counted values.
+   * @details The result is the middle of the bucket that contains the percentile, limited to the
+   * recorded minimum and maximum. The 100th percentile is the exact maximum unless values have been removed.
+   * @param percentile the percentile in the range [0, 1], e.g. 0.99 for the 99th percentile
+   * @return value at the percentile or 0 if no values are counted
+   */
+  [[nodiscard]] std::uint64_t percentile(double percentile) const {
+    if (_count == 0) {
+      return 0;
+    }
+    const double        clamped = std::clamp(percentile, 0.0, 1.0);
+    const std::uint64_t rank    = std::max<std::uint64_t>(1, static_cast<std::uint64_t>(clamped * static_cast<double>(_count) + 0.5));
+    std::uint64_t seen = 0;
+    for (std::size_t i = 0; i < BUCKETS - 1; ++i) {
+      seen += _counts[i];
+      if (seen >= rank) {
+        const std::uint64_t lower = bucketLowerBound(i);
+        const std::uint64_t upper = bucketLowerBound(i + 1);
+        // the highest value can not be above the upper bound of its bucket
+        const std::uint64_t value = rank >= _count ? upper - 1 : lower + (upper - lower) / 2;
+        return std::clamp(value, _minimum, _maximum);
+      }
+    }
+    return _maximum;
+  }
+
+  /**
+   * @return number of counted values
+   */
+  [[nodiscard]] std::uint64_t count() const { return _count; }
+
+  /**
+   * @return sum of the counted values
+   */
+  [[nodiscard]] std::uint64_t sum() const { return _sum; }
+
+  /**
+   * @return average of the counted values or 0 if no values are counted
+   */
+  [[nodiscard]] std::uint64_t average() const { return _count == 0 ? 0 : _sum / _count; }
+
+  /**
+   * @return smallest recorded value since the last reset or 0 if no values are counted
+   */
+  [[nodiscard]] std::uint64_t minimum() const { return _count == 0 ? 0 : _minimum; }
+
+  /**
+   * @return largest recorded value since the last reset
+   */
+  [[nodiscard]] std::uint64_t maximum() const { return _maximum; }
+};
+
+#endif  // FLYBYWIRE_AIRCRAFT_LOGHISTOGRAM_HPP
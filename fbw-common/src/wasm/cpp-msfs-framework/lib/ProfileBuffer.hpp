@@ -5,11 +5,15 @@
 #define FLYBYWIRE_AIRCRAFT_PROFILEBUFFER_HPP
 
 #include <algorithm>
+#include <array>
 #include <chrono>
-#include <deque>
-#include <iostream>
-#include <numeric>
+#include <cmath>
+#include <cstdint>
+#include <functional>
 #include <type_traits>
+#include <vector>
+
+#include "LogHistogram.hpp"
 
 // required to check valid template parameters - numeric types and std::chrono::duration
 template <typename T>
@@ -24,21 +28,102 @@ struct is_numeric<std::chrono::duration<T>> : std::true_type {};
 /**
  * @brief A buffer to collect a fixed number of values for profiling purposes.
  * @details The buffer will collect the last n values and provide methods to
- * calculate the sum, average and trimmed average of the collected values.
+ * calculate the sum, average, minimum, maximum and estimated trimmed average of the collected values.
+ *
+ * The values are stored in a fixed size circular array that is allocated on construction, pushing a value
+ * does not allocate and is amortized constant time. Sum and average use a running sum, which is recomputed
+ * from the values once per pass through the array for floating point values so rounding errors do not
+ * accumulate. The minimum and maximum are exact and kept in monotonic queues of the candidates of the window.
+ *
+ * Trimmed averages and percentile averages are estimates. They use a histogram with logarithmic buckets (see
+ * LogHistogram) which stores the count and the sum of the values per bucket. Whole buckets contribute their
+ * exact sum, only the partially used bucket at the trim boundary is estimated with the average of the bucket,
+ * so the error is bounded by the relative width of one bucket. These queries walk the fixed number of buckets
+ * and do not depend on the number of values in the buffer.
+ * Integral values and durations smaller than LogHistogram::SUB_BUCKETS are counted exactly. Floating point
+ * values are scaled by 2^FLOATING_POINT_SCALE_BITS before bucketing, so values down to about 1e-8 keep the
+ * relative resolution of the buckets (e.g. sub-millisecond timings in milliseconds). Negative values share
+ * the lowest bucket.
+ *
  * @tparam T the type of the values to collect - must be numeric or a std::chrono::duration
  */
 template <typename T>
 class ProfileBuffer {
  private:
-  std::size_t   _capacity;
-  std::deque<T> _buffer;
+  /**
+   * @brief Monotonic queue of the values of the window which can still become its minimum (or maximum).
+   * @details A pushed value removes the candidates from the back it is better than, as these leave the window
+   * before it, so the front is the extreme of the window. Each value is pushed and removed once, which makes
+   * pushing amortized constant time. The candidates are stored in a ring of the buffer's capacity.
+   * @tparam Keeps the comparison a candidate must pass against a pushed value to be kept (e.g. std::less for the minimum)
+   */
+  template <typename Keeps>
+  class ExtremeQueue {
+   private:
+    struct Candidate {
+      std::uint64_t sequence;
+      T             value;
+    };
+
+    std::vector<Candidate> _candidates;
+    std::size_t            _head  = 0;
+    std::size_t            _count = 0;
+
+   public:
+    explicit ExtremeQueue(std::size_t capacity) : _candidates(capacity) {}
+
+    /**
+     * @brief Push the value with the given sequence number and remove the candidate which left the window.
+     * @param sequence the sequence number of the value
+     * @param value the value
+     * @param firstSequence the sequence number of the oldest value in the window
+     */
+    void push(std::uint64_t sequence, T value, std::uint64_t firstSequence) {
+      // only the oldest candidate can have left the window with this push
+      if (_count > 0 && _candidates[_head].sequence < firstSequence) {
+        _head = wrap(_head + 1);
+        _count--;
+      }
+      while (_count > 0 && !Keeps{}(_candidates[wrap(_head + _count - 1)].value, value)) {
+        _count--;
+      }
+      _candidates[wrap(_head + _count)] = {sequence, value};
+      _count++;
+    }
+
+    /**
+     * @brief The extreme of the window or T{} if no value was pushed.
+     */
+    [[nodiscard]] T front() const { return _count == 0 ? T{} : _candidates[_head].value; }
+
+   private:
+    [[nodiscard]] std::size_t wrap(std::size_t index) const { return index >= _candidates.size() ? index - _candidates.size() : index; }
+  };
+
+  std::size_t    _capacity;
+  std::vector<T> _buffer;
+  std::size_t    _next   = 0;
+  std::size_t    _size   = 0;
+  std::uint64_t  _pushed = 0;
+  T              _sum{};
+
+  std::array<std::size_t, LogHistogram::BUCKETS> _bucketCounts{};
+  std::array<T, LogHistogram::BUCKETS>           _bucketSums{};
+
+  ExtremeQueue<std::less<T>>    _minimum;
+  ExtremeQueue<std::greater<T>> _maximum;
 
  public:
+  /**
+   * @brief Floating point values are multiplied by 2^FLOATING_POINT_SCALE_BITS before bucketing.
+   */
+  static constexpr int FLOATING_POINT_SCALE_BITS = 32;
+
   /**
    * @brief Construct a new Profile Buffer object
    * @param capacity the maximum number of values to collect in the buffer
    */
-  explicit ProfileBuffer(std::size_t capacity) : _capacity{capacity}, _buffer{std::deque<T>()} {
+  explicit ProfileBuffer(std::size_t capacity) : _capacity{capacity}, _buffer(capacity), _minimum(capacity), _maximum(capacity) {
     static_assert(is_numeric<T>::value || is_duration<T>::value, "T must be numeric or duration type");
   }
 
@@ -48,98 +133,227 @@ class ProfileBuffer {
    * @param value the value to push
    */
   void push(T value) {
-    if (_buffer.size() == _capacity) {
-      _buffer.pop_front();
+    if (_capacity == 0) {
+      return;
+    }
+
+    // remove the oldest value
+    if (_size == _capacity) {
+      const T oldest = _buffer[_next];
+      _sum -= oldest;
+      const std::size_t bucket = bucketIndex(oldest);
+      _bucketCounts[bucket]--;
+      _bucketSums[bucket] -= oldest;
+    } else {
+      _size++;
+    }
+
+    // add the new value
+    _buffer[_next] = value;
+    _sum += value;
+    const std::size_t bucket = bucketIndex(value);
+    _bucketCounts[bucket]++;
+    _bucketSums[bucket] += value;
+    _minimum.push(_pushed, value, _pushed + 1 - _size);
+    _maximum.push(_pushed, value, _pushed + 1 - _size);
+    _pushed++;
+    if (++_next == _capacity) {
+      _next = 0;
+      recomputeSums();
     }
-    _buffer.push_back(value);
   }
 
   /**
    * @brief Calculate the sum of all values in the buffer at the time of the call.
    * @return sum of all values
    */
-  T sum() {
-#if __cpp_lib_parallel_algorithm >= 201603
-    return std::reduce(_buffer.begin(), _buffer.end(), T(0));
-#else
-    return std::accumulate(_buffer.begin(), _buffer.end(), T(0));
-#endif
-  }
+  [[nodiscard]] T sum() const { return _sum; }
 
   /**
    * @brief Calculate the average of all values in the buffer at the time of the call.
-   * @return average of all values with type T
+   * @return average of all values with type T or 0 if the buffer is empty
    */
-  [[nodiscard]] inline T avg() { return sum() / _buffer.size(); }
+  [[nodiscard]] inline T avg() const { return _size == 0 ? T{} : divide(_sum, _size); }
 
   /**
-   * @brief Calculate the trimmed average of all values in the buffer at the time of the call.
-   * The trimmed average is calculated by creating a sorted copy of the buffer and removing the
-   * lowest and highest values before calculating the average.
+   * @brief Estimate the trimmed average of all values in the buffer at the time of the call.
+   * The trimmed average is calculated by removing the lowest and highest values before calculating
+   * the average. At least one value is kept.
+   * The trimmed values are taken from the histogram buckets, the bucket at each trim boundary contributes its
+   * average instead of its actual lowest or highest values (see class description).
    * @param trimPercent the percentage of values to trim from the buffer before calculating the average (default: 5%)
-   * @return trimmed average of all values
-   */
-  [[nodiscard]] T trimmedAverage(float trimPercent = 0.05f) {
-    auto sorted = _buffer;
-    std::sort(sorted.begin(), sorted.end());
-    const std::size_t trimSize = sorted.size() * trimPercent;
-
-#if __cpp_lib_parallel_algorithm >= 201603
-    return std::reduce(sorted.begin() + trimSize, sorted.end() - trimSize, T(0)) / (sorted.size() - trimSize * 2);
-#else
-    return std::accumulate(sorted.begin() + trimSize, sorted.end() - trimSize, T(0)) / (sorted.size() - trimSize * 2);
-#endif
+   * @return trimmed average of all values or 0 if the buffer is empty
+   */
+  [[nodiscard]] T trimmedAverage(float trimPercent = 0.05f) const {
+    if (_size == 0) {
+      return T{};
+    }
+    const std::size_t trimSize = std::min(static_cast<std::size_t>(_size * trimPercent), (_size - 1) / 2);
+    return divide(_sum - sumOfLowest(trimSize) - sumOfHighest(trimSize), _size - trimSize * 2);
   }
 
   /**
-   * @brief Get the minimum value in the buffer. If percentile is set, the minimum value will be calculated by
+   * @brief Get the minimum value in the buffer. If percentile is set, the minimum value will be estimated by
    *        averaging the lowest percentile values in the buffer.
+   * @details The minimum is exact, the percentile average is taken from the histogram buckets and the bucket at
+   * the percentile boundary contributes its average instead of its actual lowest values (see class description).
    * @param percentile Percentile to return, e.g. 0.05 for the 5% minimum. If no percentile is given, the minimum of all values is returned.
-   * @return Average value of the minimum percentile of the collected samples at the time of calling this method or the minimum of
-   * all samples if no percentile is given
-   */
-  [[nodiscard]] T minimum(float percentile = 0.0f) {
-    if (percentile > 0.0) {
-      auto sorted = _buffer;
-      std::sort(sorted.begin(), sorted.end());
-      const std::size_t trimSize = sorted.size() * percentile;
-#if __cpp_lib_parallel_algorithm >= 201603
-      return std::reduce(sorted.begin(), sorted.begin() + trimSize, T(0)) / trimSize;
-#else
-      return std::accumulate(sorted.begin(), sorted.begin() + trimSize, T(0)) / trimSize;
-#endif
-    }
-    return *std::min_element(_buffer.begin(), _buffer.end());
+   * @return Estimated average value of the minimum percentile of the collected samples at the time of calling this method or the
+   * minimum of all samples if no percentile is given or the percentile contains no samples
+   */
+  [[nodiscard]] T minimum(float percentile = 0.0f) const {
+    if (_size == 0) {
+      return T{};
+    }
+    const std::size_t trimSize = static_cast<std::size_t>(_size * std::min(percentile, 1.0f));
+    if (percentile > 0.0 && trimSize > 0) {
+      return divide(sumOfLowest(trimSize), trimSize);
+    }
+    return _minimum.front();
   }
 
   /**
-   * @brief Get the maximum value in the buffer. If percentile is set, the maximum value will be calculated by
+   * @brief Get the maximum value in the buffer. If percentile is set, the maximum value will be estimated by
    *        averaging the highest percentile values in the buffer.
+   * @details The maximum is exact, the percentile average is taken from the histogram buckets and the bucket at
+   * the percentile boundary contributes its highest values estimated with its average (see class description).
    * @param percentile Percentile to return, e.g. 0.05 for the 5% maximum. If no percentile is given, the maximum of all values is returned.
-   * @return Average value of the maximum percentile of the collected samples at the time of calling this method or the maximum of
-   * all samples if no percentile is given
+   * @return Estimated average value of the maximum percentile of the collected samples at the time of calling this method or the
+   * maximum of all samples if no percentile is given or the percentile contains no samples
    */
-  [[nodiscard]] T maximum(float percentile = 0.0f) {
-    if (percentile > 0.0) {
-      auto sorted = _buffer;
-      std::sort(sorted.begin(), sorted.end());
-      const std::size_t trimSize = sorted.size() * percentile;
-      return std::accumulate(sorted.end() - trimSize, sorted.end(), T(0)) / trimSize;
+  [[nodiscard]] T maximum(float percentile = 0.0f) const {
+    if (_size == 0) {
+      return T{};
+    }
+    const std::size_t trimSize = static_cast<std::size_t>(_size * std::min(percentile, 1.0f));
+    if (percentile > 0.0 && trimSize > 0) {
+      return divide(sumOfHighest(trimSize), trimSize);
     }
-    return *std::max_element(_buffer.begin(), _buffer.end());
+    return _maximum.front();
   }
 
   /**
    * @brief Get the current number of values in the buffer.
    * @return Current number of values in the buffer.
    */
-  [[nodiscard]] std::size_t size() const { return _buffer.size(); }
+  [[nodiscard]] std::size_t size() const { return _size; }
 
   /**
    * @brief Get the capacity of the buffer.
    * @return Capacity of the buffer.
    */
   [[nodiscard]] std::size_t capacity() const { return _capacity; }
+
+ private:
+  /**
+   * @brief Get the histogram bucket of a value. Negative values are counted in the lowest bucket.
+   */
+  static std::size_t bucketIndex(T value) { return bucketIndexOf(rep(value)); }
+
+  template <typename V>
+  static std::size_t bucketIndexOf(V value) {
+    if (!(value > V(0))) {
+      return 0;
+    }
+    if constexpr (std::is_floating_point_v<V>) {
+      // scale to keep the resolution of small values, e.g. a timing of 0.25 ms would otherwise share the bucket of zero
+      const V scaled = std::ldexp(value, FLOATING_POINT_SCALE_BITS);
+      if (scaled >= static_cast<V>(UINT64_MAX)) {
+        return LogHistogram::BUCKETS - 1;
+      }
+      return LogHistogram::bucketIndex(static_cast<std::uint64_t>(scaled));
+    } else {
+      return LogHistogram::bucketIndex(static_cast<std::uint64_t>(value));
+    }
+  }
+
+  /**
+   * @brief Recompute the running sums from the values in the buffer.
+   * @details Floating point running sums accumulate the rounding errors of every added and removed value, so
+   * they are recomputed once per pass through the buffer, which keeps pushing amortized constant time. Integral
+   * sums are exact and never recomputed.
+   */
+  void recomputeSums() {
+    if constexpr (std::is_floating_point_v<decltype(rep(T{}))>) {
+      _sum = T{};
+      _bucketSums.fill(T{});
+      for (const T& value : _buffer) {
+        _sum += value;
+        _bucketSums[bucketIndex(value)] += value;
+      }
+    }
+  }
+
+  /**
+   * @brief The representation of a value, the count for durations.
+   */
+  static auto rep(T value) {
+    if constexpr (is_duration<T>::value) {
+      return value.count();
+    } else {
+      return value;
+    }
+  }
+
+  /**
+   * @brief Divide a value by a count, works for arithmetic types and durations.
+   */
+  static T divide(T value, std::size_t count) {
+    if constexpr (is_duration<T>::value) {
+      return value / static_cast<typename T::rep>(count);
+    } else {
+      return value / static_cast<T>(count);
+    }
+  }
+
+  /**
+   * @brief Multiply a value by a count, works for arithmetic types and durations.
+   */
+  static T multiply(T value, std::size_t count) {
+    if constexpr (is_duration<T>::value) {
+      return value * static_cast<typename T::rep>(count);
+    } else {
+      return value * static_cast<T>(count);
+    }
+  }
+
+  /**
+   * @brief Sum of the count lowest values, exact for whole buckets and estimated with the bucket average for
+   * the bucket at the boundary.
+   */
+  [[nodiscard]] T sumOfLowest(std::size_t count) const {
+    T result{};
+    for (std::size_t i = 0; i < LogHistogram::BUCKETS && count > 0; ++i) {
+      result += takeFromBucket(i, count);
+    }
+    return result;
+  }
+
+  /**
+   * @brief Sum of the count highest values, exact for whole buckets and estimated with the bucket average for
+   * the bucket at the boundary.
+   */
+  [[nodiscard]] T sumOfHighest(std::size_t count) const {
+    T result{};
+    for (std::size_t i = LogHistogram::BUCKETS; i > 0 && count > 0; --i) {
+      result += takeFromBucket(i - 1, count);
+    }
+    return result;
+  }
+
+  [[nodiscard]] T takeFromBucket(std::size_t bucket, std::size_t& count) const {
+    const std::size_t bucketCount = _bucketCounts[bucket];
+    if (bucketCount == 0) {
+      return T{};
+    }
+    if (bucketCount <= count) {
+      count -= bucketCount;
+      return _bucketSums[bucket];
+    }
+    const T partial = divide(multiply(_bucketSums[bucket], count), bucketCount);
+    count           = 0;
+    return partial;
+  }
 };
 
 #endif  // FLYBYWIRE_AIRCRAFT_PROFILEBUFFER_HPP
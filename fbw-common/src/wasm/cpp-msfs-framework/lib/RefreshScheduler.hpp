@@ -0,0 +1,243 @@
+// Copyright (c) 2024 FlyByWire Simulations
+// SPDX-License-Identifier: GPL-3.0
+
+#ifndef FLYBYWIRE_AIRCRAFT_REFRESHSCHEDULER_HPP
+#define FLYBYWIRE_AIRCRAFT_REFRESHSCHEDULER_HPP
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Timing wheel scheduler for objects which are refreshed when they are older than a maximum age in
+ * sim time and in ticks.
+ *
+ * @details An object is due when both the tick counter is past its next update tick stamp and the time
+ * stamp is past its next update time stamp (see ManagedDataObjectBase::needsUpdateFromSim()). Each object
+ * is filed into a bucket of a tick wheel until its tick stamp has passed and then into a bucket of a time
+ * wheel until its time stamp has passed, so an update only touches the buckets of the elapsed ticks and
+ * time slots instead of every object. Objects in a bucket which are due in a later turn of a wheel stay in
+ * the bucket and are checked once per turn.
+ *
+ * The stamps are read again from the object whenever it leaves a bucket, so objects refreshed outside of
+ * the scheduler are filed again by their new stamps and are never refreshed late.
+ *
+ * Due objects are refreshed in the order of the order key given when adding them (e.g. the index of
+ * registration). The keys index a bitset of the due objects, so they should be small and dense.
+ *
+ * Objects which are scheduled again after clear() (e.g. after a change of the update modes) can be added
+ * with reschedule() instead. They keep the phase given by their stamps and are due when their stamps have
+ * passed, so they are not all refreshed in the same tick.
+ *
+ * @usage
+ *   - Add the objects with a unique and dense order key (e.g. scheduler.add(var, index);), they are due in the next update<br/>
+ *   - Call update() every tick with a function refreshing an object and updating its stamps
+ *     (e.g. scheduler.update(timeStamp, tickCounter, [&](Var* var) { var->updateFromSim(timeStamp, tickCounter); });)<br/>
+ *
+ * @tparam T the object type, providing getNextUpdateTimeStamp() and getNextUpdateTickStamp()
+ */
+template <typename T>
+class RefreshScheduler {
+ public:
+  static constexpr std::size_t TICK_SLOTS         = 256;
+  static constexpr std::size_t TIME_SLOTS         = 256;
+  static constexpr double      TIME_SLOT_DURATION = 1.0 / 32.0;  // seconds
+
+ private:
+  struct Entry {
+    T*            object;
+    std::size_t   order;
+    std::uint64_t dueTick;  // first tick at which the tick stamp has passed
+    double        dueTime;  // time stamp which has to be passed
+  };
+
+  std::vector<std::vector<Entry>> _tickSlots = std::vector<std::vector<Entry>>(TICK_SLOTS);
+  std::vector<std::vector<Entry>> _timeSlots = std::vector<std::vector<Entry>>(TIME_SLOTS);
+
+  // objects which are due in the next update (newly added)
+  std::vector<Entry> _pending{};
+  // objects which are filed by their stamps in the next update (rescheduled)
+  std::vector<Entry> _rescheduled{};
+  // scratch list reused every update
+  std::vector<Entry> _ready{};
+
+  // the due objects indexed by their order key and the bitset of the due order keys
+  std::vector<T*>            _dueObjects{};
+  std::vector<std::uint64_t> _dueBits{};
+
+  std::uint64_t _lastTick     = 0;
+  std::int64_t  _lastTimeSlot = 0;
+  bool          _started      = false;
+  std::size_t   _size         = 0;
+  std::size_t   _lastVisited  = 0;
+
+ public:
+  /**
+   * @brief Adds an object to the scheduler. The object is due in the next update.
+   * @param object the object to schedule - must stay valid until it is removed by clear()
+   * @param order the order key - due objects are refreshed in ascending order of the key
+   */
+  void add(T* object, std::size_t order) {
+    _pending.push_back({object, order, 0, 0.0});
+    reserveOrder(order);
+  }
+
+  /**
+   * @brief Adds an object to the scheduler which keeps its stamps. The object is due in the first update
+   * in which its stamps have passed.
+   * @param object the object to schedule - must stay valid until it is removed by clear()
+   * @param order the order key - due objects are refreshed in ascending order of the key
+   */
+  void reschedule(T* object, std::size_t order) {
+    _rescheduled.push_back({object, order, 0, 0.0});
+    reserveOrder(order);
+  }
+
+  /**
+   * @brief Removes all objects from the scheduler.
+   */
+  void clear() {
+    for (auto& slot : _tickSlots) {
+      slot.clear();
+    }
+    for (auto& slot : _timeSlots) {
+      slot.clear();
+    }
+    _pending.clear();
+    _rescheduled.clear();
+    std::fill(_dueBits.begin(), _dueBits.end(), 0);
+    _size         = 0;
+    _lastVisited  = 0;
+    _lastTick     = 0;
+    _lastTimeSlot = 0;
+    _started      = false;
+  }
+
+  /**
+   * @brief Refreshes all due objects and files them again by their new stamps.
+   * @param timeStamp the current time stamp
+   * @param tickCounter the current tick counter
+   * @param refresh function called with each due object - should refresh the object and update its stamps
+   */
+  template <typename Refresh>
+  void update(double timeStamp, std::uint64_t tickCounter, Refresh&& refresh) {
+    _ready.clear();
+    _ready.swap(_pending);
+    collectTickSlots(tickCounter);
+    collectTimeSlots(timeStamp);
+    _lastVisited = _ready.size() + _rescheduled.size();
+
+    // objects added since the last update are due regardless of their stamps
+    for (const Entry& entry : _ready) {
+      if (entry.dueTick == 0 && entry.dueTime == 0.0) {
+        markDue(entry);
+      } else {
+        file(entry, timeStamp, tickCounter);
+      }
+    }
+    for (const Entry& entry : _rescheduled) {
+      file(entry, timeStamp, tickCounter);
+    }
+    _rescheduled.clear();
+
+    // refreshes the due objects in the order of their keys and files them by their new stamps - at the
+    // earliest for the next tick
+    for (std::size_t word = 0; word < _dueBits.size(); word++) {
+      while (_dueBits[word] != 0) {
+        const std::size_t order  = word * 64 + static_cast<std::size_t>(std::countr_zero(_dueBits[word]));
+        T*                object = _dueObjects[order];
+        _dueBits[word] &= _dueBits[word] - 1;
+        refresh(object);
+        const std::uint64_t dueTick = (std::max<std::uint64_t>)(object->getNextUpdateTickStamp(), tickCounter) + 1;
+        fileTick({object, order, dueTick, object->getNextUpdateTimeStamp()});
+      }
+    }
+  }
+
+  /**
+   * @return the number of scheduled objects
+   */
+  [[nodiscard]] std::size_t size() const { return _size; }
+
+  /**
+   * @return the number of objects taken out of the buckets in the last update (including the refreshed ones)
+   */
+  [[nodiscard]] std::size_t lastVisited() const { return _lastVisited; }
+
+ private:
+  void reserveOrder(std::size_t order) {
+    if (order >= _dueObjects.size()) {
+      _dueObjects.resize(order + 1, nullptr);
+      _dueBits.resize(order / 64 + 1, 0);
+    }
+    _size++;
+  }
+
+  // files the entry into the wheel of the condition which has not passed yet or into the due list
+  void file(const Entry& entry, double timeStamp, std::uint64_t tickCounter) {
+    const std::uint64_t nextTick = entry.object->getNextUpdateTickStamp();
+    const double        nextTime = entry.object->getNextUpdateTimeStamp();
+    if (nextTick >= tickCounter) {
+      fileTick({entry.object, entry.order, nextTick + 1, nextTime});
+    } else if (nextTime >= timeStamp) {
+      fileTime({entry.object, entry.order, nextTick + 1, nextTime});
+    } else {
+      markDue(entry);
+    }
+  }
+
+  void markDue(const Entry& entry) {
+    _dueObjects[entry.order] = entry.object;
+    _dueBits[entry.order / 64] |= std::uint64_t{1} << (entry.order % 64);
+  }
+
+  void fileTick(const Entry& entry) { _tickSlots[entry.dueTick % TICK_SLOTS].push_back(entry); }
+
+  void fileTime(const Entry& entry) { _timeSlots[timeSlot(entry.dueTime) % TIME_SLOTS].push_back(entry); }
+
+  static std::int64_t timeSlot(double time) { return static_cast<std::int64_t>(std::floor(time / TIME_SLOT_DURATION)); }
+
+  // moves the entries of the slots from begin to end (inclusive) which satisfy isReady to the ready list
+  template <typename IsReady>
+  void collect(std::vector<std::vector<Entry>>& slots, std::int64_t begin, std::int64_t end, IsReady&& isReady) {
+    const auto count = static_cast<std::int64_t>(slots.size());
+    if (end - begin >= count) {
+      begin = end - count + 1;
+    }
+    for (std::int64_t i = begin; i <= end; i++) {
+      auto&       slot = slots[static_cast<std::size_t>(((i % count) + count) % count)];
+      std::size_t kept = 0;
+      for (const Entry& entry : slot) {
+        if (isReady(entry)) {
+          _ready.push_back(entry);
+        } else {
+          slot[kept++] = entry;
+        }
+      }
+      slot.resize(kept);
+    }
+  }
+
+  void collectTickSlots(std::uint64_t tickCounter) {
+    const std::uint64_t first = _started ? _lastTick + 1 : tickCounter - (std::min<std::uint64_t>)(tickCounter, TICK_SLOTS - 1);
+    if (tickCounter >= first) {
+      collect(_tickSlots, static_cast<std::int64_t>(first), static_cast<std::int64_t>(tickCounter),
+              [tickCounter](const Entry& entry) { return entry.dueTick <= tickCounter; });
+    }
+    _lastTick = tickCounter;
+  }
+
+  void collectTimeSlots(double timeStamp) {
+    // the last slot is checked again as its entries may only pass during the slot
+    const std::int64_t current = timeSlot(timeStamp);
+    const std::int64_t first   = _started ? (std::min)(_lastTimeSlot, current) : current - static_cast<std::int64_t>(TIME_SLOTS) + 1;
+    collect(_timeSlots, first, current, [timeStamp](const Entry& entry) { return entry.dueTime < timeStamp; });
+    _lastTimeSlot = current;
+    _started      = true;
+  }
+};
+
+#endif  // FLYBYWIRE_AIRCRAFT_REFRESHSCHEDULER_HPP
@@ -29,7 +29,7 @@
  *     - Output will be printed to std::cout: "Profiler:     33,052 (32,898) nanoseconds for MsfsHandler::update() (avg of 120
  * samples)"<br/>
  *     - The first number is the average execution time of the collected samples at the time of calling this method.<br/>
- *     - The second number is the avg of the 5-95% samples at the time of calling this method.<br/>
+ *     - The second number is the estimated avg of the 5-95% samples at the time of calling this method.<br/>
  */
 class SimpleProfiler {
   using Clock = std::chrono::high_resolution_clock;
@@ -76,14 +76,16 @@ class SimpleProfiler {
   [[nodiscard]] std::uint64_t getAverage() { return _samples.avg().count(); }
 
   /**
-   * @brief Return the average execution time of the collected samples at the time of calling this method
-   * @return Average execution time of the collected samples at the time of calling this method
+   * @brief Return the estimated trimmed average execution time of the collected samples at the time of calling this method
+   * @details The trimmed samples are estimated from histogram buckets (see ProfileBuffer::trimmedAverage()).
+   * @return Estimated trimmed average execution time of the collected samples at the time of calling this method
    */
   [[nodiscard]] std::uint64_t getTrimmedAverage(double trim) { return _samples.trimmedAverage(trim).count(); }
 
   /**
    * @brief Return the avg minimum execution time of a percentile of the collected samples at the time of calling this method.
    * If no percentile is given, the minimum of all samples is returned.
+   * @details The minimum is exact, the percentile average is estimated from histogram buckets (see ProfileBuffer::minimum()).
    * @param percentile Percentile to return, e.g. 0.05 for the 5% minimum. If no percentile is given, the minimum of all samples is
    * returned.
    * @return Average execution time of the minimum percentile of the collected samples at the time of calling this method or the minimum of
@@ -93,6 +95,7 @@ class SimpleProfiler {
 
   /**
    * @brief Return the avg maximum execution time of a percentile of the collected samples at the time of calling this method.
+   * @details The maximum is exact, the percentile average is estimated from histogram buckets (see ProfileBuffer::maximum()).
    * @param percentile Percentile to return, e.g. 0.95 for the 95% maximum. If no percentile is given, the maximum of all samples is
    * returned.
    * @return Average execution time of the maximum percentile of the collected samples at the time of calling this method or the maximum of
@@ -115,7 +118,7 @@ class SimpleProfiler {
   /**
    * @brief Return a string with the average execution time of the collected samples at the time of calling this method
    * @format Profiler:     207 (     100 /           202 /           400) nanoseconds for Perft::update (avg of 100 samples) <br/>
-   *         Profiler: average ( minimum / trimmed average 5% / maximum ) <name>
+   *         Profiler: average ( minimum / estimated trimmed average 5% / maximum ) <name>
    * @return String with the average execution time of the collected samples at the time of calling this method
    */
   [[nodiscard]] std::string str() {
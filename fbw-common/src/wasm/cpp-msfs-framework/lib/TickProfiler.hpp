@@ -0,0 +1,269 @@
+// Copyright (c) 2024 FlyByWire Simulations
+// SPDX-License-Identifier: GPL-3.0
+
+#ifndef FLYBYWIRE_AIRCRAFT_TICKPROFILER_HPP
+#define FLYBYWIRE_AIRCRAFT_TICKPROFILER_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "LogHistogram.hpp"
+#include "string_utils.hpp"
+
+/**
+ * @brief Profiler to record the execution time of named sections (e.g. the update phases of each module)
+ * for every tick.
+ *
+ * @details The profiler is always compiled in and can be enabled and disabled at runtime. When disabled
+ * a Scope only checks a flag. Each measurement is stored in a fixed size ring buffer (oldest records are
+ * overwritten) and counted in a histogram per section so percentiles are available at any time without
+ * sorting. The ring buffer can be written to a binary trace file for analysis on the host
+ * (see tools/ticktrace).
+ *
+ * The ring buffer is lock-free for one writer (the update thread): the write position is published
+ * with release semantics after a record is stored.
+ *
+ * @usage
+ *   - Create a TickProfiler instance and register the sections (e.g. auto id = profiler.addSection("Module::update");)<br/>
+ *   - Enable the profiler (e.g. profiler.setEnabled(true);)<br/>
+ *   - Measure a section with a scope (e.g. { TickProfiler::Scope scope{profiler, id, tick}; doSomething(); })<br/>
+ *   - Print the summary (e.g. std::cout << profiler.str();) or write a trace (e.g. profiler.writeTrace("\\work\\profile.trace");)<br/>
+ *
+ * Trace file format (little endian):<br/>
+ *   - char[4] magic "FBWP", uint32 version, uint32 number of sections<br/>
+ *   - per section: uint32 name length, name characters<br/>
+ *   - uint64 number of records<br/>
+ *   - per record (oldest first): uint64 tick, uint32 section id, uint32 duration in nanoseconds<br/>
+ */
+class TickProfiler {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  static constexpr char          TRACE_MAGIC[4] = {'F', 'B', 'W', 'P'};
+  static constexpr std::uint32_t TRACE_VERSION  = 1;
+
+  /**
+   * @brief A single measurement of a section.
+   */
+  struct Record {
+    std::uint64_t tick;
+    std::uint32_t section;
+    std::uint32_t duration;
+  };
+
+  /**
+   * @brief Measures the execution time of a section from construction to destruction.
+   * @details Does nothing if the profiler is disabled at construction.
+   */
+  class Scope {
+    TickProfiler*     _profiler;
+    std::size_t       _section;
+    std::uint64_t     _tick;
+    Clock::time_point _start{};
+
+   public:
+    Scope(TickProfiler& profiler, std::size_t section, std::uint64_t tick)
+        : _profiler{profiler.isEnabled() ? &profiler : nullptr}, _section{section}, _tick{tick} {
+      if (_profiler != nullptr) {
+        _start = Clock::now();
+      }
+    }
+
+    Scope(const Scope&)            = delete;
+    Scope& operator=(const Scope&) = delete;
+
+    ~Scope() {
+      if (_profiler != nullptr) {
+        _profiler->record(_section, _tick, std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - _start).count());
+      }
+    }
+  };
+
+ private:
+  std::vector<std::string>   _sections;
+  std::vector<LogHistogram>  _histograms;
+  std::vector<Record>        _ring;
+  std::size_t                _mask;
+  std::atomic<std::uint64_t> _head{0};
+  std::atomic<bool>          _enabled{false};
+
+ public:
+  TickProfiler() = delete;
+
+  /**
+   * @brief Construct a new Tick Profiler object
+   * @param capacity number of records kept in the ring buffer - rounded up to the next power of two
+   */
+  explicit TickProfiler(std::size_t capacity)
+      : _ring(std::bit_ceil(std::max<std::size_t>(capacity, 1))), _mask{std::bit_ceil(std::max<std::size_t>(capacity, 1)) - 1} {}
+
+  TickProfiler(const TickProfiler&)            = delete;
+  TickProfiler& operator=(const TickProfiler&) = delete;
+
+  /**
+   * @brief Register a new section.
+   * @param name the name of the section used in the summary and the trace file
+   * @return the id of the section to be used with record() and Scope
+   */
+  std::size_t addSection(const std::string& name) {
+    _sections.push_back(name);
+    _histograms.emplace_back();
+    return _sections.size() - 1;
+  }
+
+  /**
+   * @brief Enable or disable recording.
+   * @param enabled true to record measurements, false to ignore them
+   */
+  void setEnabled(bool enabled) { _enabled.store(enabled, std::memory_order_relaxed); }
+
+  /**
+   * @return true if measurements are recorded, false otherwise
+   */
+  [[nodiscard]] bool isEnabled() const { return _enabled.load(std::memory_order_relaxed); }
+
+  /**
+   * @brief Record a measurement of a section.
+   * @details Durations longer than the range of the trace format (~4.29s) are clamped.
+   * @param section the id of the section
+   * @param tick the tick the measurement belongs to
+   * @param nanoseconds the measured duration
+   */
+  void record(std::size_t section, std::uint64_t tick, std::int64_t nanoseconds) {
+    if (section >= _sections.size()) {
+      return;
+    }
+    const auto duration = static_cast<std::uint32_t>(std::clamp<std::int64_t>(nanoseconds, 0, UINT32_MAX));
+    _histograms[section].record(duration);
+    const std::uint64_t head = _head.load(std::memory_order_relaxed);
+    _ring[head & _mask]      = {tick, static_cast<std::uint32_t>(section), duration};
+    _head.store(head + 1, std::memory_order_release);
+  }
+
+  /**
+   * @brief Remove all records and reset the histograms. The sections are kept.
+   */
+  void reset() {
+    _head.store(0, std::memory_order_release);
+    for (auto& histogram : _histograms) {
+      histogram.reset();
+    }
+  }
+
+  /**
+   * @return number of registered sections
+   */
+  [[nodiscard]] std::size_t sectionCount() const { return _sections.size(); }
+
+  /**
+   * @param section the id of the section
+   * @return the name of the section
+   */
+  [[nodiscard]] const std::string& sectionName(std::size_t section) const { return _sections[section]; }
+
+  /**
+   * @param section the id of the section
+   * @return the histogram of all durations recorded for the section since the last reset
+   */
+  [[nodiscard]] const LogHistogram& histogram(std::size_t section) const { return _histograms[section]; }
+
+  /**
+   * @return number of records currently in the ring buffer
+   */
+  [[nodiscard]] std::size_t size() const {
+    return static_cast<std::size_t>(std::min<std::uint64_t>(_head.load(std::memory_order_acquire), _ring.size()));
+  }
+
+  /**
+   * @return maximum number of records in the ring buffer
+   */
+  [[nodiscard]] std::size_t capacity() const { return _ring.size(); }
+
+  /**
+   * @return copy of the records in the ring buffer, oldest first
+   */
+  [[nodiscard]] std::vector<Record> records() const {
+    const std::uint64_t head  = _head.load(std::memory_order_acquire);
+    const std::uint64_t count = std::min<std::uint64_t>(head, _ring.size());
+    std::vector<Record> result;
+    result.reserve(static_cast<std::size_t>(count));
+    for (std::uint64_t i = head - count; i < head; ++i) {
+      result.push_back(_ring[i & _mask]);
+    }
+    return result;
+  }
+
+  /**
+   * @brief Write the sections and the records of the ring buffer in the trace format to a stream.
+   * @param os binary output stream
+   * @return true if the trace was written successfully, false otherwise
+   */
+  bool writeTrace(std::ostream& os) const {
+    os.write(TRACE_MAGIC, sizeof(TRACE_MAGIC));
+    writeValue(os, TRACE_VERSION);
+    writeValue(os, static_cast<std::uint32_t>(_sections.size()));
+    for (const auto& name : _sections) {
+      writeValue(os, static_cast<std::uint32_t>(name.size()));
+      os.write(name.data(), static_cast<std::streamsize>(name.size()));
+    }
+    const std::vector<Record> ring = records();
+    writeValue(os, static_cast<std::uint64_t>(ring.size()));
+    for (const auto& record : ring) {
+      writeValue(os, record.tick);
+      writeValue(os, record.section);
+      writeValue(os, record.duration);
+    }
+    return os.good();
+  }
+
+  /**
+   * @brief Write the sections and the records of the ring buffer in the trace format to a file.
+   * @param filename the file to write - an existing file is overwritten
+   * @return true if the trace was written successfully, false otherwise
+   */
+  bool writeTrace(const std::string& filename) const {
+    std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+      return false;
+    }
+    return writeTrace(file);
+  }
+
+  /**
+   * @brief Return a string with the percentiles of all sections with recorded measurements.
+   * @format Profiler:     12,288 /     14,336 /     20,480 /     31,002 ns (p50/p95/p99/max) for Module::update (1,000 samples)
+   * @return summary string with one line per section
+   */
+  [[nodiscard]] std::string str() const {
+    std::stringstream os{};
+    for (std::size_t i = 0; i < _sections.size(); ++i) {
+      const LogHistogram& h = _histograms[i];
+      if (h.count() == 0) {
+        continue;
+      }
+      os << "Profiler: " << std::setw(10) << std::right << helper::StringUtils::insertThousandsSeparator(h.percentile(0.5)) << " / "
+         << std::setw(10) << std::right << helper::StringUtils::insertThousandsSeparator(h.percentile(0.95)) << " / " << std::setw(10)
+         << std::right << helper::StringUtils::insertThousandsSeparator(h.percentile(0.99)) << " / " << std::setw(10) << std::right
+         << helper::StringUtils::insertThousandsSeparator(h.maximum()) << " ns (p50/p95/p99/max) for " << _sections[i] << " ("
+         << helper::StringUtils::insertThousandsSeparator(h.count()) << " samples)" << std::endl;
+    }
+    return os.str();
+  }
+
+ private:
+  template <typename T>
+  static void writeValue(std::ostream& os, T value) {
+    os.write(reinterpret_cast<const char*>(&value), sizeof(T));
+  }
+};
+
+#endif  // FLYBYWIRE_AIRCRAFT_TICKPROFILER_HPP
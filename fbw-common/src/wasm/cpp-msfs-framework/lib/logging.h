@@ -4,7 +4,12 @@
 #ifndef FLYBYWIRE_LOGGING_H
 #define FLYBYWIRE_LOGGING_H
 
-#include <iostream>
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+#include <string>
+#include <string_view>
+#include "LogBuffer.hpp"
 #include "fmt/core.h"
 
 /**
@@ -15,9 +20,11 @@
  *
  * LOG_INFO("PANEL_SERVICE_PRE_INSTALL");
  * LOG_INFO("PANEL_SERVICE_PRE_INSTALL: " + panelService->getPanelServiceName());
+ * LOG_DEBUG("Added callback to key event {} with ID {}", keyEventId, id);
  *
- * This will be improved and extended in the future.
- * E.g. it could be extended to log to a file.
+ * The last form is preferred in frequently called code: the format string is checked at compile
+ * time, registered once per call site and only the raw arguments are recorded - the message is
+ * formatted later when the log is flushed (see Logger).
  */
 
 #define ZERO_LVL 0
@@ -29,69 +36,96 @@
 #define VERBOSE_LVL 6
 #define TRACE_LVL 7
 
+// Records a log message - the format id of the call site is registered with the first call
+#define LOG_RECORD(level, ...)                                                          \
+  do {                                                                                  \
+    static std::uint32_t logFormatId = Logger::UNREGISTERED;                            \
+    logger->log(level, logFormatId, __FILE__, __LINE__, __VA_ARGS__);                   \
+  } while (0)
+
 #if LOG_LEVEL > ZERO_LVL
-#define LOG_CRITICAL(msg) logger->critical(msg)
+#define LOG_CRITICAL(...) LOG_RECORD(CRITICAL_LVL, __VA_ARGS__)
 #define LOG_CRITICAL_BLOCK(block) block
 #else
-#define LOG_CRITICAL(msg)
+#define LOG_CRITICAL(...)
 #define LOG_CRITICAL_BLOCK(block) ;
 #endif
 
 #if LOG_LEVEL > CRITICAL_LVL
-#define LOG_ERROR(msg) logger->error(msg)
+#define LOG_ERROR(...) LOG_RECORD(ERROR_LVL, __VA_ARGS__)
 #define LOG_ERROR_BLOCK(block) block
 #else
-#define LOG_ERROR(msg)
+#define LOG_ERROR(...)
 #define LOG_ERROR_BLOCK(block) ;
 #endif
 
 #if LOG_LEVEL > ERROR_LVL
-#define LOG_WARN(msg) logger->warn(msg)
+#define LOG_WARN(...) LOG_RECORD(WARN_LVL, __VA_ARGS__)
 #define LOG_WARN_BLOCK(block) block
 #else
-#define LOG_WARN(msg)
+#define LOG_WARN(...)
 #define LOG_WARN_BLOCK(block) ;
 #endif
 
 #if LOG_LEVEL > WARN_LVL
-#define LOG_INFO(msg) logger->info(msg)
+#define LOG_INFO(...) LOG_RECORD(INFO_LVL, __VA_ARGS__)
 #define LOG_INFO_BLOCK(block) block
 #else
-#define LOG_INFO(msg)
+#define LOG_INFO(...)
 #define LOG_INFO_BLOCK(block) ;
 #endif
 
 #if LOG_LEVEL > INFO_LVL
-#define LOG_DEBUG(msg) logger->debug(msg)
+#define LOG_DEBUG(...) LOG_RECORD(DEBUG_LVL, __VA_ARGS__)
 #define LOG_DEBUG_BLOCK(block) block
 #else
-#define LOG_DEBUG(msg)
+#define LOG_DEBUG(...)
 #define LOG_DEBUG_BLOCK(block) ;
 #endif
 
 #if LOG_LEVEL > DEBUG_LVL
-#define LOG_VERBOSE(msg) logger->verbose(msg)
+#define LOG_VERBOSE(...) LOG_RECORD(VERBOSE_LVL, __VA_ARGS__)
 #define LOG_VERBOSE_BLOCK(block) block
 #else
-#define LOG_VERBOSE(msg)
+#define LOG_VERBOSE(...)
 #define LOG_VERBOSE_BLOCK(block) ;
 #endif
 
 #if LOG_LEVEL > VERBOSE_LVL
-#define LOG_TRACE(msg) logger->trace(msg)
+#define LOG_TRACE(...) LOG_RECORD(TRACE_LVL, __VA_ARGS__)
 #define LOG_TRACE_BLOCK(block) block
 #else
-#define LOG_TRACE(msg)
+#define LOG_TRACE(...)
 #define LOG_TRACE_BLOCK(block) ;
 #endif
 
 /**
  * @brief The Logger class is a very simple logging facility.
  *
- * Singleton class for Logger
- * Very simple implementation for now.
+ * Singleton class for Logger.
+ * All log messages are recorded into a ring buffer (see LogBuffer). By default each message is printed
+ * right away. In deferred mode (used by the MsfsHandler) messages up to the deferred print level
+ * (default: LOG_LEVEL, so all recorded messages) are only formatted and printed by flush(), so logging
+ * within a tick only costs the copy of the arguments and a flush without such messages returns right
+ * away. The ring buffer keeps the most recent messages of all levels and can be written to a dump file
+ * (see tools/logdecode).
  */
 class Logger {
+ public:
+  static constexpr std::uint32_t UNREGISTERED         = std::numeric_limits<std::uint32_t>::max();
+  static constexpr std::size_t   BUFFER_CAPACITY      = 1 << 18;  // bytes, ~5000 messages with arguments
+#ifdef LOG_LEVEL
+  static constexpr std::uint32_t DEFERRED_PRINT_LEVEL = LOG_LEVEL;
+#else
+  static constexpr std::uint32_t DEFERRED_PRINT_LEVEL = ZERO_LVL;
+#endif
+
+ private:
+  LogBuffer     buffer{BUFFER_CAPACITY};
+  bool          deferred           = false;
+  std::uint32_t deferredPrintLevel = DEFERRED_PRINT_LEVEL;
+  std::uint64_t reportedDropped    = 0;
+
  public:
   Logger() = default;
   /** get the singleton instance of Logger */
@@ -107,13 +141,128 @@ class Logger {
   Logger(Logger const&&)            = delete;  // move
   Logger& operator=(const Logger&&) = delete;  // move assignment
 
-  static void critical(const std::string& msg) { fmt::print(stderr, "critical: {}\n", msg); }
-  static void error(const std::string& msg) { fmt::print(stderr, "error: {}\n", msg); }
-  static void warn(const std::string& msg) { fmt::print(stderr, "warn: {}\n", msg); }
-  static void info(const std::string& msg) { fmt::print("info: {}\n", msg); }
-  static void debug(const std::string& msg) { fmt::print("debug: {}\n", msg); }
-  static void verbose(const std::string& msg) { fmt::print("verbose: {}\n", msg); }
-  static void trace(const std::string& msg) { fmt::print("trace: {}\n", msg); }
+  /**
+   * Records a message with a format string and its arguments.
+   * @param level the log level
+   * @param formatId the format id of the call site - registered with the first call
+   * @param file the source file of the call site
+   * @param line the source line of the call site
+   * @param format the format string - checked against the arguments at compile time
+   * @param args the arguments - bool, characters, integers, floating point numbers, strings and pointers
+   */
+  template <typename... Args>
+  void log(std::uint32_t level, std::uint32_t& formatId, const char* file, int line, fmt::format_string<Args...> format, Args&&... args) {
+    if (formatId == UNREGISTERED) {
+      const fmt::string_view view = format.get();
+      formatId                    = buffer.addFormat(level, std::string_view{view.data(), view.size()}, file, line);
+    }
+    buffer.record(formatId, args...);
+    printIfNotDeferred();
+  }
+
+  /**
+   * Records a fixed message (e.g. LOG_INFO("Initialized")).
+   */
+  template <std::size_t N>
+  void log(std::uint32_t level, std::uint32_t& formatId, const char* file, int line, const char (&message)[N]) {
+    if (formatId == UNREGISTERED) {
+      formatId = buffer.addMessage(level, message, file, line);
+    }
+    buffer.record(formatId);
+    printIfNotDeferred();
+  }
+
+  /**
+   * Records a message built at runtime (e.g. LOG_INFO("Initialized " + name)).
+   */
+  void log(std::uint32_t level, std::uint32_t& formatId, const char* file, int line, const std::string& message) {
+    if (formatId == UNREGISTERED) {
+      formatId = buffer.addFormat(level, "{}", file, line);
+    }
+    buffer.record(formatId, message);
+    printIfNotDeferred();
+  }
+
+  /**
+   * Sets if messages are only printed by flush(). Pending messages are printed first, messages above the
+   * deferred print level recorded while deferred are not printed when leaving the deferred mode.
+   * @param isDeferred true to print messages only by flush(), false to print them right away
+   */
+  void setDeferred(bool isDeferred) {
+    flush();
+    deferred = isDeferred;
+    buffer.setDrainLevel(deferred ? deferredPrintLevel : LogBuffer::ALL_LEVELS);
+  }
+
+  /**
+   * @return true if messages are only printed by flush()
+   */
+  [[nodiscard]] bool isDeferred() const { return deferred; }
+
+  /**
+   * Sets the highest level of the messages printed in deferred mode. All messages are still recorded
+   * and written to the dump.
+   * @param level the log level (e.g. WARN_LVL)
+   */
+  void setDeferredPrintLevel(std::uint32_t level) {
+    if (deferred) {
+      flush();
+      buffer.setDrainLevel(level);
+    }
+    deferredPrintLevel = level;
+  }
+
+  /**
+   * @return the highest level of the messages printed in deferred mode
+   */
+  [[nodiscard]] std::uint32_t getDeferredPrintLevel() const { return deferredPrintLevel; }
+
+  /**
+   * Changes the size of the ring buffer. Pending messages are printed first, the recorded messages are
+   * discarded.
+   * @param capacity the size of the ring buffer in bytes - rounded up to the next power of two
+   */
+  void setCapacity(std::size_t capacity) {
+    flush();
+    buffer.resize(capacity);
+  }
+
+  /**
+   * Formats and prints the messages recorded since the last flush (in deferred mode only those up to the
+   * deferred print level).
+   * @param maxMessages the maximum number of messages to print - the others are printed by the next flush
+   * @return the number of printed messages
+   */
+  std::size_t flush(std::size_t maxMessages = std::numeric_limits<std::size_t>::max()) {
+    if (buffer.dropped() != reportedDropped) {
+      fmt::print(stderr, "warn: {} log messages dropped\n", buffer.dropped() - reportedDropped);
+      reportedDropped = buffer.dropped();
+    }
+    return buffer.drain(maxMessages, [](const LogBuffer::Format& format, const std::string& message) {
+      static constexpr std::string_view LEVEL_NAMES[] = {"", "critical", "error", "warn", "info", "debug", "verbose", "trace"};
+      const std::string_view            levelName     = format.level < std::size(LEVEL_NAMES) ? LEVEL_NAMES[format.level] : "log";
+      fmt::print(format.level <= WARN_LVL ? stderr : stdout, "{}: {}\n", levelName, message);
+    });
+  }
+
+  /**
+   * Writes the most recent messages (printed or not) to a dump file.
+   * @param filename the file to write - an existing file is overwritten
+   * @return true if the dump was written successfully, false otherwise
+   */
+  bool writeDump(const std::string& filename) const { return buffer.writeDump(filename); }
+
+  /**
+   * @return the ring buffer of the recorded messages
+   */
+  [[nodiscard]] const LogBuffer& getBuffer() const { return buffer; }
+
+ private:
+  void printIfNotDeferred() {
+    if (!deferred) {
+      flush();
+    }
+  }
 };
 
 inline Logger* logger = Logger::instance();
@@ -4,7 +4,9 @@
 #ifndef FLYBYWIRE_MATH_UTILS_H
 #define FLYBYWIRE_MATH_UTILS_H
 
+#include <array>
 #include <cmath>
+#include <cstddef>
 #include <limits>
 #include <type_traits>
 
@@ -48,6 +50,35 @@ class Math {
   static inline int sign(T x) {
     return (x > 0) ? 1 : ((x < 0) ? -1 : 0);
   }
+
+  /**
+   * Evaluates the polynomial c[0] + c[1] * x + ... + c[N-1] * x^(N-1) with Horner's method.
+   * Needs N-1 multiply-adds and no calls to pow(). The number of coefficients is a compile time constant, so the
+   * compiler fully unrolls the loop.
+   * @tparam T The type of the values. Must be a floating point type.
+   * @tparam N The number of coefficients (degree + 1)
+   * @param coefficients The coefficients in ascending order of the power of x
+   * @param x The value to evaluate the polynomial at
+   * @return the value of the polynomial at x
+   */
+  template <typename T, std::size_t N>
+  static constexpr T horner(const std::array<T, N>& coefficients, T x) {
+    static_assert(std::is_floating_point_v<T>, "T must be a floating point type");
+    static_assert(N > 0, "at least one coefficient is required");
+    T result = coefficients[N - 1];
+    for (std::size_t i = N - 1; i > 0; --i) {
+      result = result * x + coefficients[i - 1];
+    }
+    return result;
+  }
+
+  /**
+   * @see horner(const std::array<T, N>& coefficients, T x)
+   */
+  template <typename T, std::size_t N>
+  static constexpr T horner(const T (&coefficients)[N], T x) {
+    return horner(std::to_array(coefficients), x);
+  }
 };
 
 }  // namespace helper
@@ -0,0 +1,101 @@
+// Copyright (c) 2024 FlyByWire Simulations
+// SPDX-License-Identifier: GPL-3.0
+
+// Compares the per tick overhead of the DataManager variable registry: the former loop over a
+// std::map checking the update mode of every variable against the dense lists of auto read and
+// auto write variables. The DataManager itself requires the MSFS SDK, so the variables are modeled
+// by a minimal class with a virtual update method.
+
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+class Variable {
+ public:
+  bool autoRead  = false;
+  bool autoWrite = false;
+  double value   = 0.0;
+
+  virtual ~Variable() = default;
+  virtual void updateFromSim() { value += 1.0; }
+  virtual void updateToSim() { value -= 1.0; }
+};
+
+using VariablePtr = std::shared_ptr<Variable>;
+
+int main(int argc, char* argv[]) {
+  // Parse arguments
+  bool verbose = false;
+  for (int i = 1; i < argc; ++i) {
+    if (std::strcmp(argv[i], "verbose") == 0) {
+      verbose = true;
+    }
+  }
+
+  // Benchmark parameters
+  const int numberOfVariables = 500;
+  const int ticks             = 100000;
+
+  // Prepare variables, about 20% auto read and 5% auto write
+  std::mt19937                    gen(42);
+  std::uniform_int_distribution<> dis(0, 99);
+
+  std::map<std::string, VariablePtr> map;
+  std::vector<VariablePtr>           variables;
+  std::vector<Variable*>             autoReadVariables;
+  std::vector<Variable*>             autoWriteVariables;
+  for (int i = 0; i < numberOfVariables; ++i) {
+    auto var       = std::make_shared<Variable>();
+    const int roll = dis(gen);
+    var->autoRead  = roll < 20;
+    var->autoWrite = roll >= 95;
+    map.insert({"A32NX_VARIABLE_" + std::to_string(i) + ":1:Number", var});
+    variables.push_back(var);
+    if (var->autoRead) autoReadVariables.push_back(var.get());
+    if (var->autoWrite) autoWriteVariables.push_back(var.get());
+  }
+
+  // Former map based loop
+  auto start = std::chrono::high_resolution_clock::now();
+  for (int t = 0; t < ticks; ++t) {
+    for (auto& [name, var] : map) {
+      if (var->autoRead) var->updateFromSim();
+    }
+    for (auto& [name, var] : map) {
+      if (var->autoWrite) var->updateToSim();
+    }
+  }
+  auto mapDuration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now() - start);
+
+  // Dense auto read and auto write lists
+  start = std::chrono::high_resolution_clock::now();
+  for (int t = 0; t < ticks; ++t) {
+    for (Variable* var : autoReadVariables) {
+      var->updateFromSim();
+    }
+    for (Variable* var : autoWriteVariables) {
+      var->updateToSim();
+    }
+  }
+  auto listDuration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now() - start);
+
+  // Use the values so the loops are not optimized away
+  double checksum = 0.0;
+  for (const auto& var : variables) {
+    checksum += var->value;
+  }
+
+  if (verbose) {
+    std::cout << "Variables: " << numberOfVariables << " (auto read: " << autoReadVariables.size()
+              << ", auto write: " << autoWriteVariables.size() << "), checksum: " << checksum << std::endl;
+  }
+  std::cout << "Map loop:   " << mapDuration.count() / ticks << " ns per tick" << std::endl;
+  std::cout << "Dense list: " << listDuration.count() / ticks << " ns per tick" << std::endl;
+
+  return 0;
+}
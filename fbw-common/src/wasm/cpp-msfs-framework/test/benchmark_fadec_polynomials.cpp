@@ -0,0 +1,240 @@
+// Copyright (c) 2024 FlyByWire Simulations
+// SPDX-License-Identifier: GPL-3.0
+
+// Compares the Horner form FADEC polynomials of the A32NX and A380X with the former std::pow() based
+// implementations and measures the time for the per frame corrected fuel flow and EGT of all engines.
+
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../../../../../fbw-a32nx/src/wasm/fadec_a32nx/src/Fadec/Polynomials_A32NX.hpp"
+#include "../../../../../fbw-a380x/src/wasm/fadec_a380x/src/Fadec/Polynomials_A380X.hpp"
+
+// former implementation as reference, the A32NX and A380X use the same coefficients
+namespace reference {
+
+template <int N>
+static double sumOfPowers(const double (&coefficients)[N], double x) {
+  double result = 0.0;
+  for (int i = 0; i < N; ++i) {
+    result += coefficients[i] * (std::pow)(x, i);
+  }
+  return result;
+}
+
+constexpr double c_N2[16] = {4.03649879e+00,  -9.41981960e-01, 1.98426614e-01,  -2.11907840e-02, 1.00777507e-03,  -1.57319166e-06,
+                             -2.15034888e-06, 1.08288379e-07,  -2.48504632e-09, 2.52307089e-11,  -2.06869243e-14, 8.99045761e-16,
+                             -9.94853959e-17, 1.85366499e-18,  -1.44869928e-20, 4.31033031e-23};
+constexpr double c_N1[9]  = {-2.2812156e-12, -5.9830374e+01, 7.0629094e+02,  -3.4580361e+03, 9.1428923e+03,
+                             -1.4097740e+04, 1.2704110e+04,  -6.2099935e+03, 1.2733071e+03};
+constexpr double c_FF[9]  = {3.1110282e-12, 1.0804331e+02,  -1.3972629e+03, 7.4874131e+03, -2.1511983e+04,
+                             3.5957757e+04, -3.5093994e+04, 1.8573033e+04,  -4.1220062e+03};
+constexpr double c_EGT[9] = {-6.8725167e+02, 7.7548864e+03,  -3.7507098e+04, 1.0147016e+05, -1.6779273e+05,
+                             1.7357157e+05,  -1.0960924e+05, 3.8591956e+04,  -5.7912600e+03};
+constexpr double c_CEGT[16] = {3.2636e+02, 0.0000e+00, 9.2893e-01,  3.9505e-02, 3.9070e+02,  -4.7911e-04, 7.7679e-03,  5.8361e-05,
+                               -2.5566e+00, 5.1227e-06, 1.0178e-07, -7.4602e-03, 1.2106e-07, -5.1639e+01, -2.7356e-03, 1.9312e-08};
+constexpr double c_Flow[21] = {-1.7630e+02, -2.1542e-01, 4.7119e+01,  6.1519e+02,  1.8047e-03,  -4.4554e-01, -4.3940e+01,
+                               4.0459e-05,  -3.2912e+01, -6.2894e-03, -1.2544e-07, 1.0938e-02,  4.0936e-01,  -5.5841e-06,
+                               -2.3829e+01, 9.3269e-04,  2.0273e-11,  -2.4100e+02, 1.4171e-02,  -9.5581e-07, 1.2728e-11};
+
+static double startN2Raw(double n2, double idleN2, double scale) {
+  return sumOfPowers(c_N2, n2 * scale / idleN2) * n2;
+}
+
+static double startN1(double fbwN2, double idleN2, double idleN1) {
+  const double normalN2    = fbwN2 / idleN2;
+  const double normalN1pre = (-2.4698087 * (std::pow)(normalN2, 3)) + (0.9662026 * (std::pow)(normalN2, 2)) + (0.0701367 * normalN2);
+  const double normalN1post = sumOfPowers(c_N1, normalN2);
+  return (normalN1post >= normalN1pre ? normalN1post : normalN1pre) * idleN1;
+}
+
+static double startFF(double fbwN2, double idleN2, double idleFF) {
+  const double normalN2 = fbwN2 / idleN2;
+  const double normalFF = normalN2 <= 0.37 ? 0 : sumOfPowers(c_FF, normalN2);
+  return (std::max)(normalFF, 0.0) * idleFF;
+}
+
+static double startEGT(double fbwN2, double idleN2, double ambientTemp, double idleEGT) {
+  const double normalizedN2 = fbwN2 / idleN2;
+  double       normalizedEGT;
+  if (normalizedN2 < 0.17) {
+    normalizedEGT = 0;
+  } else if (normalizedN2 <= 0.4) {
+    normalizedEGT = (0.04783 * normalizedN2) - 0.00813;
+  } else {
+    normalizedEGT = sumOfPowers(c_EGT, normalizedN2);
+  }
+  return (normalizedEGT * (idleEGT - (ambientTemp))) + (ambientTemp);
+}
+
+static double correctedEGT(double cn1, double cff, double mach, double alt) {
+  return c_CEGT[0] + c_CEGT[1] + (c_CEGT[2] * cn1) + (c_CEGT[3] * cff) + (c_CEGT[4] * mach) + (c_CEGT[5] * alt) +
+         (c_CEGT[6] * (std::pow)(cn1, 2)) + (c_CEGT[7] * cn1 * cff) + (c_CEGT[8] * cn1 * mach) + (c_CEGT[9] * cn1 * alt) +
+         (c_CEGT[10] * (std::pow)(cff, 2)) + (c_CEGT[11] * mach * cff) + (c_CEGT[12] * cff * alt) + (c_CEGT[13] * (std::pow)(mach, 2)) +
+         (c_CEGT[14] * mach * alt) + (c_CEGT[15] * (std::pow)(alt, 2));
+}
+
+static double correctedFuelFlow(double cn1, double mach, double alt) {
+  return c_Flow[0] + c_Flow[1] + (c_Flow[2] * cn1) + (c_Flow[3] * mach) + (c_Flow[4] * alt) + (c_Flow[5] * (std::pow)(cn1, 2)) +
+         (c_Flow[6] * cn1 * mach) + (c_Flow[7] * cn1 * alt) + (c_Flow[8] * (std::pow)(mach, 2)) + (c_Flow[9] * mach * alt) +
+         (c_Flow[10] * (std::pow)(alt, 2)) + (c_Flow[11] * (std::pow)(cn1, 3)) + (c_Flow[12] * (std::pow)(cn1, 2) * mach) +
+         (c_Flow[13] * (std::pow)(cn1, 2) * alt) + (c_Flow[14] * cn1 * (std::pow)(mach, 2)) + (c_Flow[15] * cn1 * mach * alt) +
+         (c_Flow[16] * cn1 * (std::pow)(alt, 2)) + (c_Flow[17] * (std::pow)(mach, 3)) + (c_Flow[18] * (std::pow)(mach, 2) * alt) +
+         (c_Flow[19] * mach * (std::pow)(alt, 2)) + (c_Flow[20] * (std::pow)(alt, 3));
+}
+
+static double oilPressure(double simN2) {
+  return -0.88921 + (0.23711 * simN2) + (0.00682 * (std::pow)(simN2, 2));
+}
+
+}  // namespace reference
+
+// The rounding differs between both forms, so the results are compared with a tolerance relative to the
+// magnitude of the result (at least 1 unit of the parameter).
+static bool isClose(double value, double expected) {
+  return std::abs(value - expected) <= 1e-7 * (std::max)(1.0, std::abs(expected));
+}
+
+int main(int argc, char* argv[]) {
+  // Parse arguments
+  bool verbose = false;
+  for (int i = 1; i < argc; ++i) {
+    if (std::strcmp(argv[i], "verbose") == 0) {
+      verbose = true;
+    }
+  }
+
+  const int    inputs = 200000;
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<> unit(0.0, 1.0);
+  bool         passed = true;
+
+  auto check = [&](const std::string& name, double value, double expected) {
+    if (!isClose(value, expected)) {
+      std::cout << "FAILED: " << name << " returned " << value << ", expected " << expected << std::endl;
+      passed = false;
+    }
+  };
+
+  // Check results over the start (normalized N2 0 .. 1.05) and the whole flight envelope
+  for (int i = 0; i < inputs && passed; ++i) {
+    const double idleN2 = 55 + 20 * unit(gen);
+    const double n2     = idleN2 * 1.05 * unit(gen);
+    const double cn1    = 110 * unit(gen);
+    const double mach   = 0.9 * unit(gen);
+    const double alt    = -1000 + 46000 * unit(gen);
+    const double cff    = reference::correctedFuelFlow(cn1, mach, alt);
+
+    // startN2/startN3 clamp the raw result, compare with the clamping applied to the reference
+    check("A32NX startN2", Polynomial_A32NX::startN2(n2, 0, idleN2),
+          (std::min)((std::max)(reference::startN2Raw(n2, idleN2, 68.2), 0.002), idleN2 + 0.1));
+    check("A32NX startN1", Polynomial_A32NX::startN1(n2, idleN2, 20), reference::startN1(n2, idleN2, 20));
+    check("A32NX startFF", Polynomial_A32NX::startFF(n2, idleN2, 300), reference::startFF(n2, idleN2, 300));
+    check("A32NX startEGT", Polynomial_A32NX::startEGT(n2, idleN2, 15, 400), reference::startEGT(n2, idleN2, 15, 400));
+    check("A32NX correctedFuelFlow", Polynomial_A32NX::correctedFuelFlow(cn1, mach, alt), cff);
+    check("A32NX correctedEGT", Polynomial_A32NX::correctedEGT(cn1, cff, mach, alt), reference::correctedEGT(cn1, cff, mach, alt));
+    check("A32NX oilPressure", Polynomial_A32NX::oilPressure(n2), reference::oilPressure(n2));
+
+    double startN3 = reference::startN2Raw(n2, idleN2, 60.0);
+    startN3        = startN3 < 0 ? 0.002 : startN3;
+    startN3        = startN3 >= idleN2 + 0.1 ? idleN2 + 0.05 : startN3;
+    check("A380X startN3", Polynomial_A380X::startN3(n2, 0, idleN2), startN3);
+    check("A380X startN1", Polynomial_A380X::startN1(n2, idleN2, 20), reference::startN1(n2, idleN2, 20));
+    check("A380X startFF", Polynomial_A380X::startFF(n2, idleN2, 300), reference::startFF(n2, idleN2, 300));
+    check("A380X startEGT", Polynomial_A380X::startEGT(n2, idleN2, 15, 400), reference::startEGT(n2, idleN2, 15, 400));
+    check("A380X correctedFuelFlow", Polynomial_A380X::correctedFuelFlow(cn1, mach, alt), 2.8 * cff);
+    check("A380X correctedEGT", Polynomial_A380X::correctedEGT(cn1, 2.8 * cff, mach, alt),
+          reference::correctedEGT(cn1, 2.8 * cff / 3, mach, alt));
+  }
+
+  // Prepare one frame of inputs per iteration: mach and altitude are shared by all engines
+  struct Frame {
+    double                mach;
+    double                alt;
+    std::array<double, 4> cn1;
+  };
+  std::vector<Frame> frames(inputs);
+  for (auto& frame : frames) {
+    frame.mach = 0.9 * unit(gen);
+    frame.alt  = -1000 + 46000 * unit(gen);
+    for (auto& cn1 : frame.cn1) {
+      cn1 = 110 * unit(gen);
+    }
+  }
+
+  // Check the batch results against the single engine functions
+  for (std::size_t i = 0; i < 1000 && passed; ++i) {
+    const Frame&          frame = frames[i];
+    std::array<double, 4> cff{};
+    std::array<double, 4> egt{};
+    Polynomial_A380X::correctedFuelFlow(frame.cn1, frame.mach, frame.alt, cff);
+    Polynomial_A380X::correctedEGT(frame.cn1, cff, frame.mach, frame.alt, egt);
+    for (std::size_t engine = 0; engine < 4; ++engine) {
+      check("A380X batch correctedFuelFlow", cff[engine], Polynomial_A380X::correctedFuelFlow(frame.cn1[engine], frame.mach, frame.alt));
+      check("A380X batch correctedEGT", egt[engine], Polynomial_A380X::correctedEGT(frame.cn1[engine], cff[engine], frame.mach, frame.alt));
+    }
+  }
+
+  // Benchmark corrected fuel flow and EGT of four engines per frame
+  double checksum = 0;
+  auto   start    = std::chrono::high_resolution_clock::now();
+  for (const Frame& frame : frames) {
+    for (double cn1 : frame.cn1) {
+      const double cff = reference::correctedFuelFlow(cn1, frame.mach, frame.alt);
+      checksum += reference::correctedEGT(cn1, cff, frame.mach, frame.alt);
+    }
+  }
+  auto referenceDuration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now() - start).count();
+
+  start = std::chrono::high_resolution_clock::now();
+  for (const Frame& frame : frames) {
+    for (double cn1 : frame.cn1) {
+      const double cff = Polynomial_A380X::correctedFuelFlow(cn1, frame.mach, frame.alt);
+      checksum += Polynomial_A380X::correctedEGT(cn1, cff, frame.mach, frame.alt);
+    }
+  }
+  auto singleDuration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now() - start).count();
+
+  start = std::chrono::high_resolution_clock::now();
+  for (const Frame& frame : frames) {
+    std::array<double, 4> cff{};
+    std::array<double, 4> egt{};
+    Polynomial_A380X::correctedFuelFlow(frame.cn1, frame.mach, frame.alt, cff);
+    Polynomial_A380X::correctedEGT(frame.cn1, cff, frame.mach, frame.alt, egt);
+    checksum += egt[0] + egt[1] + egt[2] + egt[3];
+  }
+  auto batchDuration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now() - start).count();
+
+  // Benchmark the 16 coefficient start polynomial
+  start = std::chrono::high_resolution_clock::now();
+  for (const Frame& frame : frames) {
+    checksum += reference::startN2Raw(frame.cn1[0] * 0.6, 68, 68.2);
+  }
+  auto startReferenceDuration =
+      std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now() - start).count();
+
+  start = std::chrono::high_resolution_clock::now();
+  for (const Frame& frame : frames) {
+    checksum += Polynomial_A32NX::startN2(frame.cn1[0] * 0.6, 0, 68);
+  }
+  auto startHornerDuration =
+      std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now() - start).count();
+
+  const double count = static_cast<double>(frames.size());
+  std::cout << "corrected FF + EGT, 4 engines: pow " << referenceDuration / count << " ns, horner " << singleDuration / count
+            << " ns, batch " << batchDuration / count << " ns per frame" << std::endl;
+  std::cout << "startN2: pow " << startReferenceDuration / count << " ns, horner " << startHornerDuration / count << " ns per call"
+            << std::endl;
+  if (verbose) {
+    std::cout << "checksum " << checksum << std::endl;
+  }
+
+  std::cout << (passed ? "All results within tolerance" : "Results differ") << std::endl;
+  return passed ? 0 : 1;
+}
@@ -0,0 +1,147 @@
+// Copyright (c) 2024 FlyByWire Simulations
+// SPDX-License-Identifier: GPL-3.0
+
+// Compares the InterpolatingLookupTable with the former linear scan over realistic throttle axis
+// mapping tables and checks that both return identical results. The reference is not inlined, like
+// the former get() in its own translation unit.
+//
+// Compile together with ../../fbw_common/src/InterpolatingLookupTable.cpp.
+
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../../fbw_common/src/InterpolatingLookupTable.h"
+
+// former implementation as reference
+__attribute__((noinline)) static double linearLookup(const std::vector<std::pair<double, double>>& table, double minimum, double maximum, double value) {
+  if (table.empty()) {
+    return 0;
+  }
+  for (std::size_t i = 0; i < table.size() - 1; ++i) {
+    if (table[i].first <= value && table[i + 1].first >= value) {
+      double diff_x = value - table[i].first;
+      double diff_n = table[i + 1].first - table[i].first;
+      double result = table[i].first;
+      if (diff_n != 0) {
+        result = table[i].second + (table[i + 1].second - table[i].second) * diff_x / diff_n;
+      }
+      if (result < minimum) {
+        return minimum;
+      } else if (result > maximum) {
+        return maximum;
+      }
+      return result;
+    }
+  }
+  return 0;
+}
+
+static bool isSame(double a, double b) {
+  return a == b || (std::isnan(a) && std::isnan(b));
+}
+
+int main(int argc, char* argv[]) {
+  // Parse arguments
+  bool verbose = false;
+  for (int i = 1; i < argc; ++i) {
+    if (std::strcmp(argv[i], "verbose") == 0) {
+      verbose = true;
+    }
+  }
+
+  // Tables as used by the throttle axis mapping (default detents with and without reverse on axis),
+  // the 3D throttle animation and a uniformly spaced table
+  struct Table {
+    std::string name;
+    std::vector<std::pair<double, double>> mapping;
+    double minimum;
+    double maximum;
+  };
+  std::vector<Table> tables = {
+      {"axis with reverse",
+       {{-1.0, -20.0}, {-0.95, -20.0}, {-0.72, -6.0}, {-0.5, -6.0}, {-0.5, 0.0}, {0.0, 0.0}, {0.5, 25.0}, {0.55, 25.0},
+        {0.8, 35.0}, {0.85, 35.0}, {0.95, 45.0}, {1.0, 45.0}},
+       -20.0,
+       45.0},
+      {"axis without reverse",
+       {{-1.0, 0.0}, {-0.95, 0.0}, {0.0, 25.0}, {0.1, 25.0}, {0.7, 35.0}, {0.8, 35.0}, {0.9, 45.0}, {1.0, 45.0}},
+       0.0,
+       45.0},
+      {"3d animation", {{-20.0, 0.0}, {0.0, 0.0}, {25.0, 54.0}, {35.0, 71.0}, {45.0, 100.0}}, 0.0, 100.0},
+      {"uniform", {{0.0, 0.0}, {10.0, 3.0}, {20.0, 12.0}, {30.0, 20.0}, {40.0, 35.0}, {50.0, 37.0}, {60.0, 60.0}}, 0.0, 60.0},
+      {"unsorted", {{0.0, 0.0}, {1.0, 10.0}, {0.5, 20.0}, {2.0, 30.0}}, 0.0, 30.0},
+  };
+
+  // Prepare inputs: a slowly moving axis (temporally coherent) and random values including the breakpoints
+  const int inputs = 100000;
+  std::mt19937 gen(42);
+  bool passed = true;
+
+  for (auto& table : tables) {
+    const double low = table.mapping.front().first;
+    const double high = table.mapping.back().first;
+    std::uniform_real_distribution<> dis(low - 0.1 * (high - low), high + 0.1 * (high - low));
+
+    std::vector<double> coherent(inputs);
+    std::vector<double> random(inputs);
+    for (int i = 0; i < inputs; ++i) {
+      coherent[i] = low + (high - low) * (0.5 + 0.5 * std::sin(i * 0.001));
+      random[i] = dis(gen);
+    }
+    for (const auto& entry : table.mapping) {
+      random.push_back(entry.first);
+    }
+    random.push_back(std::numeric_limits<double>::quiet_NaN());
+
+    InterpolatingLookupTable lookupTable;
+    lookupTable.initialize(table.mapping, table.minimum, table.maximum);
+
+    // Check results
+    for (const auto* values : {&coherent, &random}) {
+      for (std::size_t i = 0; i < values->size(); ++i) {
+        const double expected = linearLookup(table.mapping, table.minimum, table.maximum, (*values)[i]);
+        if (!isSame(expected, lookupTable.get((*values)[i]))) {
+          std::cout << "FAILED: " << table.name << " for value " << (*values)[i] << std::endl;
+          passed = false;
+          break;
+        }
+      }
+    }
+
+    // Benchmark
+    for (const auto* values : {&coherent, &random}) {
+      double checksum = 0;
+      auto start = std::chrono::high_resolution_clock::now();
+      for (double value : *values) {
+        checksum += linearLookup(table.mapping, table.minimum, table.maximum, value);
+      }
+      auto linearDuration =
+          std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now() - start).count();
+
+      start = std::chrono::high_resolution_clock::now();
+      for (double value : *values) {
+        checksum += lookupTable.get(value);
+      }
+      auto tableDuration =
+          std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now() - start).count();
+
+      const double count = static_cast<double>(values->size());
+      std::cout << table.name << (values == &coherent ? " (coherent)" : " (random)") << ": linear " << linearDuration / count
+                << " ns, table " << tableDuration / count << " ns per value";
+      if (verbose) {
+        std::cout << " (checksum " << checksum << ")";
+      }
+      std::cout << std::endl;
+    }
+  }
+
+  std::cout << (passed ? "All results identical" : "Results differ") << std::endl;
+  return passed ? 0 : 1;
+}
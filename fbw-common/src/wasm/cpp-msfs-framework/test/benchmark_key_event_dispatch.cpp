@@ -0,0 +1,245 @@
+// Copyright (c) 2024 FlyByWire Simulations
+// SPDX-License-Identifier: GPL-3.0
+
+// Compares the dispatch of key events received from the sim to the registered callbacks during an axis event
+// storm: the former map of callback maps of the DataManager against the KeyEventDispatchTable, once calling
+// the callbacks for every key event and once with the axis events coalesced to one dispatch per frame.
+// The DataManager itself requires the MSFS SDK, so the callbacks are registered directly with the same
+// callback function type.
+//
+// Compile with the include path -I../lib.
+
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <random>
+#include <vector>
+
+#include "KeyEventDispatchTable.hpp"
+
+using Function = std::function<void(std::uint32_t, std::uint32_t, std::uint32_t, std::uint32_t, std::uint32_t)>;
+
+// key event IDs in the range of the KEY_ defines in gauges.h
+constexpr std::int32_t KEY_ID_MIN = 0x10000;
+constexpr int          AXES       = 6;
+
+// the axis key events are apart from the other key events
+static std::int32_t axisKeyEvent(int axis) {
+  return KEY_ID_MIN + 1300 + axis * 7;
+}
+
+struct KeyEvent {
+  std::int32_t  id;
+  std::uint32_t data0;
+  std::uint32_t data1;
+};
+
+struct Call {
+  std::uint64_t callback;
+  std::uint32_t data0;
+  std::uint32_t data1;
+  bool          operator==(const Call& other) const { return callback == other.callback && data0 == other.data0 && data1 == other.data1; }
+};
+
+// the former dispatch of DataManager::processKeyEvent()
+class FormerDispatch {
+  std::map<std::int32_t, std::map<std::uint64_t, Function>> keyEventCallbacks{};
+
+ public:
+  void add(std::int32_t keyEventId, std::uint64_t id, const Function& callback) { keyEventCallbacks[keyEventId].insert({id, callback}); }
+
+  void process(std::int32_t keyEventId, std::uint32_t d0, std::uint32_t d1, std::uint32_t d2, std::uint32_t d3, std::uint32_t d4) {
+    const auto eventPair = keyEventCallbacks.find(keyEventId);
+    if (eventPair != keyEventCallbacks.end()) {
+      for (const auto& callbackPair : eventPair->second) {
+        callbackPair.second(d0, d1, d2, d3, d4);
+      }
+    }
+  }
+};
+
+// the key events of an aircraft: 6 axes with 2 callbacks each and 120 other key events with 1 to 3 callbacks
+template <typename Dispatch, typename MakeCallback>
+static void registerCallbacks(Dispatch& dispatch, MakeCallback&& makeCallback) {
+  std::uint64_t id = 0;
+  for (int axis = 0; axis < AXES; axis++) {
+    for (int i = 0; i < 2; i++, id++) {
+      dispatch.add(axisKeyEvent(axis), id, makeCallback(id));
+    }
+  }
+  for (int event = 0; event < 120; event++) {
+    for (int i = 0; i <= event % 3; i++, id++) {
+      dispatch.add(KEY_ID_MIN + event * 13 % 1200, id, makeCallback(id));
+    }
+  }
+}
+
+// per frame the axis events of the storm (each axis moved with a random share of the events per second) and
+// now and then another key event, also some key events without callbacks
+static std::vector<std::vector<KeyEvent>> makeFrames(int frames, int fps, int axisEventsPerSecond) {
+  std::mt19937                       gen(42);
+  std::uniform_int_distribution<>    axis(0, AXES - 1);
+  std::uniform_int_distribution<>    value(0, 32767);
+  std::uniform_int_distribution<>    roll(0, 99);
+  std::vector<std::vector<KeyEvent>> result(frames);
+  for (int f = 0; f < frames; f++) {
+    const int events = axisEventsPerSecond / fps;
+    for (int e = 0; e < events; e++) {
+      result[f].push_back({axisKeyEvent(axis(gen)), static_cast<std::uint32_t>(value(gen)), 0});
+      if (roll(gen) < 2) {
+        result[f].push_back({KEY_ID_MIN + roll(gen) * 13 % 1200, static_cast<std::uint32_t>(value(gen)), static_cast<std::uint32_t>(f)});
+      }
+    }
+  }
+  return result;
+}
+
+static bool isAxis(std::uint64_t callback) {
+  return callback < 2 * AXES;
+}
+
+int main(int argc, char* argv[]) {
+  // Parse arguments
+  bool verbose = false;
+  for (int i = 1; i < argc; ++i) {
+    if (std::strcmp(argv[i], "verbose") == 0) {
+      verbose = true;
+    }
+  }
+
+  // Benchmark parameters
+  const int fps                 = 60;
+  const int frames              = fps * 120;
+  const int axisEventsPerSecond = 6000;
+
+  const std::vector<std::vector<KeyEvent>> keyEvents = makeFrames(frames, fps, axisEventsPerSecond);
+  std::size_t                              total     = 0;
+  for (const auto& frame : keyEvents) {
+    total += frame.size();
+  }
+
+  // Calls of the former dispatch, the dispatch table and the coalesced dispatch table
+  std::vector<Call> formerCalls;
+  std::vector<Call> tableCalls;
+  std::vector<Call> coalescedCalls;
+  // the latest value of each axis callback at the end of each frame
+  std::vector<std::uint32_t> formerAxisValues(2 * AXES);
+  std::vector<std::uint32_t> coalescedAxisValues(2 * AXES);
+  std::size_t                axisMismatches = 0;
+
+  FormerDispatch                  former;
+  KeyEventDispatchTable<Function> table;
+  KeyEventDispatchTable<Function> coalesced;
+  registerCallbacks(former, [&](std::uint64_t id) {
+    return [&, id](std::uint32_t d0, std::uint32_t d1, auto...) {
+      formerCalls.push_back({id, d0, d1});
+      if (isAxis(id)) {
+        formerAxisValues[id] = d0;
+      }
+    };
+  });
+  registerCallbacks(table, [&](std::uint64_t id) {
+    return [&, id](std::uint32_t d0, std::uint32_t d1, auto...) { tableCalls.push_back({id, d0, d1}); };
+  });
+  registerCallbacks(coalesced, [&](std::uint64_t id) {
+    return [&, id](std::uint32_t d0, std::uint32_t d1, auto...) {
+      if (isAxis(id)) {
+        coalescedAxisValues[id] = d0;
+      } else {
+        coalescedCalls.push_back({id, d0, d1});
+      }
+    };
+  });
+  for (int axis = 0; axis < AXES; axis++) {
+    coalesced.setCoalescing(axisKeyEvent(axis), true);
+  }
+
+  for (const auto& frame : keyEvents) {
+    for (const KeyEvent& e : frame) {
+      former.process(e.id, e.data0, e.data1, 0, 0, 0);
+      table.process(e.id, e.data0, e.data1, 0, 0, 0);
+      coalesced.process(e.id, e.data0, e.data1, 0, 0, 0);
+    }
+    coalesced.dispatchCoalesced();
+    axisMismatches += formerAxisValues != coalescedAxisValues;
+  }
+
+  // the non-axis calls of the former dispatch for comparison with the coalesced dispatch
+  std::vector<Call> formerOtherCalls;
+  std::size_t       formerAxisCalls = 0;
+  for (const Call& call : formerCalls) {
+    if (isAxis(call.callback)) {
+      formerAxisCalls++;
+    } else {
+      formerOtherCalls.push_back(call);
+    }
+  }
+
+  // Timing with callbacks writing the value like a callback setting a variable
+  std::vector<std::uint32_t> sink(1024);
+  const auto                 makeTimedCallback = [&](std::uint64_t id) {
+    return [&, id](std::uint32_t d0, auto...) { sink[id] = d0; };
+  };
+
+  FormerDispatch timedFormer;
+  registerCallbacks(timedFormer, makeTimedCallback);
+  auto start = std::chrono::high_resolution_clock::now();
+  for (const auto& frame : keyEvents) {
+    for (const KeyEvent& e : frame) {
+      timedFormer.process(e.id, e.data0, e.data1, 0, 0, 0);
+    }
+  }
+  const auto formerTime = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now() - start);
+
+  KeyEventDispatchTable<Function> timedTable;
+  registerCallbacks(timedTable, makeTimedCallback);
+  start = std::chrono::high_resolution_clock::now();
+  for (const auto& frame : keyEvents) {
+    for (const KeyEvent& e : frame) {
+      timedTable.process(e.id, e.data0, e.data1, 0, 0, 0);
+    }
+  }
+  const auto tableTime = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now() - start);
+
+  KeyEventDispatchTable<Function> timedCoalesced;
+  registerCallbacks(timedCoalesced, makeTimedCallback);
+  for (int axis = 0; axis < AXES; axis++) {
+    timedCoalesced.setCoalescing(axisKeyEvent(axis), true);
+  }
+  start = std::chrono::high_resolution_clock::now();
+  for (const auto& frame : keyEvents) {
+    for (const KeyEvent& e : frame) {
+      timedCoalesced.process(e.id, e.data0, e.data1, 0, 0, 0);
+    }
+    timedCoalesced.dispatchCoalesced();
+  }
+  const auto coalescedTime = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now() - start);
+
+  // Validate that the dispatch table calls the same callbacks with the same parameters in the same order and
+  // that the coalesced axis callbacks end every frame with the same values
+  const bool passed = tableCalls == formerCalls && coalescedCalls == formerOtherCalls && axisMismatches == 0;
+
+  std::cout << total << " key events in " << frames << " frames at " << fps << " fps (" << axisEventsPerSecond
+            << " axis events per second on " << AXES << " axes)" << std::endl;
+  std::cout << "Former map of maps:    " << formerTime.count() / total << " ns per key event, " << formerTime.count() / frames
+            << " ns per frame" << std::endl;
+  std::cout << "Dispatch table:        " << tableTime.count() / total << " ns per key event, " << tableTime.count() / frames
+            << " ns per frame" << std::endl;
+  std::cout << "Coalesced axis events: " << coalescedTime.count() / total << " ns per key event, " << coalescedTime.count() / frames
+            << " ns per frame" << std::endl;
+  if (verbose) {
+    std::cout << "Calls: former " << formerCalls.size() << " (" << formerAxisCalls << " axis), dispatch table " << tableCalls.size()
+              << ", coalesced " << coalescedCalls.size() << " other" << std::endl;
+  }
+
+  if (passed) {
+    std::cout << "All results identical" << std::endl;
+    return 0;
+  }
+  std::cout << "FAILED: the callbacks were not called with the same parameters (" << axisMismatches << " frames with different axis values)"
+            << std::endl;
+  return 1;
+}
@@ -0,0 +1,193 @@
+// Copyright (c) 2024 FlyByWire Simulations
+// SPDX-License-Identifier: GPL-3.0
+
+// Compares the per frame cost of LocalVariable::readAll() and LocalVariable::writeAll(): the former
+// std::set of heap allocated variables against the pooled LocalVariableStore with update groups.
+// The former implementation read every variable each frame, the throttle configuration variables
+// are now in the on demand group and skipped by readAll(). The sim is modeled by a table of values
+// behind non-inlined functions.
+//
+// Compile with the include paths -I../../fbw_common/src and
+// -I../../../../../fbw-a32nx/src/wasm/fbw_a320/native/msfs-stubs (stand-in for the MSFS SDK header).
+
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "../../fbw_common/src/LocalVariable.cpp"
+#include "../../fbw_common/src/LocalVariableStore.cpp"
+
+// sim side of the named variables
+static std::vector<double> simValues;
+static long long simWrites = 0;
+
+__attribute__((noinline)) ID register_named_variable(PCSTRINGZ) {
+  simValues.push_back(0.0);
+  return static_cast<ID>(simValues.size() - 1);
+}
+
+__attribute__((noinline)) FLOAT64 get_named_variable_value(ID id) {
+  return simValues[id];
+}
+
+__attribute__((noinline)) void set_named_variable_value(ID id, FLOAT64 value) {
+  simValues[id] = value;
+  simWrites++;
+}
+
+// former implementation as reference
+class FormerLocalVariable {
+ public:
+  explicit FormerLocalVariable(const std::string& variable, bool shouldUseDirtyState = true)
+      : name(variable), useDirtyState(shouldUseDirtyState), isDirty(false), value(0.0) {
+    id = register_named_variable(name.c_str());
+    read();
+    LOCAL_VARIABLES.insert(this);
+  }
+  ~FormerLocalVariable() { LOCAL_VARIABLES.erase(this); }
+
+  double get() { return value; }
+
+  void set(double newValue, bool shouldWrite = true) {
+    value = newValue;
+    isDirty = true;
+    if (shouldWrite) {
+      write();
+    }
+  }
+
+  void read() { value = get_named_variable_value(id); }
+
+  void write() {
+    if (useDirtyState && !isDirty) {
+      return;
+    }
+    set_named_variable_value(id, value);
+    isDirty = false;
+  }
+
+  static void readAll() {
+    for (auto variable : LOCAL_VARIABLES) {
+      variable->read();
+    }
+  }
+
+  static void writeAll() {
+    for (auto variable : LOCAL_VARIABLES) {
+      variable->write();
+    }
+  }
+
+ private:
+  static std::set<FormerLocalVariable*> LOCAL_VARIABLES;
+
+  ID id;
+  std::string name;
+  bool useDirtyState;
+  bool isDirty;
+  double value;
+};
+
+std::set<FormerLocalVariable*> FormerLocalVariable::LOCAL_VARIABLES;
+
+int main(int argc, char* argv[]) {
+  // Parse arguments
+  bool verbose = false;
+  for (int i = 1; i < argc; ++i) {
+    if (std::strcmp(argv[i], "verbose") == 0) {
+      verbose = true;
+    }
+  }
+
+  // Benchmark parameters, about the number of local variables of the A32NX fly-by-wire module with
+  // the configuration variables of both throttle axes, about 10% are set per frame without writing
+  const int numberOfVariables = 420;
+  const int numberOfOnDemandVariables = 38;
+  const int numberOfSetVariables = 42;
+  const int frames = 100000;
+
+  std::mt19937 gen(42);
+  std::uniform_int_distribution<> dis(0, numberOfVariables - numberOfOnDemandVariables - 1);
+  std::vector<int> setIndices;
+  for (int i = 0; i < numberOfSetVariables; ++i) {
+    setIndices.push_back(dis(gen));
+  }
+
+  // Former set based variables, allocated interleaved with other objects as in the module
+  std::vector<std::unique_ptr<FormerLocalVariable>> formerVariables;
+  std::vector<std::unique_ptr<std::string>> clutter;
+  for (int i = 0; i < numberOfVariables; ++i) {
+    formerVariables.push_back(std::make_unique<FormerLocalVariable>("A32NX_VARIABLE_" + std::to_string(i), i % 7 != 0));
+    clutter.push_back(std::make_unique<std::string>(64, 'x'));
+  }
+  const std::size_t formerOffset = 0;
+
+  // Pooled variables with the throttle configuration in the on demand group
+  std::vector<std::unique_ptr<LocalVariable>> variables;
+  const std::size_t pooledOffset = simValues.size();
+  for (int i = 0; i < numberOfVariables; ++i) {
+    const bool isOnDemand = i >= numberOfVariables - numberOfOnDemandVariables;
+    variables.push_back(std::make_unique<LocalVariable>("A32NX_VARIABLE_" + std::to_string(i), i % 7 != 0,
+                                                        isOnDemand ? LocalVariable::OnDemand : LocalVariable::EveryFrame));
+    clutter.push_back(std::make_unique<std::string>(64, 'x'));
+  }
+
+  // Former readAll / writeAll
+  simWrites = 0;
+  double formerChecksum = 0.0;
+  auto start = std::chrono::high_resolution_clock::now();
+  for (int f = 0; f < frames; ++f) {
+    FormerLocalVariable::readAll();
+    for (int index : setIndices) {
+      formerVariables[index]->set(formerVariables[index]->get() + 1.0, false);
+    }
+    FormerLocalVariable::writeAll();
+  }
+  auto formerDuration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now() - start);
+  const long long formerWrites = simWrites;
+  for (int i = 0; i < numberOfVariables; ++i) {
+    formerChecksum += simValues[formerOffset + i];
+  }
+
+  // Pooled readAll / writeAll
+  simWrites = 0;
+  double pooledChecksum = 0.0;
+  start = std::chrono::high_resolution_clock::now();
+  for (int f = 0; f < frames; ++f) {
+    LocalVariable::readAll();
+    for (int index : setIndices) {
+      variables[index]->set(variables[index]->get() + 1.0, false);
+    }
+    LocalVariable::writeAll();
+  }
+  auto pooledDuration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now() - start);
+  const long long pooledWrites = simWrites;
+  for (int i = 0; i < numberOfVariables; ++i) {
+    pooledChecksum += simValues[pooledOffset + i];
+  }
+
+  // Both must have written the same values with the same number of sim calls
+  bool identical = formerWrites == pooledWrites && formerChecksum == pooledChecksum;
+  for (int i = 0; i < numberOfVariables && identical; ++i) {
+    identical = simValues[formerOffset + i] == simValues[pooledOffset + i];
+  }
+
+  if (verbose) {
+    std::cout << "Variables: " << numberOfVariables << " (on demand: " << numberOfOnDemandVariables
+              << ", set per frame: " << numberOfSetVariables << "), writes per frame: " << pooledWrites / frames << std::endl;
+  }
+  std::cout << "std::set variables: " << formerDuration.count() / frames << " ns per frame" << std::endl;
+  std::cout << "Pooled store:       " << pooledDuration.count() / frames << " ns per frame" << std::endl;
+
+  if (!identical) {
+    std::cout << "FAILED: results differ" << std::endl;
+    return 1;
+  }
+  std::cout << "All results identical" << std::endl;
+  return 0;
+}
@@ -0,0 +1,140 @@
+// Copyright (c) 2024 FlyByWire Simulations
+// SPDX-License-Identifier: GPL-3.0
+
+// Compares the cost of a log message on the hot path: the former logger which built the message by string
+// concatenation and printed it right away against recording the format ID and the arguments into the
+// LogBuffer, and the cost of formatting the recorded messages when the buffer is drained between ticks.
+// The messages are printed to a file instead of the console so the console does not dominate the timing.
+//
+// Compile with the include path -I../lib.
+
+#define FMT_HEADER_ONLY
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "LogBuffer.hpp"
+#include "fmt/format.h"
+
+constexpr std::uint32_t WARN_LEVEL  = 3;
+constexpr std::uint32_t DEBUG_LEVEL = 5;
+
+struct Message {
+  std::string   name;
+  double        value;
+  std::uint64_t tick;
+};
+
+int main(int argc, char* argv[]) {
+  // Parse arguments
+  bool verbose = false;
+  for (int i = 1; i < argc; ++i) {
+    if (std::strcmp(argv[i], "verbose") == 0) {
+      verbose = true;
+    }
+  }
+
+  // Benchmark parameters - a debug message for some variables in every tick
+  const int         ticks           = 60 * 60;
+  const int         messagesPerTick = 20;
+  const int         drainLimit      = 64;
+  const int         totalMessages   = ticks * messagesPerTick;
+  const std::string varNames[]      = {"A32NX_ENGINE_N1:1", "A32NX_ENGINE_N2:1", "A32NX_FADEC_THRUST_LIMIT", "LIGHT POTENTIOMETER:84"};
+
+  std::vector<Message> messages;
+  messages.reserve(totalMessages);
+  for (int t = 0; t < ticks; t++) {
+    for (int m = 0; m < messagesPerTick; m++) {
+      messages.push_back({varNames[m % 4], t * 0.25 + m, static_cast<std::uint64_t>(t)});
+    }
+  }
+
+  FILE* out = std::tmpfile();
+  if (out == nullptr) {
+    std::cout << "FAILED: could not open a temporary file" << std::endl;
+    return 1;
+  }
+
+  // Former logger: concatenated message printed right away
+  std::vector<std::string> formerTexts;
+  formerTexts.reserve(totalMessages);
+  auto start = std::chrono::high_resolution_clock::now();
+  for (const Message& m : messages) {
+    const std::string text = "CacheableVariable::get() - " + m.name + " changed to " + std::to_string(m.value) + " in tick " +
+                             std::to_string(m.tick);
+    fmt::print(out, "debug: {}\n", text);
+    formerTexts.push_back(text);
+  }
+  const auto formerTime = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now() - start);
+
+  // LogBuffer: recorded in the tick, drained (formatted and printed) between the ticks
+  LogBuffer                buffer(1 << 18);
+  const std::uint32_t      id =
+      buffer.addFormat(DEBUG_LEVEL, "CacheableVariable::get() - {} changed to {:f} in tick {}", __FILE__, __LINE__);
+  std::vector<std::string> bufferTexts;
+  bufferTexts.reserve(totalMessages);
+  std::chrono::nanoseconds recordTime{0};
+  std::chrono::nanoseconds drainTime{0};
+  std::size_t              maxPending = 0;
+  const auto               sink       = [&](const LogBuffer::Format&, const std::string& text) {
+    fmt::print(out, "debug: {}\n", text);
+    bufferTexts.push_back(text);
+  };
+  for (int t = 0; t < ticks; t++) {
+    start = std::chrono::high_resolution_clock::now();
+    for (int m = 0; m < messagesPerTick; m++) {
+      const Message& message = messages[t * messagesPerTick + m];
+      buffer.record(id, message.name, message.value, message.tick);
+    }
+    recordTime += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now() - start);
+    maxPending = (std::max)(maxPending, buffer.pending());
+    start      = std::chrono::high_resolution_clock::now();
+    buffer.drain(drainLimit, sink);
+    drainTime += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now() - start);
+  }
+
+  // Deferred mode of the MsfsHandler: only warnings are drained, the debug messages are only recorded
+  LogBuffer           deferredBuffer(1 << 18);
+  const std::uint32_t deferredId =
+      deferredBuffer.addFormat(DEBUG_LEVEL, "CacheableVariable::get() - {} changed to {:f} in tick {}", __FILE__, __LINE__);
+  deferredBuffer.setDrainLevel(WARN_LEVEL);
+  std::chrono::nanoseconds deferredDrainTime{0};
+  for (int t = 0; t < ticks; t++) {
+    for (int m = 0; m < messagesPerTick; m++) {
+      const Message& message = messages[t * messagesPerTick + m];
+      deferredBuffer.record(deferredId, message.name, message.value, message.tick);
+    }
+    start = std::chrono::high_resolution_clock::now();
+    deferredBuffer.drain(drainLimit, sink);
+    deferredDrainTime += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now() - start);
+  }
+  std::fclose(out);
+
+  // Validate that the drained messages are identical to the former messages
+  const bool passed = bufferTexts == formerTexts && buffer.dropped() == 0 && deferredBuffer.dropped() == 0;
+
+  std::cout << totalMessages << " debug messages in " << ticks << " ticks (" << messagesPerTick << " per tick)" << std::endl;
+  std::cout << "Former concatenate and print:  " << formerTime.count() / totalMessages << " ns per message, "
+            << formerTime.count() / ticks << " ns per tick" << std::endl;
+  std::cout << "LogBuffer record in tick:      " << recordTime.count() / totalMessages << " ns per message, "
+            << recordTime.count() / ticks << " ns per tick" << std::endl;
+  std::cout << "LogBuffer drain between ticks: " << drainTime.count() / totalMessages << " ns per message, "
+            << drainTime.count() / ticks << " ns per tick" << std::endl;
+  std::cout << "Deferred drain of warnings:    " << deferredDrainTime.count() / ticks << " ns per tick" << std::endl;
+  if (verbose) {
+    std::cout << "Buffer: " << buffer.capacity() << " bytes, " << buffer.size() << " records retained, " << maxPending
+              << " max pending, " << buffer.dropped() << " dropped" << std::endl;
+  }
+
+  if (passed) {
+    std::cout << "All results identical" << std::endl;
+    return 0;
+  }
+  std::cout << "FAILED: the drained messages differ from the former messages (" << buffer.dropped() << " dropped)" << std::endl;
+  return 1;
+}
@@ -0,0 +1,133 @@
+// Copyright (c) 2024 FlyByWire Simulations
+// SPDX-License-Identifier: GPL-3.0
+
+// Compares the cost of the ProfileBuffer with the former std::deque implementation which sorted a
+// copy of the buffer for every trimmed average and percentile query. Each iteration pushes a sample
+// and queries the statistics as SimpleProfiler::str() does.
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <deque>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "../lib/ProfileBuffer.hpp"
+
+// former implementation as reference
+template <typename T>
+class DequeProfileBuffer {
+  std::size_t   _capacity;
+  std::deque<T> _buffer;
+
+ public:
+  explicit DequeProfileBuffer(std::size_t capacity) : _capacity{capacity} {}
+
+  void push(T value) {
+    if (_buffer.size() == _capacity) {
+      _buffer.pop_front();
+    }
+    _buffer.push_back(value);
+  }
+
+  T sum() { return std::accumulate(_buffer.begin(), _buffer.end(), T(0)); }
+
+  T avg() { return sum() / _buffer.size(); }
+
+  T trimmedAverage(float trimPercent = 0.05f) {
+    auto sorted = _buffer;
+    std::sort(sorted.begin(), sorted.end());
+    const std::size_t trimSize = sorted.size() * trimPercent;
+    return std::accumulate(sorted.begin() + trimSize, sorted.end() - trimSize, T(0)) / (sorted.size() - trimSize * 2);
+  }
+
+  T minimum(float percentile = 0.0f) {
+    if (percentile > 0.0) {
+      auto sorted = _buffer;
+      std::sort(sorted.begin(), sorted.end());
+      const std::size_t trimSize = sorted.size() * percentile;
+      return std::accumulate(sorted.begin(), sorted.begin() + trimSize, T(0)) / trimSize;
+    }
+    return *std::min_element(_buffer.begin(), _buffer.end());
+  }
+
+  T maximum(float percentile = 0.0f) {
+    if (percentile > 0.0) {
+      auto sorted = _buffer;
+      std::sort(sorted.begin(), sorted.end());
+      const std::size_t trimSize = sorted.size() * percentile;
+      return std::accumulate(sorted.end() - trimSize, sorted.end(), T(0)) / trimSize;
+    }
+    return *std::max_element(_buffer.begin(), _buffer.end());
+  }
+};
+
+template <typename Buffer>
+static std::int64_t run(Buffer& buffer, const std::vector<std::chrono::nanoseconds>& samples, std::size_t queries, std::int64_t& checksum) {
+  auto start = std::chrono::high_resolution_clock::now();
+  for (std::size_t i = 0; i < queries; ++i) {
+    buffer.push(samples[i % samples.size()]);
+    checksum += buffer.avg().count() + buffer.trimmedAverage().count() + buffer.minimum().count() + buffer.maximum().count() +
+                buffer.minimum(0.05f).count() + buffer.maximum(0.05f).count();
+  }
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now() - start).count();
+}
+
+int main(int argc, char* argv[]) {
+  // Parse arguments
+  bool verbose = false;
+  for (int i = 1; i < argc; ++i) {
+    if (std::strcmp(argv[i], "verbose") == 0) {
+      verbose = true;
+    }
+  }
+
+  // Benchmark parameters
+  const std::size_t capacity = 10000;
+  const std::size_t queries  = 200;
+
+  // Samples similar to module update durations: 20us to 2ms with a few outliers
+  std::mt19937                    gen(42);
+  std::uniform_int_distribution<> dis(20000, 2000000);
+  std::vector<std::chrono::nanoseconds> samples(capacity * 2);
+  for (std::size_t i = 0; i < samples.size(); ++i) {
+    samples[i] = std::chrono::nanoseconds(dis(gen) * (i % 1000 == 0 ? 20 : 1));
+  }
+
+  DequeProfileBuffer<std::chrono::nanoseconds> dequeBuffer(capacity);
+  ProfileBuffer<std::chrono::nanoseconds>      profileBuffer(capacity);
+
+  // Fill both buffers
+  auto start = std::chrono::high_resolution_clock::now();
+  for (const auto& sample : samples) {
+    dequeBuffer.push(sample);
+  }
+  auto dequePushDuration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now() - start);
+  start                  = std::chrono::high_resolution_clock::now();
+  for (const auto& sample : samples) {
+    profileBuffer.push(sample);
+  }
+  auto pushDuration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now() - start);
+
+  // Push and query all statistics
+  std::int64_t dequeChecksum = 0;
+  std::int64_t checksum      = 0;
+  const auto   dequeDuration = run(dequeBuffer, samples, queries, dequeChecksum);
+  const auto   duration      = run(profileBuffer, samples, queries, checksum);
+
+  if (verbose) {
+    std::cout << "Capacity: " << capacity << ", checksums: " << dequeChecksum << " / " << checksum << std::endl;
+    std::cout << "Trimmed average: " << dequeBuffer.trimmedAverage().count() << " / " << profileBuffer.trimmedAverage().count() << " ns"
+              << std::endl;
+    std::cout << "5% maximum:      " << dequeBuffer.maximum(0.05f).count() << " / " << profileBuffer.maximum(0.05f).count() << " ns"
+              << std::endl;
+  }
+  std::cout << "Push (deque):          " << dequePushDuration.count() / samples.size() << " ns per sample" << std::endl;
+  std::cout << "Push (ProfileBuffer):  " << pushDuration.count() / samples.size() << " ns per sample" << std::endl;
+  std::cout << "Query (deque):         " << dequeDuration / static_cast<std::int64_t>(queries) << " ns per push and query" << std::endl;
+  std::cout << "Query (ProfileBuffer): " << duration / static_cast<std::int64_t>(queries) << " ns per push and query" << std::endl;
+
+  return 0;
+}
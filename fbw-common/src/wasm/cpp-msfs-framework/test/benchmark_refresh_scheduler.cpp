@@ -0,0 +1,211 @@
+// Copyright (c) 2024 FlyByWire Simulations
+// SPDX-License-Identifier: GPL-3.0
+
+// Compares the per tick overhead of refreshing the DataManager's auto read variables: the former loop
+// calling updateFromSim() on every auto read variable against the dense list of variables without max age
+// plus the RefreshScheduler for the variables with a max age in ticks or sim time.
+// The DataManager itself requires the MSFS SDK, so the variables are modeled by a minimal class with the
+// stamp handling of ManagedDataObjectBase and CacheableVariable::updateFromSim().
+//
+// Compile with the include path -I../lib.
+
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "RefreshScheduler.hpp"
+
+class Variable {
+ public:
+  std::size_t   index               = 0;
+  double        maxAgeTime          = 0.0;
+  std::uint64_t maxAgeTicks         = 0;
+  double        nextUpdateTimeStamp = 0.0;
+  std::uint64_t nextUpdateTickStamp = 0;
+  bool          hasValue            = false;
+  double        value               = 0.0;
+
+  virtual ~Variable() = default;
+
+  [[nodiscard]] bool hasMaxAge() const { return maxAgeTime > 0.0 || maxAgeTicks > 0; }
+
+  [[nodiscard]] double        getNextUpdateTimeStamp() const { return nextUpdateTimeStamp; }
+  [[nodiscard]] std::uint64_t getNextUpdateTickStamp() const { return nextUpdateTickStamp; }
+
+  // returns true if the variable was read from the sim
+  virtual bool updateFromSim(double timeStamp, std::uint64_t tickCounter) {
+    if (hasValue && !(nextUpdateTimeStamp < timeStamp && nextUpdateTickStamp < tickCounter)) {
+      return false;
+    }
+    nextUpdateTimeStamp = timeStamp + maxAgeTime;
+    nextUpdateTickStamp = tickCounter + maxAgeTicks;
+    hasValue            = true;
+    value += 1.0;
+    return true;
+  }
+};
+
+struct Read {
+  std::uint64_t tick;
+  std::size_t   index;
+  bool          operator==(const Read& other) const { return tick == other.tick && index == other.index; }
+};
+
+// about 10% of the variables every tick, the others with a max age in ticks, in sim time or both
+static std::vector<Variable> makeVariables(int numberOfVariables) {
+  std::mt19937                    gen(42);
+  std::uniform_int_distribution<> dis(0, 99);
+  const std::uint64_t             tickAges[] = {3, 5, 10, 30, 60, 300};
+  const double                    timeAges[] = {0.1, 0.2, 0.25, 0.5, 1.0, 5.0, 12.0};
+
+  std::vector<Variable> variables(numberOfVariables);
+  for (int i = 0; i < numberOfVariables; ++i) {
+    Variable& var  = variables[i];
+    var.index      = i;
+    const int roll = dis(gen);
+    if (roll < 10) {
+      continue;
+    }
+    if (roll < 55) {
+      var.maxAgeTicks = tickAges[dis(gen) % 6];
+    } else if (roll < 90) {
+      var.maxAgeTime = timeAges[dis(gen) % 7];
+    } else {
+      var.maxAgeTicks = tickAges[dis(gen) % 6];
+      var.maxAgeTime  = timeAges[dis(gen) % 7];
+    }
+  }
+  return variables;
+}
+
+// the sim time of each tick at about 30 fps with jitter and an occasional stutter
+static std::vector<double> makeTimeStamps(int ticks) {
+  std::mt19937                     gen(7);
+  std::uniform_real_distribution<> jitter(0.8, 1.2);
+  std::vector<double>              timeStamps(ticks);
+  double                           time = 0.0;
+  for (int t = 0; t < ticks; ++t) {
+    time += (t % 997 == 0 ? 0.5 : 1.0 / 30.0) * jitter(gen);
+    timeStamps[t] = time;
+  }
+  return timeStamps;
+}
+
+int main(int argc, char* argv[]) {
+  // Parse arguments
+  bool verbose = false;
+  for (int i = 1; i < argc; ++i) {
+    if (std::strcmp(argv[i], "verbose") == 0) {
+      verbose = true;
+    }
+  }
+
+  // Benchmark parameters
+  const int numberOfVariables = 4000;
+  const int ticks             = 30000;
+
+  const std::vector<double> timeStamps = makeTimeStamps(ticks);
+
+  // Reads of the former loop over all auto read variables
+  std::vector<Variable> formerVariables = makeVariables(numberOfVariables);
+  std::vector<Read>     formerReads;
+  formerReads.reserve(static_cast<std::size_t>(ticks) * numberOfVariables / 8);
+  for (int t = 0; t < ticks; ++t) {
+    const std::uint64_t tick = t + 1;
+    for (Variable& var : formerVariables) {
+      if (var.updateFromSim(timeStamps[t], tick)) {
+        formerReads.push_back({tick, var.index});
+      }
+    }
+  }
+
+  // Reads of the dense list plus scheduler
+  std::vector<Variable>      scheduledVariables = makeVariables(numberOfVariables);
+  std::vector<Variable*>     everyTickVariables;
+  RefreshScheduler<Variable> scheduler;
+  for (Variable& var : scheduledVariables) {
+    if (var.hasMaxAge()) {
+      scheduler.add(&var, var.index);
+    } else {
+      everyTickVariables.push_back(&var);
+    }
+  }
+  std::vector<Read> everyTickReads;
+  std::vector<Read> schedulerReads;
+  everyTickReads.reserve(static_cast<std::size_t>(ticks) * numberOfVariables / 8);
+  schedulerReads.reserve(static_cast<std::size_t>(ticks) * numberOfVariables / 8);
+  std::size_t visited = 0;
+  for (int t = 0; t < ticks; ++t) {
+    const std::uint64_t tick = t + 1;
+    for (Variable* var : everyTickVariables) {
+      if (var->updateFromSim(timeStamps[t], tick)) {
+        everyTickReads.push_back({tick, var->index});
+      }
+    }
+    scheduler.update(timeStamps[t], tick, [&](Variable* var) {
+      if (var->updateFromSim(timeStamps[t], tick)) {
+        schedulerReads.push_back({tick, var->index});
+      }
+    });
+    visited += scheduler.lastVisited();
+  }
+
+  // Timing without recording the reads
+  std::vector<Variable> timedFormer = makeVariables(numberOfVariables);
+  std::size_t           formerCount = 0;
+  auto                  start       = std::chrono::high_resolution_clock::now();
+  for (int t = 0; t < ticks; ++t) {
+    for (Variable& var : timedFormer) {
+      formerCount += var.updateFromSim(timeStamps[t], t + 1);
+    }
+  }
+  const auto formerTime = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now() - start);
+
+  std::vector<Variable>      timedScheduled = makeVariables(numberOfVariables);
+  std::vector<Variable*>     timedEveryTick;
+  RefreshScheduler<Variable> timedScheduler;
+  for (Variable& var : timedScheduled) {
+    if (var.hasMaxAge()) {
+      timedScheduler.add(&var, var.index);
+    } else {
+      timedEveryTick.push_back(&var);
+    }
+  }
+  std::size_t schedulerCount = 0;
+  start                      = std::chrono::high_resolution_clock::now();
+  for (int t = 0; t < ticks; ++t) {
+    for (Variable* var : timedEveryTick) {
+      schedulerCount += var->updateFromSim(timeStamps[t], t + 1);
+    }
+    timedScheduler.update(timeStamps[t], t + 1, [&](Variable* var) { schedulerCount += var->updateFromSim(timeStamps[t], t + 1); });
+  }
+  const auto schedulerTime = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now() - start);
+
+  // Validate that every variable is read in exactly the same ticks
+  std::vector<Read> expectedEveryTick;
+  std::vector<Read> expectedScheduled;
+  for (const Read& read : formerReads) {
+    (formerVariables[read.index].hasMaxAge() ? expectedScheduled : expectedEveryTick).push_back(read);
+  }
+  const bool passed = everyTickReads == expectedEveryTick && schedulerReads == expectedScheduled && formerCount == schedulerCount;
+
+  std::cout << numberOfVariables << " auto read variables (" << everyTickVariables.size() << " every tick, " << scheduler.size()
+            << " scheduled), " << ticks << " ticks, " << formerReads.size() / ticks << " reads per tick" << std::endl;
+  std::cout << "Former loop:  " << formerTime.count() / ticks << " ns per tick" << std::endl;
+  std::cout << "Scheduler:    " << schedulerTime.count() / ticks << " ns per tick, " << visited / ticks
+            << " scheduled variables visited per tick" << std::endl;
+  if (verbose) {
+    std::cout << "Reads: former " << formerReads.size() << ", every tick " << everyTickReads.size() << ", scheduler "
+              << schedulerReads.size() << std::endl;
+  }
+
+  if (passed) {
+    std::cout << "All results identical" << std::endl;
+    return 0;
+  }
+  std::cout << "FAILED: the variables were not read in the same ticks" << std::endl;
+  return 1;
+}
@@ -0,0 +1,190 @@
+// Copyright (c) 2024 FlyByWire Simulations
+// SPDX-License-Identifier: GPL-3.0
+
+// Compares the grid based ThrustLimitCache of the A32NX and A380X with the direct ThrustLimits::limitN1
+// calculation over the flight envelope and during a simulated climb, and measures the time for the per frame
+// thrust limits (TO, GA, flex TO, flex GA, CLB, MCT).
+//
+// Compile with the include paths -I../lib -I../../fadec_common/src.
+//
+// The Fadec module and EngineRatios require the MSFS SDK, so the Fadec class is reduced to its static helpers
+// (with the original definitions from Fadec.cpp) and the EngineRatios used by the limits are copied.
+
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#define FLYBYWIRE_LOGGING_H
+#define FLYBYWIRE_AIRCRAFT_FADEC_H
+#define FLYBYWIRE_AIRCRAFT_ENGINERATIOS_HPP
+
+class Fadec {
+ public:
+  static double interpolate(double x, double x0, double x1, double y0, double y1);
+  static double cas2mach(double cas, double ambientPressure);
+};
+
+class EngineRatios {
+ public:
+  static double theta(double ambientTemp) { return (273.15 + ambientTemp) / 288.15; }
+  static double theta2(double mach, double ambientTemp) { return theta(ambientTemp) * (1 + 0.2 * (std::pow)(mach, 2)); }
+};
+
+#include "../../fadec_common/src/Fadec.cpp"
+#include "../../fadec_common/src/ThrustLimitCache.hpp"
+#include "../../../../../fbw-a32nx/src/wasm/fadec_a32nx/src/Fadec/ThrustLimits_A32NX.hpp"
+#include "../../../../../fbw-a380x/src/wasm/fadec_a380x/src/Fadec/ThrustLimits_A380X.hpp"
+
+// maximum allowed difference to limitN1 in % N1
+constexpr double MAX_ERROR = 0.1;
+
+struct Inputs {
+  double altitude;
+  double ambientTemp;
+  double ambientPressure;
+  double flexTemp;
+  int    packs;
+  int    nacelle;
+  int    wing;
+};
+
+// the thrust limits as requested by EngineControl every frame
+template <typename Limit>
+static double frameLimits(Limit&& limitN1, const Inputs& in) {
+  const double altitude = (std::min)(16600.0, in.altitude);
+  double       sum      = 0;
+  sum += limitN1(0, altitude, in.ambientTemp, in.ambientPressure, 0, in.packs, in.nacelle, in.wing);
+  sum += limitN1(1, altitude, in.ambientTemp, in.ambientPressure, 0, in.packs, in.nacelle, in.wing);
+  sum += limitN1(0, altitude, in.ambientTemp, in.ambientPressure, in.flexTemp, in.packs, in.nacelle, in.wing);
+  sum += limitN1(1, altitude, in.ambientTemp, in.ambientPressure, in.flexTemp, in.packs, in.nacelle, in.wing);
+  sum += limitN1(2, in.altitude, in.ambientTemp, in.ambientPressure, 0, in.packs, in.nacelle, in.wing);
+  sum += limitN1(3, in.altitude, in.ambientTemp, in.ambientPressure, 0, in.packs, in.nacelle, in.wing);
+  return sum;
+}
+
+template <typename ThrustLimits>
+static bool validate(const std::string& name, int inputs, int frames, bool verbose) {
+  ThrustLimitCache<ThrustLimits> cache;
+  auto                           start = std::chrono::high_resolution_clock::now();
+  cache.initialize();
+  const auto initTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - start);
+
+  std::mt19937                     gen(42);
+  std::uniform_real_distribution<> unit(0.0, 1.0);
+  bool                             passed   = true;
+  double                           maxError = 0;
+
+  auto check = [&](const char* what, int type, const Inputs& in, double value, double expected) {
+    const double error = std::abs(value - expected);
+    maxError           = (std::max)(maxError, error);
+    if (error > MAX_ERROR) {
+      std::cout << "FAILED: " << name << " " << what << " type " << type << " at " << in.altitude << "ft " << in.ambientTemp << "C "
+                << in.ambientPressure << "hPa flex " << in.flexTemp << " bleed " << in.packs << in.nacelle << in.wing << ": " << value
+                << ", expected " << expected << std::endl;
+      passed = false;
+    }
+  };
+
+  // Random inputs over the envelope, each limit is requested once so the grids are used
+  for (int i = 0; i < inputs && passed; ++i) {
+    const int type = i % 4;
+    Inputs    in{};
+    in.altitude        = -2000 + (type <= 1 ? 18600 : 45000) * unit(gen);
+    in.ambientTemp     = -75 + 130 * unit(gen);
+    in.ambientPressure = ThrustLimitCache<ThrustLimits>::isaPressure(in.altitude) + (unit(gen) - 0.5);
+    in.flexTemp        = unit(gen) < 0.25 ? 80 * unit(gen) : 0;
+    in.packs           = unit(gen) < 0.5;
+    in.nacelle         = unit(gen) < 0.3;
+    in.wing            = unit(gen) < 0.3;
+    const double value = cache.limitN1(type, in.altitude, in.ambientTemp, in.ambientPressure, in.flexTemp, in.packs, in.nacelle, in.wing);
+    check("envelope", type, in, value,
+          ThrustLimits::limitN1(type, in.altitude, in.ambientTemp, in.ambientPressure, in.flexTemp, in.packs, in.nacelle, in.wing));
+  }
+
+  // A climb from sea level to 39000ft at 2000ft/min with 60 frames per second, refreshing within the tolerances
+  std::vector<Inputs> climb(frames);
+  for (int i = 0; i < frames; ++i) {
+    Inputs& in         = climb[i];
+    in.altitude        = 39000.0 * i / frames;
+    in.ambientTemp     = 20 - 1.98 * in.altitude / 1000 + 0.002 * std::sin(i * 0.1);
+    in.ambientPressure = ThrustLimitCache<ThrustLimits>::isaPressure(in.altitude);
+    in.flexTemp        = in.altitude < 1500 ? 55 : 0;
+    in.packs           = 1;
+    in.nacelle         = in.altitude > 20000 && in.altitude < 25000;
+    in.wing            = 0;
+  }
+  // limitN1 itself jumps where the bleed de-rating switches (8000ft, corner point, flex above the limit point), a
+  // cached limit may lag behind such a jump until the inputs move beyond the refresh tolerances
+  const double tolerance = ThrustLimitCache<ThrustLimits>::ALTITUDE_TOLERANCE;
+  int          lagging   = 0;
+  for (const Inputs& in : climb) {
+    if (!passed) {
+      break;
+    }
+    for (int type = 0; type < 4; ++type) {
+      const double altitude = type <= 1 ? (std::min)(16600.0, in.altitude) : in.altitude;
+      const double flexTemp = type <= 1 ? in.flexTemp : 0;
+      auto         direct   = [&](double alt) {
+        return ThrustLimits::limitN1(type, alt, in.ambientTemp, in.ambientPressure, flexTemp, in.packs, in.nacelle, in.wing);
+      };
+      const double value    = cache.limitN1(type, altitude, in.ambientTemp, in.ambientPressure, flexTemp, in.packs, in.nacelle, in.wing);
+      const double expected = direct(altitude);
+      const double jump     = std::abs(direct(altitude - tolerance) - direct(altitude + tolerance));
+      if (std::abs(value - expected) > MAX_ERROR && std::abs(value - expected) <= jump + MAX_ERROR) {
+        ++lagging;
+        continue;
+      }
+      check("climb", type, in, value, expected);
+    }
+  }
+  std::cout << name << ": maximum difference " << maxError << " % N1 (" << lagging << " limits lagging behind a jump of limitN1)"
+            << ", grids initialized in " << initTime.count() << " us" << std::endl;
+
+  // Timing of all limits per frame during the climb
+  volatile double sink = 0;
+  start                = std::chrono::high_resolution_clock::now();
+  for (const Inputs& in : climb) {
+    sink = sink + frameLimits(ThrustLimits::limitN1, in);
+  }
+  const auto directTime = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now() - start);
+
+  cache.initialize();
+  start = std::chrono::high_resolution_clock::now();
+  for (const Inputs& in : climb) {
+    sink = sink + frameLimits([&](auto... args) { return cache.limitN1(args...); }, in);
+  }
+  const auto cacheTime = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now() - start);
+
+  std::cout << name << ": limitN1 " << directTime.count() / frames << " ns per frame, ThrustLimitCache " << cacheTime.count() / frames
+            << " ns per frame" << std::endl;
+  if (verbose) {
+    std::cout << name << ": " << frames << " frames, checksum " << sink << std::endl;
+  }
+  return passed;
+}
+
+int main(int argc, char* argv[]) {
+  // Parse arguments
+  bool verbose = false;
+  for (int i = 1; i < argc; ++i) {
+    if (std::strcmp(argv[i], "verbose") == 0) {
+      verbose = true;
+    }
+  }
+
+  const int inputs = 200000;
+  const int frames = 60 * 60 * 39000 / 2000;
+
+  bool passed = validate<ThrustLimits_A32NX>("A32NX", inputs, frames, verbose);
+  passed      = validate<ThrustLimits_A380X>("A380X", inputs, frames, verbose) && passed;
+
+  if (passed) {
+    std::cout << "All results within " << MAX_ERROR << " % N1 of limitN1" << std::endl;
+    return 0;
+  }
+  return 1;
+}
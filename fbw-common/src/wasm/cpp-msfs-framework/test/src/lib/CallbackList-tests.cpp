@@ -0,0 +1,137 @@
+// Copyright (c) 2024 FlyByWire Simulations
+// SPDX-License-Identifier: GPL-3.0
+
+#include <vector>
+
+#include "CallbackList.hpp"
+#include "gtest/gtest.h"
+
+TEST(CallbackList, CallsCallbacksInTheOrderOfRegistration) {
+  CallbackList     callbacks;
+  std::vector<int> calls;
+  callbacks.add([&]() { calls.push_back(1); });
+  callbacks.add([&]() { calls.push_back(2); });
+  callbacks.add([&]() { calls.push_back(3); });
+  callbacks.notify();
+  EXPECT_EQ(calls, (std::vector<int>{1, 2, 3}));
+}
+
+TEST(CallbackList, OnlyCallsCallbacksSharingABitWithTheMask) {
+  CallbackList     callbacks;
+  std::vector<int> calls;
+  callbacks.add([&]() { calls.push_back(1); }, 0b01);
+  callbacks.add([&]() { calls.push_back(2); }, 0b10);
+  callbacks.add([&]() { calls.push_back(3); }, 0b11);
+  callbacks.notify(0b10);
+  EXPECT_EQ(calls, (std::vector<int>{2, 3}));
+  calls.clear();
+  callbacks.notify(0);
+  EXPECT_TRUE(calls.empty());
+}
+
+TEST(CallbackList, RemovedCallbacksAreNotCalled) {
+  CallbackList     callbacks;
+  std::vector<int> calls;
+  callbacks.add([&]() { calls.push_back(1); });
+  const auto id = callbacks.add([&]() { calls.push_back(2); });
+  callbacks.add([&]() { calls.push_back(3); });
+  EXPECT_TRUE(callbacks.remove(id));
+  EXPECT_FALSE(callbacks.remove(id));
+  EXPECT_EQ(callbacks.size(), 2u);
+  callbacks.notify();
+  EXPECT_EQ(calls, (std::vector<int>{1, 3}));
+}
+
+TEST(CallbackList, IdsAreUnique) {
+  CallbackList callbacks;
+  const auto   first = callbacks.add([]() {});
+  callbacks.remove(first);
+  const auto second = callbacks.add([]() {});
+  EXPECT_NE(first, second);
+  EXPECT_FALSE(callbacks.empty());
+}
+
+TEST(CallbackList, CallbackRemovingItselfDoesNotSkipTheNext) {
+  CallbackList     callbacks;
+  std::vector<int> calls;
+  CallbackList::ID id = 0;
+  id                  = callbacks.add([&]() {
+    calls.push_back(1);
+    callbacks.remove(id);
+  });
+  callbacks.add([&]() { calls.push_back(2); });
+  callbacks.add([&]() { calls.push_back(3); });
+  callbacks.notify();
+  EXPECT_EQ(calls, (std::vector<int>{1, 2, 3}));
+  EXPECT_EQ(callbacks.size(), 2u);
+  calls.clear();
+  callbacks.notify();
+  EXPECT_EQ(calls, (std::vector<int>{2, 3}));
+}
+
+TEST(CallbackList, CallbackRemovedDuringNotificationIsNotCalled) {
+  CallbackList     callbacks;
+  std::vector<int> calls;
+  CallbackList::ID later = 0;
+  callbacks.add([&]() {
+    calls.push_back(1);
+    EXPECT_TRUE(callbacks.remove(later));
+    EXPECT_FALSE(callbacks.remove(later));
+  });
+  later = callbacks.add([&]() { calls.push_back(2); });
+  callbacks.add([&]() { calls.push_back(3); });
+  callbacks.notify();
+  EXPECT_EQ(calls, (std::vector<int>{1, 3}));
+  EXPECT_EQ(callbacks.size(), 2u);
+}
+
+TEST(CallbackList, CallbackAddedDuringNotificationIsCalledFromTheNextNotification) {
+  CallbackList     callbacks;
+  std::vector<int> calls;
+  bool             added = false;
+  callbacks.add([&]() {
+    calls.push_back(1);
+    if (!added) {
+      added = true;
+      callbacks.add([&]() { calls.push_back(2); });
+    }
+  });
+  callbacks.notify();
+  EXPECT_EQ(calls, (std::vector<int>{1}));
+  EXPECT_EQ(callbacks.size(), 2u);
+  calls.clear();
+  callbacks.notify();
+  EXPECT_EQ(calls, (std::vector<int>{1, 2}));
+}
+
+TEST(CallbackList, CallbackAddedAndRemovedDuringNotificationIsNeverCalled) {
+  CallbackList     callbacks;
+  std::vector<int> calls;
+  callbacks.add([&]() {
+    calls.push_back(1);
+    const auto id = callbacks.add([&]() { calls.push_back(2); });
+    EXPECT_TRUE(callbacks.remove(id));
+  });
+  callbacks.notify();
+  callbacks.notify();
+  EXPECT_EQ(calls, (std::vector<int>{1, 1}));
+  EXPECT_EQ(callbacks.size(), 1u);
+}
+
+TEST(CallbackList, NestedNotificationsKeepRemovedCallbacksUntilTheOutermostEnds) {
+  CallbackList     callbacks;
+  std::vector<int> calls;
+  CallbackList::ID second = 0;
+  int              depth  = 0;
+  callbacks.add([&]() {
+    calls.push_back(1);
+    if (depth++ == 0) {
+      callbacks.remove(second);
+      callbacks.notify();
+    }
+  });
+  second = callbacks.add([&]() { calls.push_back(2); });
+  callbacks.notify();
+  EXPECT_EQ(calls, (std::vector<int>{1, 1}));
+  EXPECT_EQ(callbacks.size(), 1u);
+}
@@ -0,0 +1,95 @@
+// Copyright (c) 2024 FlyByWire Simulations
+// SPDX-License-Identifier: GPL-3.0
+
+#include <vector>
+
+#include "CallbackList.hpp"
+#include "DeferredNotificationQueue.hpp"
+#include "gtest/gtest.h"
+
+struct TestObject {
+  int          id;
+  bool         queued = false;
+  CallbackList callbacks{};
+};
+
+using TestQueue = DeferredNotificationQueue<TestObject, &TestObject::queued>;
+
+class DeferredNotificationQueueTest : public ::testing::Test {
+ protected:
+  TestQueue        queue;
+  TestObject       first{1};
+  TestObject       second{2};
+  std::vector<int> notified;
+
+  std::size_t dispatch() {
+    return queue.dispatch([this](TestObject* object) {
+      notified.push_back(object->id);
+      object->callbacks.notify();
+    });
+  }
+};
+
+TEST_F(DeferredNotificationQueueTest, ChangesAreCoalescedUntilTheNextDispatch) {
+  EXPECT_TRUE(queue.push(&first));
+  EXPECT_TRUE(queue.push(&second));
+  EXPECT_FALSE(queue.push(&first));
+  EXPECT_FALSE(queue.push(&second));
+  EXPECT_FALSE(queue.push(&first));
+  EXPECT_EQ(queue.size(), 2u);
+
+  EXPECT_EQ(dispatch(), 2u);
+  EXPECT_EQ(notified, (std::vector<int>{1, 2}));
+  EXPECT_EQ(queue.size(), 0u);
+  EXPECT_FALSE(first.queued);
+
+  // a change after the dispatch is queued again
+  notified.clear();
+  EXPECT_TRUE(queue.push(&second));
+  EXPECT_EQ(dispatch(), 1u);
+  EXPECT_EQ(notified, (std::vector<int>{2}));
+  EXPECT_EQ(dispatch(), 0u);
+}
+
+TEST_F(DeferredNotificationQueueTest, ObjectsQueuedWhileDispatchingAreDispatchedNextTime) {
+  first.callbacks.add([this]() {
+    queue.push(&first);
+    queue.push(&second);
+  });
+  queue.push(&first);
+  EXPECT_EQ(dispatch(), 1u);
+  EXPECT_EQ(notified, (std::vector<int>{1}));
+  EXPECT_EQ(queue.size(), 2u);
+
+  notified.clear();
+  first.callbacks.notify();  // coalesced with the queued notifications
+  EXPECT_EQ(queue.size(), 2u);
+  EXPECT_EQ(dispatch(), 2u);
+  EXPECT_EQ(notified, (std::vector<int>{1, 2}));
+}
+
+TEST_F(DeferredNotificationQueueTest, RemovedObjectsAreNotDispatched) {
+  first.callbacks.add([this]() { queue.remove(&second); });
+  queue.push(&first);
+  queue.push(&second);
+  EXPECT_EQ(dispatch(), 1u);
+  EXPECT_EQ(notified, (std::vector<int>{1}));
+  EXPECT_FALSE(second.queued);
+  EXPECT_EQ(queue.size(), 0u);
+}
+
+TEST_F(DeferredNotificationQueueTest, CallbackRemovingItselfDuringDispatchDoesNotSkipTheNext) {
+  int              calls = 0;
+  CallbackList::ID id    = 0;
+  id                     = first.callbacks.add([&]() {
+    calls++;
+    first.callbacks.remove(id);
+  });
+  first.callbacks.add([&]() { calls += 10; });
+  queue.push(&first);
+  dispatch();
+  EXPECT_EQ(calls, 11);
+  queue.push(&first);
+  dispatch();
+  EXPECT_EQ(calls, 21);
+}
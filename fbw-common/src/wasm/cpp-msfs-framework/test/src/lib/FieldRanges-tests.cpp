@@ -0,0 +1,100 @@
+// Copyright (c) 2024 FlyByWire Simulations
+// SPDX-License-Identifier: GPL-3.0
+
+#include <cstdint>
+
+#include "CallbackList.hpp"
+#include "FieldRanges.hpp"
+#include "gtest/gtest.h"
+
+#pragma pack(push, 1)
+struct TestData {
+  double       first;
+  std::int32_t second;
+  std::int64_t third;
+  char         text[6];
+};
+#pragma pack(pop)
+
+class FieldRangesTest : public ::testing::Test {
+ protected:
+  FieldRanges ranges{sizeof(TestData)};
+  TestData    current{1.0, 2, 3, "abc"};
+  TestData    received = current;
+
+  void SetUp() override {
+    ranges.add(sizeof(double));
+    ranges.add(sizeof(std::int32_t));
+    ranges.add(sizeof(std::int64_t));
+    ranges.add(0);
+  }
+};
+
+TEST_F(FieldRangesTest, EqualDataHasNoChangedFields) {
+  EXPECT_EQ(ranges.compare(&received, &current), 0u);
+}
+
+TEST_F(FieldRangesTest, ChangedFieldsSetTheirBit) {
+  received.second = 5;
+  EXPECT_EQ(ranges.compare(&received, &current), FieldRanges::fieldBit(1));
+  received.third = 7;
+  EXPECT_EQ(ranges.compare(&received, &current), FieldRanges::fieldBit(1) | FieldRanges::fieldBit(2));
+}
+
+TEST_F(FieldRangesTest, FieldOfUnknownSizeExtendsToTheEndOfTheStruct) {
+  received.text[5] = 'x';
+  EXPECT_EQ(ranges.compare(&received, &current), FieldRanges::fieldBit(3));
+  EXPECT_EQ(ranges.size(), 4u);
+  EXPECT_GT(ranges.declaredSize(), sizeof(TestData));
+}
+
+TEST_F(FieldRangesTest, FieldCallbacksAreOnlyCalledForTheirFields) {
+  CallbackList callbacks;
+  int          firstCalls         = 0;
+  int          secondOrThirdCalls = 0;
+  int          allCalls           = 0;
+  callbacks.add([&]() { firstCalls++; }, FieldRanges::fieldBit(0));
+  callbacks.add([&]() { secondOrThirdCalls++; }, FieldRanges::fieldBit(1) | FieldRanges::fieldBit(2));
+  callbacks.add([&]() { allCalls++; });
+
+  received.third = 9;
+  callbacks.notify(ranges.compare(&received, &current));
+  EXPECT_EQ(firstCalls, 0);
+  EXPECT_EQ(secondOrThirdCalls, 1);
+  EXPECT_EQ(allCalls, 1);
+
+  // no change -> no callbacks
+  current = received;
+  callbacks.notify(ranges.compare(&received, &current));
+  EXPECT_EQ(firstCalls, 0);
+  EXPECT_EQ(secondOrThirdCalls, 1);
+  EXPECT_EQ(allCalls, 1);
+
+  received.first = 2.0;
+  callbacks.notify(ranges.compare(&received, &current));
+  EXPECT_EQ(firstCalls, 1);
+  EXPECT_EQ(secondOrThirdCalls, 1);
+  EXPECT_EQ(allCalls, 2);
+}
+
+TEST(FieldRanges, FieldsBeyondTheStructAreClipped) {
+  std::int32_t current  = 1;
+  std::int32_t received = 2;
+  FieldRanges  ranges{sizeof(std::int32_t)};
+  ranges.add(sizeof(double));
+  ranges.add(sizeof(double));
+  EXPECT_EQ(ranges.compare(&received, &current), FieldRanges::fieldBit(0));
+  EXPECT_EQ(ranges.declaredSize(), 2 * sizeof(double));
+}
+
+TEST(FieldRanges, FieldsBeyondTheLastBitShareIt) {
+  unsigned char current[70]{};
+  unsigned char received[70]{};
+  FieldRanges   ranges{sizeof(current)};
+  for (int i = 0; i < 70; i++) {
+    ranges.add(1);
+  }
+  received[68] = 1;
+  EXPECT_EQ(ranges.compare(received, current), FieldRanges::fieldBit(63));
+  EXPECT_EQ(FieldRanges::fieldBit(63), FieldRanges::fieldBit(69));
+}
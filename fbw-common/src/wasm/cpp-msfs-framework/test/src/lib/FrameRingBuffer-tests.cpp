@@ -0,0 +1,108 @@
+// Copyright (c) 2024 FlyByWire Simulations
+// SPDX-License-Identifier: GPL-3.0
+
+#include <gtest/gtest.h>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include "FrameRingBuffer.h"
+
+namespace {
+// fills the next frame with the given character and commits it
+bool pushFrame(FrameRingBuffer& buffer, char c) {
+  char* frame = buffer.acquireFrame();
+  if (frame == nullptr) {
+    return false;
+  }
+  std::memset(frame, c, buffer.getFrameSize());
+  buffer.commitFrame();
+  return true;
+}
+}  // namespace
+
+TEST(FrameRingBufferTest, FramesAreDrainedInOrder) {
+  FrameRingBuffer buffer;
+  buffer.initialize(4, 3);
+  ASSERT_TRUE(buffer.isEmpty());
+  ASSERT_EQ(buffer.getCapacity(), 12);
+  ASSERT_TRUE(pushFrame(buffer, 'a'));
+  ASSERT_TRUE(pushFrame(buffer, 'b'));
+  ASSERT_EQ(buffer.getBufferedBytes(), 8);
+
+  std::ostringstream stream;
+  ASSERT_EQ(buffer.drainAll(stream), 8);
+  ASSERT_EQ(stream.str(), "aaaabbbb");
+  ASSERT_TRUE(buffer.isEmpty());
+}
+
+TEST(FrameRingBufferTest, UncommittedFramesAreNotDrained) {
+  FrameRingBuffer buffer;
+  buffer.initialize(4, 3);
+  std::memset(buffer.acquireFrame(), 'a', 4);
+  std::ostringstream stream;
+  ASSERT_EQ(buffer.drainAll(stream), 0);
+  buffer.commitFrame();
+  buffer.commitFrame();
+  ASSERT_EQ(buffer.getBufferedBytes(), 4);
+}
+
+TEST(FrameRingBufferTest, FullBufferRejectsFrames) {
+  FrameRingBuffer buffer;
+  buffer.initialize(4, 2);
+  ASSERT_TRUE(pushFrame(buffer, 'a'));
+  ASSERT_TRUE(pushFrame(buffer, 'b'));
+  ASSERT_TRUE(buffer.isFull());
+  ASSERT_EQ(buffer.acquireFrame(), nullptr);
+
+  // a partial drain does not free a complete slot yet
+  std::ostringstream stream;
+  ASSERT_EQ(buffer.drain(stream, 3), 3);
+  ASSERT_TRUE(buffer.isFull());
+  ASSERT_EQ(buffer.drain(stream, 1), 1);
+  ASSERT_FALSE(buffer.isFull());
+  ASSERT_TRUE(pushFrame(buffer, 'c'));
+  ASSERT_EQ(buffer.drainAll(stream), 8);
+  ASSERT_EQ(stream.str(), "aaaabbbbcccc");
+}
+
+TEST(FrameRingBufferTest, SlicesWrapAroundTheEndOfTheStorage) {
+  FrameRingBuffer buffer;
+  buffer.initialize(4, 3);
+  std::ostringstream stream;
+  std::string        expected;
+  // drain in slices that are not frame aligned so that the read position crosses the end of the storage,
+  // the slices are smaller than a frame so the buffer runs full now and then
+  for (char c = 'a'; c <= 'z'; c++) {
+    if (!pushFrame(buffer, c)) {
+      ASSERT_TRUE(buffer.isFull());
+      buffer.drain(stream, 5);
+      ASSERT_TRUE(pushFrame(buffer, c));
+    }
+    expected += std::string(4, c);
+    buffer.drain(stream, 3);
+  }
+  ASSERT_LE(buffer.getBufferedBytes(), buffer.getCapacity());
+  buffer.drainAll(stream);
+  ASSERT_EQ(stream.str(), expected);
+  ASSERT_TRUE(buffer.isEmpty());
+}
+
+TEST(FrameRingBufferTest, ClearDiscardsBufferedFrames) {
+  FrameRingBuffer buffer;
+  buffer.initialize(4, 2);
+  ASSERT_TRUE(pushFrame(buffer, 'a'));
+  ASSERT_TRUE(pushFrame(buffer, 'b'));
+  buffer.clear();
+  ASSERT_TRUE(buffer.isEmpty());
+  ASSERT_TRUE(pushFrame(buffer, 'c'));
+  std::ostringstream stream;
+  buffer.drainAll(stream);
+  ASSERT_EQ(stream.str(), "cccc");
+}
+
+TEST(FrameRingBufferTest, UninitializedBufferHasNoFrames) {
+  FrameRingBuffer buffer;
+  ASSERT_EQ(buffer.acquireFrame(), nullptr);
+  buffer.initialize(4, 0);
+  ASSERT_EQ(buffer.getCapacity(), 4);
+}
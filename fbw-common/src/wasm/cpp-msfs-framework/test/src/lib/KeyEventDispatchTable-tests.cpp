@@ -0,0 +1,174 @@
+// Copyright (c) 2024 FlyByWire Simulations
+// SPDX-License-Identifier: GPL-3.0
+
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <functional>
+#include <vector>
+#include "KeyEventDispatchTable.hpp"
+
+namespace {
+using Function = std::function<void(std::uint32_t, std::uint32_t, std::uint32_t, std::uint32_t, std::uint32_t)>;
+using Table    = KeyEventDispatchTable<Function>;
+
+// key event IDs in the range of the KEY_ defines in gauges.h
+constexpr Table::EventId AXIS_ELEVATOR = 0x10000 + 510;
+constexpr Table::EventId AXIS_AILERONS = 0x10000 + 511;
+constexpr Table::EventId BEACON_LIGHTS = 0x10000 + 100;
+
+// returns a callback which records its first parameter
+Function record(std::vector<std::uint32_t>& values) {
+  return [&values](std::uint32_t data0, std::uint32_t, std::uint32_t, std::uint32_t, std::uint32_t) { values.push_back(data0); };
+}
+}  // namespace
+
+TEST(KeyEventDispatchTableTest, CallbacksAreCalledInOrderOfAdding) {
+  Table            table;
+  std::vector<int> calls;
+  table.add(AXIS_ELEVATOR, 0, [&](auto...) { calls.push_back(0); });
+  table.add(AXIS_ELEVATOR, 1, [&](auto...) { calls.push_back(1); });
+  table.add(AXIS_AILERONS, 2, [&](auto...) { calls.push_back(2); });
+  ASSERT_TRUE(table.process(AXIS_ELEVATOR, 0, 0, 0, 0, 0));
+  ASSERT_EQ(calls, std::vector<int>({0, 1}));
+  ASSERT_EQ(table.size(AXIS_ELEVATOR), 2);
+  ASSERT_EQ(table.size(AXIS_AILERONS), 1);
+}
+
+TEST(KeyEventDispatchTableTest, ParametersArePassed) {
+  Table                      table;
+  std::vector<std::uint32_t> params;
+  table.add(AXIS_ELEVATOR, 0, [&](std::uint32_t d0, std::uint32_t d1, std::uint32_t d2, std::uint32_t d3, std::uint32_t d4) {
+    params = {d0, d1, d2, d3, d4};
+  });
+  table.process(AXIS_ELEVATOR, 1, 2, 3, 4, 5);
+  ASSERT_EQ(params, std::vector<std::uint32_t>({1, 2, 3, 4, 5}));
+}
+
+TEST(KeyEventDispatchTableTest, UnknownKeyEventsAreIgnored) {
+  Table                      table;
+  std::vector<std::uint32_t> values;
+  table.add(AXIS_ELEVATOR, 0, record(values));
+  ASSERT_FALSE(table.process(AXIS_ELEVATOR - 1, 1, 0, 0, 0, 0));
+  ASSERT_FALSE(table.process(AXIS_ELEVATOR + 1, 1, 0, 0, 0, 0));
+  ASSERT_FALSE(table.process(-1, 1, 0, 0, 0, 0));
+  ASSERT_TRUE(values.empty());
+}
+
+TEST(KeyEventDispatchTableTest, LowerAndDistantKeyEventIds) {
+  Table                      table;
+  std::vector<std::uint32_t> values;
+  table.add(AXIS_ELEVATOR, 0, record(values));
+  table.add(BEACON_LIGHTS, 1, record(values));
+  table.add(0x7FFF0000, 2, record(values));
+  table.add(1, 3, record(values));
+  table.process(AXIS_ELEVATOR, 1, 0, 0, 0, 0);
+  table.process(BEACON_LIGHTS, 2, 0, 0, 0, 0);
+  table.process(0x7FFF0000, 3, 0, 0, 0, 0);
+  table.process(1, 4, 0, 0, 0, 0);
+  ASSERT_EQ(values, std::vector<std::uint32_t>({1, 2, 3, 4}));
+}
+
+TEST(KeyEventDispatchTableTest, RemoveCallback) {
+  Table                      table;
+  std::vector<std::uint32_t> first;
+  std::vector<std::uint32_t> second;
+  table.add(AXIS_ELEVATOR, 0, record(first));
+  table.add(AXIS_ELEVATOR, 1, record(second));
+  ASSERT_TRUE(table.remove(AXIS_ELEVATOR, 0));
+  ASSERT_FALSE(table.remove(AXIS_ELEVATOR, 0));
+  ASSERT_FALSE(table.remove(AXIS_AILERONS, 1));
+  table.process(AXIS_ELEVATOR, 1, 0, 0, 0, 0);
+  ASSERT_TRUE(first.empty());
+  ASSERT_EQ(second, std::vector<std::uint32_t>({1}));
+  ASSERT_EQ(table.size(AXIS_ELEVATOR), 1);
+}
+
+TEST(KeyEventDispatchTableTest, CallbacksChangedWhileCalled) {
+  Table                      table;
+  std::vector<std::uint32_t> values;
+  table.add(AXIS_ELEVATOR, 0, [&](auto...) {
+    table.remove(AXIS_ELEVATOR, 0);
+    table.remove(AXIS_ELEVATOR, 1);
+    table.add(AXIS_ELEVATOR, 2, record(values));
+  });
+  table.add(AXIS_ELEVATOR, 1, record(values));
+  table.process(AXIS_ELEVATOR, 1, 0, 0, 0, 0);
+  ASSERT_TRUE(values.empty());
+  ASSERT_EQ(table.size(AXIS_ELEVATOR), 1);
+  table.process(AXIS_ELEVATOR, 2, 0, 0, 0, 0);
+  ASSERT_EQ(values, std::vector<std::uint32_t>({2}));
+}
+
+TEST(KeyEventDispatchTableTest, CoalescedKeyEventsAreDispatchedOnceWithLatestParameters) {
+  Table                      table;
+  std::vector<std::uint32_t> elevator;
+  std::vector<std::uint32_t> ailerons;
+  std::vector<std::uint32_t> beacon;
+  table.add(AXIS_ELEVATOR, 0, record(elevator));
+  table.add(AXIS_AILERONS, 1, record(ailerons));
+  table.add(BEACON_LIGHTS, 2, record(beacon));
+  table.setCoalescing(AXIS_ELEVATOR, true);
+  table.setCoalescing(AXIS_AILERONS, true);
+  ASSERT_TRUE(table.isCoalescing(AXIS_ELEVATOR));
+  ASSERT_FALSE(table.isCoalescing(BEACON_LIGHTS));
+
+  for (std::uint32_t i = 1; i <= 100; i++) {
+    table.process(AXIS_ELEVATOR, i, 0, 0, 0, 0);
+    table.process(AXIS_AILERONS, 1000 + i, 0, 0, 0, 0);
+  }
+  table.process(BEACON_LIGHTS, 1, 0, 0, 0, 0);
+  ASSERT_TRUE(elevator.empty());
+  ASSERT_EQ(beacon, std::vector<std::uint32_t>({1}));
+  ASSERT_EQ(table.pendingCount(), 2);
+
+  ASSERT_EQ(table.dispatchCoalesced(), 2);
+  ASSERT_EQ(elevator, std::vector<std::uint32_t>({100}));
+  ASSERT_EQ(ailerons, std::vector<std::uint32_t>({1100}));
+  ASSERT_EQ(table.dispatchCoalesced(), 0);
+  ASSERT_EQ(elevator.size(), 1);
+}
+
+TEST(KeyEventDispatchTableTest, KeyEventsCoalescedWhileDispatchingWaitForNextDispatch) {
+  Table                      table;
+  std::vector<std::uint32_t> values;
+  table.setCoalescing(AXIS_ELEVATOR, true);
+  table.add(AXIS_ELEVATOR, 0, [&](std::uint32_t data0, auto...) {
+    values.push_back(data0);
+    if (data0 < 3) {
+      table.process(AXIS_ELEVATOR, data0 + 1, 0, 0, 0, 0);
+    }
+  });
+  table.process(AXIS_ELEVATOR, 1, 0, 0, 0, 0);
+  table.dispatchCoalesced();
+  ASSERT_EQ(values, std::vector<std::uint32_t>({1}));
+  table.dispatchCoalesced();
+  table.dispatchCoalesced();
+  table.dispatchCoalesced();
+  ASSERT_EQ(values, std::vector<std::uint32_t>({1, 2, 3}));
+}
+
+TEST(KeyEventDispatchTableTest, PendingKeyEventsAreDispatchedAfterCoalescingIsTurnedOff) {
+  Table                      table;
+  std::vector<std::uint32_t> values;
+  table.add(AXIS_ELEVATOR, 0, record(values));
+  table.setCoalescing(AXIS_ELEVATOR, true);
+  table.process(AXIS_ELEVATOR, 1, 0, 0, 0, 0);
+  table.setCoalescing(AXIS_ELEVATOR, false);
+  table.process(AXIS_ELEVATOR, 2, 0, 0, 0, 0);
+  table.dispatchCoalesced();
+  ASSERT_EQ(values, std::vector<std::uint32_t>({2, 1}));
+}
+
+TEST(KeyEventDispatchTableTest, ClearRemovesEverything) {
+  Table                      table;
+  std::vector<std::uint32_t> values;
+  table.add(AXIS_ELEVATOR, 0, record(values));
+  table.setCoalescing(AXIS_ELEVATOR, true);
+  table.process(AXIS_ELEVATOR, 1, 0, 0, 0, 0);
+  table.clear();
+  ASSERT_EQ(table.pendingCount(), 0);
+  ASSERT_EQ(table.size(AXIS_ELEVATOR), 0);
+  ASSERT_FALSE(table.process(AXIS_ELEVATOR, 1, 0, 0, 0, 0));
+  table.dispatchCoalesced();
+  ASSERT_TRUE(values.empty());
+}
@@ -0,0 +1,249 @@
+// Copyright (c) 2024 FlyByWire Simulations
+// SPDX-License-Identifier: GPL-3.0
+
+#define FMT_HEADER_ONLY
+#define LOG_LEVEL 7
+
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "LogBuffer.hpp"
+#include "logging.h"
+
+namespace {
+// drains all records and returns the formatted texts
+std::vector<std::string> drainAll(LogBuffer& buffer) {
+  std::vector<std::string> texts;
+  buffer.drain(1000000, [&](const LogBuffer::Format&, const std::string& text) { texts.push_back(text); });
+  return texts;
+}
+}  // namespace
+
+TEST(LogBufferTest, CapacityIsRoundedToPowerOfTwo) {
+  LogBuffer buffer(1000);
+  ASSERT_EQ(buffer.capacity(), 1024);
+}
+
+TEST(LogBufferTest, RecordsAreFormattedWhenDrained) {
+  LogBuffer           buffer(1024);
+  const std::uint32_t id = buffer.addFormat(DEBUG_LVL, "{} {} {} {:.2f} {:x} {} {}", "file.cpp", 42);
+  const std::string   name{"var"};
+  buffer.record(id, name, -5, std::uint64_t{7}, 1.23456f, 255u, true, 'c');
+  ASSERT_EQ(buffer.size(), 1);
+  ASSERT_EQ(buffer.pending(), 1);
+  ASSERT_EQ(drainAll(buffer), std::vector<std::string>({"var -5 7 1.23 ff true c"}));
+  ASSERT_EQ(buffer.pending(), 0);
+  ASSERT_TRUE(drainAll(buffer).empty());
+}
+
+TEST(LogBufferTest, FixedMessagesAreEscaped) {
+  LogBuffer           buffer(1024);
+  const std::uint32_t id = buffer.addMessage(INFO_LVL, "{not a format}", "file.cpp", 1);
+  buffer.record(id);
+  ASSERT_EQ(buffer.formats()[id].format, "{{not a format}}");
+  ASSERT_EQ(drainAll(buffer), std::vector<std::string>({"{not a format}"}));
+}
+
+TEST(LogBufferTest, StringsAreTruncated) {
+  LogBuffer           buffer(1 << 14);
+  const std::uint32_t id = buffer.addFormat(INFO_LVL, "{}", "file.cpp", 1);
+  buffer.record(id, std::string(5000, 'x'));
+  ASSERT_EQ(drainAll(buffer)[0].size(), LogBuffer::MAX_STRING_SIZE);
+}
+
+TEST(LogBufferTest, DrainIsLimited) {
+  LogBuffer           buffer(1024);
+  const std::uint32_t id = buffer.addFormat(INFO_LVL, "{}", "file.cpp", 1);
+  for (int i = 0; i < 5; i++) {
+    buffer.record(id, i);
+  }
+  std::vector<std::string> texts;
+  ASSERT_EQ(buffer.drain(3, [&](const LogBuffer::Format&, const std::string& text) { texts.push_back(text); }), 3);
+  ASSERT_EQ(buffer.pending(), 2);
+  ASSERT_EQ(drainAll(buffer), std::vector<std::string>({"3", "4"}));
+}
+
+TEST(LogBufferTest, RingOverwritesOldestRecords) {
+  LogBuffer           buffer(256);
+  const std::uint32_t id = buffer.addFormat(INFO_LVL, "{}", "file.cpp", 1);
+  // 25 bytes per record, 10 records fit
+  for (int i = 0; i < 30; i++) {
+    buffer.record(id, i);
+  }
+  ASSERT_EQ(buffer.size(), 10);
+  ASSERT_EQ(buffer.dropped(), 20);
+  const auto texts = drainAll(buffer);
+  ASSERT_EQ(texts.size(), 10);
+  ASSERT_EQ(texts.front(), "20");
+  ASSERT_EQ(texts.back(), "29");
+
+  // drained records are overwritten without being counted as dropped
+  buffer.record(id, 30);
+  ASSERT_EQ(buffer.dropped(), 20);
+  ASSERT_EQ(drainAll(buffer), std::vector<std::string>({"30"}));
+}
+
+TEST(LogBufferTest, RecordsLargerThanTheBufferAreDropped) {
+  LogBuffer           buffer(256);
+  const std::uint32_t id = buffer.addFormat(INFO_LVL, "{}", "file.cpp", 1);
+  ASSERT_FALSE(buffer.record(id, std::string(300, 'x')));
+  ASSERT_EQ(buffer.size(), 0);
+  ASSERT_EQ(buffer.dropped(), 1);
+}
+
+TEST(LogBufferTest, RecordsAboveTheDrainLevelArePassedOver) {
+  LogBuffer           buffer(256);
+  const std::uint32_t info  = buffer.addFormat(INFO_LVL, "info {}", "file.cpp", 1);
+  const std::uint32_t error = buffer.addFormat(ERROR_LVL, "error {}", "file.cpp", 2);
+  buffer.setDrainLevel(WARN_LVL);
+  ASSERT_EQ(buffer.drainLevel(), WARN_LVL);
+
+  buffer.record(info, 1);
+  buffer.record(error, 2);
+  buffer.record(info, 3);
+  ASSERT_EQ(buffer.size(), 3);
+  ASSERT_EQ(buffer.pending(), 1);
+  ASSERT_EQ(drainAll(buffer), std::vector<std::string>({"error 2"}));
+  ASSERT_EQ(buffer.pending(), 0);
+
+  // overwritten records above the drain level are not counted as dropped
+  for (int i = 0; i < 30; i++) {
+    buffer.record(info, i);
+  }
+  ASSERT_EQ(buffer.size(), 10);
+  ASSERT_EQ(buffer.dropped(), 0);
+  ASSERT_TRUE(drainAll(buffer).empty());
+
+  // records passed over are not drained when the drain level is raised
+  buffer.setDrainLevel(LogBuffer::ALL_LEVELS);
+  ASSERT_EQ(buffer.pending(), 0);
+  buffer.record(info, 30);
+  ASSERT_EQ(drainAll(buffer), std::vector<std::string>({"info 30"}));
+}
+
+TEST(LogBufferTest, ResizeDiscardsRecordsAndKeepsFormats) {
+  LogBuffer           buffer(256);
+  const std::uint32_t id = buffer.addFormat(INFO_LVL, "{}", "file.cpp", 1);
+  buffer.record(id, 1);
+  buffer.resize(2000);
+  ASSERT_EQ(buffer.capacity(), 2048);
+  ASSERT_EQ(buffer.size(), 0);
+  ASSERT_EQ(buffer.pending(), 0);
+  ASSERT_EQ(buffer.formats().size(), 1);
+  buffer.record(id, 2);
+  ASSERT_EQ(drainAll(buffer), std::vector<std::string>({"2"}));
+}
+
+TEST(LogBufferTest, WriteDumpWritesFormatsAndRecords) {
+  LogBuffer           buffer(256);
+  const std::uint32_t id = buffer.addFormat(WARN_LVL, "{} {}", "a.cpp", 7);
+  // wrap around the end of the ring
+  for (int i = 0; i < 12; i++) {
+    buffer.record(id, "x", i);
+  }
+
+  std::stringstream stream;
+  ASSERT_TRUE(buffer.writeDump(stream));
+  const std::string dump = stream.str();
+  ASSERT_EQ(dump.substr(0, 4), "FBWL");
+
+  std::uint32_t version;
+  std::uint32_t formats;
+  std::memcpy(&version, dump.data() + 4, sizeof(version));
+  std::memcpy(&formats, dump.data() + 8, sizeof(formats));
+  ASSERT_EQ(version, LogBuffer::DUMP_VERSION);
+  ASSERT_EQ(formats, 1);
+  // level, line, file, format
+  std::size_t offset = 12 + 4 + 4 + 4 + 5 + 4 + 5;
+  ASSERT_EQ(dump.substr(12 + 12, 5), "a.cpp");
+  ASSERT_EQ(dump.substr(12 + 12 + 5 + 4, 5), "{} {}");
+
+  std::uint64_t dropped;
+  std::uint64_t records;
+  std::memcpy(&dropped, dump.data() + offset, sizeof(dropped));
+  std::memcpy(&records, dump.data() + offset + 8, sizeof(records));
+  offset += 16;
+  ASSERT_EQ(records, buffer.size());
+  ASSERT_EQ(dropped, buffer.dropped());
+  // 16 bytes header, 4 bytes string, 9 bytes integer
+  ASSERT_EQ(dump.size(), offset + records * 29);
+
+  std::uint32_t formatId;
+  std::int64_t  last;
+  std::memcpy(&formatId, dump.data() + offset + (records - 1) * 29, sizeof(formatId));
+  std::memcpy(&last, dump.data() + offset + (records - 1) * 29 + 16 + 4 + 1, sizeof(last));
+  ASSERT_EQ(formatId, id);
+  ASSERT_EQ(last, 11);
+}
+
+TEST(LoggerTest, MacrosRegisterEachCallSiteOnce) {
+  logger->setDeferred(true);
+  logger->setDeferredPrintLevel(TRACE_LVL);
+  const std::size_t formats = logger->getBuffer().formats().size();
+
+  const std::string name = "var";
+  for (int i = 0; i < 3; i++) {
+    LOG_INFO("fixed {message}");
+    LOG_DEBUG("runtime " + name);
+    LOG_VERBOSE("{} is {:.1f}", name, i * 0.5);
+  }
+  ASSERT_EQ(logger->getBuffer().formats().size(), formats + 3);
+  testing::internal::CaptureStdout();
+  ASSERT_EQ(logger->flush(), 9);
+  const std::string output = testing::internal::GetCapturedStdout();
+  ASSERT_NE(output.find("info: fixed {message}\n"), std::string::npos);
+  ASSERT_NE(output.find("debug: runtime var\n"), std::string::npos);
+  ASSERT_NE(output.find("verbose: var is 1.0\n"), std::string::npos);
+  logger->setDeferredPrintLevel(Logger::DEFERRED_PRINT_LEVEL);
+  logger->setDeferred(false);
+}
+
+TEST(LoggerTest, DeferredModePrintsAllRecordedLevelsByDefault) {
+  ASSERT_EQ(Logger::DEFERRED_PRINT_LEVEL, std::uint32_t{LOG_LEVEL});
+  logger->setDeferred(true);
+  LOG_TRACE("printed {}", 1);
+  testing::internal::CaptureStdout();
+  ASSERT_EQ(logger->flush(), 1);
+  ASSERT_EQ(testing::internal::GetCapturedStdout(), "trace: printed 1\n");
+  logger->setDeferred(false);
+}
+
+TEST(LoggerTest, DeferredModeOnlyPrintsUpToThePrintLevel) {
+  logger->setDeferred(true);
+  logger->setDeferredPrintLevel(WARN_LVL);
+  const std::size_t records = logger->getBuffer().size();
+  LOG_INFO("recorded only");
+  LOG_WARN("printed {}", 1);
+  ASSERT_EQ(logger->getBuffer().size(), records + 2);
+  testing::internal::CaptureStdout();
+  testing::internal::CaptureStderr();
+  ASSERT_EQ(logger->flush(), 1);
+  ASSERT_EQ(logger->flush(), 0);
+  ASSERT_EQ(testing::internal::GetCapturedStdout(), "");
+  ASSERT_EQ(testing::internal::GetCapturedStderr(), "warn: printed 1\n");
+
+  // messages recorded while deferred are not printed when leaving the deferred mode
+  LOG_DEBUG("recorded only");
+  testing::internal::CaptureStdout();
+  logger->setDeferred(false);
+  ASSERT_EQ(testing::internal::GetCapturedStdout(), "");
+  logger->setDeferredPrintLevel(Logger::DEFERRED_PRINT_LEVEL);
+}
+
+TEST(LoggerTest, SetCapacityResizesTheBuffer) {
+  logger->setCapacity(1 << 12);
+  ASSERT_EQ(logger->getBuffer().capacity(), 1 << 12);
+  ASSERT_EQ(logger->getBuffer().size(), 0);
+  logger->setCapacity(Logger::BUFFER_CAPACITY);
+  ASSERT_EQ(logger->getBuffer().capacity(), Logger::BUFFER_CAPACITY);
+}
+
+TEST(LoggerTest, MessagesArePrintedRightAwayWhenNotDeferred) {
+  logger->setDeferred(false);
+  testing::internal::CaptureStderr();
+  LOG_ERROR("failed for {}", 42);
+  ASSERT_EQ(testing::internal::GetCapturedStderr(), "error: failed for 42\n");
+}
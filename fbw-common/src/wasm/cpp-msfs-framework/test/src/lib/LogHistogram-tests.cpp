@@ -0,0 +1,81 @@
+// Copyright (c) 2024 FlyByWire Simulations
+// SPDX-License-Identifier: GPL-3.0
+
+#include <gtest/gtest.h>
+#include "LogHistogram.hpp"
+
+TEST(LogHistogramTest, EmptyHistogramReturnsZero) {
+  LogHistogram histogram;
+  ASSERT_EQ(histogram.count(), 0);
+  ASSERT_EQ(histogram.percentile(0.5), 0);
+  ASSERT_EQ(histogram.minimum(), 0);
+  ASSERT_EQ(histogram.maximum(), 0);
+  ASSERT_EQ(histogram.average(), 0);
+}
+
+TEST(LogHistogramTest, SmallValuesAreExact) {
+  LogHistogram histogram;
+  for (std::uint64_t i = 0; i < LogHistogram::SUB_BUCKETS; ++i) {
+    ASSERT_EQ(LogHistogram::bucketIndex(i), i);
+    ASSERT_EQ(LogHistogram::bucketLowerBound(i), i);
+  }
+}
+
+TEST(LogHistogramTest, BucketBoundsAreConsistent) {
+  for (std::size_t i = 0; i < LogHistogram::BUCKETS; ++i) {
+    const std::uint64_t lower = LogHistogram::bucketLowerBound(i);
+    ASSERT_EQ(LogHistogram::bucketIndex(lower), i);
+    if (i > 0) {
+      ASSERT_EQ(LogHistogram::bucketIndex(lower - 1), i - 1);
+    }
+  }
+  ASSERT_EQ(LogHistogram::bucketIndex(UINT64_MAX), LogHistogram::BUCKETS - 1);
+}
+
+TEST(LogHistogramTest, SumMinimumMaximumAreExact) {
+  LogHistogram histogram;
+  histogram.record(1000);
+  histogram.record(3);
+  histogram.record(123456);
+  ASSERT_EQ(histogram.count(), 3);
+  ASSERT_EQ(histogram.sum(), 124459);
+  ASSERT_EQ(histogram.average(), 41486);
+  ASSERT_EQ(histogram.minimum(), 3);
+  ASSERT_EQ(histogram.maximum(), 123456);
+}
+
+TEST(LogHistogramTest, PercentileIsWithinRelativeError) {
+  LogHistogram histogram;
+  for (std::uint64_t i = 1; i <= 10000; ++i) {
+    histogram.record(i * 100);
+  }
+  const double tolerance = 0.5 / LogHistogram::SUB_BUCKETS;
+  ASSERT_NEAR(histogram.percentile(0.5), 500000.0, 500000.0 * tolerance);
+  ASSERT_NEAR(histogram.percentile(0.95), 950000.0, 950000.0 * tolerance);
+  ASSERT_NEAR(histogram.percentile(0.99), 990000.0, 990000.0 * tolerance);
+  ASSERT_EQ(histogram.percentile(0.0), 100);
+  ASSERT_EQ(histogram.percentile(1.0), 1000000);
+}
+
+TEST(LogHistogramTest, RemoveUndoesRecord) {
+  LogHistogram histogram;
+  histogram.record(10);
+  histogram.record(20);
+  histogram.record(30000);
+  histogram.remove(30000);
+  ASSERT_EQ(histogram.count(), 2);
+  ASSERT_EQ(histogram.sum(), 30);
+  ASSERT_GE(histogram.percentile(1.0), 20);
+  ASSERT_LT(histogram.percentile(1.0), 24);
+  histogram.remove(12345);  // not recorded
+  ASSERT_EQ(histogram.count(), 2);
+}
+
+TEST(LogHistogramTest, ResetRemovesAllValues) {
+  LogHistogram histogram;
+  histogram.record(10);
+  histogram.reset();
+  ASSERT_EQ(histogram.count(), 0);
+  ASSERT_EQ(histogram.sum(), 0);
+  ASSERT_EQ(histogram.maximum(), 0);
+}
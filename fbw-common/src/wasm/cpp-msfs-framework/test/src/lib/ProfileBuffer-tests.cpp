@@ -2,6 +2,9 @@
 // SPDX-License-Identifier: GPL-3.0
 
 #include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdint>
+#include <vector>
 #include "ProfileBuffer.hpp"
 
 class ProfileBufferTest : public ::testing::Test {};
@@ -75,3 +78,183 @@ TEST(ProfileBufferTest, CapacityReturnsCorrectValue) {
   ProfileBuffer<int> buffer(3);
   ASSERT_EQ(buffer.capacity(), 3);
 }
+
+TEST(ProfileBufferTest, EmptyBufferReturnsZero) {
+  ProfileBuffer<int> buffer(3);
+  ASSERT_EQ(buffer.sum(), 0);
+  ASSERT_EQ(buffer.avg(), 0);
+  ASSERT_EQ(buffer.trimmedAverage(), 0);
+  ASSERT_EQ(buffer.minimum(), 0);
+  ASSERT_EQ(buffer.maximum(), 0);
+}
+
+TEST(ProfileBufferTest, ZeroCapacityIgnoresValues) {
+  ProfileBuffer<int> buffer(0);
+  buffer.push(1);
+  ASSERT_EQ(buffer.size(), 0);
+  ASSERT_EQ(buffer.sum(), 0);
+}
+
+TEST(ProfileBufferTest, SumAndMinimumMaximumFollowSlidingWindow) {
+  ProfileBuffer<int> buffer(3);
+  for (int value : {5, 1, 9, 7, 8, 6}) {
+    buffer.push(value);
+  }
+  // window is 7, 8, 6
+  ASSERT_EQ(buffer.size(), 3);
+  ASSERT_EQ(buffer.sum(), 21);
+  ASSERT_EQ(buffer.minimum(), 6);
+  ASSERT_EQ(buffer.maximum(), 8);
+  buffer.push(1);
+  buffer.push(2);
+  // window is 6, 1, 2
+  ASSERT_EQ(buffer.minimum(), 1);
+  ASSERT_EQ(buffer.maximum(), 6);
+}
+
+TEST(ProfileBufferTest, PercentileMinimumMaximumAverageLowestAndHighestValues) {
+  ProfileBuffer<int> buffer(10);
+  for (int value = 1; value <= 7; ++value) {
+    buffer.push(value);
+  }
+  buffer.push(100);
+  buffer.push(200);
+  buffer.push(400);
+  ASSERT_EQ(buffer.minimum(0.2f), 1);    // (1 + 2) / 2
+  ASSERT_EQ(buffer.maximum(0.2f), 300);  // (200 + 400) / 2
+  ASSERT_EQ(buffer.minimum(0.01f), 1);   // percentile without values returns the minimum
+  ASSERT_EQ(buffer.maximum(0.01f), 400);
+}
+
+TEST(ProfileBufferTest, TrimmedAverageKeepsAtLeastOneValue) {
+  ProfileBuffer<int> buffer(3);
+  buffer.push(1);
+  buffer.push(2);
+  buffer.push(3);
+  ASSERT_EQ(buffer.trimmedAverage(0.9f), 2);
+}
+
+TEST(ProfileBufferTest, DurationValues) {
+  ProfileBuffer<std::chrono::nanoseconds> buffer(4);
+  buffer.push(std::chrono::nanoseconds(1000));
+  buffer.push(std::chrono::nanoseconds(3000));
+  buffer.push(std::chrono::nanoseconds(2000));
+  ASSERT_EQ(buffer.sum().count(), 6000);
+  ASSERT_EQ(buffer.avg().count(), 2000);
+  ASSERT_EQ(buffer.minimum().count(), 1000);
+  ASSERT_EQ(buffer.maximum().count(), 3000);
+  ASSERT_EQ(buffer.trimmedAverage(0.34f).count(), 2000);
+}
+
+TEST(ProfileBufferTest, NegativeAndFloatingPointValues) {
+  ProfileBuffer<double> buffer(4);
+  buffer.push(-2.5);
+  buffer.push(0.5);
+  buffer.push(1.5);
+  buffer.push(4.5);
+  ASSERT_DOUBLE_EQ(buffer.sum(), 4.0);
+  ASSERT_DOUBLE_EQ(buffer.minimum(), -2.5);
+  ASSERT_DOUBLE_EQ(buffer.maximum(), 4.5);
+  ASSERT_DOUBLE_EQ(buffer.maximum(0.25f), 4.5);
+}
+
+TEST(ProfileBufferTest, TrimmedAverageIsCloseToExactForLargeBuffers) {
+  const std::size_t          capacity = 10000;
+  ProfileBuffer<std::int64_t> buffer(capacity);
+  std::vector<std::int64_t>   values;
+  // pseudo random durations between 10us and 2ms with some outliers, more values than the capacity
+  std::uint64_t state = 12345;
+  for (std::size_t i = 0; i < capacity * 3; ++i) {
+    state              = state * 6364136223846793005ULL + 1442695040888963407ULL;
+    std::int64_t value = 10000 + static_cast<std::int64_t>((state >> 33) % 2000000);
+    if (i % 500 == 0) {
+      value *= 50;
+    }
+    buffer.push(value);
+    values.push_back(value);
+  }
+  std::vector<std::int64_t> window(values.end() - capacity, values.end());
+  std::sort(window.begin(), window.end());
+  const std::size_t trimSize = capacity / 20;
+  std::int64_t      expected = 0;
+  for (std::size_t i = trimSize; i < capacity - trimSize; ++i) {
+    expected += window[i];
+  }
+  expected /= static_cast<std::int64_t>(capacity - 2 * trimSize);
+
+  ASSERT_EQ(buffer.minimum(), window.front());
+  ASSERT_EQ(buffer.maximum(), window.back());
+  ASSERT_NEAR(static_cast<double>(buffer.trimmedAverage()), static_cast<double>(expected), expected * 0.005);
+  std::int64_t expectedTop = 0;
+  for (std::size_t i = capacity - trimSize; i < capacity; ++i) {
+    expectedTop += window[i];
+  }
+  expectedTop /= static_cast<std::int64_t>(trimSize);
+  ASSERT_NEAR(static_cast<double>(buffer.maximum(0.05f)), static_cast<double>(expectedTop), expectedTop * 0.01);
+}
+
+TEST(ProfileBufferTest, SubUnitFloatingPointValuesAreBucketedSeparately) {
+  ProfileBuffer<double> buffer(10);
+  for (int i = 1; i <= 10; ++i) {
+    buffer.push(i * 0.1);
+  }
+  // 0.1 ... 1.0, each value has its own bucket so the trimmed values are exact
+  ASSERT_NEAR(buffer.trimmedAverage(0.1f), 0.55, 1e-12);
+  ASSERT_NEAR(buffer.minimum(0.2f), 0.15, 1e-12);
+  ASSERT_NEAR(buffer.maximum(0.2f), 0.95, 1e-12);
+  ASSERT_DOUBLE_EQ(buffer.minimum(), 0.1);
+  ASSERT_DOUBLE_EQ(buffer.maximum(), 1.0);
+}
+
+TEST(ProfileBufferTest, MinimumMaximumFollowSlidingWindowAfterQuery) {
+  ProfileBuffer<int> buffer(3);
+  buffer.push(5);
+  buffer.push(1);
+  buffer.push(9);
+  ASSERT_EQ(buffer.minimum(), 1);
+  ASSERT_EQ(buffer.maximum(), 9);
+  buffer.push(3);  // 5 leaves
+  buffer.push(4);  // 1 leaves
+  ASSERT_EQ(buffer.minimum(), 3);
+  ASSERT_EQ(buffer.maximum(), 9);
+  buffer.push(2);  // 9 leaves
+  ASSERT_EQ(buffer.minimum(), 2);
+  ASSERT_EQ(buffer.maximum(), 4);
+  buffer.push(10);
+  ASSERT_EQ(buffer.maximum(), 10);
+}
+
+TEST(ProfileBufferTest, MinimumMaximumAreExactForLargeSlidingWindows) {
+  const std::size_t  capacity = 500;
+  ProfileBuffer<int> buffer(capacity);
+  std::vector<int>   values;
+  std::uint64_t      state = 42;
+  for (std::size_t i = 0; i < capacity * 4; ++i) {
+    state     = state * 6364136223846793005ULL + 1442695040888963407ULL;
+    int value = static_cast<int>((state >> 33) % 100000);
+    // long monotonic runs push and remove many candidates at once
+    if ((i / 300) % 2 == 1) {
+      value = static_cast<int>(i % 300) * (i % 600 < 300 ? 1 : -1);
+    }
+    buffer.push(value);
+    values.push_back(value);
+    const auto first = values.end() - static_cast<std::ptrdiff_t>(std::min(values.size(), capacity));
+    ASSERT_EQ(buffer.minimum(), *std::min_element(first, values.end()));
+    ASSERT_EQ(buffer.maximum(), *std::max_element(first, values.end()));
+  }
+}
+
+TEST(ProfileBufferTest, FloatingPointSumsDoNotDrift) {
+  ProfileBuffer<double> buffer(4);
+  for (int i = 0; i < 4; ++i) {
+    buffer.push(1e16);
+  }
+  // adding 1.0 to a running sum of about 1e16 is lost to rounding
+  for (int i = 0; i < 4; ++i) {
+    buffer.push(1.0);
+  }
+  ASSERT_DOUBLE_EQ(buffer.sum(), 4.0);
+  ASSERT_DOUBLE_EQ(buffer.avg(), 1.0);
+  ASSERT_DOUBLE_EQ(buffer.trimmedAverage(0.25f), 1.0);
+  ASSERT_DOUBLE_EQ(buffer.maximum(0.5f), 1.0);
+}
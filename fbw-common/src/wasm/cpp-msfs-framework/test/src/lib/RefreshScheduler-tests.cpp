@@ -0,0 +1,272 @@
+// Copyright (c) 2024 FlyByWire Simulations
+// SPDX-License-Identifier: GPL-3.0
+
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <vector>
+#include "DeferredNotificationQueue.hpp"
+#include "RefreshScheduler.hpp"
+
+namespace {
+struct Object {
+  double        maxAgeTime          = 0.0;
+  std::uint64_t maxAgeTicks         = 0;
+  double        nextUpdateTimeStamp = 0.0;
+  std::uint64_t nextUpdateTickStamp = 0;
+  int           reads               = 0;
+
+  double        getNextUpdateTimeStamp() const { return nextUpdateTimeStamp; }
+  std::uint64_t getNextUpdateTickStamp() const { return nextUpdateTickStamp; }
+
+  void read(double timeStamp, std::uint64_t tickCounter) {
+    nextUpdateTimeStamp = timeStamp + maxAgeTime;
+    nextUpdateTickStamp = tickCounter + maxAgeTicks;
+    reads++;
+  }
+};
+
+// runs the scheduler for the given ticks at 1/30s per tick and returns the ticks in which the object was read
+std::vector<std::uint64_t> run(RefreshScheduler<Object>& scheduler, Object& object, std::uint64_t fromTick, std::uint64_t toTick) {
+  std::vector<std::uint64_t> ticks;
+  for (std::uint64_t tick = fromTick; tick <= toTick; tick++) {
+    const double timeStamp = tick / 30.0;
+    scheduler.update(timeStamp, tick, [&](Object* o) {
+      o->read(timeStamp, tick);
+      if (o == &object) {
+        ticks.push_back(tick);
+      }
+    });
+  }
+  return ticks;
+}
+
+// a scheduled variable with a changed flag like the CacheableVariable
+struct Variable : Object {
+  double simValue    = 0.0;
+  double cachedValue = 0.0;
+  bool   changed     = false;
+  bool   queued      = false;
+
+  bool needsUpdateFromSim(double timeStamp, std::uint64_t tickCounter) const {
+    return nextUpdateTimeStamp < timeStamp && nextUpdateTickStamp < tickCounter;
+  }
+
+  void updateFromSim(double timeStamp, std::uint64_t tickCounter) {
+    if (!needsUpdateFromSim(timeStamp, tickCounter)) {
+      changed = false;
+      return;
+    }
+    read(timeStamp, tickCounter);
+    changed     = cachedValue != simValue;
+    cachedValue = simValue;
+  }
+};
+
+using ChangedFlagResetQueue = DeferredNotificationQueue<Variable, &Variable::queued>;
+
+// resets the changed flags and refreshes the due variables as the DataManager's preUpdate()
+void preUpdate(RefreshScheduler<Variable>& scheduler, ChangedFlagResetQueue& resetQueue, std::uint64_t tick) {
+  const double timeStamp = tick / 30.0;
+  resetQueue.dispatch([&](Variable* v) {
+    if (!v->needsUpdateFromSim(timeStamp, tick)) {
+      v->updateFromSim(timeStamp, tick);
+    }
+  });
+  scheduler.update(timeStamp, tick, [&](Variable* v) {
+    v->updateFromSim(timeStamp, tick);
+    resetQueue.push(v);
+  });
+}
+}  // namespace
+
+TEST(RefreshSchedulerTest, AddedObjectIsDueInNextUpdate) {
+  RefreshScheduler<Object> scheduler;
+  Object                   object{0.0, 10};
+  object.nextUpdateTickStamp = 100;
+  scheduler.add(&object, 0);
+  ASSERT_EQ(scheduler.size(), 1);
+  ASSERT_EQ(run(scheduler, object, 1, 1), std::vector<std::uint64_t>({1}));
+}
+
+TEST(RefreshSchedulerTest, MaxAgeTicks) {
+  RefreshScheduler<Object> scheduler;
+  Object                   object{0.0, 3};
+  scheduler.add(&object, 0);
+  ASSERT_EQ(run(scheduler, object, 1, 12), std::vector<std::uint64_t>({1, 5, 9}));
+}
+
+TEST(RefreshSchedulerTest, MaxAgeTime) {
+  RefreshScheduler<Object> scheduler;
+  Object                   object{0.1, 0};
+  scheduler.add(&object, 0);
+  // read at tick 1 (1/30s), next read after 4/30s
+  ASSERT_EQ(run(scheduler, object, 1, 10), std::vector<std::uint64_t>({1, 5, 9}));
+}
+
+TEST(RefreshSchedulerTest, MaxAgeTimeAndTicks) {
+  RefreshScheduler<Object> scheduler;
+  Object                   object{0.05, 4};
+  scheduler.add(&object, 0);
+  ASSERT_EQ(run(scheduler, object, 1, 12), std::vector<std::uint64_t>({1, 6, 11}));
+}
+
+TEST(RefreshSchedulerTest, LongMaxAgeWrapsAroundWheels) {
+  RefreshScheduler<Object> scheduler;
+  Object                   ticks{0.0, 600};
+  Object                   time{20.0, 0};
+  scheduler.add(&ticks, 0);
+  scheduler.add(&time, 1);
+  ASSERT_EQ(run(scheduler, ticks, 1, 1300), std::vector<std::uint64_t>({1, 602, 1203}));
+  ASSERT_EQ(time.reads, 3);  // ticks 1, 602 and 1203
+}
+
+TEST(RefreshSchedulerTest, DueObjectsAreRefreshedInOrder) {
+  RefreshScheduler<Object> scheduler;
+  std::vector<Object>      objects(100, Object{0.0, 1});
+  for (std::size_t i = 0; i < objects.size(); i++) {
+    scheduler.add(&objects[(i * 37) % objects.size()], (i * 37) % objects.size());
+  }
+  for (std::uint64_t tick = 1; tick <= 5; tick++) {
+    std::vector<Object*> refreshed;
+    scheduler.update(tick / 30.0, tick, [&](Object* o) {
+      o->read(tick / 30.0, tick);
+      refreshed.push_back(o);
+    });
+    ASSERT_EQ(refreshed.size(), tick % 2 == 1 ? objects.size() : 0);
+    for (std::size_t i = 0; i < refreshed.size(); i++) {
+      ASSERT_EQ(refreshed[i], &objects[i]);
+    }
+  }
+}
+
+TEST(RefreshSchedulerTest, ExternalRefreshDefersObject) {
+  RefreshScheduler<Object> scheduler;
+  Object                   object{0.0, 5};
+  scheduler.add(&object, 0);
+  ASSERT_EQ(run(scheduler, object, 1, 4), std::vector<std::uint64_t>({1}));
+  object.read(4 / 30.0, 4);
+  ASSERT_EQ(run(scheduler, object, 5, 12), std::vector<std::uint64_t>({10}));
+}
+
+TEST(RefreshSchedulerTest, TickAndTimeJumps) {
+  RefreshScheduler<Object> scheduler;
+  Object                   object{1.0, 2};
+  scheduler.add(&object, 0);
+  scheduler.update(1.0, 1, [](Object* o) { o->read(1.0, 1); });
+  int reads = 0;
+  scheduler.update(500.0, 5000, [&](Object* o) {
+    o->read(500.0, 5000);
+    reads++;
+  });
+  ASSERT_EQ(reads, 1);
+  scheduler.update(500.5, 5003, [&](Object* o) {
+    o->read(500.5, 5003);
+    reads++;
+  });
+  ASSERT_EQ(reads, 1);
+  scheduler.update(501.5, 5004, [&](Object* o) {
+    o->read(501.5, 5004);
+    reads++;
+  });
+  ASSERT_EQ(reads, 2);
+}
+
+TEST(RefreshSchedulerTest, ClearRemovesAllObjects) {
+  RefreshScheduler<Object> scheduler;
+  Object                   object{0.0, 1};
+  scheduler.add(&object, 0);
+  run(scheduler, object, 1, 2);
+  scheduler.clear();
+  ASSERT_EQ(scheduler.size(), 0);
+  ASSERT_TRUE(run(scheduler, object, 3, 10).empty());
+}
+
+TEST(RefreshSchedulerTest, OnlyDueObjectsAreVisited) {
+  RefreshScheduler<Object> scheduler;
+  std::vector<Object>      objects(1000, Object{0.0, 99});
+  for (std::size_t i = 0; i < objects.size(); i++) {
+    scheduler.add(&objects[i], i);
+  }
+  run(scheduler, objects[0], 1, 50);
+  ASSERT_EQ(scheduler.lastVisited(), 0);
+  run(scheduler, objects[0], 51, 101);
+  ASSERT_EQ(scheduler.lastVisited(), objects.size());
+  ASSERT_EQ(objects[999].reads, 2);
+}
+
+TEST(RefreshSchedulerTest, ClearResetsTiming) {
+  RefreshScheduler<Object> scheduler;
+  Object                   object{0.0, 3};
+  scheduler.add(&object, 0);
+  run(scheduler, object, 100, 105);
+  scheduler.clear();
+  ASSERT_EQ(scheduler.size(), 0);
+  // a cleared scheduler starts again at an earlier tick and time (e.g. after a reload)
+  Object restarted{0.0, 3};
+  scheduler.add(&restarted, 0);
+  ASSERT_EQ(run(scheduler, restarted, 1, 12), std::vector<std::uint64_t>({1, 5, 9}));
+}
+
+TEST(RefreshSchedulerTest, RescheduledObjectsKeepTheirPhase) {
+  RefreshScheduler<Object> scheduler;
+  std::vector<Object>      objects(4, Object{0.0, 3});
+  for (std::size_t i = 0; i < objects.size(); i++) {
+    objects[i].nextUpdateTickStamp = 10 + i;
+    scheduler.reschedule(&objects[i], i);
+  }
+  ASSERT_EQ(scheduler.size(), objects.size());
+
+  std::vector<std::vector<std::size_t>> readsPerTick;
+  for (std::uint64_t tick = 10; tick <= 14; tick++) {
+    std::vector<std::size_t> reads;
+    scheduler.update(tick / 30.0, tick, [&](Object* o) {
+      o->read(tick / 30.0, tick);
+      reads.push_back(static_cast<std::size_t>(o - objects.data()));
+    });
+    readsPerTick.push_back(reads);
+  }
+  // each object is due in the tick after its stamp instead of all in the first update
+  ASSERT_EQ(readsPerTick, (std::vector<std::vector<std::size_t>>{{}, {0}, {1}, {2}, {3}}));
+}
+
+TEST(RefreshSchedulerTest, RescheduledObjectWithPassedStampsIsDue) {
+  RefreshScheduler<Object> scheduler;
+  Object                   object{0.0, 3};
+  scheduler.reschedule(&object, 0);
+  ASSERT_EQ(run(scheduler, object, 5, 12), std::vector<std::uint64_t>({5, 9}));
+}
+
+TEST(RefreshSchedulerTest, ChangedFlagOfScheduledVariablesIsResetInTheNextTick) {
+  RefreshScheduler<Variable> scheduler;
+  ChangedFlagResetQueue      resetQueue;
+  Variable                   variable{};
+  variable.maxAgeTicks = 10;
+  scheduler.add(&variable, 0);
+
+  // refreshed from the sim
+  variable.simValue = 1.0;
+  preUpdate(scheduler, resetQueue, 1);
+  ASSERT_TRUE(variable.changed);
+  preUpdate(scheduler, resetQueue, 2);
+  ASSERT_FALSE(variable.changed);
+
+  // set locally between refreshes as CacheableVariable::set()
+  variable.cachedValue = 2.0;
+  variable.changed     = true;
+  resetQueue.push(&variable);
+  preUpdate(scheduler, resetQueue, 3);
+  ASSERT_FALSE(variable.changed);
+  ASSERT_EQ(variable.reads, 1);
+
+  // set locally in the tick before its refresh - the refresh reads the sim value once and its change is kept
+  variable.cachedValue = 3.0;
+  variable.changed     = true;
+  resetQueue.push(&variable);
+  preUpdate(scheduler, resetQueue, 12);
+  ASSERT_TRUE(variable.changed);
+  ASSERT_EQ(variable.cachedValue, 1.0);
+  ASSERT_EQ(variable.reads, 2);
+  preUpdate(scheduler, resetQueue, 13);
+  ASSERT_FALSE(variable.changed);
+  ASSERT_EQ(variable.reads, 2);
+}
@@ -0,0 +1,104 @@
+// Copyright (c) 2024 FlyByWire Simulations
+// SPDX-License-Identifier: GPL-3.0
+
+#include <gtest/gtest.h>
+#include <cstring>
+#include <sstream>
+#include "TickProfiler.hpp"
+
+TEST(TickProfilerTest, DisabledByDefault) {
+  TickProfiler profiler(16);
+  const auto section = profiler.addSection("section");
+  ASSERT_FALSE(profiler.isEnabled());
+  { TickProfiler::Scope scope{profiler, section, 1}; }
+  ASSERT_EQ(profiler.size(), 0);
+  ASSERT_EQ(profiler.histogram(section).count(), 0);
+}
+
+TEST(TickProfilerTest, ScopeRecordsWhenEnabled) {
+  TickProfiler profiler(16);
+  const auto first  = profiler.addSection("first");
+  const auto second = profiler.addSection("second");
+  profiler.setEnabled(true);
+  { TickProfiler::Scope scope{profiler, first, 1}; }
+  { TickProfiler::Scope scope{profiler, second, 1}; }
+  ASSERT_EQ(profiler.size(), 2);
+  ASSERT_EQ(profiler.histogram(first).count(), 1);
+  ASSERT_EQ(profiler.histogram(second).count(), 1);
+  ASSERT_EQ(profiler.records()[1].section, second);
+}
+
+TEST(TickProfilerTest, CapacityIsRoundedToPowerOfTwo) {
+  TickProfiler profiler(100);
+  ASSERT_EQ(profiler.capacity(), 128);
+}
+
+TEST(TickProfilerTest, RingOverwritesOldestRecords) {
+  TickProfiler profiler(4);
+  const auto section = profiler.addSection("section");
+  profiler.setEnabled(true);
+  for (std::uint64_t tick = 0; tick < 10; ++tick) {
+    profiler.record(section, tick, static_cast<std::int64_t>(tick * 10));
+  }
+  const auto records = profiler.records();
+  ASSERT_EQ(records.size(), 4);
+  ASSERT_EQ(records.front().tick, 6);
+  ASSERT_EQ(records.back().tick, 9);
+  ASSERT_EQ(records.back().duration, 90);
+  ASSERT_EQ(profiler.histogram(section).count(), 10);
+}
+
+TEST(TickProfilerTest, InvalidSectionIsIgnored) {
+  TickProfiler profiler(4);
+  profiler.record(3, 1, 100);
+  ASSERT_EQ(profiler.size(), 0);
+}
+
+TEST(TickProfilerTest, ResetKeepsSections) {
+  TickProfiler profiler(4);
+  const auto section = profiler.addSection("section");
+  profiler.record(section, 1, 100);
+  profiler.reset();
+  ASSERT_EQ(profiler.size(), 0);
+  ASSERT_EQ(profiler.histogram(section).count(), 0);
+  ASSERT_EQ(profiler.sectionCount(), 1);
+  ASSERT_EQ(profiler.sectionName(section), "section");
+}
+
+TEST(TickProfilerTest, WriteTraceWritesHeaderSectionsAndRecords) {
+  TickProfiler profiler(4);
+  const auto section = profiler.addSection("Module::update");
+  profiler.record(section, 42, 1234);
+
+  std::stringstream stream;
+  ASSERT_TRUE(profiler.writeTrace(stream));
+  const std::string trace = stream.str();
+  ASSERT_EQ(trace.size(), 4 + 4 + 4 + 4 + 14 + 8 + 16);
+  ASSERT_EQ(trace.substr(0, 4), "FBWP");
+
+  std::uint32_t version;
+  std::memcpy(&version, trace.data() + 4, sizeof(version));
+  ASSERT_EQ(version, TickProfiler::TRACE_VERSION);
+  ASSERT_EQ(trace.substr(16, 14), "Module::update");
+
+  std::uint64_t count, tick;
+  std::uint32_t id, duration;
+  std::memcpy(&count, trace.data() + 30, sizeof(count));
+  std::memcpy(&tick, trace.data() + 38, sizeof(tick));
+  std::memcpy(&id, trace.data() + 46, sizeof(id));
+  std::memcpy(&duration, trace.data() + 50, sizeof(duration));
+  ASSERT_EQ(count, 1);
+  ASSERT_EQ(tick, 42);
+  ASSERT_EQ(id, section);
+  ASSERT_EQ(duration, 1234);
+}
+
+TEST(TickProfilerTest, StrListsSectionsWithSamples) {
+  TickProfiler profiler(4);
+  const auto used = profiler.addSection("used");
+  profiler.addSection("unused");
+  profiler.record(used, 1, 2048);
+  const std::string summary = profiler.str();
+  ASSERT_NE(summary.find("used (1 samples)"), std::string::npos);
+  ASSERT_EQ(summary.find("unused"), std::string::npos);
+}
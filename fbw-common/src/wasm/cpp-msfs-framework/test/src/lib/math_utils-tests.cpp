@@ -27,3 +27,14 @@ TEST_F(MathUtilsTest, TestSign) {
   EXPECT_EQ(Math::sign(-10), -1);
   EXPECT_EQ(Math::sign(0), 0);
 }
+
+TEST_F(MathUtilsTest, TestHorner) {
+  constexpr double coefficients[4] = {1.0, -2.0, 0.5, 3.0};
+  for (const double x : {-3.0, -0.5, 0.0, 0.25, 2.0, 68.2}) {
+    const double expected = coefficients[0] + coefficients[1] * x + coefficients[2] * std::pow(x, 2) + coefficients[3] * std::pow(x, 3);
+    EXPECT_NEAR(Math::horner(coefficients, x), expected, 1e-12 * std::abs(expected) + 1e-12);
+  }
+  EXPECT_EQ(Math::horner(std::array<double, 1>{4.0}, 10.0), 4.0);
+  EXPECT_EQ(Math::horner(std::array<double, 3>{1.0, 2.0, 3.0}, 2.0), 17.0);
+  static_assert(Math::horner(std::array<double, 2>{1.0, 2.0}, 3.0) == 7.0);
+}
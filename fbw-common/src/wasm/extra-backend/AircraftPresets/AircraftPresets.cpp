@@ -1,6 +1,7 @@
 // Copyright (c) 2023-2024 FlyByWire Simulations
 // SPDX-License-Identifier: GPL-3.0
 
+#include <chrono>
 #include <fstream>
 #include <iostream>
 #include <string>
@@ -122,43 +123,20 @@ bool AircraftPresets::update(sGaugeDrawData* pData) {
     // Signal other systems to use quick mode via a LVAR
     aircraftPresetQuickMode->setAndWriteToSim(expeditedMode ? 1 : 0);
 
-    // convenience tmp
-    const ProcedureStep* currentStepPtr = (*currentProcedure)[currentStep];
-
-    // Check if the current step should be skipped based on the step type
-    if (checkStepTypeSkipping(expeditedMode, currentStepPtr)) {
-      return true;
+    // In normal mode one step is processed per frame.
+    // In expedited mode consecutive steps are processed in the same frame until a step has to wait (delay,
+    // unmet condition, action with deferred effects) or the time budget for this frame is used up.
+    const auto           batchStart      = std::chrono::steady_clock::now();
+    const ProcedureStep* progressStepPtr = nullptr;
+    while (processStep(expeditedMode, progressStepPtr) && expeditedMode && currentDelay <= currentLoadingTime &&
+           currentStep < currentProcedure->size() && std::chrono::steady_clock::now() - batchStart < EXPEDITED_FRAME_BUDGET) {
     }
 
-    // Calculate next delay
-    currentDelay = currentLoadingTime + currentStepPtr->delayAfter;
-
-    // Check if the current step is a condition step and handle it.
-    // It has already been checked above if a condition step should be skipped,
-    // so we only check for the condition flag here
-    if (currentStepPtr->type & StepType::CONDITION) {
-      handleConditionStep(currentStepPtr);
-      return true;
+    // only report the progress once per frame
+    if (progressStepPtr) {
+      updateProgress(progressStepPtr);
     }
 
-    // Remove the delay if the step is expedited and the delay can be ignored.
-    // This adds a general expedited delay to each step to generally slow down the process.
-    // The delay is specified in the LVAR "A32NX_AIRCRAFT_PRESET_LOAD_EXPEDITE_DELAY"
-    // and can be adjusted if the default value of 0 causes issues.
-    if (expeditedMode && !(currentStepPtr->type & StepType::EXPEDITED_DELAY)) {
-      currentDelay = currentLoadingTime + aircraftPresetExpediteDelay->get();
-    }
-
-    // test if the next step is required or if the state is already set in
-    // which case the action can be skipped, and delay can be ignored.
-    if (checkExpectedState(currentStepPtr)) {
-      return true;
-    }
-
-    updateProgress(currentStepPtr);
-
-    executeAction(currentStepPtr);
-
   } else if (loadingIsActive) {  // loading has been 0
     finishLoading();
   }
@@ -217,20 +195,62 @@ bool AircraftPresets::checkStepTypeSkipping(const bool expeditedMode, const Proc
   return false;
 }
 
-void AircraftPresets::handleConditionStep(const ProcedureStep* currentStepPtr) {  // prepare return values for execute_calculator_code
+bool AircraftPresets::processStep(const bool expeditedMode, const ProcedureStep*& progressStepPtr) {
+  // convenience tmp
+  const ProcedureStep* currentStepPtr = (*currentProcedure)[currentStep];
+
+  // Check if the current step should be skipped based on the step type
+  if (checkStepTypeSkipping(expeditedMode, currentStepPtr)) {
+    return true;
+  }
+
+  // Calculate next delay
+  currentDelay = currentLoadingTime + currentStepPtr->delayAfter;
+
+  // Check if the current step is a condition step and handle it.
+  // It has already been checked above if a condition step should be skipped,
+  // so we only check for the condition flag here
+  if (currentStepPtr->type & StepType::CONDITION) {
+    progressStepPtr = currentStepPtr;
+    return handleConditionStep(currentStepPtr);
+  }
+
+  // Remove the delay if the step is expedited and the delay can be ignored.
+  // This adds a general expedited delay to each step to generally slow down the process.
+  // The delay is specified in the LVAR "A32NX_AIRCRAFT_PRESET_LOAD_EXPEDITE_DELAY"
+  // and can be adjusted if the default value of 0 causes issues.
+  if (expeditedMode && !(currentStepPtr->type & StepType::EXPEDITED_DELAY)) {
+    currentDelay = currentLoadingTime + aircraftPresetExpediteDelay->get();
+  }
+
+  // test if the next step is required or if the state is already set in
+  // which case the action can be skipped, and delay can be ignored.
+  if (checkExpectedState(currentStepPtr)) {
+    return true;
+  }
+
+  progressStepPtr = currentStepPtr;
+  executeAction(currentStepPtr);
+
+  // events and sim variables set by the action are only visible in the next frame, so the following steps must
+  // not be evaluated before that
+  return !currentStepPtr->hasDeferredEffects;
+}
+
+bool AircraftPresets::handleConditionStep(const ProcedureStep* currentStepPtr) {  // prepare return values for execute_calculator_code
   LOG_INFO(fmt::format("AircraftPresets: Aircraft Preset Step {} Condition: {} (delay between tests: {})", currentStep,
                        currentStepPtr->description, currentStepPtr->delayAfter));
   FLOAT64 fvalue = 0.0;
-  updateProgress(currentStepPtr);
   if (aircraftPresetVerbose->getAsBool()) {
     fmt::print("AircraftPresets: Aircraft Preset Step Condition: [{}]\n", currentStepPtr->expectedStateCheckCode);
   }
-  execute_calculator_code(currentStepPtr->expectedStateCheckCode.c_str(), &fvalue, nullptr, nullptr);
+  execute_calculator_code(currentStepPtr->expectedStateCheckCodeCompiled.c_str(), &fvalue, nullptr, nullptr);
   const bool conditionIsTrue = !helper::Math::almostEqual(0.0, fvalue);
   if (conditionIsTrue) {
     currentDelay = 0;
     currentStep++;
   }
+  return conditionIsTrue;
 }
 
 bool AircraftPresets::checkExpectedState(const ProcedureStep* currentStepPtr) {
@@ -245,7 +265,7 @@ bool AircraftPresets::checkExpectedState(const ProcedureStep* currentStepPtr) {
                currentStepPtr->expectedStateCheckCode);
   }
 
-  execute_calculator_code(currentStepPtr->expectedStateCheckCode.c_str(), &fvalue, nullptr, nullptr);
+  execute_calculator_code(currentStepPtr->expectedStateCheckCodeCompiled.c_str(), &fvalue, nullptr, nullptr);
 
   const bool conditionIsTrue = !helper::Math::almostEqual(0.0, fvalue);
   if (conditionIsTrue) {
@@ -266,7 +286,7 @@ void AircraftPresets::executeAction(const ProcedureStep* currentStepPtr) {
   if (aircraftPresetVerbose->getAsBool()) {
     fmt::print("AircraftPresets: Aircraft Preset Step Action: [{}]\n", currentStepPtr->actionCode);
   }
-  execute_calculator_code(currentStepPtr->actionCode.c_str(), nullptr, nullptr, nullptr);
+  execute_calculator_code(currentStepPtr->actionCodeCompiled.c_str(), nullptr, nullptr, nullptr);
   currentStep++;
 }
 
@@ -4,6 +4,7 @@
 #ifndef FLYBYWIRE_AIRCRAFTPRESETS_H
 #define FLYBYWIRE_AIRCRAFTPRESETS_H
 
+#include <chrono>
 #include <cstdint>
 
 #include "DataManager.h"
@@ -35,6 +36,10 @@ class MsfsHandler;
  */
 class AircraftPresets : public Module {
  private:
+  // In expedited mode steps that do not need to wait are batched into one frame. This limits the time a batch may
+  // take so loading a preset does not cause frame spikes.
+  static constexpr std::chrono::microseconds EXPEDITED_FRAME_BUDGET{2000};
+
   // Convenience pointer to the data manager
   DataManager* dataManager = nullptr;
 
@@ -100,6 +105,7 @@ class AircraftPresets : public Module {
   bool update(sGaugeDrawData* pData) override;
   bool postUpdate(sGaugeDrawData*) override { return true; };  // not required for this module
   bool shutdown() override;
+  [[nodiscard]] std::string getName() const override { return "AircraftPresets"; }
 
  private:
   /**
@@ -143,15 +149,28 @@ class AircraftPresets : public Module {
    */
   bool checkStepTypeSkipping(bool expeditedMode, const ProcedureStep* currentStepPtr);
 
+  /**
+   * @brief Processes the current step of the loading process.
+   *
+   * Skips, tests or executes the current step and advances to the next step when the current one is done.
+   *
+   * @param expeditedMode A boolean indicating if expedited mode is active.
+   * @param progressStepPtr Set to the step if it was tested as a condition or its action was executed.
+   * @return True if the next step may be processed in the same frame, false if the step has to wait or its
+   * effects only become visible in the next frame.
+   */
+  bool processStep(bool expeditedMode, const ProcedureStep*& progressStepPtr);
+
   /**
    * @brief Handles the execution of a condition step in the loading process.
    *
    * Condition steps require special handling to evaluate whether the conditions for proceeding with
-   * the next step are met. This method manages the checking of conditions and updating of progress.
+   * the next step are met. This method manages the checking of conditions.
    *
    * @param currentStepPtr Pointer to the current condition step to handle.
+   * @return True if the condition is met and the loading process continues with the next step.
    */
-  void handleConditionStep(const ProcedureStep* currentStepPtr);
+  bool handleConditionStep(const ProcedureStep* currentStepPtr);
 
   /**
    * @brief Checks if the expected state for a step is already met.
@@ -4,6 +4,7 @@
 #ifndef FLYBYWIRE_AIRCRAFT_PROCEDURESTEP_HPP
 #define FLYBYWIRE_AIRCRAFT_PROCEDURESTEP_HPP
 
+#include <MSFS/Legacy/gauges.h>
 #include <fmt/core.h>
 #include <sstream>
 #include <string>
@@ -55,7 +56,13 @@ enum StepType {
  * @field expectedStateCheckCode Check if desired state is already set so the action can be skipped. If it is a conditional step
  *         this code needs to eval to true or false. The procedure only continues if the code evals to true.
  * @field actionCode Calculator code to achieve the desired state.
- * @field noExpedite If true, the step will not be expedited even if expedite is set (default: false)
+ * @field expectedStateCheckCodeCompiled The check code precompiled by the sim - used for execution
+ * @field actionCodeCompiled The action code precompiled by the sim - used for execution
+ * @field hasDeferredEffects True if the action sends events or sets sim variables. Their effect is only visible to other calculator
+ *         code in a later frame, so no further step may be evaluated in the same frame after this step's action.
+ *
+ * The calculator code is compiled once when the step is created from the XML so the sim does not have to parse the RPN text
+ * again on every evaluation (conditions are re-evaluated every tick until they are true).
  */
 class ProcedureStep {
  public:
@@ -67,6 +74,9 @@ class ProcedureStep {
   const double      delayAfter;
   const std::string expectedStateCheckCode;
   const std::string actionCode;
+  const std::string expectedStateCheckCodeCompiled;
+  const std::string actionCodeCompiled;
+  const bool        hasDeferredEffects;
 
   /**
    * @brief Construct a new Procedure Step object
@@ -85,7 +95,30 @@ class ProcedureStep {
         type(type),
         delayAfter(delayAfter),
         expectedStateCheckCode(expectedStateCheckCode),
-        actionCode(actionCode) {}
+        actionCode(actionCode),
+        expectedStateCheckCodeCompiled(precompile(expectedStateCheckCode)),
+        actionCodeCompiled(precompile(actionCode)),
+        hasDeferredEffects(actionCode.find("(>K:") != std::string::npos || actionCode.find("(>A:") != std::string::npos ||
+                           actionCode.find("(>B:") != std::string::npos || actionCode.find("(>H:") != std::string::npos) {}
+
+  /**
+   * @brief Precompiles calculator code so execute_calculator_code does not need to parse the source text.
+   * @param source the calculator code in RPN
+   * @return the compiled code or the source if the sim could not compile it (execute_calculator_code accepts both)
+   */
+  static std::string precompile(const std::string& source) {
+    if (source.empty()) {
+      return source;
+    }
+    PCSTRINGZ compiled     = nullptr;
+    UINT32    compiledSize = 0;
+    if (!gauge_calculator_code_precompile(&compiled, &compiledSize, source.c_str()) || !compiled || compiledSize == 0) {
+      return source;
+    }
+    // the compiled form is binary and may contain NUL bytes, so the size is used instead of strlen.
+    // The sim owns the buffer and may reuse it with the next call, so it is copied here.
+    return std::string(compiled, compiledSize);
+  }
 
   /**
    * @brief Convert a StepType to a string.
@@ -56,6 +56,7 @@ class LightingPresets : public Module {
   bool update(sGaugeDrawData* pData) override;
   bool postUpdate([[maybe_unused]] sGaugeDrawData* pData) override { return true; };  // not required for this module
   bool shutdown() override;
+  [[nodiscard]] std::string getName() const override { return "LightingPresets"; }
 
   /**
    * Initializes the aircraft specific variables.
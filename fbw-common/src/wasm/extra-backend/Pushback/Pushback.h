@@ -108,6 +108,7 @@ class Pushback : public Module {
   bool update(sGaugeDrawData* pData) override;
   bool postUpdate(sGaugeDrawData* pData) override;
   bool shutdown() override;
+  [[nodiscard]] std::string getName() const override { return "Pushback"; }
 
  protected:
   /**
@@ -0,0 +1,205 @@
+// Copyright (c) 2024 FlyByWire Simulations
+// SPDX-License-Identifier: GPL-3.0
+
+#ifndef FLYBYWIRE_AIRCRAFT_THRUSTLIMITCACHE_HPP
+#define FLYBYWIRE_AIRCRAFT_THRUSTLIMITCACHE_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+/**
+ * @class ThrustLimitCache
+ * @brief Caches the N1 thrust limits of an aircraft's static ThrustLimits class.
+ *
+ * At initialization the rated N1 limit (limitN1 without any bleed) of each limit type is sampled on a grid
+ * over altitude and ambient temperature, assuming the ISA pressure of the altitude. A limit is then a bilinear
+ * grid lookup plus the exact bleed de-rating from ThrustLimits::bleedN1 and is only recalculated when its
+ * inputs move beyond a small tolerance.
+ *
+ * The climb grid is split at 10000ft where the climb speed and the table jump. Flex limits, inputs outside
+ * of the grids and ambient pressures too far from the ISA pressure of the altitude are calculated directly
+ * with ThrustLimits::limitN1. The error against limitN1 is validated in benchmark_thrust_limits.cpp.
+ *
+ * @tparam ThrustLimits The static thrust limits class providing limitN1() and bleedN1().
+ */
+template <typename ThrustLimits>
+class ThrustLimitCache {
+ public:
+  // grid resolution and temperature range
+  static constexpr double ALTITUDE_STEP     = 250.0;  // ft
+  static constexpr double TEMPERATURE_STEP  = 0.5;    // °C
+  static constexpr double TEMPERATURE_MIN   = -80.0;  // °C
+  static constexpr int    TEMPERATURE_COUNT = 281;    // up to +60°C
+
+  // inputs have to move beyond these tolerances before a limit is recalculated
+  static constexpr double ALTITUDE_TOLERANCE    = 5.0;   // ft
+  static constexpr double TEMPERATURE_TOLERANCE = 0.01;  // °C
+  static constexpr double PRESSURE_TOLERANCE    = 0.2;   // hPa
+
+  // maximum deviation of the ambient pressure from the ISA pressure of the altitude for the CLB and MCT grids
+  static constexpr double ISA_PRESSURE_TOLERANCE = 2.0;  // hPa
+
+ private:
+  /**
+   * @brief The rated N1 limit of one limit type sampled over altitude and ambient temperature.
+   */
+  struct Grid {
+    int                type          = 0;
+    double             altitudeMin   = 0;
+    int                altitudeCount = 0;
+    std::vector<float> values{};  // altitude major
+
+    double altitudeMax() const { return altitudeMin + (altitudeCount - 1) * ALTITUDE_STEP; }
+
+    bool contains(double altitude, double ambientTemp) const {
+      return !values.empty()                    //
+             && altitude >= altitudeMin         //
+             && altitude <= altitudeMax()       //
+             && ambientTemp >= TEMPERATURE_MIN  //
+             && ambientTemp <= TEMPERATURE_MIN + (TEMPERATURE_COUNT - 1) * TEMPERATURE_STEP;
+    }
+
+    double lookup(double altitude, double ambientTemp) const {
+      const double x  = (altitude - altitudeMin) / ALTITUDE_STEP;
+      const double y  = (ambientTemp - TEMPERATURE_MIN) / TEMPERATURE_STEP;
+      const int    i  = (std::min)(static_cast<int>(x), altitudeCount - 2);
+      const int    j  = (std::min)(static_cast<int>(y), TEMPERATURE_COUNT - 2);
+      const double fx = x - i;
+      const double fy = y - j;
+
+      const float* lo = &values[i * TEMPERATURE_COUNT + j];
+      const float* hi = lo + TEMPERATURE_COUNT;
+      return (1 - fx) * ((1 - fy) * lo[0] + fy * lo[1]) + fx * ((1 - fy) * hi[0] + fy * hi[1]);
+    }
+  };
+
+  /**
+   * @brief The inputs and the result of the last calculation of a limit.
+   */
+  struct Entry {
+    bool   valid           = false;
+    double altitude        = 0;
+    double ambientTemp     = 0;
+    double ambientPressure = 0;
+    double flexTemp        = 0;
+    int    packs           = 0;
+    int    nacelle         = 0;
+    int    wing            = 0;
+    double value           = 0;
+  };
+
+  // TO, GA, CLB up to 10000ft, CLB above 10000ft, MCT
+  Grid grids[5] = {
+      {0, -2000.0, 76},   // up to 16750ft
+      {1, -2000.0, 76},   // up to 16750ft
+      {2, -2000.0, 49},   // up to 10000ft
+      {2, 10000.1, 141},  // up to 45000.1ft
+      {3, -2000.0, 189},  // up to 45000ft
+  };
+
+  // TO, GA, CLB, MCT, flex TO, flex GA
+  Entry entries[6]{};
+
+ public:
+  /**
+   * @brief Samples the rated N1 limits into the grids. Limits requested before are calculated directly.
+   */
+  void initialize() {
+    for (Grid& grid : grids) {
+      grid.values.resize(static_cast<size_t>(grid.altitudeCount) * TEMPERATURE_COUNT);
+      for (int i = 0; i < grid.altitudeCount; i++) {
+        const double altitude = grid.altitudeMin + i * ALTITUDE_STEP;
+        const double pressure = isaPressure(altitude);
+        for (int j = 0; j < TEMPERATURE_COUNT; j++) {
+          const double ambientTemp               = TEMPERATURE_MIN + j * TEMPERATURE_STEP;
+          const double ratedN1                   = ThrustLimits::limitN1(grid.type, altitude, ambientTemp, pressure, 0, 0, 0, 0);
+          grid.values[i * TEMPERATURE_COUNT + j] = static_cast<float>(ratedN1);
+        }
+      }
+    }
+    for (Entry& entry : entries) {
+      entry.valid = false;
+    }
+  }
+
+  /**
+   * @brief Returns the N1 limit with the same parameters and result as ThrustLimits::limitN1 within the
+   *        interpolation error of the grids.
+   *
+   * @param type The type of limit (0-TO, 1-GA, 2-CLB, 3-MCT).
+   * @param altitude The altitude in feet.
+   * @param ambientTemp The ambient temperature in degrees Celsius.
+   * @param ambientPressure The ambient pressure in hPa.
+   * @param flexTemp The flex temperature in degrees Celsius.
+   * @param packs The status of the air conditioning (0 for off, 1 for on).
+   * @param nacelle The status of the nacelle anti-ice (0 for off, 1 for on).
+   * @param wing The status of the wing anti-ice (0 for off, 1 for on).
+   * @return The N1 limit for the engine.
+   */
+  double limitN1(int    type,             //
+                 double altitude,         //
+                 double ambientTemp,      //
+                 double ambientPressure,  //
+                 double flexTemp,         //
+                 int    packs,            //
+                 int    nacelle,          //
+                 int    wing              //
+  ) {
+    if (type < 0 || type > 3) {
+      return ThrustLimits::limitN1(type, altitude, ambientTemp, ambientPressure, flexTemp, packs, nacelle, wing);
+    }
+
+    const bool isFlex = flexTemp > 0 && type <= 1;
+    Entry&     entry  = entries[isFlex ? 4 + type : type];
+    if (entry.valid                                                                 //
+        && std::abs(altitude - entry.altitude) <= ALTITUDE_TOLERANCE                //
+        && std::abs(ambientTemp - entry.ambientTemp) <= TEMPERATURE_TOLERANCE       //
+        && std::abs(ambientPressure - entry.ambientPressure) <= PRESSURE_TOLERANCE  //
+        && flexTemp == entry.flexTemp                                               //
+        && packs == entry.packs && nacelle == entry.nacelle && wing == entry.wing) {
+      return entry.value;
+    }
+
+    entry       = {true, altitude, ambientTemp, ambientPressure, flexTemp, packs, nacelle, wing, 0};
+    entry.value = calculate(type, isFlex, altitude, ambientTemp, ambientPressure, flexTemp, packs, nacelle, wing);
+    return entry.value;
+  }
+
+  /**
+   * @brief Calculates the ISA pressure for a pressure altitude.
+   *
+   * @param altitude The pressure altitude in feet.
+   * @return The ISA pressure in hPa.
+   */
+  static double isaPressure(double altitude) {
+    if (altitude <= 36089) {
+      return 1013.25 * (std::pow)(1 - 6.8755856e-6 * altitude, 5.2558797);
+    }
+    return 226.32 * std::exp(-4.806346e-5 * (altitude - 36089));
+  }
+
+ private:
+  double calculate(int    type,             //
+                   bool   isFlex,           //
+                   double altitude,         //
+                   double ambientTemp,      //
+                   double ambientPressure,  //
+                   double flexTemp,         //
+                   int    packs,            //
+                   int    nacelle,          //
+                   int    wing              //
+  ) const {
+    if (!isFlex) {
+      const Grid& grid = type <= 1 ? grids[type] : type == 2 ? grids[altitude <= 10000 ? 2 : 3] : grids[4];
+      // TO and GA are calculated at a fixed mach number and do not depend on the ambient pressure
+      if (grid.contains(altitude, ambientTemp)
+          && (type <= 1 || std::abs(ambientPressure - isaPressure(altitude)) <= ISA_PRESSURE_TOLERANCE)) {
+        return grid.lookup(altitude, ambientTemp) + ThrustLimits::bleedN1(type, altitude, ambientTemp, flexTemp, packs, nacelle, wing);
+      }
+    }
+    return ThrustLimits::limitN1(type, altitude, ambientTemp, ambientPressure, flexTemp, packs, nacelle, wing);
+  }
+};
+
+#endif  // FLYBYWIRE_AIRCRAFT_THRUSTLIMITCACHE_HPP
@@ -0,0 +1,301 @@
+#include <algorithm>
+#include <limits>
+
+#include "ColumnarFrameWriter.h"
+
+ColumnarFrameWriter::~ColumnarFrameWriter() {
+  close();
+  if (isStreamInitialized) {
+    deflateEnd(&zStream);
+  }
+}
+
+bool ColumnarFrameWriter::open(const std::string& filename,
+                               uint64_t interfaceVersion,
+                               const std::vector<FrameSegment>& frameSegments,
+                               std::size_t numberOfTicksPerBlock,
+                               Encoding frameEncoding) {
+  close();
+
+  // prepare compression, the stream is reset and reused for every segment
+  if (!isStreamInitialized) {
+    isStreamInitialized = deflateInit(&zStream, Z_DEFAULT_COMPRESSION) == Z_OK;
+    if (!isStreamInitialized) {
+      return false;
+    }
+  }
+
+  // prepare layout
+  segments = frameSegments;
+  segmentOffsets.clear();
+  frameSize = 0;
+  for (const auto& segment : segments) {
+    segmentOffsets.push_back(frameSize);
+    frameSize += segment.size;
+  }
+  ticksPerBlock = std::max<std::size_t>(numberOfTicksPerBlock, 1);
+  encoding = frameEncoding;
+  previousFrame.assign(frameSize, 0);
+  for (auto& block : blocks) {
+    block.data.assign(frameSize * ticksPerBlock, 0);
+    block.numberOfTicks = 0;
+  }
+  fillingBlock = 0;
+  isBlockPending = false;
+  isFinishingFile = false;
+  nextSegmentToCompress = 0;
+  segmentInput = nullptr;
+  compressedSegments.resize(segments.size());
+  index.clear();
+
+  // create file
+  stream.open(filename, std::ios::out | std::ios::binary | std::ios::trunc);
+  if (!stream.is_open()) {
+    return false;
+  }
+
+  // write header
+  stream.write("FDR2", 4);
+  writeValue(FORMAT_VERSION);
+  writeValue(interfaceVersion);
+  writeValue(static_cast<uint32_t>(frameSize));
+  writeValue(static_cast<uint32_t>(ticksPerBlock));
+  writeValue(static_cast<uint32_t>(encoding));
+  writeValue(static_cast<uint32_t>(segments.size()));
+  for (const auto& segment : segments) {
+    writeValue(static_cast<uint32_t>(segment.size));
+    writeValue(static_cast<uint32_t>(segment.name.size()));
+    stream.write(segment.name.data(), static_cast<std::streamsize>(segment.name.size()));
+  }
+
+  return true;
+}
+
+void ColumnarFrameWriter::writeFrame(const char* frame, double simulationTime) {
+  if (!stream.is_open() || isFinishingFile) {
+    return;
+  }
+
+  Block& block = blocks[fillingBlock];
+  const std::size_t tick = block.numberOfTicks;
+
+  // scatter bytes into their columns, the first tick of a block is always stored as keyframe
+  const bool isDelta = encoding == XorDelta && tick > 0;
+  for (std::size_t segment = 0; segment < segments.size(); ++segment) {
+    const char* source = frame + segmentOffsets[segment];
+    const char* previous = previousFrame.data() + segmentOffsets[segment];
+    char* destination = block.data.data() + segmentOffsets[segment] * ticksPerBlock + tick;
+    if (isDelta) {
+      for (std::size_t i = 0; i < segments[segment].size; ++i) {
+        destination[i * ticksPerBlock] = static_cast<char>(source[i] ^ previous[i]);
+      }
+    } else {
+      for (std::size_t i = 0; i < segments[segment].size; ++i) {
+        destination[i * ticksPerBlock] = source[i];
+      }
+    }
+  }
+  if (encoding == XorDelta) {
+    std::copy_n(frame, frameSize, previousFrame.data());
+  }
+
+  // time range of the block, the simulation time is not necessarily monotonic (e.g. flight reset)
+  if (tick == 0) {
+    block.minimumSimulationTime = simulationTime;
+    block.maximumSimulationTime = simulationTime;
+  } else {
+    block.minimumSimulationTime = std::min(block.minimumSimulationTime, simulationTime);
+    block.maximumSimulationTime = std::max(block.maximumSimulationTime, simulationTime);
+  }
+  block.numberOfTicks++;
+
+  // hand over full block for compression
+  if (block.numberOfTicks == ticksPerBlock) {
+    startPendingBlock();
+  }
+}
+
+std::size_t ColumnarFrameWriter::process(std::size_t maxBytes) {
+  std::size_t processed = 0;
+  while (isBlockPending) {
+    processed += compressPendingBlock(maxBytes - processed);
+    if (isBlockPending) {
+      return processed;
+    }
+    // a finishing file hands over its last block once the previous one is written
+    if (isFinishingFile && blocks[fillingBlock].numberOfTicks > 0) {
+      startPendingBlock();
+    }
+  }
+
+  if (isFinishingFile && stream.is_open()) {
+    closeFile();
+  }
+  return processed;
+}
+
+void ColumnarFrameWriter::finish() {
+  if (!stream.is_open() || isFinishingFile) {
+    return;
+  }
+  isFinishingFile = true;
+  if (!isBlockPending && blocks[fillingBlock].numberOfTicks > 0) {
+    startPendingBlock();
+  }
+}
+
+void ColumnarFrameWriter::close() {
+  if (!stream.is_open()) {
+    return;
+  }
+
+  // compress remaining blocks and write the block index
+  finish();
+  process(std::numeric_limits<std::size_t>::max());
+}
+
+bool ColumnarFrameWriter::isOpen() const {
+  return stream.is_open();
+}
+
+bool ColumnarFrameWriter::isFinishing() const {
+  return isFinishingFile;
+}
+
+std::size_t ColumnarFrameWriter::getFrameSize() const {
+  return frameSize;
+}
+
+std::size_t ColumnarFrameWriter::getNumberOfSegments() const {
+  return segments.size();
+}
+
+std::size_t ColumnarFrameWriter::getBufferedBytes() const {
+  std::size_t numberOfTicks = blocks[fillingBlock].numberOfTicks;
+  if (isBlockPending) {
+    numberOfTicks += blocks[fillingBlock ^ 1].numberOfTicks;
+  }
+  return numberOfTicks * frameSize;
+}
+
+void ColumnarFrameWriter::startPendingBlock() {
+  // the previous block needs to be written before it can be reused
+  while (isBlockPending) {
+    compressPendingBlock(std::numeric_limits<std::size_t>::max());
+  }
+
+  isBlockPending = true;
+  nextSegmentToCompress = 0;
+  fillingBlock ^= 1;
+  blocks[fillingBlock].numberOfTicks = 0;
+}
+
+std::size_t ColumnarFrameWriter::compressPendingBlock(std::size_t maxBytes) {
+  const Block& block = blocks[fillingBlock ^ 1];
+  std::size_t processed = 0;
+  while (nextSegmentToCompress < segments.size()) {
+    if (segmentInput == nullptr) {
+      if (processed == maxBytes) {
+        return processed;
+      }
+      beginSegment(block, nextSegmentToCompress);
+    }
+
+    // feed the next chunk, the output buffer is large enough for the whole segment so deflate consumes all of it
+    std::size_t chunk = std::min(maxBytes - processed, segmentInputSize - segmentInputOffset);
+    if (chunk > 0) {
+      zStream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(segmentInput + segmentInputOffset));
+      zStream.avail_in = static_cast<uInt>(chunk);
+      deflate(&zStream, Z_NO_FLUSH);
+      segmentInputOffset += chunk;
+      processed += chunk;
+    }
+    if (segmentInputOffset < segmentInputSize) {
+      return processed;
+    }
+
+    endSegment(nextSegmentToCompress++);
+  }
+
+  finishPendingBlock();
+  return processed;
+}
+
+void ColumnarFrameWriter::beginSegment(const Block& block, std::size_t segment) {
+  const std::size_t segmentSize = segments[segment].size;
+  const char* columns = block.data.data() + segmentOffsets[segment] * ticksPerBlock;
+  std::size_t inputSize = segmentSize * block.numberOfTicks;
+
+  // a partial block has gaps between the columns -> make them contiguous first
+  if (block.numberOfTicks < ticksPerBlock) {
+    scratch.resize(inputSize);
+    for (std::size_t i = 0; i < segmentSize; ++i) {
+      std::copy_n(columns + i * ticksPerBlock, block.numberOfTicks, scratch.data() + i * block.numberOfTicks);
+    }
+    columns = scratch.data();
+  }
+
+  auto& output = compressedSegments[segment];
+  output.resize(deflateBound(&zStream, static_cast<uLong>(inputSize)));
+
+  deflateReset(&zStream);
+  zStream.next_out = reinterpret_cast<Bytef*>(output.data());
+  zStream.avail_out = static_cast<uInt>(output.size());
+  segmentInput = columns;
+  segmentInputSize = inputSize;
+  segmentInputOffset = 0;
+}
+
+void ColumnarFrameWriter::endSegment(std::size_t segment) {
+  zStream.next_in = nullptr;
+  zStream.avail_in = 0;
+  deflate(&zStream, Z_FINISH);
+  compressedSegments[segment].resize(zStream.total_out);
+  segmentInput = nullptr;
+}
+
+void ColumnarFrameWriter::finishPendingBlock() {
+  const Block& block = blocks[fillingBlock ^ 1];
+
+  // remember block in index
+  index.push_back({static_cast<uint64_t>(stream.tellp()), static_cast<uint32_t>(block.numberOfTicks), block.minimumSimulationTime,
+                   block.maximumSimulationTime});
+
+  // write block header and data
+  writeValue(static_cast<uint32_t>(block.numberOfTicks));
+  writeValue(block.minimumSimulationTime);
+  writeValue(block.maximumSimulationTime);
+  for (const auto& compressedSegment : compressedSegments) {
+    writeValue(static_cast<uint32_t>(compressedSegment.size()));
+  }
+  for (const auto& compressedSegment : compressedSegments) {
+    stream.write(compressedSegment.data(), static_cast<std::streamsize>(compressedSegment.size()));
+  }
+
+  isBlockPending = false;
+  nextSegmentToCompress = 0;
+}
+
+void ColumnarFrameWriter::closeFile() {
+  // write block index
+  auto indexOffset = static_cast<uint64_t>(stream.tellp());
+  for (const auto& entry : index) {
+    writeValue(entry.offset);
+    writeValue(entry.numberOfTicks);
+    writeValue(entry.minimumSimulationTime);
+    writeValue(entry.maximumSimulationTime);
+  }
+  writeValue(indexOffset);
+  writeValue(static_cast<uint32_t>(index.size()));
+  stream.write("FDRI", 4);
+
+  stream.close();
+  isFinishingFile = false;
+
+  // release the blocks, they are allocated again when the next file is opened
+  for (auto& block : blocks) {
+    std::vector<char>().swap(block.data);
+    block.numberOfTicks = 0;
+  }
+  std::vector<std::vector<char>>(segments.size()).swap(compressedSegments);
+}
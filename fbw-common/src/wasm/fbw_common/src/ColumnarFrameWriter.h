@@ -0,0 +1,138 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "zlib.h"
+
+// Named part of a frame, usually one struct that is written per tick
+struct FrameSegment {
+  std::string name;
+  std::size_t size;
+};
+
+// Writes frames into a seekable file that consists of independently compressed blocks.
+//
+// File layout (little endian):
+//   header : "FDR2", u32 format version, u64 interface version, u32 frame size, u32 ticks per block,
+//            u32 encoding (since format version 3), u32 number of segments, per segment { u32 size, u32 name length, name }
+//   block  : u32 number of ticks, f64 minimum simulation time, f64 maximum simulation time,
+//            u32 compressed size per segment, compressed segment data
+//   footer : per block { u64 file offset, u32 number of ticks, f64 minimum time, f64 maximum time },
+//            u64 offset of the footer, u32 number of blocks, "FDRI"
+//
+// Inside a block each segment is stored column-wise: byte i of all ticks is stored consecutively before
+// byte i + 1. Values that change slowly therefore end up next to each other which compresses well and
+// each segment can be decoded on its own.
+//
+// With the XorDelta encoding every tick except the first one of a block is stored as XOR against the previous
+// tick. Unchanged bytes become zero, which deflate handles much faster and smaller than repeated values. The
+// first tick of each block is the keyframe, so blocks stay independently decodable.
+//
+// Blocks are double-buffered: while one block is filled, the previous one is compressed with process(), which feeds
+// deflate a limited number of bytes per call and continues with the next call. The compression cost is therefore
+// spread evenly over the update calls. finish() does the same for the remaining blocks of a file that is replaced.
+class ColumnarFrameWriter {
+ public:
+  static constexpr uint32_t FORMAT_VERSION = 3;
+  // files of format version 2 have no encoding in the header and are always stored plain
+  static constexpr uint32_t FORMAT_VERSION_WITHOUT_ENCODING = 2;
+
+  enum Encoding : uint32_t {
+    Plain = 0,
+    XorDelta = 1,
+  };
+
+  ColumnarFrameWriter() = default;
+  ~ColumnarFrameWriter();
+
+  ColumnarFrameWriter(const ColumnarFrameWriter&) = delete;
+  ColumnarFrameWriter& operator=(const ColumnarFrameWriter&) = delete;
+
+  // creates the file and writes the header, an already open file is closed first
+  bool open(const std::string& filename,
+            uint64_t interfaceVersion,
+            const std::vector<FrameSegment>& segments,
+            std::size_t ticksPerBlock,
+            Encoding encoding);
+
+  // copies a complete frame (sum of all segment sizes) into the current block
+  void writeFrame(const char* frame, double simulationTime);
+
+  // compresses up to maxBytes of uncompressed data of the pending blocks and returns the number of compressed bytes,
+  // a finishing file is closed once its last block is written
+  std::size_t process(std::size_t maxBytes);
+
+  // stops accepting frames and hands over the partially filled block, the remaining blocks are compressed and the
+  // file is closed by the following process() calls
+  void finish();
+
+  // writes all remaining data and the block index, then closes the file
+  void close();
+
+  bool isOpen() const;
+  bool isFinishing() const;
+  std::size_t getFrameSize() const;
+  std::size_t getNumberOfSegments() const;
+  std::size_t getBufferedBytes() const;
+
+ private:
+  struct Block {
+    std::vector<char> data;
+    std::size_t numberOfTicks = 0;
+    double minimumSimulationTime = 0;
+    double maximumSimulationTime = 0;
+  };
+
+  struct IndexEntry {
+    uint64_t offset;
+    uint32_t numberOfTicks;
+    double minimumSimulationTime;
+    double maximumSimulationTime;
+  };
+
+  std::ofstream stream;
+  std::vector<FrameSegment> segments;
+  std::vector<std::size_t> segmentOffsets;
+  std::size_t frameSize = 0;
+  std::size_t ticksPerBlock = 0;
+  Encoding encoding = Plain;
+  std::vector<char> previousFrame;
+
+  Block blocks[2];
+  std::size_t fillingBlock = 0;
+  bool isBlockPending = false;
+  bool isFinishingFile = false;
+  std::size_t nextSegmentToCompress = 0;
+  // uncompressed data of the segment in the deflate stream and the number of bytes already fed to it,
+  // nullptr when no segment is started
+  const char* segmentInput = nullptr;
+  std::size_t segmentInputSize = 0;
+  std::size_t segmentInputOffset = 0;
+  std::vector<std::vector<char>> compressedSegments;
+  std::vector<char> scratch;
+  std::vector<IndexEntry> index;
+
+  z_stream zStream = {};
+  bool isStreamInitialized = false;
+
+  void startPendingBlock();
+
+  std::size_t compressPendingBlock(std::size_t maxBytes);
+
+  void beginSegment(const Block& block, std::size_t segment);
+
+  void endSegment(std::size_t segment);
+
+  void finishPendingBlock();
+
+  void closeFile();
+
+  template <typename T>
+  void writeValue(const T& value) {
+    stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+  }
+};
@@ -0,0 +1,324 @@
+#include <dirent.h>
+#include <stdio.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+#include "FrameRecorder.h"
+
+namespace {
+// converts a configuration value to a size, values that are not finite or below the minimum result in the minimum
+std::size_t toSize(double value, std::size_t minimum, std::size_t maximum) {
+  if (!std::isfinite(value) || value <= static_cast<double>(minimum)) {
+    return minimum;
+  }
+  if (value >= static_cast<double>(maximum)) {
+    return maximum;
+  }
+  return static_cast<std::size_t>(value);
+}
+
+// upper limits of the configuration values, protects against a configuration that would allocate all memory
+constexpr std::size_t MAXIMUM_BUFFERED_FRAMES = 4096;
+constexpr std::size_t MAXIMUM_SLICE_SIZE = 16 * 1024 * 1024;
+constexpr std::size_t MAXIMUM_TICKS_PER_BLOCK = 4096;
+
+// delay in updates before a failed file creation is retried, doubled with every further failure
+constexpr int OPEN_RETRY_INITIAL_DELAY = 100;
+constexpr int OPEN_RETRY_MAXIMUM_DELAY = 12800;
+}  // namespace
+
+void FrameRecorder::initialize(uint64_t version, const std::vector<FrameSegment>& frameSegments, const Configuration& configuration) {
+  interfaceVersion = version;
+  segments = frameSegments;
+  frameSize = 0;
+  for (const auto& segment : segments) {
+    frameSize += segment.size;
+  }
+
+  // prepare columnar format
+  isColumnar = configuration.fileFormatVersion == COLUMNAR_FILE_FORMAT;
+  if (isColumnar) {
+    columnarFrame.resize(frameSize);
+    ticksPerBlock = toSize(configuration.ticksPerBlock, 1, MAXIMUM_TICKS_PER_BLOCK);
+    isDeltaEncodingEnabled = configuration.isDeltaEncodingEnabled;
+    // compress the size of one frame per update, which finishes a block before the next one is full
+    columnarBytesPerUpdate = frameSize;
+  }
+
+  // prepare buffered writer, the columnar format already buffers complete blocks
+  isBufferedWriter = configuration.isBufferedWriterEnabled && !isColumnar;
+  if (isBufferedWriter) {
+    // the slice needs to be at least one frame, otherwise the buffer can never catch up
+    bufferedWriterSliceSize = toSize(configuration.bufferedWriterSliceSize, frameSize, std::max(MAXIMUM_SLICE_SIZE, frameSize));
+    frameBuffer.initialize(frameSize, toSize(configuration.bufferedWriterNumberOfFrames, 2, MAXIMUM_BUFFERED_FRAMES));
+  }
+}
+
+void FrameRecorder::setFileLimits(double numberOfFiles, double numberOfEntriesPerFile) {
+  maximumNumberOfFiles = numberOfFiles;
+  maximumNumberOfEntriesPerFile = numberOfEntriesPerFile;
+}
+
+void FrameRecorder::beginFrame() {
+  manageFiles();
+
+  if (isColumnar) {
+    frame = columnarFrame.data();
+    frameOffset = 0;
+    return;
+  }
+
+  if (!isBufferedWriter) {
+    return;
+  }
+
+  frame = frameBuffer.acquireFrame();
+  if (frame == nullptr) {
+    // compression could not keep up -> make room for one frame synchronously
+    drainFrameBuffer(frameBuffer.getFrameSize());
+    frame = frameBuffer.acquireFrame();
+    bufferOverruns++;
+  }
+  frameOffset = 0;
+}
+
+void FrameRecorder::write(const char* data, std::size_t size) {
+  if (frame == nullptr) {
+    fileStream->write(data, size);
+    return;
+  }
+
+  // copy into frame slot, the check protects against a frame size that is out of sync with the written data
+  if (frameOffset + size <= frameSize) {
+    std::memcpy(frame + frameOffset, data, size);
+  }
+  frameOffset += size;
+}
+
+void FrameRecorder::endFrame(double simulationTime) {
+  if (!isBufferedWriter && !isColumnar) {
+    return;
+  }
+
+  // an incomplete frame is dropped and counted, the mismatch is only printed once
+  bool isFrameComplete = frameOffset == frameSize;
+  if (!isFrameComplete) {
+    droppedFrames++;
+    if (!hasReportedFrameSizeMismatch) {
+      std::cout << "WASM: Flight Data Recorder : frame size mismatch, expected " << frameSize << " got " << frameOffset
+                << ", frame dropped" << std::endl;
+      hasReportedFrameSizeMismatch = true;
+    }
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  if (isColumnar) {
+    if (isFrameComplete) {
+      columnarWriters[currentColumnarWriter].writeFrame(frame, simulationTime);
+    }
+    // compress a fixed number of bytes of the pending blocks of the previous and the current file
+    columnarWriters[currentColumnarWriter ^ 1].process(columnarBytesPerUpdate);
+    columnarWriters[currentColumnarWriter].process(columnarBytesPerUpdate);
+  } else {
+    if (isFrameComplete) {
+      frameBuffer.commitFrame();
+    }
+    // compress a fixed size slice of the buffered data
+    drainFrameBuffer(bufferedWriterSliceSize);
+  }
+  compressionTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+  frame = nullptr;
+}
+
+void FrameRecorder::terminate() {
+  for (auto& columnarWriter : columnarWriters) {
+    columnarWriter.close();
+  }
+  if (fileStream) {
+    flushFrameBuffer();
+    fileStream->close();
+    fileStream.reset();
+  }
+  closePreviousFile();
+}
+
+bool FrameRecorder::isBufferedWriterEnabled() const {
+  return isBufferedWriter;
+}
+
+bool FrameRecorder::isColumnarFormat() const {
+  return isColumnar;
+}
+
+std::size_t FrameRecorder::getBufferedWriterSliceSize() const {
+  return bufferedWriterSliceSize;
+}
+
+std::size_t FrameRecorder::getFrameSize() const {
+  return frameSize;
+}
+
+std::size_t FrameRecorder::getBufferedBytes() const {
+  if (isColumnar) {
+    return columnarWriters[0].getBufferedBytes() + columnarWriters[1].getBufferedBytes();
+  }
+  return frameBuffer.getBufferedBytes();
+}
+
+int64_t FrameRecorder::getCompressionTime() const {
+  return compressionTime;
+}
+
+int FrameRecorder::getBufferOverruns() const {
+  return bufferOverruns;
+}
+
+int FrameRecorder::getDroppedFrames() const {
+  return droppedFrames;
+}
+
+void FrameRecorder::manageFiles() {
+  // increase sample counter
+  sampleCounter++;
+
+  // check if file is considered full
+  if (sampleCounter >= maximumNumberOfEntriesPerFile) {
+    // close file and delete
+    if (fileStream) {
+      if (isBufferedWriter) {
+        // the buffered frames belong to the current file -> it is closed once they are drained in slices
+        closePreviousFile();
+        previousFileStream = std::move(fileStream);
+        previousFileBufferedBytes = frameBuffer.getBufferedBytes();
+        if (previousFileBufferedBytes == 0) {
+          closePreviousFile();
+        }
+      } else {
+        fileStream->close();
+        fileStream.reset();
+      }
+    }
+    if (columnarWriters[currentColumnarWriter].isOpen()) {
+      // the remaining blocks are compressed by the following updates while the next file is recorded, the writer of
+      // the file before only has blocks left when the file is changed again before they were written
+      columnarWriters[currentColumnarWriter ^ 1].close();
+      columnarWriters[currentColumnarWriter].finish();
+      currentColumnarWriter ^= 1;
+    }
+    // reset counter
+    sampleCounter = 0;
+  }
+
+  if (isColumnar) {
+    if (openRetryDelay > 0) {
+      // a previous file creation failed -> wait before trying again
+      openRetryDelay--;
+    } else if (!columnarWriters[currentColumnarWriter].isOpen()) {
+      // create new file, the version is part of the header
+      if (columnarWriters[currentColumnarWriter].open(getFilename(), interfaceVersion, segments, ticksPerBlock,
+                              isDeltaEncodingEnabled ? ColumnarFrameWriter::XorDelta : ColumnarFrameWriter::Plain)) {
+        openFailures = 0;
+        // clean up directory
+        cleanUpFiles();
+      } else {
+        // back off instead of blocking every update with a failing file creation
+        openRetryDelay = std::min(OPEN_RETRY_INITIAL_DELAY << std::min(openFailures, 7), OPEN_RETRY_MAXIMUM_DELAY);
+        openFailures++;
+        std::cout << "WASM: Flight Data Recorder : failed to create file, retry in " << openRetryDelay << " updates" << std::endl;
+      }
+    }
+  } else if (!fileStream) {
+    // create new file
+    fileStream = std::make_shared<gzofstream>(getFilename().c_str());
+    // write version to file
+    fileStream->write((char*)&interfaceVersion, sizeof(interfaceVersion));
+    // clean up directory
+    cleanUpFiles();
+  }
+}
+
+void FrameRecorder::drainFrameBuffer(std::size_t maxBytes) {
+  // the oldest frames can still belong to the previous file after a file change
+  if (previousFileStream) {
+    std::size_t written = frameBuffer.drain(*previousFileStream, std::min(maxBytes, previousFileBufferedBytes));
+    previousFileBufferedBytes -= written;
+    maxBytes -= written;
+    if (previousFileBufferedBytes == 0) {
+      closePreviousFile();
+    }
+  }
+  frameBuffer.drain(*fileStream, maxBytes);
+}
+
+void FrameRecorder::flushFrameBuffer() {
+  if (isBufferedWriter) {
+    drainFrameBuffer(frameBuffer.getBufferedBytes());
+  }
+}
+
+void FrameRecorder::closePreviousFile() {
+  if (!previousFileStream) {
+    return;
+  }
+  // only happens when the file is changed again before the frames of the previous file were drained
+  if (previousFileBufferedBytes > 0) {
+    frameBuffer.drain(*previousFileStream, previousFileBufferedBytes);
+  }
+  previousFileStream->close();
+  previousFileStream.reset();
+  previousFileBufferedBytes = 0;
+}
+
+std::string FrameRecorder::getFilename() {
+  // get time
+  auto in_time_t = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
+
+  // get filepath based on time
+  std::stringstream result;
+  result << std::put_time(std::gmtime(&in_time_t), "\\work\\%Y-%m-%d-%H-%M-%S.fdr");
+
+  // return result
+  return result.str();
+}
+
+void FrameRecorder::cleanUpFiles() {
+  // std::vector for directory entries
+  std::vector<std::string> files;
+
+  // extension
+  std::string extension = "fdr";
+
+  // structure representing an directory entry
+  struct dirent* directoryEntry;
+
+  // open directory
+  DIR* directory = opendir("\\work");
+
+  // read directory until end
+  while ((directoryEntry = readdir(directory)) != NULL) {
+    // get filename as std::string
+    std::string filename = directoryEntry->d_name;
+
+    // check if file has right extension
+    if (filename.find(extension, (filename.length() - extension.length())) != std::string::npos) {
+      files.push_back(std::move(filename));
+    }
+  }
+
+  // close directory
+  closedir(directory);
+
+  // sort std::vector
+  std::sort(files.begin(), files.end(), std::greater<>());
+
+  // remove older files
+  while (files.size() > maximumNumberOfFiles) {
+    remove(("\\work\\" + files.back()).c_str());
+    files.pop_back();
+  }
+}
@@ -0,0 +1,117 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "ColumnarFrameWriter.h"
+#include "FrameRingBuffer.h"
+#include "zlib/zfstream.h"
+
+// Records one frame per update into flight data recorder files in the work folder, shared by the flight data
+// recorders of the aircraft which write the contents of the frame between beginFrame() and endFrame().
+//
+// Depending on the configuration the frames are written by one of three writers:
+//   direct   : frames are written into a gzip stream in the update that produced them
+//   buffered : frames are copied into a FrameRingBuffer and compressed in slices of a fixed size per update
+//   columnar : frames are collected into blocks of a ColumnarFrameWriter that are compressed with a byte budget per update
+//
+// A file is closed after the maximum number of entries and a new one is created, only the newest files are kept.
+class FrameRecorder {
+ public:
+  // configured file format that selects the columnar writer, the writer stores its own format version in the header
+  static constexpr int COLUMNAR_FILE_FORMAT = 2;
+
+  // configuration values as read from the configuration file, invalid values are clamped to sensible limits
+  struct Configuration {
+    bool isBufferedWriterEnabled = false;
+    double bufferedWriterNumberOfFrames = 64;
+    double bufferedWriterSliceSize = 8192;
+    double fileFormatVersion = 1;
+    double ticksPerBlock = 128;
+    bool isDeltaEncodingEnabled = true;
+  };
+
+  FrameRecorder() = default;
+
+  FrameRecorder(const FrameRecorder&) = delete;
+  FrameRecorder& operator=(const FrameRecorder&) = delete;
+
+  // prepares the writer for frames of the given segments, the first file is created by the first frame
+  void initialize(uint64_t interfaceVersion, const std::vector<FrameSegment>& segments, const Configuration& configuration);
+
+  // limits of the files, can be changed while recording
+  void setFileLimits(double maximumNumberOfFiles, double maximumNumberOfEntriesPerFile);
+
+  // changes the file if the current one is full and starts the frame of this update
+  void beginFrame();
+
+  // appends data to the current frame
+  void write(const char* data, std::size_t size);
+
+  // completes the frame and compresses a slice of the buffered data
+  void endFrame(double simulationTime);
+
+  // writes all buffered frames and closes the files
+  void terminate();
+
+  bool isBufferedWriterEnabled() const;
+  bool isColumnarFormat() const;
+  std::size_t getBufferedWriterSliceSize() const;
+  std::size_t getFrameSize() const;
+  std::size_t getBufferedBytes() const;
+  int64_t getCompressionTime() const;
+  int getBufferOverruns() const;
+  int getDroppedFrames() const;
+
+ private:
+  uint64_t interfaceVersion = 0;
+  std::vector<FrameSegment> segments;
+  double maximumNumberOfFiles = 15;
+  double maximumNumberOfEntriesPerFile = 864000;
+  int sampleCounter = 0;
+  std::shared_ptr<gzofstream> fileStream;
+
+  // frame of the current update, nullptr when writing directly into the file stream
+  char* frame = nullptr;
+  std::size_t frameOffset = 0;
+  std::size_t frameSize = 0;
+  bool hasReportedFrameSizeMismatch = false;
+  int bufferOverruns = 0;
+  int droppedFrames = 0;
+  int64_t compressionTime = 0;
+
+  // buffered writer: frames are copied into the ring and compressed in slices of a fixed size per update
+  bool isBufferedWriter = false;
+  std::size_t bufferedWriterSliceSize = 0;
+  FrameRingBuffer frameBuffer;
+  // after a file change the previous file stays open until its buffered frames are drained
+  std::shared_ptr<gzofstream> previousFileStream;
+  std::size_t previousFileBufferedBytes = 0;
+
+  // columnar format: frames are collected into blocks that are compressed with a byte budget per update, after a
+  // file change the writer of the previous file finishes its remaining blocks over the following updates
+  bool isColumnar = false;
+  ColumnarFrameWriter columnarWriters[2];
+  std::size_t currentColumnarWriter = 0;
+  std::vector<char> columnarFrame;
+  std::size_t ticksPerBlock = 1;
+  bool isDeltaEncodingEnabled = true;
+  std::size_t columnarBytesPerUpdate = 0;
+  int openFailures = 0;
+  int openRetryDelay = 0;
+
+  void manageFiles();
+
+  std::string getFilename();
+
+  void cleanUpFiles();
+
+  void drainFrameBuffer(std::size_t maxBytes);
+
+  void flushFrameBuffer();
+
+  void closePreviousFile();
+};
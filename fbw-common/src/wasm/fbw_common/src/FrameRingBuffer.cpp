@@ -0,0 +1,72 @@
+#include <algorithm>
+
+#include "FrameRingBuffer.h"
+
+void FrameRingBuffer::initialize(std::size_t size, std::size_t numberOfFrames) {
+  frameSize = size;
+  storage.assign(frameSize * std::max<std::size_t>(numberOfFrames, 1), 0);
+  clear();
+}
+
+char* FrameRingBuffer::acquireFrame() {
+  if (frameSize == 0 || isFull()) {
+    return nullptr;
+  }
+  // write position is always frame aligned and the storage a multiple of the frame size
+  // -> a slot is never split at the end of the storage
+  isFrameAcquired = true;
+  return storage.data() + writePosition;
+}
+
+void FrameRingBuffer::commitFrame() {
+  if (!isFrameAcquired) {
+    return;
+  }
+  isFrameAcquired = false;
+  writePosition = (writePosition + frameSize) % storage.size();
+  bufferedBytes += frameSize;
+}
+
+std::size_t FrameRingBuffer::drain(std::ostream& stream, std::size_t maxBytes) {
+  std::size_t written = 0;
+  while (written < maxBytes && bufferedBytes > 0) {
+    // write contiguous chunk until end of storage, buffered data or budget is reached
+    std::size_t chunk = std::min({maxBytes - written, bufferedBytes, storage.size() - readPosition});
+    stream.write(storage.data() + readPosition, static_cast<std::streamsize>(chunk));
+    readPosition = (readPosition + chunk) % storage.size();
+    bufferedBytes -= chunk;
+    written += chunk;
+  }
+  return written;
+}
+
+std::size_t FrameRingBuffer::drainAll(std::ostream& stream) {
+  return drain(stream, bufferedBytes);
+}
+
+void FrameRingBuffer::clear() {
+  writePosition = 0;
+  readPosition = 0;
+  bufferedBytes = 0;
+  isFrameAcquired = false;
+}
+
+std::size_t FrameRingBuffer::getFrameSize() const {
+  return frameSize;
+}
+
+std::size_t FrameRingBuffer::getCapacity() const {
+  return storage.size();
+}
+
+std::size_t FrameRingBuffer::getBufferedBytes() const {
+  return bufferedBytes;
+}
+
+bool FrameRingBuffer::isEmpty() const {
+  return bufferedBytes == 0;
+}
+
+bool FrameRingBuffer::isFull() const {
+  return storage.size() - bufferedBytes < frameSize;
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstddef>
+#include <ostream>
+#include <vector>
+
+// Preallocated ring of fixed-size frame slots. A producer fills one complete frame per tick while the
+// consumer drains the buffered bytes into a stream in slices of bounded size. This allows to move the
+// expensive part of writing (e.g. compression) out of the tick that produced the data.
+class FrameRingBuffer {
+ public:
+  FrameRingBuffer() = default;
+
+  // allocates storage for the given number of frames, any buffered data is discarded
+  void initialize(std::size_t frameSize, std::size_t numberOfFrames);
+
+  // returns the slot for the next frame or nullptr if the buffer is full
+  char* acquireFrame();
+
+  // marks the previously acquired frame as complete and ready to be drained
+  void commitFrame();
+
+  // writes up to maxBytes of buffered data into the stream and returns the number of bytes written
+  std::size_t drain(std::ostream& stream, std::size_t maxBytes);
+
+  // writes all buffered data into the stream
+  std::size_t drainAll(std::ostream& stream);
+
+  // discards all buffered data
+  void clear();
+
+  std::size_t getFrameSize() const;
+  std::size_t getCapacity() const;
+  std::size_t getBufferedBytes() const;
+
+  bool isEmpty() const;
+  bool isFull() const;
+
+ private:
+  std::vector<char> storage;
+  std::size_t frameSize = 0;
+  std::size_t writePosition = 0;
+  std::size_t readPosition = 0;
+  std::size_t bufferedBytes = 0;
+  bool isFrameAcquired = false;
+};
@@ -1,42 +1,61 @@
+#include <algorithm>
+
 #include "InterpolatingLookupTable.h"
 
 void InterpolatingLookupTable::initialize(std::vector<std::pair<double, double>> mapping, double minimum, double maximum) {
   mappingTable = std::move(mapping);
   mappingMinimum = minimum;
   mappingMaximum = maximum;
+
+  // unsorted tables (e.g. misconfigured detents) always search the first matching segment, NaN breakpoints never match
+  isSorted = std::adjacent_find(mappingTable.begin(), mappingTable.end(),
+                                [](const auto& a, const auto& b) { return !(b.first >= a.first); }) == mappingTable.end();
+  lastSegment = 0;
 }
 
 double InterpolatingLookupTable::get(double value) {
-  if (mappingTable.empty()) {
-    // not initialized yet
+  // check if size is big enough
+  if (mappingTable.size() < 2) {
     return 0;
   }
 
-  // iterate over values and do interpolation
+  // inputs are usually temporally coherent -> check the segment of the previous call first, with sorted
+  // breakpoints it is the first matching segment if the value is above its start (or it is the first one)
+  const std::size_t s = lastSegment;
+  if (isSorted && value <= mappingTable[s + 1].first && (s == 0 ? mappingTable[0].first <= value : mappingTable[s].first < value)) {
+    return interpolate(s, value);
+  }
+
+  // iterate over values, the first matching segment wins
   for (std::size_t i = 0; i < mappingTable.size() - 1; ++i) {
     if (mappingTable[i].first <= value && mappingTable[i + 1].first >= value) {
-      // calculate differences
-      double diff_x = value - mappingTable[i].first;
-      double diff_n = mappingTable[i + 1].first - mappingTable[i].first;
-
-      // interpolation
-      double result = mappingTable[i].first;
-      if (diff_n != 0) {
-        result = mappingTable[i].second + (mappingTable[i + 1].second - mappingTable[i].second) * diff_x / diff_n;
-      }
-
-      // clip the result to minimum and maximum
-      if (result < mappingMinimum) {
-        return mappingMinimum;
-      } else if (result > mappingMaximum) {
-        return mappingMaximum;
-      }
-
-      // no clipping needed -> return result
-      return result;
+      lastSegment = i;
+      return interpolate(i, value);
     }
   }
 
   // not in range
   return 0;
 }
+
+double InterpolatingLookupTable::interpolate(std::size_t segment, double value) const {
+  // calculate differences
+  double diff_x = value - mappingTable[segment].first;
+  double diff_n = mappingTable[segment + 1].first - mappingTable[segment].first;
+
+  // interpolation
+  double result = mappingTable[segment].first;
+  if (diff_n != 0) {
+    result = mappingTable[segment].second + (mappingTable[segment + 1].second - mappingTable[segment].second) * diff_x / diff_n;
+  }
+
+  // clip the result to minimum and maximum
+  if (result < mappingMinimum) {
+    return mappingMinimum;
+  } else if (result > mappingMaximum) {
+    return mappingMaximum;
+  }
+
+  // no clipping needed -> return result
+  return result;
+}
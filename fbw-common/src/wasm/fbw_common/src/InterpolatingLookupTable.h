@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <utility>
 #include <vector>
 
@@ -15,4 +16,10 @@ class InterpolatingLookupTable {
   std::vector<std::pair<double, double>> mappingTable;
   double mappingMinimum = 0;
   double mappingMaximum = 0;
+
+  // segment of the previous call, only used for sorted breakpoints where it is the first matching segment
+  bool isSorted = false;
+  std::size_t lastSegment = 0;
+
+  double interpolate(std::size_t segment, double value) const;
 };
@@ -2,27 +2,18 @@
 
 using std::cout;
 using std::endl;
-using std::set;
 using std::string;
 
-set<LocalVariable*> LocalVariable::LOCAL_VARIABLES;
-
-LocalVariable::LocalVariable(const string& variable, bool shouldUseDirtyState) {
-  // initialize variables
-  useDirtyState = shouldUseDirtyState;
-  isDirty = false;
-  value = 0.0;
-  name = variable;
-  // register variable
-  id = register_named_variable(name.c_str());
+LocalVariable::LocalVariable(const string& variable, bool shouldUseDirtyState, UpdateGroup updateGroup)
+    : store(getStore(updateGroup)), name(variable) {
+  // register variable in the pool of its group (for readAll)
+  slot = store.add(register_named_variable(name.c_str()), shouldUseDirtyState);
   // read current value
   read();
-  // remember in global list (for readAll)
-  LOCAL_VARIABLES.insert(this);
 }
 
 LocalVariable::~LocalVariable() {
-  LOCAL_VARIABLES.erase(this);
+  store.remove(slot);
 }
 
 string LocalVariable::getName() {
@@ -33,37 +24,44 @@ double LocalVariable::get(bool shouldRead) {
   if (shouldRead) {
     read();
   }
-  return value;
+  return store.getValue(slot);
 }
 
 void LocalVariable::set(double newValue, bool shouldWrite) {
-  value = newValue;
-  isDirty = true;
+  store.setValue(slot, newValue);
   if (shouldWrite) {
     write();
   }
 }
 
 void LocalVariable::read() {
-  value = get_named_variable_value(id);
+  store.read(slot);
 }
 
 void LocalVariable::write() {
-  if (useDirtyState && !isDirty) {
-    return;
-  }
-  set_named_variable_value(id, value);
-  isDirty = false;
+  store.write(slot);
 }
 
 void LocalVariable::readAll() {
-  for (auto variable : LOCAL_VARIABLES) {
-    variable->read();
-  }
+  readGroup(EveryFrame);
 }
 
 void LocalVariable::writeAll() {
-  for (auto variable : LOCAL_VARIABLES) {
-    variable->write();
+  for (int group = 0; group < NumberOfUpdateGroups; ++group) {
+    writeGroup(static_cast<UpdateGroup>(group));
   }
 }
+
+void LocalVariable::readGroup(UpdateGroup group) {
+  getStore(group).readAll();
+}
+
+void LocalVariable::writeGroup(UpdateGroup group) {
+  getStore(group).writeAll();
+}
+
+LocalVariableStore& LocalVariable::getStore(UpdateGroup group) {
+  // function local to be available independent of the static initialization order
+  static LocalVariableStore stores[NumberOfUpdateGroups];
+  return stores[group];
+}
@@ -1,17 +1,29 @@
 #pragma once
 
 #include <iostream>
-#include <set>
 #include <string>
 #include <utility>
 
 #include <MSFS/Legacy/gauges.h>
 
+#include "LocalVariableStore.h"
+
 class LocalVariable {
  public:
-  explicit LocalVariable(const std::string& name, bool shouldUseDirtyState = true);
+  // variables of the every frame group are updated by readAll(), on demand variables are only read
+  // explicitly (e.g. configuration that is only evaluated on request)
+  enum UpdateGroup {
+    EveryFrame = 0,
+    OnDemand = 1,
+    NumberOfUpdateGroups = 2,
+  };
+
+  explicit LocalVariable(const std::string& name, bool shouldUseDirtyState = true, UpdateGroup updateGroup = EveryFrame);
   ~LocalVariable();
 
+  LocalVariable(const LocalVariable&) = delete;
+  LocalVariable& operator=(const LocalVariable&) = delete;
+
   std::string getName();
 
   double get(bool shouldRead = false);
@@ -20,15 +32,19 @@ class LocalVariable {
   void read();
   void write();
 
+  // reads all variables of the every frame group
   static void readAll();
+
+  // writes all changed variables of all groups
   static void writeAll();
 
+  static void readGroup(UpdateGroup group);
+  static void writeGroup(UpdateGroup group);
+
  private:
-  static std::set<LocalVariable*> LOCAL_VARIABLES;
+  static LocalVariableStore& getStore(UpdateGroup group);
 
-  ID id;
+  LocalVariableStore& store;
+  std::size_t slot;
   std::string name;
-  bool useDirtyState;
-  bool isDirty;
-  double value;
 };
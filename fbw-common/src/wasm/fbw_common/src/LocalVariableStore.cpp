@@ -0,0 +1,88 @@
+#include <bit>
+
+#include "LocalVariableStore.h"
+
+std::size_t LocalVariableStore::add(ID id, bool useDirtyState) {
+  std::size_t slot;
+  if (!freeSlots.empty()) {
+    slot = freeSlots.back();
+    freeSlots.pop_back();
+  } else {
+    slot = ids.size();
+    ids.push_back(0);
+    values.push_back(0.0);
+    if (slot % BITS_PER_WORD == 0) {
+      activeBits.push_back(0);
+      dirtyBits.push_back(0);
+      alwaysWriteBits.push_back(0);
+    }
+  }
+
+  const std::size_t word = slot / BITS_PER_WORD;
+  ids[slot] = id;
+  values[slot] = 0.0;
+  activeBits[word] |= bit(slot);
+  dirtyBits[word] &= ~bit(slot);
+  if (useDirtyState) {
+    alwaysWriteBits[word] &= ~bit(slot);
+  } else {
+    alwaysWriteBits[word] |= bit(slot);
+  }
+  return slot;
+}
+
+void LocalVariableStore::remove(std::size_t slot) {
+  const std::size_t word = slot / BITS_PER_WORD;
+  activeBits[word] &= ~bit(slot);
+  dirtyBits[word] &= ~bit(slot);
+  alwaysWriteBits[word] &= ~bit(slot);
+  freeSlots.push_back(slot);
+}
+
+void LocalVariableStore::read(std::size_t slot) {
+  values[slot] = get_named_variable_value(ids[slot]);
+}
+
+void LocalVariableStore::write(std::size_t slot) {
+  const std::size_t word = slot / BITS_PER_WORD;
+  if (((dirtyBits[word] | alwaysWriteBits[word]) & bit(slot)) == 0) {
+    return;
+  }
+  set_named_variable_value(ids[slot], values[slot]);
+  dirtyBits[word] &= ~bit(slot);
+}
+
+void LocalVariableStore::readAll() {
+  for (std::size_t word = 0; word < activeBits.size(); ++word) {
+    const std::size_t base = word * BITS_PER_WORD;
+    uint64_t bits = activeBits[word];
+    // fully used words are the common case -> plain linear loop
+    if (bits == ~uint64_t{0}) {
+      for (std::size_t slot = base; slot < base + BITS_PER_WORD; ++slot) {
+        values[slot] = get_named_variable_value(ids[slot]);
+      }
+      continue;
+    }
+    while (bits != 0) {
+      const std::size_t slot = base + static_cast<std::size_t>(std::countr_zero(bits));
+      values[slot] = get_named_variable_value(ids[slot]);
+      bits &= bits - 1;
+    }
+  }
+}
+
+void LocalVariableStore::writeAll() {
+  for (std::size_t word = 0; word < dirtyBits.size(); ++word) {
+    uint64_t bits = (dirtyBits[word] | alwaysWriteBits[word]) & activeBits[word];
+    while (bits != 0) {
+      const std::size_t slot = word * BITS_PER_WORD + static_cast<std::size_t>(std::countr_zero(bits));
+      set_named_variable_value(ids[slot], values[slot]);
+      bits &= bits - 1;
+    }
+    dirtyBits[word] = 0;
+  }
+}
+
+std::size_t LocalVariableStore::getNumberOfVariables() const {
+  return ids.size() - freeSlots.size();
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <MSFS/Legacy/gauges.h>
+
+// Pooled storage of local variables. IDs and cached values are packed in contiguous arrays so reading
+// all variables walks linear memory instead of scattered heap objects. Changed values are tracked in a
+// bitset, writing all variables only touches the dirty entries. Slots of removed variables are reused.
+class LocalVariableStore {
+ public:
+  LocalVariableStore() = default;
+
+  LocalVariableStore(const LocalVariableStore&) = delete;
+  LocalVariableStore& operator=(const LocalVariableStore&) = delete;
+
+  // adds a variable and returns its slot, without dirty state the variable is written on every writeAll()
+  std::size_t add(ID id, bool useDirtyState);
+
+  // frees the slot for reuse
+  void remove(std::size_t slot);
+
+  ID getId(std::size_t slot) const { return ids[slot]; }
+  double getValue(std::size_t slot) const { return values[slot]; }
+
+  // updates the cached value and marks the slot as dirty
+  void setValue(std::size_t slot, double value) {
+    values[slot] = value;
+    dirtyBits[slot / BITS_PER_WORD] |= bit(slot);
+  }
+
+  // reads the value from the sim
+  void read(std::size_t slot);
+
+  // writes the value to the sim if it is dirty or the variable does not use the dirty state
+  void write(std::size_t slot);
+
+  // reads all variables from the sim
+  void readAll();
+
+  // writes all dirty variables and variables without dirty state to the sim
+  void writeAll();
+
+  std::size_t getNumberOfVariables() const;
+
+ private:
+  static constexpr std::size_t BITS_PER_WORD = 64;
+
+  static uint64_t bit(std::size_t slot) { return uint64_t{1} << (slot % BITS_PER_WORD); }
+
+  std::vector<ID> ids;
+  std::vector<double> values;
+  std::vector<uint64_t> activeBits;
+  std::vector<uint64_t> dirtyBits;
+  std::vector<uint64_t> alwaysWriteBits;
+  std::vector<std::size_t> freeSlots;
+};
@@ -31,25 +31,25 @@ ThrottleAxisMapping::ThrottleAxisMapping(unsigned int id) {
   LVAR_DETENT_TOGA_HIGH = LVAR_DETENT_TOGA_HIGH.append(stringId);
 
   // register local variables
-  idInputValue = std::make_unique<LocalVariable>(LVAR_INPUT_VALUE.c_str());
-  idThrustLeverAngle = std::make_unique<LocalVariable>(LVAR_THRUST_LEVER_ANGLE.c_str());
-  idUsingConfig = std::make_unique<LocalVariable>(LVAR_LOAD_CONFIG.c_str());
-  idUseReverseOnAxis = std::make_unique<LocalVariable>(LVAR_USE_REVERSE_ON_AXIS.c_str());
-  idUseTogaOnAxis = std::make_unique<LocalVariable>(LVAR_USE_TOGA_ON_AXIS.c_str());
-  idIncrementNormal = std::make_unique<LocalVariable>(LVAR_INCREMENT_NORMAL.c_str());
-  idIncrementSmall = std::make_unique<LocalVariable>(LVAR_INCREMENT_SMALL.c_str());
-  idDetentReverseLow = std::make_unique<LocalVariable>(LVAR_DETENT_REVERSE_LOW.c_str());
-  idDetentReverseHigh = std::make_unique<LocalVariable>(LVAR_DETENT_REVERSE_HIGH.c_str());
-  idDetentReverseIdleLow = std::make_unique<LocalVariable>(LVAR_DETENT_REVERSEIDLE_LOW.c_str());
-  idDetentReverseIdleHigh = std::make_unique<LocalVariable>(LVAR_DETENT_REVERSEIDLE_HIGH.c_str());
-  idDetentIdleLow = std::make_unique<LocalVariable>(LVAR_DETENT_IDLE_LOW.c_str());
-  idDetentIdleHigh = std::make_unique<LocalVariable>(LVAR_DETENT_IDLE_HIGH.c_str());
-  idDetentClimbLow = std::make_unique<LocalVariable>(LVAR_DETENT_CLIMB_LOW.c_str());
-  idDetentClimbHigh = std::make_unique<LocalVariable>(LVAR_DETENT_CLIMB_HIGH.c_str());
-  idDetentFlexMctLow = std::make_unique<LocalVariable>(LVAR_DETENT_FLEXMCT_LOW.c_str());
-  idDetentFlexMctHigh = std::make_unique<LocalVariable>(LVAR_DETENT_FLEXMCT_HIGH.c_str());
-  idDetentTogaLow = std::make_unique<LocalVariable>(LVAR_DETENT_TOGA_LOW.c_str());
-  idDetentTogaHigh = std::make_unique<LocalVariable>(LVAR_DETENT_TOGA_HIGH.c_str());
+  idInputValue = std::make_unique<LocalVariable>(LVAR_INPUT_VALUE.c_str(), true, LocalVariable::OnDemand);
+  idThrustLeverAngle = std::make_unique<LocalVariable>(LVAR_THRUST_LEVER_ANGLE.c_str(), true, LocalVariable::OnDemand);
+  idUsingConfig = std::make_unique<LocalVariable>(LVAR_LOAD_CONFIG.c_str(), true, LocalVariable::OnDemand);
+  idUseReverseOnAxis = std::make_unique<LocalVariable>(LVAR_USE_REVERSE_ON_AXIS.c_str(), true, LocalVariable::OnDemand);
+  idUseTogaOnAxis = std::make_unique<LocalVariable>(LVAR_USE_TOGA_ON_AXIS.c_str(), true, LocalVariable::OnDemand);
+  idIncrementNormal = std::make_unique<LocalVariable>(LVAR_INCREMENT_NORMAL.c_str(), true, LocalVariable::OnDemand);
+  idIncrementSmall = std::make_unique<LocalVariable>(LVAR_INCREMENT_SMALL.c_str(), true, LocalVariable::OnDemand);
+  idDetentReverseLow = std::make_unique<LocalVariable>(LVAR_DETENT_REVERSE_LOW.c_str(), true, LocalVariable::OnDemand);
+  idDetentReverseHigh = std::make_unique<LocalVariable>(LVAR_DETENT_REVERSE_HIGH.c_str(), true, LocalVariable::OnDemand);
+  idDetentReverseIdleLow = std::make_unique<LocalVariable>(LVAR_DETENT_REVERSEIDLE_LOW.c_str(), true, LocalVariable::OnDemand);
+  idDetentReverseIdleHigh = std::make_unique<LocalVariable>(LVAR_DETENT_REVERSEIDLE_HIGH.c_str(), true, LocalVariable::OnDemand);
+  idDetentIdleLow = std::make_unique<LocalVariable>(LVAR_DETENT_IDLE_LOW.c_str(), true, LocalVariable::OnDemand);
+  idDetentIdleHigh = std::make_unique<LocalVariable>(LVAR_DETENT_IDLE_HIGH.c_str(), true, LocalVariable::OnDemand);
+  idDetentClimbLow = std::make_unique<LocalVariable>(LVAR_DETENT_CLIMB_LOW.c_str(), true, LocalVariable::OnDemand);
+  idDetentClimbHigh = std::make_unique<LocalVariable>(LVAR_DETENT_CLIMB_HIGH.c_str(), true, LocalVariable::OnDemand);
+  idDetentFlexMctLow = std::make_unique<LocalVariable>(LVAR_DETENT_FLEXMCT_LOW.c_str(), true, LocalVariable::OnDemand);
+  idDetentFlexMctHigh = std::make_unique<LocalVariable>(LVAR_DETENT_FLEXMCT_HIGH.c_str(), true, LocalVariable::OnDemand);
+  idDetentTogaLow = std::make_unique<LocalVariable>(LVAR_DETENT_TOGA_LOW.c_str(), true, LocalVariable::OnDemand);
+  idDetentTogaHigh = std::make_unique<LocalVariable>(LVAR_DETENT_TOGA_HIGH.c_str(), true, LocalVariable::OnDemand);
 }
 
 void ThrottleAxisMapping::setInFlight() {
@@ -318,10 +318,13 @@ ThrottleAxisMapping::Configuration ThrottleAxisMapping::getDefaultConfiguration(
 
 ThrottleAxisMapping::Configuration ThrottleAxisMapping::loadConfigurationFromLocalVariables() {
   idUsingConfig->set(true);
-  return {idUseReverseOnAxis->get() == 1, idUseTogaOnAxis->get() == 1, idIncrementNormal->get(),      idIncrementSmall->get(),
-          idDetentReverseLow->get(),      idDetentReverseHigh->get(),  idDetentReverseIdleLow->get(), idDetentReverseIdleHigh->get(),
-          idDetentIdleLow->get(),         idDetentIdleHigh->get(),     idDetentClimbLow->get(),       idDetentClimbHigh->get(),
-          idDetentFlexMctLow->get(),      idDetentFlexMctHigh->get(),  idDetentTogaLow->get(),        idDetentTogaHigh->get()};
+  // configuration variables are not part of the per frame update -> read them now
+  return {idUseReverseOnAxis->get(true) == 1, idUseTogaOnAxis->get(true) == 1,    idIncrementNormal->get(true),
+          idIncrementSmall->get(true),        idDetentReverseLow->get(true),      idDetentReverseHigh->get(true),
+          idDetentReverseIdleLow->get(true),  idDetentReverseIdleHigh->get(true), idDetentIdleLow->get(true),
+          idDetentIdleHigh->get(true),        idDetentClimbLow->get(true),        idDetentClimbHigh->get(true),
+          idDetentFlexMctLow->get(true),      idDetentFlexMctHigh->get(true),     idDetentTogaLow->get(true),
+          idDetentTogaHigh->get(true)};
 }
 
 void ThrottleAxisMapping::storeConfigurationInLocalVariables(const Configuration& configuration) {
@@ -67,6 +67,7 @@ clang++ \
   "${DIR}/src/nanovg/nanovg.cpp" \
   "${DIR}/src/navigationdisplay/collection.cpp" \
   "${DIR}/src/navigationdisplay/displaybase.cpp" \
+  "${DIR}/src/navigationdisplay/framedecoder.cpp" \
   "${DIR}/src/simconnect/connection.cpp" \
 
 # restore directory
@@ -871,6 +871,11 @@ void nvgUpdateImage(NVGcontext* ctx, int image, const unsigned char* data) {
   ctx->params.renderUpdateTexture(ctx->params.userPtr, image, 0, 0, w, h, data);
 }
 
+void nvgUpdateImageRegion(NVGcontext* ctx, int image, int x, int y, int w, int h, const unsigned char* data) {
+  // the data contains only the pixels of the region with a row length of w pixels
+  ctx->params.renderUpdateTexture(ctx->params.userPtr, image, x, y, w, h, data);
+}
+
 void nvgImageSize(NVGcontext* ctx, int image, int* w, int* h) {
   ctx->params.renderGetTextureSize(ctx->params.userPtr, image, w, h);
 }
@@ -0,0 +1,15 @@
+#pragma once
+
+#include <MSFS/Render/nanovg.h>
+
+/**
+ * @brief Updates a rectangular region of an image
+ * @param ctx The nanovg context
+ * @param image The image handle
+ * @param x The left border of the region
+ * @param y The top border of the region
+ * @param w The width of the region
+ * @param h The height of the region
+ * @param data The RGBA pixels of the region, tightly packed rows of w pixels
+ */
+void nvgUpdateImageRegion(NVGcontext* ctx, int image, int x, int y, int w, int h, const unsigned char* data);
@@ -15,11 +15,20 @@ Collection::Collection(simconnect::Connection& connection)
       _simulatorData(nullptr),
       _aircraftStatus(nullptr),
       _ndConfiguration(nullptr),
-      _simconnectAircraftStatus(nullptr) {
+      _simconnectAircraftStatus(nullptr),
+      _simconnectFrameCapabilities(nullptr) {
   this->_simconnectAircraftStatus = connection.clientDataArea<types::AircraftStatusData>();
   this->_simconnectAircraftStatus->defineArea("FBW_SIMBRIDGE_EGPWC_AIRCRAFT_STATUS");
   this->_simconnectAircraftStatus->allocateArea(true);
 
+  this->_simconnectFrameCapabilities = connection.clientDataArea<types::FrameCapabilitiesData>();
+  this->_simconnectFrameCapabilities->defineArea(FrameCapabilitiesName);
+  this->_simconnectFrameCapabilities->allocateArea(true);
+  this->_simconnectFrameCapabilities->data().version = types::FrameFormatVersion;
+  this->_simconnectFrameCapabilities->data().supportedFrameEncodings =
+      static_cast<std::uint8_t>((1 << types::FrameEncoding::PNG) | (1 << types::FrameEncoding::PALETTE_RLE));
+  this->_simconnectFrameCapabilities->data().supportsFrameRegions = 1;
+
   this->_aircraftStatus =
       connection.lvarObject<EgpwcDestinationLat, EgpwcDestinationLong, EgpwcPresentLat, EgpwcPresentLong, EgpwcTerrOnNdRenderingMode,
                             EgpwcAltitude, EgpwcHeading, EgpwcVerticalSpeed, EgpwcGearIsDown>();
@@ -156,6 +165,8 @@ void Collection::updateDisplay(FsContext context) {
     this->_simconnectAircraftStatus->data().groundTruthLongitude = this->_groundTruth.longitude.convert(types::degree);
 
     this->_simconnectAircraftStatus->setArea();
+    // the capabilities are repeated with the status, a SimBridge that connects later receives them as well
+    this->_simconnectFrameCapabilities->setArea();
     this->_lastAircraftStatusTransmission = now;
     this->_sendAircraftStatus = false;
   }
@@ -70,6 +70,7 @@ class Collection {
 
   // outputs
   std::shared_ptr<simconnect::ClientDataArea<types::AircraftStatusData>> _simconnectAircraftStatus;
+  std::shared_ptr<simconnect::ClientDataArea<types::FrameCapabilitiesData>> _simconnectFrameCapabilities;
 
  public:
   /**
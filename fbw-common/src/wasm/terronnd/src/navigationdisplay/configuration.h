@@ -8,6 +8,9 @@ static const std::string ThresholdsLeftName = "FBW_SIMBRIDGE_TERRONND_THRESHOLDS
 static const std::string ThresholdsRightName = "FBW_SIMBRIDGE_TERRONND_THRESHOLDS_RIGHT";
 static const std::string FrameDataLeftName = "FBW_SIMBRIDGE_TERRONND_FRAME_DATA_LEFT";
 static const std::string FrameDataRightName = "FBW_SIMBRIDGE_TERRONND_FRAME_DATA_RIGHT";
+static const std::string FrameFormatLeftName = "FBW_SIMBRIDGE_TERRONND_FRAME_FORMAT_LEFT";
+static const std::string FrameFormatRightName = "FBW_SIMBRIDGE_TERRONND_FRAME_FORMAT_RIGHT";
+static const std::string FrameCapabilitiesName = "FBW_SIMBRIDGE_TERRONND_FRAME_CAPABILITIES";
 static constexpr std::string_view EgpwcTerrOnNdRightActive = "EGPWC_ND_R_TERRAIN_ACTIVE";
 static constexpr std::string_view NdLeftMinElevation = "EGPWC_ND_L_TERRAIN_MIN_ELEVATION";
 static constexpr std::string_view NdLeftMinElevationMode = "EGPWC_ND_L_TERRAIN_MIN_ELEVATION_MODE";
@@ -42,4 +45,13 @@ static constexpr std::uint8_t NavigationDisplayRoseVorModeId = 1;
 static constexpr std::uint8_t NavigationDisplayRoseNavModeId = 2;
 static constexpr std::uint8_t NavigationDisplayArcModeId = 3;
 
+// resolution of the gauge (see panel.cfg), the frames of the SimBridge cover the complete display
+#ifdef A380X
+static constexpr int NavigationDisplayWidth = 768;
+static constexpr int NavigationDisplayHeight = 1024;
+#else
+static constexpr int NavigationDisplayWidth = 768;
+static constexpr int NavigationDisplayHeight = 768;
+#endif
+
 }  // namespace navigationdisplay
@@ -16,6 +16,7 @@
 #define FMT_HEADER_ONLY
 #include <fmt/format.h>
 
+#include "../nanovg/nanovgext.h"
 #include "../simconnect/clientdataarea.hpp"
 #include "../simconnect/connection.hpp"
 #include "../simconnect/lvarobject.hpp"
@@ -24,6 +25,7 @@
 #include "../types/quantity.hpp"
 #include "../types/simbridge.h"
 #include "configuration.h"
+#include "framedecoder.h"
 
 namespace navigationdisplay {
 
@@ -45,6 +47,13 @@ class DisplayBase {
     bool powered;
   };
 
+  struct FrameRegion {
+    int x;
+    int y;
+    int width;
+    int height;
+  };
+
   DisplayBase(const DisplayBase&) = delete;
   virtual ~DisplayBase() { this->destroy(); }
 
@@ -60,14 +69,21 @@ class DisplayBase {
   DisplaySide _side;
   NdConfiguration _configuration;
   std::size_t _frameBufferSize;
+  std::uint8_t _frameEncoding;
+  FrameRegion _frameRegion;
+  std::vector<std::uint32_t> _pixelBuffer;
   int _nanovgImage;
   NVGcontext* _context;
   std::shared_ptr<simconnect::ClientDataArea<types::ThresholdData>> _thresholds;
+  std::shared_ptr<simconnect::ClientDataArea<types::FrameFormatData>> _frameFormat;
   std::shared_ptr<simconnect::ClientDataAreaBuffered<std::uint8_t, SIMCONNECT_CLIENTDATA_MAX_SIZE>> _frameData;
 
   DisplayBase(DisplaySide side, FsContext context);
 
   void destroyImage();
+  void updateImageFromFrame();
+  void updateImageFromPngFrame();
+  bool decodeFrame(int expectedWidth, int expectedHeight);
 };
 
 /**
@@ -101,6 +117,10 @@ class Display : public DisplayBase {
    * Communcation concept to the SimBridge:
    *  - The threshold data block from the SimBridge contains the number of bytes for a frame
    *  - The framedata is sent afterwards in chunks of SIMCONNECT_CLIENTDATA_MAX_SIZE bytes per chunk, until the frame is transmitted
+   *  - The optional frame format block is sent before the threshold data block, without it the frame is a complete PNG
+   *  - The frame format block defines the encoding of the frame, a PNG or a palette frame that is expanded without image decoder
+   *  - The frame format block defines the region of the frame, a frame can contain only the changed part of the image
+   *    which is uploaded as sub-region of the image
    *
    * @param connection The connection to SimCommect
    * @param side The display side
@@ -117,48 +137,32 @@ class Display : public DisplayBase {
     this->_frameData->requestArea(SIMCONNECT_CLIENT_DATA_PERIOD_ON_SET);
     this->_frameData->setOnChangeCallback([=]() {
       if (!this->_ignoreNextFrame && this->_configuration.terrainActive) {
-        if (this->_nanovgImage == 0) {
-          // If we don't have an image yet, create one
-          this->_nanovgImage = nvgCreateImageMem(this->_context, 0, this->_frameData->data().data(), static_cast<int>(this->_frameBufferSize));
-          if (this->_nanovgImage == 0) {
-            std::cerr << fmt::format("TERR ON ND: Unable to create the image from the stream. Reason: {}", stbi_failure_reason());
-          }
-
-          return;
-        }
-
-        // Otherwise, decode the PNG manually and update the existing image
-        int decodedWidth, decodedHeight;
-        uint8_t* decodedImage = stbi_load_from_memory(this->_frameData->data().data(), static_cast<int>(this->_frameBufferSize), &decodedWidth, &decodedHeight, nullptr, 4);
-        if (decodedImage == nullptr) {
-          std::cerr << fmt::format("TERR ON ND: Unable to create the image from the stream. Reason: {}", stbi_failure_reason());
-          return;
-        }
-
-        int width, height;
-        nvgImageSize(this->_context, this->_nanovgImage, &width, &height);
-
-        if (decodedWidth != width || decodedHeight != height) {
-          // This should never happen, but bail just in case
-          std::cerr << fmt::format("TERR ON ND: The image size does not match the expected size. Expected: {}x{}, actual: {}x{}", width, height, decodedWidth, decodedHeight);
-          stbi_image_free(decodedImage);
-          return;
-        }
-
-        nvgUpdateImage(this->_context, this->_nanovgImage, decodedImage);
-
-        stbi_image_free(decodedImage);
+        this->updateImageFromFrame();
       } else {
         this->resetNavigationDisplayData();
       }
     });
 
+    this->_frameFormat = connection.clientDataArea<types::FrameFormatData>();
+    this->_frameFormat->defineArea(side == DisplaySide::Left ? FrameFormatLeftName : FrameFormatRightName);
+    this->_frameFormat->requestArea(SIMCONNECT_CLIENT_DATA_PERIOD_ON_SET);
+    this->_frameFormat->setAlwaysChanges(true);
+
     this->_thresholds = connection.clientDataArea<types::ThresholdData>();
     this->_thresholds->defineArea(side == DisplaySide::Left ? ThresholdsLeftName : ThresholdsRightName);
     this->_thresholds->requestArea(SIMCONNECT_CLIENT_DATA_PERIOD_ON_SET);
     this->_thresholds->setAlwaysChanges(true);
     this->_thresholds->setOnChangeCallback([=]() {
       this->_frameBufferSize = this->_thresholds->data().frameByteCount;
+      // a SimBridge without frame format support never sends the block, its version stays zero
+      const auto& format = this->_frameFormat->data();
+      if (format.version == types::FrameFormatVersion) {
+        this->_frameEncoding = format.frameEncoding;
+        this->_frameRegion = {format.frameRegionX, format.frameRegionY, format.frameRegionWidth, format.frameRegionHeight};
+      } else {
+        this->_frameEncoding = types::FrameEncoding::PNG;
+        this->_frameRegion = {};
+      }
       this->_frameData->reserve(this->_frameBufferSize);
       this->_ignoreNextFrame =
           this->_ignoreNextFrame &&
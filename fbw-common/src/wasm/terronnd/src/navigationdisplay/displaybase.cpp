@@ -1,3 +1,5 @@
+#include <cstring>
+
 #include "display.h"
 
 #ifdef A380X
@@ -11,7 +13,17 @@
 using namespace navigationdisplay;
 
 DisplayBase::DisplayBase(DisplaySide side, FsContext context)
-    : _side(side), _configuration(), _frameBufferSize(0), _nanovgImage(0), _context(nullptr), _thresholds(nullptr), _frameData(nullptr) {
+    : _side(side),
+      _configuration(),
+      _frameBufferSize(0),
+      _frameEncoding(types::FrameEncoding::PNG),
+      _frameRegion(),
+      _pixelBuffer(),
+      _nanovgImage(0),
+      _context(nullptr),
+      _thresholds(nullptr),
+      _frameFormat(nullptr),
+      _frameData(nullptr) {
   NVGparams params;
   params.userPtr       = context;
   params.edgeAntiAlias = false;
@@ -35,6 +47,127 @@ void DisplayBase::destroyImage() {
   }
 }
 
+bool DisplayBase::decodeFrame(int expectedWidth, int expectedHeight) {
+  std::uint8_t* data = this->_frameData->data().data();
+  if (this->_frameEncoding == types::FrameEncoding::PALETTE_RLE) {
+    if (!FrameDecoder::decodePaletteFrame(data, this->_frameBufferSize, expectedWidth, expectedHeight, this->_pixelBuffer)) {
+      std::cerr << fmt::format("TERR ON ND: Unable to decode the palette frame of {}x{} pixels", expectedWidth, expectedHeight)
+                << std::endl;
+      return false;
+    }
+    return true;
+  }
+
+  int width, height;
+  std::uint8_t* decodedImage = stbi_load_from_memory(data, static_cast<int>(this->_frameBufferSize), &width, &height, nullptr, 4);
+  if (decodedImage == nullptr) {
+    std::cerr << fmt::format("TERR ON ND: Unable to create the image from the stream. Reason: {}", stbi_failure_reason());
+    return false;
+  }
+
+  if (width != expectedWidth || height != expectedHeight) {
+    std::cerr << fmt::format("TERR ON ND: Unexpected frame size {}x{}, expected {}x{}", width, height, expectedWidth, expectedHeight)
+              << std::endl;
+    stbi_image_free(decodedImage);
+    return false;
+  }
+
+  this->_pixelBuffer.resize(static_cast<std::size_t>(width) * static_cast<std::size_t>(height));
+  std::memcpy(this->_pixelBuffer.data(), decodedImage, this->_pixelBuffer.size() * sizeof(std::uint32_t));
+  stbi_image_free(decodedImage);
+  return true;
+}
+
+void DisplayBase::updateImageFromPngFrame() {
+  std::uint8_t* data = this->_frameData->data().data();
+  int width, height;
+
+  if (this->_nanovgImage == 0) {
+    // If we don't have an image yet, create one
+    this->_nanovgImage = nvgCreateImageMem(this->_context, 0, data, static_cast<int>(this->_frameBufferSize));
+    if (this->_nanovgImage == 0) {
+      std::cerr << fmt::format("TERR ON ND: Unable to create the image from the stream. Reason: {}", stbi_failure_reason());
+      return;
+    }
+
+    nvgImageSize(this->_context, this->_nanovgImage, &width, &height);
+    if (width != NavigationDisplayWidth || height != NavigationDisplayHeight) {
+      std::cerr << fmt::format("TERR ON ND: Unexpected frame size {}x{}, expected {}x{}", width, height, NavigationDisplayWidth,
+                               NavigationDisplayHeight)
+                << std::endl;
+      this->destroyImage();
+    }
+    return;
+  }
+
+  // Otherwise, decode the PNG manually and update the existing image
+  std::uint8_t* decodedImage = stbi_load_from_memory(data, static_cast<int>(this->_frameBufferSize), &width, &height, nullptr, 4);
+  if (decodedImage == nullptr) {
+    std::cerr << fmt::format("TERR ON ND: Unable to create the image from the stream. Reason: {}", stbi_failure_reason());
+    return;
+  }
+
+  if (width != NavigationDisplayWidth || height != NavigationDisplayHeight) {
+    std::cerr << fmt::format("TERR ON ND: Unexpected frame size {}x{}, expected {}x{}", width, height, NavigationDisplayWidth,
+                             NavigationDisplayHeight)
+              << std::endl;
+    stbi_image_free(decodedImage);
+    return;
+  }
+
+  nvgUpdateImage(this->_context, this->_nanovgImage, decodedImage);
+  stbi_image_free(decodedImage);
+}
+
+void DisplayBase::updateImageFromFrame() {
+  const FrameRegion& region = this->_frameRegion;
+  const bool isCompleteFrame = region.width == 0 || region.height == 0;
+
+  // complete PNG frames are decoded by nanovg, without an intermediate copy
+  if (isCompleteFrame && this->_frameEncoding == types::FrameEncoding::PNG) {
+    this->updateImageFromPngFrame();
+    return;
+  }
+
+  // a complete palette frame replaces the image
+  if (isCompleteFrame) {
+    if (!this->decodeFrame(NavigationDisplayWidth, NavigationDisplayHeight)) {
+      return;
+    }
+
+    const auto pixels = reinterpret_cast<const unsigned char*>(this->_pixelBuffer.data());
+    if (this->_nanovgImage == 0) {
+      this->_nanovgImage = nvgCreateImageRGBA(this->_context, NavigationDisplayWidth, NavigationDisplayHeight, 0, pixels);
+      if (this->_nanovgImage == 0) {
+        std::cerr << "TERR ON ND: Unable to create the image from the frame" << std::endl;
+      }
+    } else {
+      nvgUpdateImage(this->_context, this->_nanovgImage, pixels);
+    }
+    return;
+  }
+
+  // a changed region is uploaded into the existing image, this requires a complete frame first
+  if (this->_nanovgImage == 0) {
+    return;
+  }
+
+  if (region.x + region.width > NavigationDisplayWidth || region.y + region.height > NavigationDisplayHeight) {
+    std::cerr << fmt::format("TERR ON ND: The frame region does not match the display. Display: {}x{}, region: {}x{} at {},{}",
+                             NavigationDisplayWidth, NavigationDisplayHeight, region.width, region.height, region.x, region.y)
+              << std::endl;
+    return;
+  }
+
+  // the decoded region is tightly packed, as expected by the region upload
+  if (!this->decodeFrame(region.width, region.height)) {
+    return;
+  }
+
+  nvgUpdateImageRegion(this->_context, this->_nanovgImage, region.x, region.y, region.width, region.height,
+                       reinterpret_cast<const unsigned char*>(this->_pixelBuffer.data()));
+}
+
 void DisplayBase::render(sGaugeDrawData* pDrawData) {
   if (this->_context == nullptr) {
     return;
@@ -0,0 +1,54 @@
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+#include "framedecoder.h"
+
+using namespace navigationdisplay;
+
+bool FrameDecoder::decodePaletteFrame(const std::uint8_t* data,
+                                      std::size_t size,
+                                      int expectedWidth,
+                                      int expectedHeight,
+                                      std::vector<std::uint32_t>& pixels) {
+  if (size < 5) {
+    return false;
+  }
+
+  // the size is checked before the pixels are allocated, a corrupted header must not define a huge frame
+  const int width = data[0] | (data[1] << 8);
+  const int height = data[2] | (data[3] << 8);
+  if (width != expectedWidth || height != expectedHeight) {
+    return false;
+  }
+  const std::size_t paletteSize = data[4] == 0 ? 256 : data[4];
+  std::size_t offset = 5;
+
+  if (size < offset + paletteSize * 4) {
+    return false;
+  }
+
+  // the palette entries keep the RGBA byte order of the frame
+  std::array<std::uint32_t, 256> palette{};
+  std::memcpy(palette.data(), &data[offset], paletteSize * 4);
+  offset += paletteSize * 4;
+
+  const std::size_t pixelCount = static_cast<std::size_t>(width) * static_cast<std::size_t>(height);
+  pixels.resize(pixelCount);
+
+  std::size_t pixel = 0;
+  while (pixel < pixelCount && offset + 1 < size) {
+    const std::size_t runLength = static_cast<std::size_t>(data[offset]) + 1;
+    const std::uint8_t index = data[offset + 1];
+    offset += 2;
+
+    if (index >= paletteSize || runLength > pixelCount - pixel) {
+      return false;
+    }
+
+    std::fill_n(&pixels[pixel], runLength, palette[index]);
+    pixel += runLength;
+  }
+
+  return pixel == pixelCount;
+}
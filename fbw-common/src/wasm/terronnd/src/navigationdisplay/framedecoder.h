@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace navigationdisplay {
+
+/**
+ * @brief Decodes frames of the SimBridge that are not transmitted as PNG
+ */
+class FrameDecoder {
+ public:
+  /**
+   * @brief Expands a run-length encoded palette frame into RGBA pixels
+   *
+   * Layout of the frame (little endian):
+   *  - u16 width, u16 height
+   *  - u8 number of palette entries (0 defines 256 entries), followed by the RGBA bytes per entry
+   *  - runs of { u8 run length - 1, u8 palette index } until all pixels are defined
+   *
+   * @param data The received frame data
+   * @param size The number of bytes of the frame
+   * @param expectedWidth The width of the display or region the frame is drawn to
+   * @param expectedHeight The height of the display or region the frame is drawn to
+   * @param pixels The RGBA pixels, the buffer is reused to avoid allocations per frame
+   * @return true if the frame is decoded
+   * @return false if the frame is corrupted or its size differs from the expected size
+   */
+  static bool decodePaletteFrame(const std::uint8_t* data,
+                                 std::size_t size,
+                                 int expectedWidth,
+                                 int expectedHeight,
+                                 std::vector<std::uint32_t>& pixels);
+};
+
+}  // namespace navigationdisplay
@@ -58,4 +58,41 @@ struct ThresholdData {
   std::uint32_t frameByteCount;
 } __attribute__((packed));
 
+/**
+ * @brief The encoding of the frame data
+ * The supported encodings are announced as bit mask (1 << encoding) in the frame capabilities,
+ * the SimBridge defines the used encoding per frame in the frame format
+ */
+enum FrameEncoding : std::uint8_t { PNG = 0, PALETTE_RLE = 1 };
+
+/**
+ * @brief The layout version of the frame capabilities and the frame format blocks
+ * The aircraft status and the threshold data keep their layout, SimBridge versions without support of the
+ * frame format do not read or write these blocks and keep sending complete PNG frames
+ */
+static constexpr std::uint8_t FrameFormatVersion = 1;
+
+/**
+ * @brief Client data area block that is sent to the SimBridge to announce the supported frame formats
+ */
+struct FrameCapabilitiesData {
+  std::uint8_t version;
+  std::uint8_t supportedFrameEncodings;
+  std::uint8_t supportsFrameRegions;
+} __attribute__((packed));
+
+/**
+ * @brief The frame format that is received from the SimBridge before the threshold data of a frame
+ * A frame region with a width or height of zero defines a complete frame, otherwise the frame data contains
+ * only the changed region of the image that is located at the given offsets
+ */
+struct FrameFormatData {
+  std::uint8_t version;
+  std::uint8_t frameEncoding;
+  std::uint16_t frameRegionX;
+  std::uint16_t frameRegionY;
+  std::uint16_t frameRegionWidth;
+  std::uint16_t frameRegionHeight;
+} __attribute__((packed));
+
 }  // namespace types
@@ -5,15 +5,18 @@ use crate::{
         base_fac_discrete_outputs, base_fmgc_ap_fd_logic_outputs, base_fmgc_athr_outputs,
         base_fmgc_bus_inputs, base_fmgc_bus_outputs, base_fmgc_discrete_inputs,
         base_fmgc_discrete_outputs, base_fmgc_logic_outputs, base_fms_inputs,
-        base_sec_analog_outputs, base_sec_discrete_outputs, base_sec_out_bus, AircraftSpecificData,
-        BaseData,
+        base_sec_analog_outputs, base_sec_discrete_outputs, base_sec_out_bus, base_sim_data,
+        base_time, elac_inputs, fac_inputs, sec_inputs, AircraftSpecificData, BaseData,
     },
     read_bytes,
 };
+use bytemuck::AnyBitPattern;
 use serde::Serialize;
 use std::io::{prelude::*, Error};
 
 pub const INTERFACE_VERSION: u64 = 3200004;
+// The recording also contains the model inputs to replay the computers (REPLAY_INPUTS_ENABLED)
+pub const INTERFACE_VERSION_WITH_INPUTS: u64 = 3200005;
 
 // A single FDR record
 #[derive(Serialize, Default)]
@@ -36,6 +39,8 @@ struct ElacData {
     bus_outputs: base_elac_out_bus,
     discrete_outputs: base_elac_discrete_outputs,
     analog_outputs: base_elac_analog_outputs,
+    #[serde(skip_serializing_if = "Option::is_none")]
+    inputs: Option<elac_inputs>,
 }
 
 #[derive(Serialize, Default)]
@@ -43,6 +48,8 @@ struct SecData {
     bus_outputs: base_sec_out_bus,
     discrete_outputs: base_sec_discrete_outputs,
     analog_outputs: base_sec_analog_outputs,
+    #[serde(skip_serializing_if = "Option::is_none")]
+    inputs: Option<sec_inputs>,
 }
 
 #[derive(Serialize, Default)]
@@ -50,6 +57,8 @@ struct FacData {
     bus_outputs: base_fac_bus,
     discrete_outputs: base_fac_discrete_outputs,
     analog_outputs: base_fac_analog_outputs,
+    #[serde(skip_serializing_if = "Option::is_none")]
+    inputs: Option<fac_inputs>,
 }
 
 #[derive(Serialize, Default)]
@@ -63,6 +72,10 @@ struct FmgcData {
     bus_inputs: base_fmgc_bus_inputs,
     discrete_inputs: base_fmgc_discrete_inputs,
     fms_inputs: base_fms_inputs,
+    #[serde(skip_serializing_if = "Option::is_none")]
+    time: Option<base_time>,
+    #[serde(skip_serializing_if = "Option::is_none")]
+    sim_data: Option<base_sim_data>,
 }
 
 #[derive(Serialize, Default)]
@@ -71,48 +84,94 @@ struct FadecData {
     outputs: athr_output,
 }
 
+impl FdrData {
+    pub fn simulation_time(&self) -> f64 {
+        self.base.simulation_time_s
+    }
+
+    // An empty record with the layout of the interface version, used to generate the header
+    pub fn with_layout(interface_version: u64) -> FdrData {
+        let mut fdr_data = FdrData::default();
+        if has_inputs(interface_version) {
+            for elac in [&mut fdr_data.elac_1, &mut fdr_data.elac_2] {
+                elac.inputs = Some(Default::default());
+            }
+            for sec in [&mut fdr_data.sec_1, &mut fdr_data.sec_2, &mut fdr_data.sec_3] {
+                sec.inputs = Some(Default::default());
+            }
+            for fac in [&mut fdr_data.fac_1, &mut fdr_data.fac_2] {
+                fac.inputs = Some(Default::default());
+            }
+            fdr_data.fmgc_1.time = Some(Default::default());
+            fdr_data.fmgc_1.sim_data = Some(Default::default());
+        }
+        fdr_data
+    }
+}
+
+// The model inputs are only recorded when enabled, the interface version selects the layout
+fn has_inputs(interface_version: u64) -> bool {
+    interface_version == INTERFACE_VERSION_WITH_INPUTS
+}
+
 // These are helper functions to read in a whole FDR record.
-pub fn read_record(reader: &mut impl Read) -> Result<FdrData, Error> {
+pub fn read_record(reader: &mut impl Read, interface_version: u64) -> Result<FdrData, Error> {
+    let inputs = has_inputs(interface_version);
     Ok(FdrData {
         base: read_bytes::<BaseData>(reader)?,
         specific: read_bytes::<AircraftSpecificData>(reader)?,
-        elac_1: read_elac(reader)?,
-        elac_2: read_elac(reader)?,
-        sec_1: read_sec(reader)?,
-        sec_2: read_sec(reader)?,
-        sec_3: read_sec(reader)?,
-        fac_1: read_fac(reader)?,
-        fac_2: read_fac(reader)?,
-        fmgc_1: read_fmgc(reader)?,
+        elac_1: read_elac(reader, inputs)?,
+        elac_2: read_elac(reader, inputs)?,
+        sec_1: read_sec(reader, inputs)?,
+        sec_2: read_sec(reader, inputs)?,
+        sec_3: read_sec(reader, inputs)?,
+        fac_1: read_fac(reader, inputs)?,
+        fac_2: read_fac(reader, inputs)?,
+        fmgc_1: read_fmgc(reader, inputs)?,
         fadec_1: read_fadec(reader)?,
     })
 }
 
-fn read_elac(reader: &mut impl Read) -> Result<ElacData, Error> {
+// Reads an optional segment of the record
+fn read_optional<T: AnyBitPattern>(
+    reader: &mut impl Read,
+    is_present: bool,
+) -> Result<Option<T>, Error> {
+    if is_present {
+        Ok(Some(read_bytes::<T>(reader)?))
+    } else {
+        Ok(None)
+    }
+}
+
+fn read_elac(reader: &mut impl Read, has_inputs: bool) -> Result<ElacData, Error> {
     Ok(ElacData {
         bus_outputs: read_bytes::<base_elac_out_bus>(reader)?,
         discrete_outputs: read_bytes::<base_elac_discrete_outputs>(reader)?,
         analog_outputs: read_bytes::<base_elac_analog_outputs>(reader)?,
+        inputs: read_optional::<elac_inputs>(reader, has_inputs)?,
     })
 }
 
-fn read_sec(reader: &mut impl Read) -> Result<SecData, Error> {
+fn read_sec(reader: &mut impl Read, has_inputs: bool) -> Result<SecData, Error> {
     Ok(SecData {
         bus_outputs: read_bytes::<base_sec_out_bus>(reader)?,
         discrete_outputs: read_bytes::<base_sec_discrete_outputs>(reader)?,
         analog_outputs: read_bytes::<base_sec_analog_outputs>(reader)?,
+        inputs: read_optional::<sec_inputs>(reader, has_inputs)?,
     })
 }
 
-fn read_fac(reader: &mut impl Read) -> Result<FacData, Error> {
+fn read_fac(reader: &mut impl Read, has_inputs: bool) -> Result<FacData, Error> {
     Ok(FacData {
         bus_outputs: read_bytes::<base_fac_bus>(reader)?,
         discrete_outputs: read_bytes::<base_fac_discrete_outputs>(reader)?,
         analog_outputs: read_bytes::<base_fac_analog_outputs>(reader)?,
+        inputs: read_optional::<fac_inputs>(reader, has_inputs)?,
     })
 }
 
-fn read_fmgc(reader: &mut impl Read) -> Result<FmgcData, Error> {
+fn read_fmgc(reader: &mut impl Read, has_inputs: bool) -> Result<FmgcData, Error> {
     Ok(FmgcData {
         logic: read_bytes::<base_fmgc_logic_outputs>(reader)?,
         ap_fd_logic: read_bytes::<base_fmgc_ap_fd_logic_outputs>(reader)?,
@@ -123,6 +182,8 @@ fn read_fmgc(reader: &mut impl Read) -> Result<FmgcData, Error> {
         bus_inputs: read_bytes::<base_fmgc_bus_inputs>(reader)?,
         discrete_inputs: read_bytes::<base_fmgc_discrete_inputs>(reader)?,
         fms_inputs: read_bytes::<base_fms_inputs>(reader)?,
+        time: read_optional::<base_time>(reader, has_inputs)?,
+        sim_data: read_optional::<base_sim_data>(reader, has_inputs)?,
     })
 }
 
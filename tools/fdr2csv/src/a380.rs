@@ -53,6 +53,12 @@ struct FacData {
     analog_outputs: base_fac_analog_outputs,
 }
 
+impl FdrData {
+    pub fn simulation_time(&self) -> f64 {
+        self.base.simulation_time_s
+    }
+}
+
 // These are helper functions to read in a whole FDR record.
 pub fn read_record(reader: &mut impl Read) -> Result<FdrData, Error> {
     Ok(FdrData {
@@ -0,0 +1,296 @@
+use flate2::read::ZlibDecoder;
+use std::io::{prelude::*, Error, ErrorKind, SeekFrom};
+
+// Magic at the start of a columnar FDR file
+pub const MAGIC: &[u8; 4] = b"FDR2";
+const FORMAT_VERSION: u32 = 3;
+// Format version 2 has no encoding in the header, the frames are always stored plain
+const FORMAT_VERSION_WITHOUT_ENCODING: u32 = 2;
+
+// Magic at the end of the file if the block index was written
+const INDEX_MAGIC: &[u8; 4] = b"FDRI";
+const INDEX_TRAILER_SIZE: u64 = 16;
+const INDEX_ENTRY_SIZE: u64 = 28;
+
+// Frame encodings, with XOR delta each tick except the first of a block is stored as XOR against the previous tick
+const ENCODING_PLAIN: u32 = 0;
+const ENCODING_XOR_DELTA: u32 = 1;
+
+// A named part of a frame, usually one struct
+pub struct Segment {
+    pub name: String,
+    pub size: usize,
+    pub offset: usize,
+}
+
+// Location and time range of a block
+pub struct Block {
+    pub offset: u64,
+    pub number_of_ticks: usize,
+    pub minimum_simulation_time: f64,
+    pub maximum_simulation_time: f64,
+}
+
+// Reader for the columnar FDR format. The file consists of independently compressed blocks of
+// frames and a block index at the end, so only the blocks of a requested time window and only the
+// requested segments need to be decompressed. See ColumnarFrameWriter.h for the layout.
+pub struct ColumnarReader<R: Read + Seek> {
+    reader: R,
+    pub interface_version: u64,
+    pub frame_size: usize,
+    pub is_delta_encoded: bool,
+    pub segments: Vec<Segment>,
+    pub blocks: Vec<Block>,
+}
+
+impl<R: Read + Seek> ColumnarReader<R> {
+    pub fn new(mut reader: R) -> Result<Self, Error> {
+        let file_size = reader.seek(SeekFrom::End(0))?;
+        reader.seek(SeekFrom::Start(0))?;
+
+        // Read and check the header
+        let mut magic = [0u8; 4];
+        reader.read_exact(&mut magic)?;
+        if &magic != MAGIC {
+            return Err(Error::new(
+                ErrorKind::InvalidData,
+                "Not a columnar FDR file",
+            ));
+        }
+
+        let format_version = read_u32(&mut reader)?;
+        if format_version != FORMAT_VERSION && format_version != FORMAT_VERSION_WITHOUT_ENCODING {
+            return Err(Error::new(
+                ErrorKind::InvalidData,
+                format!("Unsupported columnar format version {format_version}"),
+            ));
+        }
+
+        let interface_version = read_u64(&mut reader)?;
+        let frame_size = read_u32(&mut reader)? as usize;
+        let _ticks_per_block = read_u32(&mut reader)?;
+        let encoding = if format_version == FORMAT_VERSION_WITHOUT_ENCODING {
+            ENCODING_PLAIN
+        } else {
+            read_u32(&mut reader)?
+        };
+        if encoding != ENCODING_PLAIN && encoding != ENCODING_XOR_DELTA {
+            return Err(Error::new(
+                ErrorKind::InvalidData,
+                format!("Unsupported frame encoding {encoding}"),
+            ));
+        }
+        let number_of_segments = read_u32(&mut reader)? as usize;
+
+        // Read the segment layout of a frame
+        let mut segments = Vec::with_capacity(number_of_segments);
+        let mut offset = 0;
+        for _ in 0..number_of_segments {
+            let size = read_u32(&mut reader)? as usize;
+            let name_length = read_u32(&mut reader)? as usize;
+            let mut name = vec![0u8; name_length];
+            reader.read_exact(&mut name)?;
+            segments.push(Segment {
+                name: String::from_utf8_lossy(&name).into_owned(),
+                size,
+                offset,
+            });
+            offset += size;
+        }
+
+        if frame_size == 0 || offset != frame_size {
+            return Err(Error::new(
+                ErrorKind::InvalidData,
+                "Segment sizes do not match frame size",
+            ));
+        }
+
+        // Use the block index if available, otherwise (e.g. sim was closed unexpectedly) walk the blocks
+        let data_offset = reader.stream_position()?;
+        let blocks = match read_index(&mut reader, data_offset, file_size)? {
+            Some(blocks) => blocks,
+            None => scan_blocks(&mut reader, data_offset, file_size, number_of_segments)?,
+        };
+
+        Ok(ColumnarReader {
+            reader,
+            interface_version,
+            frame_size,
+            is_delta_encoded: encoding == ENCODING_XOR_DELTA,
+            segments,
+            blocks,
+        })
+    }
+
+    // Decodes all blocks with a time range overlapping the given window and calls the callback for
+    // each frame of these blocks. Segments that are not selected are not decompressed and are left
+    // zeroed in the frame.
+    pub fn read_frames<F>(
+        &mut self,
+        start_time: f64,
+        end_time: f64,
+        selected_segments: &[bool],
+        mut callback: F,
+    ) -> Result<(), Error>
+    where
+        F: FnMut(&[u8]) -> Result<(), Error>,
+    {
+        let number_of_segments = self.segments.len();
+        let mut frames = Vec::new();
+        let mut compressed = Vec::new();
+        let mut columns = Vec::new();
+
+        for block in &self.blocks {
+            if block.maximum_simulation_time < start_time
+                || block.minimum_simulation_time > end_time
+            {
+                continue;
+            }
+
+            // Block header
+            self.reader.seek(SeekFrom::Start(block.offset))?;
+            let number_of_ticks = read_u32(&mut self.reader)? as usize;
+            let _minimum_simulation_time = read_f64(&mut self.reader)?;
+            let _maximum_simulation_time = read_f64(&mut self.reader)?;
+            let mut compressed_sizes = Vec::with_capacity(number_of_segments);
+            for _ in 0..number_of_segments {
+                compressed_sizes.push(read_u32(&mut self.reader)? as usize);
+            }
+
+            frames.clear();
+            frames.resize(number_of_ticks * self.frame_size, 0u8);
+
+            for (index, segment) in self.segments.iter().enumerate() {
+                let compressed_size = compressed_sizes[index];
+                if !selected_segments.get(index).copied().unwrap_or(true) {
+                    self.reader
+                        .seek(SeekFrom::Current(compressed_size as i64))?;
+                    continue;
+                }
+
+                compressed.resize(compressed_size, 0u8);
+                self.reader.read_exact(&mut compressed)?;
+                columns.clear();
+                ZlibDecoder::new(compressed.as_slice()).read_to_end(&mut columns)?;
+                if columns.len() != segment.size * number_of_ticks {
+                    return Err(Error::new(
+                        ErrorKind::InvalidData,
+                        format!("Unexpected size of segment '{}'", segment.name),
+                    ));
+                }
+
+                // Byte i of all ticks is stored consecutively -> gather back into the frames,
+                // a delta encoded column is restored by accumulating the XOR starting at the keyframe
+                for i in 0..segment.size {
+                    let column = &columns[i * number_of_ticks..(i + 1) * number_of_ticks];
+                    let mut previous = 0u8;
+                    for (tick, value) in column.iter().enumerate() {
+                        let value = if self.is_delta_encoded {
+                            previous ^ *value
+                        } else {
+                            *value
+                        };
+                        frames[tick * self.frame_size + segment.offset + i] = value;
+                        previous = value;
+                    }
+                }
+            }
+
+            for frame in frames.chunks_exact(self.frame_size) {
+                callback(frame)?;
+            }
+        }
+
+        Ok(())
+    }
+}
+
+fn read_index(
+    reader: &mut (impl Read + Seek),
+    data_offset: u64,
+    file_size: u64,
+) -> Result<Option<Vec<Block>>, Error> {
+    if file_size < data_offset + INDEX_TRAILER_SIZE {
+        return Ok(None);
+    }
+
+    reader.seek(SeekFrom::Start(file_size - INDEX_TRAILER_SIZE))?;
+    let index_offset = read_u64(reader)?;
+    let number_of_blocks = read_u32(reader)? as u64;
+    let mut magic = [0u8; 4];
+    reader.read_exact(&mut magic)?;
+    if &magic != INDEX_MAGIC
+        || index_offset < data_offset
+        || index_offset + number_of_blocks * INDEX_ENTRY_SIZE + INDEX_TRAILER_SIZE != file_size
+    {
+        return Ok(None);
+    }
+
+    reader.seek(SeekFrom::Start(index_offset))?;
+    let mut blocks = Vec::with_capacity(number_of_blocks as usize);
+    for _ in 0..number_of_blocks {
+        blocks.push(Block {
+            offset: read_u64(reader)?,
+            number_of_ticks: read_u32(reader)? as usize,
+            minimum_simulation_time: read_f64(reader)?,
+            maximum_simulation_time: read_f64(reader)?,
+        });
+    }
+
+    Ok(Some(blocks))
+}
+
+fn scan_blocks(
+    reader: &mut (impl Read + Seek),
+    data_offset: u64,
+    file_size: u64,
+    number_of_segments: usize,
+) -> Result<Vec<Block>, Error> {
+    let header_size = 20 + 4 * number_of_segments as u64;
+    let mut blocks = Vec::new();
+    let mut offset = data_offset;
+
+    // Stop at the first incomplete block
+    while offset + header_size <= file_size {
+        reader.seek(SeekFrom::Start(offset))?;
+        let number_of_ticks = read_u32(reader)? as usize;
+        let minimum_simulation_time = read_f64(reader)?;
+        let maximum_simulation_time = read_f64(reader)?;
+        let mut data_size = 0u64;
+        for _ in 0..number_of_segments {
+            data_size += read_u32(reader)? as u64;
+        }
+
+        if offset + header_size + data_size > file_size {
+            break;
+        }
+
+        blocks.push(Block {
+            offset,
+            number_of_ticks,
+            minimum_simulation_time,
+            maximum_simulation_time,
+        });
+        offset += header_size + data_size;
+    }
+
+    Ok(blocks)
+}
+
+fn read_u32(reader: &mut impl Read) -> Result<u32, Error> {
+    let mut buf = [0u8; 4];
+    reader.read_exact(&mut buf)?;
+    Ok(u32::from_le_bytes(buf))
+}
+
+fn read_u64(reader: &mut impl Read) -> Result<u64, Error> {
+    let mut buf = [0u8; 8];
+    reader.read_exact(&mut buf)?;
+    Ok(u64::from_le_bytes(buf))
+}
+
+fn read_f64(reader: &mut impl Read) -> Result<f64, Error> {
+    let mut buf = [0u8; 8];
+    reader.read_exact(&mut buf)?;
+    Ok(f64::from_le_bytes(buf))
+}
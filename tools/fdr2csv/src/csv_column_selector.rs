@@ -0,0 +1,238 @@
+use serde::{ser, Serialize};
+
+use crate::error::{Error, Result};
+
+// A scalar value of a record. The untagged enum serializes to the plain value, so the csv writer formats
+// the selected values exactly like the values of a complete record.
+#[derive(Serialize)]
+#[serde(untagged)]
+pub enum Value {
+    Bool(bool),
+    Int(i64),
+    UInt(u64),
+    F32(f32),
+    F64(f64),
+}
+
+// Collects the values of the selected columns of a record. The column index is the position of the
+// scalar in the flattened record, the same order as the header of csv_header_serializer. Only the
+// selected scalars are converted, all other fields are just counted.
+pub fn select<T>(value: &T, selected_columns: &[bool], values: &mut Vec<Value>) -> Result<()>
+where
+    T: Serialize,
+{
+    values.clear();
+    let mut selector = CsvColumnSelector {
+        selected_columns,
+        column: 0,
+        values,
+    };
+    value.serialize(&mut selector)
+}
+
+pub struct CsvColumnSelector<'a> {
+    // Per column of the header if it is selected
+    selected_columns: &'a [bool],
+
+    // Index of the next scalar
+    column: usize,
+
+    values: &'a mut Vec<Value>,
+}
+
+impl<'a> CsvColumnSelector<'a> {
+    // This method will be called if an elementary data type has been encountered. The value is only
+    // created if the column is selected.
+    fn serialize_scalar(&mut self, value: impl FnOnce() -> Value) -> Result<()> {
+        if self
+            .selected_columns
+            .get(self.column)
+            .copied()
+            .unwrap_or(false)
+        {
+            self.values.push(value());
+        }
+        self.column += 1;
+
+        Ok(())
+    }
+}
+
+impl<'a, 'b> ser::Serializer for &'a mut CsvColumnSelector<'b> {
+    type Ok = ();
+    type Error = Error;
+
+    type SerializeSeq = ser::Impossible<(), Error>;
+    type SerializeTuple = ser::Impossible<(), Error>;
+    type SerializeTupleStruct = ser::Impossible<(), Error>;
+    type SerializeTupleVariant = ser::Impossible<(), Error>;
+    type SerializeMap = ser::Impossible<(), Error>;
+    type SerializeStruct = Self;
+    type SerializeStructVariant = ser::Impossible<(), Error>;
+
+    fn serialize_bool(self, v: bool) -> Result<()> {
+        self.serialize_scalar(|| Value::Bool(v))
+    }
+
+    fn serialize_i8(self, v: i8) -> Result<()> {
+        self.serialize_scalar(|| Value::Int(v.into()))
+    }
+
+    fn serialize_i16(self, v: i16) -> Result<()> {
+        self.serialize_scalar(|| Value::Int(v.into()))
+    }
+
+    fn serialize_i32(self, v: i32) -> Result<()> {
+        self.serialize_scalar(|| Value::Int(v.into()))
+    }
+
+    fn serialize_i64(self, v: i64) -> Result<()> {
+        self.serialize_scalar(|| Value::Int(v))
+    }
+
+    fn serialize_u8(self, v: u8) -> Result<()> {
+        self.serialize_scalar(|| Value::UInt(v.into()))
+    }
+
+    fn serialize_u16(self, v: u16) -> Result<()> {
+        self.serialize_scalar(|| Value::UInt(v.into()))
+    }
+
+    fn serialize_u32(self, v: u32) -> Result<()> {
+        self.serialize_scalar(|| Value::UInt(v.into()))
+    }
+
+    fn serialize_u64(self, v: u64) -> Result<()> {
+        self.serialize_scalar(|| Value::UInt(v))
+    }
+
+    fn serialize_f32(self, v: f32) -> Result<()> {
+        self.serialize_scalar(|| Value::F32(v))
+    }
+
+    fn serialize_f64(self, v: f64) -> Result<()> {
+        self.serialize_scalar(|| Value::F64(v))
+    }
+
+    fn serialize_char(self, _v: char) -> Result<()> {
+        Err(Error::Message("Unsupported datatype".to_owned()))
+    }
+
+    fn serialize_str(self, _v: &str) -> Result<()> {
+        Err(Error::Message("Unsupported datatype".to_owned()))
+    }
+
+    fn serialize_bytes(self, _v: &[u8]) -> Result<()> {
+        Err(Error::Message("Unsupported datatype".to_owned()))
+    }
+
+    fn serialize_none(self) -> Result<()> {
+        Err(Error::Message("Unsupported datatype".to_owned()))
+    }
+
+    // Optional segments of a record are only serialized when present, like the value itself
+    fn serialize_some<T>(self, value: &T) -> Result<()>
+    where
+        T: ?Sized + Serialize,
+    {
+        value.serialize(self)
+    }
+
+    fn serialize_unit(self) -> Result<()> {
+        Err(Error::Message("Unsupported datatype".to_owned()))
+    }
+
+    fn serialize_unit_struct(self, _name: &'static str) -> Result<()> {
+        Err(Error::Message("Unsupported datatype".to_owned()))
+    }
+
+    fn serialize_unit_variant(
+        self,
+        _name: &'static str,
+        _variant_index: u32,
+        _variant: &'static str,
+    ) -> Result<()> {
+        Err(Error::Message("Unsupported datatype".to_owned()))
+    }
+
+    fn serialize_newtype_struct<T>(self, _name: &'static str, _value: &T) -> Result<()>
+    where
+        T: ?Sized + Serialize,
+    {
+        Err(Error::Message("Unsupported datatype".to_owned()))
+    }
+
+    fn serialize_newtype_variant<T>(
+        self,
+        _name: &'static str,
+        _variant_index: u32,
+        _variant: &'static str,
+        _value: &T,
+    ) -> Result<()>
+    where
+        T: ?Sized + Serialize,
+    {
+        Err(Error::Message("Unsupported datatype".to_owned()))
+    }
+
+    fn serialize_seq(self, _len: Option<usize>) -> Result<Self::SerializeSeq> {
+        Err(Error::Message("Unsupported datatype".to_owned()))
+    }
+
+    fn serialize_tuple(self, _len: usize) -> Result<Self::SerializeTuple> {
+        Err(Error::Message("Unsupported datatype".to_owned()))
+    }
+
+    fn serialize_tuple_struct(
+        self,
+        _name: &'static str,
+        _len: usize,
+    ) -> Result<Self::SerializeTupleStruct> {
+        Err(Error::Message("Unsupported datatype".to_owned()))
+    }
+
+    fn serialize_tuple_variant(
+        self,
+        _name: &'static str,
+        _variant_index: u32,
+        _variant: &'static str,
+        _len: usize,
+    ) -> Result<Self::SerializeTupleVariant> {
+        Err(Error::Message("Unsupported datatype".to_owned()))
+    }
+
+    fn serialize_map(self, _len: Option<usize>) -> Result<Self::SerializeMap> {
+        Err(Error::Message("Unsupported datatype".to_owned()))
+    }
+
+    // For structs, return this as the Serializer. Nothing else needs to be done here.
+    fn serialize_struct(self, _name: &'static str, _len: usize) -> Result<Self::SerializeStruct> {
+        Ok(self)
+    }
+
+    fn serialize_struct_variant(
+        self,
+        _name: &'static str,
+        _variant_index: u32,
+        _variant: &'static str,
+        _len: usize,
+    ) -> Result<Self::SerializeStructVariant> {
+        Err(Error::Message("Unsupported datatype".to_owned()))
+    }
+}
+
+impl<'a, 'b> ser::SerializeStruct for &'a mut CsvColumnSelector<'b> {
+    type Ok = ();
+    type Error = Error;
+
+    fn serialize_field<T>(&mut self, _key: &'static str, value: &T) -> Result<()>
+    where
+        T: ?Sized + Serialize,
+    {
+        value.serialize(&mut **self)
+    }
+
+    fn end(self) -> Result<()> {
+        Ok(())
+    }
+}
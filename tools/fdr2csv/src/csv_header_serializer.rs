@@ -132,11 +132,12 @@ impl<'a> ser::Serializer for &'a mut CsvHeaderSerializer {
         Err(Error::Message("Unsupported datatype".to_owned()))
     }
 
-    fn serialize_some<T>(self, _value: &T) -> Result<()>
+    // Optional segments of a record are only serialized when present, like the value itself
+    fn serialize_some<T>(self, value: &T) -> Result<()>
     where
         T: ?Sized + Serialize,
     {
-        Err(Error::Message("Unsupported datatype".to_owned()))
+        value.serialize(self)
     }
 
     fn serialize_unit(self) -> Result<()> {
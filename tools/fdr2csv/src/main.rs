@@ -1,10 +1,11 @@
 use bytemuck::AnyBitPattern;
 use clap::Parser;
-use csv::WriterBuilder;
+use csv::{Writer, WriterBuilder};
 use flate2::bufread::GzDecoder;
+use serde::Serialize;
 use std::{
     fs::{File, OpenOptions},
-    io::{prelude::*, BufReader, BufWriter, Error, ErrorKind},
+    io::{prelude::*, BufReader, BufWriter, Error, ErrorKind, SeekFrom},
     mem,
 };
 
@@ -12,6 +13,8 @@ mod a320;
 mod a320_headers;
 mod a380;
 mod a380_headers;
+mod columnar;
+mod csv_column_selector;
 mod csv_header_serializer;
 mod error;
 
@@ -21,6 +24,11 @@ enum AircraftType {
     A380,
 }
 
+enum Input {
+    Stream(Box<dyn Read>),
+    Columnar(columnar::ColumnarReader<BufReader<File>>),
+}
+
 #[derive(Parser, Debug)]
 #[command(version, about, long_about = None)]
 struct Args {
@@ -45,6 +53,60 @@ struct Args {
     /// Print raw interface version of input file
     #[arg(short = 'r', long, default_value_t = false)]
     get_raw_input_file_version: bool,
+    /// Only convert entries with a simulation time (s) at or after this value
+    #[arg(short, long)]
+    start_time: Option<f64>,
+    /// Only convert entries with a simulation time (s) at or before this value
+    #[arg(short, long)]
+    end_time: Option<f64>,
+    /// Comma separated list of columns to convert, a name also selects all columns below it (e.g. 'base' or 'elac_1.bus_outputs')
+    #[arg(short, long, value_delimiter = ',')]
+    columns: Vec<String>,
+}
+
+// Writes the records within the time window and optionally only the selected columns
+struct RecordWriter<W: Write> {
+    writer: Writer<W>,
+    selected_columns: Option<Vec<bool>>,
+    selected_values: Vec<csv_column_selector::Value>,
+    start_time: f64,
+    end_time: f64,
+    counter: usize,
+}
+
+impl<W: Write> RecordWriter<W> {
+    fn write<T: Serialize>(&mut self, record: &T, simulation_time: f64) -> Result<(), Error> {
+        if simulation_time < self.start_time || simulation_time > self.end_time {
+            return Ok(());
+        }
+
+        match &self.selected_columns {
+            None => self.writer.serialize(record)?,
+            Some(columns) => {
+                // Only the values of the selected columns are converted, the others are skipped
+                csv_column_selector::select(record, columns, &mut self.selected_values)
+                    .map_err(|e| Error::new(ErrorKind::Other, e.to_string()))?;
+                self.writer.serialize(&self.selected_values)?;
+            }
+        }
+
+        self.counter += 1;
+
+        if self.counter % 1000 == 0 {
+            print!("Processed {} entries...\r", self.counter);
+            std::io::stdout().flush()?;
+        }
+
+        Ok(())
+    }
+}
+
+// A column is selected if it is listed or if one of its parents is listed
+fn is_column_selected(name: &str, selection: &[String]) -> bool {
+    selection.iter().any(|selected| {
+        let selected = selected.trim();
+        name == selected || (name.starts_with(selected) && name[selected.len()..].starts_with('.'))
+    })
 }
 
 // Read number of bytes specified by the size of T from the binary file
@@ -68,27 +130,38 @@ fn main() -> Result<(), std::io::Error> {
     let args = Args::parse();
 
     // Open the input file
-    let in_file = File::open(args.input.trim())
+    let mut in_file = File::open(args.input.trim())
         .map_err(|e| std::io::Error::new(e.kind(), "Failed to open input file!"))?;
 
-    // Create Gzip Reader
-    let mut reader: Box<dyn Read> = if args.no_compression {
-        Box::new(BufReader::new(in_file))
+    // Detect columnar format, otherwise the file is a stream of records
+    let mut magic = [0u8; 4];
+    let is_columnar = in_file.read_exact(&mut magic).is_ok() && &magic == columnar::MAGIC;
+    in_file.seek(SeekFrom::Start(0))?;
+
+    // Create Columnar or Gzip Reader
+    let mut input = if is_columnar {
+        Input::Columnar(columnar::ColumnarReader::new(BufReader::new(in_file))?)
+    } else if args.no_compression {
+        Input::Stream(Box::new(BufReader::new(in_file)))
     } else {
-        Box::new(GzDecoder::new(BufReader::new(in_file)))
+        Input::Stream(Box::new(GzDecoder::new(BufReader::new(in_file))))
     };
 
     // Read file version
-    let file_format_version = read_bytes::<u64>(&mut reader)?;
+    let file_format_version = match &mut input {
+        Input::Stream(reader) => read_bytes::<u64>(reader)?,
+        Input::Columnar(reader) => reader.interface_version,
+    };
     let aircraft_type = if file_format_version > a380::INTERFACE_MIN_VERSION {
         AircraftType::A380
     } else {
         AircraftType::A320
     };
 
-    let aircraft_interface_version = match aircraft_type {
-        AircraftType::A320 => a320::INTERFACE_VERSION,
-        AircraftType::A380 => a380::INTERFACE_VERSION,
+    // The A320 layout with the replay inputs has its own interface version
+    let aircraft_interface_versions: &[u64] = match aircraft_type {
+        AircraftType::A320 => &[a320::INTERFACE_VERSION, a320::INTERFACE_VERSION_WITH_INPUTS],
+        AircraftType::A380 => &[a380::INTERFACE_VERSION],
     };
 
     // Print or check file version
@@ -101,11 +174,11 @@ fn main() -> Result<(), std::io::Error> {
     } else if args.get_raw_input_file_version {
         println!("{}", file_format_version);
         return Ok(());
-    } else if aircraft_interface_version != file_format_version {
+    } else if !aircraft_interface_versions.contains(&file_format_version) {
         return Err(std::io::Error::new(
             ErrorKind::InvalidInput,
             format!(
-                "Mismatch between converter and file version (expected {aircraft_interface_version}, got {file_format_version})",
+                "Mismatch between converter and file version (expected {aircraft_interface_versions:?}, got {file_format_version})",
             ),
         ));
     }
@@ -126,12 +199,13 @@ fn main() -> Result<(), std::io::Error> {
 
     let mut buf_writer = BufWriter::new(out_file);
 
-    let mut counter = 0;
-
     // Generate and write the header
     let header = match aircraft_type {
         AircraftType::A320 => {
-            csv_header_serializer::to_string(&a320::FdrData::default(), args.delimiter)
+            csv_header_serializer::to_string(
+                &a320::FdrData::with_layout(file_format_version),
+                args.delimiter,
+            )
         }
         AircraftType::A380 => {
             csv_header_serializer::to_string(&a380::FdrData::default(), args.delimiter)
@@ -139,41 +213,112 @@ fn main() -> Result<(), std::io::Error> {
     }
     .map_err(|_| std::io::Error::new(ErrorKind::Other, "Failed to generate header."))?;
 
-    buf_writer.write(header.as_bytes())?;
-
-    // Create the CSV writer, and serialize the file.
-    let mut writer = WriterBuilder::new()
-        .delimiter(args.delimiter as u8)
-        .has_headers(false)
-        .from_writer(buf_writer);
-
-    match aircraft_type {
-        AircraftType::A320 => {
-            while let Ok(fdr_data) = a320::read_record(&mut reader) {
-                writer.serialize(&fdr_data)?;
-
-                counter += 1;
+    // Select columns
+    let column_names: Vec<&str> = header.trim_end().split(args.delimiter).collect();
+    let selected_columns: Option<Vec<bool>> = if args.columns.is_empty() {
+        None
+    } else {
+        Some(
+            column_names
+                .iter()
+                .map(|name| is_column_selected(name, &args.columns))
+                .collect(),
+        )
+    };
 
-                if counter % 1000 == 0 {
-                    print!("Processed {counter} entries...\r");
-                    std::io::stdout().flush()?;
-                }
+    match &selected_columns {
+        None => buf_writer.write(header.as_bytes())?,
+        Some(columns) => {
+            let selected_header: Vec<&str> = column_names
+                .iter()
+                .zip(columns)
+                .filter(|(_, &selected)| selected)
+                .map(|(name, _)| *name)
+                .collect();
+            if selected_header.is_empty() {
+                return Err(std::io::Error::new(
+                    ErrorKind::InvalidInput,
+                    "None of the requested columns exists",
+                ));
             }
+            buf_writer
+                .write((selected_header.join(&args.delimiter.to_string()) + "\n").as_bytes())?
         }
-        AircraftType::A380 => {
-            while let Ok(fdr_data) = a380::read_record(&mut reader) {
-                writer.serialize(&fdr_data)?;
+    };
 
-                counter += 1;
+    // Create the CSV writer, and serialize the file.
+    let mut record_writer = RecordWriter {
+        writer: WriterBuilder::new()
+            .delimiter(args.delimiter as u8)
+            .has_headers(false)
+            .from_writer(buf_writer),
+        selected_columns,
+        selected_values: Vec::new(),
+        start_time: args.start_time.unwrap_or(f64::NEG_INFINITY),
+        end_time: args.end_time.unwrap_or(f64::INFINITY),
+        counter: 0,
+    };
 
-                if counter % 1000 == 0 {
-                    print!("Processed {counter} entries...\r");
-                    std::io::stdout().flush()?;
+    match input {
+        Input::Stream(mut reader) => match aircraft_type {
+            AircraftType::A320 => {
+                while let Ok(fdr_data) = a320::read_record(&mut reader, file_format_version) {
+                    record_writer.write(&fdr_data, fdr_data.simulation_time())?;
                 }
             }
+            AircraftType::A380 => {
+                while let Ok(fdr_data) = a380::read_record(&mut reader) {
+                    record_writer.write(&fdr_data, fdr_data.simulation_time())?;
+                }
+            }
+        },
+        Input::Columnar(mut reader) => {
+            // Only decompress the segments of the selected columns, base data is needed for the time window
+            let selected_segments: Vec<bool> = reader
+                .segments
+                .iter()
+                .map(|segment| {
+                    segment.name == "base"
+                        || args.columns.is_empty()
+                        || column_names.iter().any(|name| {
+                            is_column_selected(name, &args.columns)
+                                && is_column_selected(name, std::slice::from_ref(&segment.name))
+                        })
+                })
+                .collect();
+
+            let number_of_entries: usize = reader
+                .blocks
+                .iter()
+                .map(|block| block.number_of_ticks)
+                .sum();
+            println!(
+                "Columnar file with {} blocks and {} entries",
+                reader.blocks.len(),
+                number_of_entries
+            );
+
+            let start_time = record_writer.start_time;
+            let end_time = record_writer.end_time;
+            reader.read_frames(
+                start_time,
+                end_time,
+                &selected_segments,
+                |mut frame: &[u8]| match aircraft_type {
+                    AircraftType::A320 => {
+                        let fdr_data = a320::read_record(&mut frame, file_format_version)?;
+                        record_writer.write(&fdr_data, fdr_data.simulation_time())
+                    }
+                    AircraftType::A380 => {
+                        let fdr_data = a380::read_record(&mut frame)?;
+                        record_writer.write(&fdr_data, fdr_data.simulation_time())
+                    }
+                },
+            )?;
         }
     }
 
+    let counter = record_writer.counter;
     println!("Processed {counter} entries...");
 
     Result::Ok(())
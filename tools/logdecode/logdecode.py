@@ -0,0 +1,141 @@
+import argparse
+import struct
+import sys
+
+MAGIC = b'FBWL'
+SUPPORTED_VERSION = 1
+LEVELS = ['zero', 'critical', 'error', 'warn', 'info', 'debug', 'verbose', 'trace']
+
+
+class Bool:
+    """bool printed like fmt ("true"/"false"), or as number with a format spec"""
+
+    def __init__(self, value):
+        self.value = value
+
+    def __format__(self, spec):
+        if spec == '' or spec[-1] == 's':
+            return format('true' if self.value else 'false', spec)
+        return format(int(self.value), spec)
+
+
+class Double:
+    """double printed like fmt without a format spec (shortest representation, no trailing .0)"""
+
+    def __init__(self, value):
+        self.value = value
+
+    def __format__(self, spec):
+        if spec == '':
+            text = repr(self.value)
+            return text[:-2] if text.endswith('.0') else text
+        return format(self.value, spec)
+
+
+class Pointer:
+    """pointer printed like fmt (hexadecimal with 0x prefix)"""
+
+    def __init__(self, value):
+        self.value = value
+
+    def __format__(self, spec):
+        return format('0x{:x}'.format(self.value), spec)
+
+
+def read_args(data, offset, end):
+    args = []
+    while offset < end:
+        arg_type = data[offset]
+        offset += 1
+        if arg_type == 1:
+            args.append(Bool(data[offset] != 0))
+            offset += 1
+        elif arg_type == 2:
+            args.append(chr(data[offset]))
+            offset += 1
+        elif arg_type == 6:
+            (length,) = struct.unpack_from('<H', data, offset)
+            args.append(data[offset + 2:offset + 2 + length].decode('utf-8', 'replace'))
+            offset += 2 + length
+        elif arg_type in (3, 4, 5, 7):
+            value = struct.unpack_from({3: '<q', 4: '<Q', 5: '<d', 7: '<Q'}[arg_type], data, offset)[0]
+            args.append(Double(value) if arg_type == 5 else Pointer(value) if arg_type == 7 else value)
+            offset += 8
+        else:
+            raise ValueError('unknown argument type {} at offset {}'.format(arg_type, offset - 1))
+    return args
+
+
+def read_dump(path):
+    with open(path, 'rb') as file:
+        data = file.read()
+
+    if data[0:4] != MAGIC:
+        raise ValueError('not a log dump file')
+    version, format_count = struct.unpack_from('<II', data, 4)
+    if version != SUPPORTED_VERSION:
+        raise ValueError('unsupported dump version {}'.format(version))
+
+    offset = 12
+    formats = []
+    for _ in range(format_count):
+        level, line, file_length = struct.unpack_from('<III', data, offset)
+        offset += 12
+        file = data[offset:offset + file_length].decode('utf-8', 'replace')
+        offset += file_length
+        (format_length,) = struct.unpack_from('<I', data, offset)
+        offset += 4
+        formats.append((level, line, file, data[offset:offset + format_length].decode('utf-8', 'replace')))
+        offset += format_length
+
+    dropped, record_count = struct.unpack_from('<QQ', data, offset)
+    offset += 16
+    records = []
+    for _ in range(record_count):
+        format_id, arg_bytes, time_stamp = struct.unpack_from('<IIQ', data, offset)
+        offset += 16
+        records.append((format_id, time_stamp, read_args(data, offset, offset + arg_bytes)))
+        offset += arg_bytes
+    return formats, dropped, records
+
+
+def format_record(format_string, args):
+    try:
+        return format_string.format(*args)
+    except (IndexError, KeyError, ValueError, TypeError):
+        # format specs python does not support - print the format string and the raw arguments
+        return '{} {}'.format(format_string, [format(arg, '') for arg in args])
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Decodes a MsfsHandler log dump file to text.')
+    parser.add_argument('dump', help='dump file written by the sim (e.g. <simconnect name>_log.dump)')
+    parser.add_argument('--level', choices=LEVELS[1:], default='trace', help='highest log level to print (default: trace)')
+    parser.add_argument('--source', action='store_true', help='print the source file and line of each message')
+    args = parser.parse_args()
+
+    try:
+        formats, dropped, records = read_dump(args.dump)
+    except (OSError, ValueError, struct.error) as error:
+        print('Failed to read {}: {}'.format(args.dump, error), file=sys.stderr)
+        return 1
+
+    print('{} records, {} formats, {} records dropped'.format(len(records), len(formats), dropped))
+    max_level = LEVELS.index(args.level)
+    for format_id, time_stamp, record_args in records:
+        if format_id >= len(formats):
+            print('{:12.6f} unknown format #{}'.format(time_stamp / 1e9, format_id))
+            continue
+        level, line, file, format_string = formats[format_id]
+        if level > max_level:
+            continue
+        text = '{:12.6f} {}: {}'.format(time_stamp / 1e9, LEVELS[level] if level < len(LEVELS) else level,
+                                        format_record(format_string, record_args))
+        if args.source:
+            text += ' ({}:{})'.format(file, line)
+        print(text)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
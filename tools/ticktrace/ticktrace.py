@@ -0,0 +1,92 @@
+import argparse
+import struct
+import sys
+from collections import defaultdict
+
+MAGIC = b'FBWP'
+SUPPORTED_VERSION = 1
+TOTAL_SECTION = 'MsfsHandler::update'
+
+
+def read_trace(path):
+    with open(path, 'rb') as file:
+        data = file.read()
+
+    if data[0:4] != MAGIC:
+        raise ValueError('not a tick profiler trace file')
+    version, section_count = struct.unpack_from('<II', data, 4)
+    if version != SUPPORTED_VERSION:
+        raise ValueError('unsupported trace version {}'.format(version))
+
+    offset = 12
+    sections = []
+    for _ in range(section_count):
+        (length,) = struct.unpack_from('<I', data, offset)
+        offset += 4
+        sections.append(data[offset:offset + length].decode('utf-8', 'replace'))
+        offset += length
+
+    (record_count,) = struct.unpack_from('<Q', data, offset)
+    offset += 8
+    records = list(struct.iter_unpack('<QII', data[offset:offset + record_count * 16]))
+    return sections, records
+
+
+def percentile(values, p):
+    index = min(len(values) - 1, max(0, int(round(p * len(values))) - 1))
+    return values[index]
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Summarizes a MsfsHandler tick profiler trace file.')
+    parser.add_argument('trace', help='trace file written by the sim (e.g. <simconnect name>_profile.trace)')
+    parser.add_argument('--budget', type=float, default=1000.0,
+                        help='frame budget in microseconds for ' + TOTAL_SECTION + ' (default: 1000)')
+    parser.add_argument('--top', type=int, default=10, help='number of over budget ticks to list (default: 10)')
+    args = parser.parse_args()
+
+    try:
+        sections, records = read_trace(args.trace)
+    except (OSError, ValueError, struct.error) as error:
+        print('Failed to read {}: {}'.format(args.trace, error), file=sys.stderr)
+        return 1
+
+    durations = defaultdict(list)
+    ticks = defaultdict(dict)
+    for tick, section, duration in records:
+        name = sections[section] if section < len(sections) else '#{}'.format(section)
+        durations[name].append(duration)
+        ticks[tick][name] = ticks[tick].get(name, 0) + duration
+
+    if not records:
+        print('No records in trace')
+        return 0
+
+    first_tick = min(ticks)
+    last_tick = max(ticks)
+    print('{} records, {} sections, ticks {} - {}'.format(len(records), len(sections), first_tick, last_tick))
+    print()
+    print('{:<40} {:>8} {:>10} {:>10} {:>10} {:>10} {:>10}'.format('section (us)', 'count', 'avg', 'p50', 'p95', 'p99', 'max'))
+    for name in sorted(durations, key=lambda n: -sum(durations[n])):
+        values = sorted(durations[name])
+        print('{:<40} {:>8} {:>10.1f} {:>10.1f} {:>10.1f} {:>10.1f} {:>10.1f}'.format(
+            name, len(values), sum(values) / len(values) / 1000, percentile(values, 0.5) / 1000,
+            percentile(values, 0.95) / 1000, percentile(values, 0.99) / 1000, values[-1] / 1000))
+
+    budget = args.budget * 1000
+    over_budget = [(tick, sections_of_tick) for tick, sections_of_tick in ticks.items()
+                   if sections_of_tick.get(TOTAL_SECTION, 0) > budget]
+    print()
+    print('{} of {} ticks over budget of {:.0f} us'.format(len(over_budget), len(ticks), args.budget))
+    over_budget.sort(key=lambda entry: -entry[1][TOTAL_SECTION])
+    for tick, sections_of_tick in over_budget[:args.top]:
+        worst = max((name for name in sections_of_tick if name != TOTAL_SECTION), key=lambda n: sections_of_tick[n], default=None)
+        line = '  tick {}: {:.1f} us'.format(tick, sections_of_tick[TOTAL_SECTION] / 1000)
+        if worst is not None:
+            line += ' - slowest {} {:.1f} us'.format(worst, sections_of_tick[worst] / 1000)
+        print(line)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())